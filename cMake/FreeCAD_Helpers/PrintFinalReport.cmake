@@ -78,6 +78,7 @@ macro(PrintFinalReport)
     value(CMAKE_CXX_FLAGS)
     value(CMAKE_BUILD_TYPE)
     value(ENABLE_DEVELOPER_TESTS)
+    value(ENABLE_BENCHMARKS)
     value(FREECAD_USE_FREETYPE)
     value(FREECAD_USE_EXTERNAL_SMESH)
     value(BUILD_SMESH)
@@ -87,6 +87,7 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Profiler.h>
 #include <Base/TimeInfo.h>
 #include <Base/Reader.h>
 #include <Base/Writer.h>
@@ -94,6 +95,7 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #include <Base/Uuid.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/ThreadPool.h>
 #include <Base/UnitsApi.h>
 
 #include "Document.h"
@@ -178,6 +180,11 @@ void Document::setStatus(Status pos, bool on)
     d->StatusBits.set((size_t)pos, on);
 }
 
+Base::Profiler& Document::getProfiler() const
+{
+    return d->profiler;
+}
+
 // bool _has_cycle_dfs(const DependencyList & g, vertex_t u, default_color_type * color)
 //{
 //   color[u] = gray_color;
@@ -883,6 +890,10 @@ Document::Document(const char* documentName)
         App::GetApplication()
             .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
             ->GetASCII("prefCompany", "");
+    d->profiler.setEnabled(
+        App::GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+            ->GetBool("RecomputeProfiling", false));
     ADD_PROPERTY_TYPE(Label, ("Unnamed"), 0, Prop_None, "The name of the document");
     ADD_PROPERTY_TYPE(FileName,
                       (""),
@@ -2119,10 +2130,80 @@ private:
 };
 }  // namespace App
 
+// Reads the deferred data files of the properties of obj. A file that cannot be
+// read raises an exception unless ignoreErrors is set, then it is only reported.
+static void _restoreDeferredFiles(const DocumentObject* obj, bool ignoreErrors = false)
+{
+    std::vector<Property*> props;
+    obj->getPropertyList(props);
+    for (auto prop : props) {
+        if (auto geo = Base::freecad_dynamic_cast<PropertyComplexGeoData>(prop)) {
+            if (!ignoreErrors) {
+                geo->restoreDeferred();
+                continue;
+            }
+            try {
+                geo->restoreDeferred();
+            }
+            catch (...) {
+                // already reported by restoreDeferred()
+            }
+        }
+    }
+}
+
+// Takes the data files that can be read on first access to the data out of the
+// files to restore and returns the properties they belong to
+static std::vector<PropertyComplexGeoData*>
+_deferDocFiles(const Document* doc, Base::XMLReader& reader, const char* filename)
+{
+    std::vector<PropertyComplexGeoData*> deferred;
+    std::shared_ptr<zipios::ZipFile> archive;
+    try {
+        archive = std::make_shared<zipios::ZipFile>(filename);
+    }
+    catch (const std::exception& e) {
+        FC_WARN("Cannot index project file " << filename << ": " << e.what());
+        return deferred;
+    }
+    if (!archive->isValid()) {
+        return deferred;
+    }
+
+    std::vector<Base::XMLReader::FileEntry> files;
+    for (const auto& entry : reader.FileList) {
+        auto prop = Base::freecad_dynamic_cast<PropertyComplexGeoData>(entry.Object);
+        auto owner =
+            prop ? Base::freecad_dynamic_cast<DocumentObject>(prop->getContainer()) : nullptr;
+        if (!owner || owner->getDocument() != doc || !prop->canRestoreDocFileDeferred()
+            || !archive->getEntry(entry.FileName)) {
+            files.push_back(entry);
+            continue;
+        }
+        prop->deferRestoreDocFile(archive, entry.FileName, reader.FileVersion);
+        deferred.push_back(prop);
+    }
+    reader.FileList.swap(files);
+    return deferred;
+}
+
+void Document::restoreDeferredFiles() const
+{
+    for (auto obj : d->objectArray) {
+        _restoreDeferredFiles(obj);
+    }
+}
+
 bool Document::saveToFile(const char* filename) const
 {
+    Base::Profiler::Activate activeProfiler(&d->profiler);
+    FC_PROFILE_SCOPE("save", filename);
+
     signalStartSave(*this, filename);
 
+    // the data files not read yet are taken from the file that may be overwritten now
+    restoreDeferredFiles();
+
     auto hGrp = App::GetApplication().GetParameterGroupByPath(
         "User parameter:BaseApp/Preferences/Document");
     int compression = hGrp->GetInt("CompressionLevel", 7);
@@ -2192,6 +2273,19 @@ bool Document::saveToFile(const char* filename) const
             writer.setMode("BinaryBrep");
         }
 
+        if (isCompressedMeshEnabled()) {
+            writer.setMode("CompressedMesh");
+        }
+
+        // serialize and compress the additional files with worker threads,
+        // the buffer size limits the memory of files waiting to be written in MB
+        if (hGrp->GetBool("ConcurrentSave", false)) {
+            long threads = std::max<long>(hGrp->GetInt("ConcurrentSaveThreads", 0), 0);
+            long bufferSize = std::max<long>(hGrp->GetInt("ConcurrentSaveBufferSize", 256), 1);
+            writer.setConcurrentFiles(static_cast<unsigned int>(threads),
+                                      static_cast<std::size_t>(bufferSize) * 1024 * 1024);
+        }
+
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << endl
                         << "<!--" << endl
                         << " FreeCAD Document, see https://www.freecad.org for more information..."
@@ -2255,11 +2349,21 @@ bool Document::isAnyRestoring()
     return globalIsRestoring;
 }
 
+bool Document::isCompressedMeshEnabled()
+{
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    return hGrp->GetBool("SaveCompressedMesh", false);
+}
+
 // Open the document
 void Document::restore(const char* filename,
                        bool delaySignal,
                        const std::vector<std::string>& objNames)
 {
+    Base::Profiler::Activate activeProfiler(&d->profiler);
+    FC_PROFILE_SCOPE("restore", filename);
+
     clearUndos();
     d->activeObject = nullptr;
 
@@ -2330,8 +2434,33 @@ void Document::restore(const char* filename,
     // Note: This file doesn't need to be available if the document has been created
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
+
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+
+    // only index the data files of geometry properties, they are read from
+    // the project file on first access to the data
+    std::vector<PropertyComplexGeoData*> deferred;
+    if (hGrp->GetBool("DeferredRestore", false)) {
+        deferred = _deferDocFiles(this, reader, filename);
+    }
+
+    // inflate and parse the data files with worker threads, the buffer size
+    // limits the memory of compressed data waiting to be applied in MB
+    if (hGrp->GetBool("ConcurrentRestore", false)) {
+        long threads = std::max<long>(hGrp->GetInt("ConcurrentRestoreThreads", 0), 0);
+        long bufferSize = std::max<long>(hGrp->GetInt("ConcurrentRestoreBufferSize", 256), 1);
+        reader.setConcurrentFiles(static_cast<unsigned int>(threads),
+                                  static_cast<std::size_t>(bufferSize) * 1024 * 1024);
+    }
     reader.readFiles(zipstream);
 
+    // notify the observers as if the deferred data had been read, e.g. the view
+    // provider of a visible object then requests its data
+    for (auto prop : deferred) {
+        signalChangedObject(*static_cast<DocumentObject*>(prop->getContainer()), *prop);
+    }
+
     DocumentP::checkStringHasher(reader);
 
     if (reader.testStatus(Base::XMLReader::ReaderStatus::PartialRestore)) {
@@ -3117,6 +3246,9 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
 
     FC_TIME_INIT(t);
 
+    Base::Profiler::Activate activeProfiler(&d->profiler);
+    FC_PROFILE_SCOPE("document", getName());
+
     Base::ObjectStatusLocker<Document::Status, Document> exe(Document::Recomputing, this);
     signalBeforeRecompute(*this);
 
@@ -3149,6 +3281,7 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
     ParameterGrp::handle hGrp =
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
 
     std::set<App::DocumentObject*> filter;
     size_t idx = 0;
@@ -3164,6 +3297,18 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                                                                 topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
+            if (parallel && passes == 0) {
+                // the second pass, if any, is done sequentially
+                if (_recomputeParallel(topoSortedObjects,
+                                       filter,
+                                       seq.get(),
+                                       objectCount,
+                                       hasError)
+                    < 0) {
+                    passes = 2;
+                }
+                idx = topoSortedObjects.size();
+            }
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
@@ -3462,17 +3607,52 @@ int Document::_recomputeFeature(DocumentObject* Feat)
 {
     FC_LOG("Recomputing " << Feat->getFullName());
 
+    std::exception_ptr error;
+    DocumentObjectExecReturn* returnCode = _executeFeature(Feat, error);
+    return _reportFeature(Feat, returnCode, error);
+}
+
+// call the recompute of the Feature. This may run in a worker thread, so the
+// exceptions are only caught here and reported by _reportFeature().
+DocumentObjectExecReturn* Document::_executeFeature(DocumentObject* Feat,
+                                                    std::exception_ptr& error)
+{
+    // activate it again, this may be a worker thread
+    Base::Profiler::Activate activeProfiler(&d->profiler);
+    Base::Profiler::Scope profileScope("recompute",
+                                       Feat->getNameInDocument(),
+                                       Feat->getTypeId().getName());
+
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
-        returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
+        {
+            FC_PROFILE_SCOPE("expression", "ExpressionEngine");
+            returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
+        }
         if (returnCode == DocumentObject::StdReturn) {
             returnCode = Feat->recompute();
             if (returnCode == DocumentObject::StdReturn) {
+                FC_PROFILE_SCOPE("expression", "ExpressionEngine");
                 returnCode =
                     Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteOutput);
             }
         }
     }
+    catch (...) {
+        error = std::current_exception();
+    }
+    return returnCode;
+}
+
+int Document::_reportFeature(DocumentObject* Feat,
+                             DocumentObjectExecReturn* returnCode,
+                             const std::exception_ptr& error)
+{
+    try {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
     catch (Base::AbortException& e) {
         e.ReportException();
         FC_LOG("Failed to recompute " << Feat->getFullName() << ": " << e.what());
@@ -3515,6 +3695,307 @@ int Document::_recomputeFeature(DocumentObject* Feat)
     return 0;
 }
 
+void ParallelRecompute::callInMainThread(const std::function<void()>& func)
+{
+    Call call {&func};
+    {
+        // A Python feature holds the GIL at this point. Release it while waiting,
+        // otherwise the main thread dead-locks on the first Python observer.
+        std::unique_ptr<Base::PyGILStateRelease> unlockGIL;
+        if (Py_IsInitialized() && PyGILState_Check()) {
+            unlockGIL = std::make_unique<Base::PyGILStateRelease>();
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        calls.push_back(&call);
+        cond.notify_all();
+        cond.wait(lock, [&call]() {
+            return call.done;
+        });
+    }
+    if (call.error) {
+        std::rethrow_exception(call.error);
+    }
+}
+
+void ParallelRecompute::processCalls(std::unique_lock<std::mutex>& lock)
+{
+    while (!calls.empty()) {
+        Call* call = calls.front();
+        calls.pop_front();
+        lock.unlock();
+        try {
+            (*call->func)();
+        }
+        catch (...) {
+            call->error = std::current_exception();
+        }
+        lock.lock();
+        call->done = true;
+        cond.notify_all();
+    }
+}
+
+bool Document::_callInMainThread(const std::function<void()>& func)
+{
+    ParallelRecompute* shared = d->parallelRecompute;
+    if (!shared || std::this_thread::get_id() == shared->mainThread) {
+        return false;
+    }
+    shared->callInMainThread(func);
+    return true;
+}
+
+// Recompute the objects by walking the dependency graph instead of the sorted
+// list. An object is scheduled as soon as all objects of its OutList are done.
+// Objects declaring themselves thread-safe are recomputed by a worker thread,
+// all others in the main thread. Results are reported, the recompute signals
+// emitted and the progress advanced in the main thread and in the same order
+// as the sequential recompute does.
+int Document::_recomputeParallel(const std::vector<App::DocumentObject*>& topoSortedObjects,
+                                 std::set<App::DocumentObject*>& filter,
+                                 Base::SequencerLauncher* seq,
+                                 int& objectCount,
+                                 bool* hasError)
+{
+    enum class JobState
+    {
+        Pending,
+        Running,
+        Done,
+        Skipped
+    };
+
+    struct Job
+    {
+        JobState state {JobState::Pending};
+        bool doRecompute {false};
+        bool touched {false};
+        int waiting {0};
+        std::vector<std::size_t> dependents;
+        DocumentObjectExecReturn* returnCode {nullptr};
+        std::exception_ptr error;
+    };
+
+    const std::size_t count = topoSortedObjects.size();
+    std::vector<Job> jobs(count);
+    std::unordered_map<const DocumentObject*, std::size_t> indices;
+    indices.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        indices.emplace(topoSortedObjects[i], i);
+    }
+
+    // Only dependencies sorted before an object are taken into account. So the
+    // graph is acyclic even if the sorting had to break a cyclic dependency.
+    std::set<std::size_t> ready;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::vector<std::size_t> deps;
+        for (auto dep : topoSortedObjects[i]->getOutList()) {
+            auto it = indices.find(dep);
+            if (it != indices.end() && it->second < i) {
+                deps.push_back(it->second);
+            }
+        }
+        std::sort(deps.begin(), deps.end());
+        deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+        for (auto dep : deps) {
+            jobs[dep].dependents.push_back(i);
+        }
+        jobs[i].waiting = static_cast<int>(deps.size());
+        if (deps.empty()) {
+            ready.insert(i);
+        }
+    }
+
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    auto threads = static_cast<unsigned int>(std::max(0L, hGrp->GetInt("RecomputeThreads", 0)));
+
+    ParallelRecompute shared;
+    // Python features recomputed by a worker thread need the GIL
+    std::unique_ptr<Base::PyGILStateRelease> unlockGIL;
+    if (Py_IsInitialized() && PyGILState_Check()) {
+        unlockGIL = std::make_unique<Base::PyGILStateRelease>();
+    }
+    Base::ThreadPool pool(threads);
+    d->parallelRecompute = &shared;
+
+    std::set<std::size_t> mainThreadJobs;
+    std::deque<std::size_t> finished;
+    std::size_t running = 0;
+    std::size_t committed = 0;
+    bool aborted = false;
+
+    // called in the main thread once an object is processed
+    auto finish = [&](std::size_t index) {
+        Job& job = jobs[index];
+        DocumentObject* obj = topoSortedObjects[index];
+        if (job.state != JobState::Skipped) {
+            job.state = JobState::Done;
+            if (job.doRecompute) {
+                int res = _reportFeature(obj, job.returnCode, job.error);
+                if (res) {
+                    if (hasError) {
+                        *hasError = true;
+                    }
+                    if (res < 0) {
+                        aborted = true;
+                        return;
+                    }
+                    // if something happened filter all object in its
+                    // inListRecursive from the queue then proceed
+                    obj->getInListEx(filter, true);
+                    filter.insert(obj);
+                    job.state = JobState::Skipped;
+                }
+            }
+            if (job.state == JobState::Done && (obj->isTouched() || job.doRecompute)) {
+                job.touched = true;
+                // set all dependent object touched to force recompute
+                for (auto inObjIt : obj->getInList()) {
+                    inObjIt->enforceRecompute();
+                }
+            }
+        }
+        for (auto dependent : job.dependents) {
+            if (--jobs[dependent].waiting == 0) {
+                ready.insert(dependent);
+            }
+        }
+    };
+
+    auto schedule = [&]() {
+        while (!ready.empty() && !aborted) {
+            std::size_t index = *ready.begin();
+            ready.erase(ready.begin());
+            Job& job = jobs[index];
+            DocumentObject* obj = topoSortedObjects[index];
+            if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
+                job.state = JobState::Skipped;
+                finish(index);
+                continue;
+            }
+            // ask the object if it should be recomputed
+            if (!obj->mustRecompute()) {
+                finish(index);
+                continue;
+            }
+
+            job.doRecompute = true;
+            ++objectCount;
+            FC_LOG("Recomputing " << obj->getFullName());
+            if (obj->getDocument() != this || !obj->canRecomputeConcurrently()) {
+                mainThreadJobs.insert(index);
+                continue;
+            }
+
+            job.state = JobState::Running;
+            ++running;
+            pool.submit([this, &shared, &job, obj, index]() {
+                job.returnCode = _executeFeature(obj, job.error);
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                shared.finished.push_back(index);
+                shared.cond.notify_all();
+            });
+        }
+    };
+
+    // purging the touched state of an object must wait for the dependent objects
+    // being recomputed by a worker thread as they may read it
+    auto isReadByWorker = [&](const Job& job) {
+        return std::any_of(job.dependents.begin(), job.dependents.end(), [&](std::size_t index) {
+            return jobs[index].state == JobState::Running;
+        });
+    };
+
+    auto commit = [&]() {
+        while (!aborted && committed < count && jobs[committed].state != JobState::Pending
+               && jobs[committed].state != JobState::Running
+               && !(jobs[committed].touched && isReadByWorker(jobs[committed]))) {
+            Job& job = jobs[committed++];
+            if (job.state == JobState::Skipped) {
+                continue;
+            }
+            DocumentObject* obj = topoSortedObjects[committed - 1];
+            if (job.touched) {
+                signalRecomputedObject(*obj);
+                obj->purgeTouched();
+            }
+            if (seq) {
+                seq->next(true);
+            }
+        }
+    };
+
+    // waits for the next finished worker job while running the forwarded functions
+    auto waitForWorkers = [&](bool block) {
+        std::unique_lock<std::mutex> lock(shared.mutex);
+        if (block) {
+            shared.cond.wait(lock, [&shared]() {
+                return !shared.finished.empty() || !shared.calls.empty();
+            });
+        }
+        shared.processCalls(lock);
+        finished.insert(finished.end(), shared.finished.begin(), shared.finished.end());
+        shared.finished.clear();
+    };
+
+    std::exception_ptr error;
+    try {
+        for (;;) {
+            schedule();
+            commit();
+            if (aborted || committed == count) {
+                break;
+            }
+
+            if (!mainThreadJobs.empty()) {
+                std::size_t index = *mainThreadJobs.begin();
+                mainThreadJobs.erase(mainThreadJobs.begin());
+                Job& job = jobs[index];
+                job.returnCode = _executeFeature(topoSortedObjects[index], job.error);
+                finish(index);
+                waitForWorkers(false);
+            }
+            else {
+                waitForWorkers(running > 0 && ready.empty());
+            }
+
+            while (!finished.empty() && !aborted) {
+                std::size_t index = finished.front();
+                finished.pop_front();
+                --running;
+                finish(index);
+            }
+        }
+    }
+    catch (...) {
+        aborted = true;
+        error = std::current_exception();
+    }
+
+    // let the worker threads finish before leaving, the results are still reported
+    while (running > 0) {
+        if (finished.empty()) {
+            waitForWorkers(true);
+        }
+        while (!finished.empty()) {
+            std::size_t index = finished.front();
+            finished.pop_front();
+            --running;
+            Job& job = jobs[index];
+            if (_reportFeature(topoSortedObjects[index], job.returnCode, job.error) && hasError) {
+                *hasError = true;
+            }
+        }
+    }
+
+    d->parallelRecompute = nullptr;
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return aborted ? -1 : 0;
+}
+
 bool Document::recomputeFeature(DocumentObject* Feat, bool recursive)
 {
     // delete recompute log
@@ -3900,6 +4381,8 @@ void Document::removeObject(const char* sName)
     if (!d->rollback) {
         // Undo stuff
         if (d->activeUndoTransaction) {
+            // the project file may be overwritten before the object is restored by undo
+            _restoreDeferredFiles(pos->second, true);
             // in this case transaction delete or save the object
             d->activeUndoTransaction->addObjectNew(pos->second);
         }
@@ -3979,6 +4462,8 @@ void Document::_removeObject(DocumentObject* pcObject)
 
     // do no transactions if we do a rollback!
     if (!d->rollback && d->activeUndoTransaction) {
+        // the project file may be overwritten before the object is restored by undo
+        _restoreDeferredFiles(pcObject, true);
         // Undo stuff
         signalTransactionRemove(*pcObject, d->activeUndoTransaction);
         breakDependency(pcObject, true);
@@ -33,12 +33,16 @@
 #include "PropertyLinks.h"
 #include "PropertyStandard.h"
 
+#include <exception>
+#include <functional>
 #include <map>
 #include <vector>
 #include <QString>
 
 namespace Base
 {
+class Profiler;
+class SequencerLauncher;
 class Writer;
 }
 
@@ -204,6 +208,13 @@ public:
                  const std::vector<std::string>& objNames = {});
     bool afterRestore(bool checkPartial = false);
     bool afterRestore(const std::vector<App::DocumentObject*>&, bool checkPartial = false);
+    /** Reads all data files whose reading was deferred on restore
+     *
+     * See PropertyComplexGeoData::restoreDeferred(). The files are read from the
+     * project file, so this must be done before it gets overwritten. Raises an
+     * exception if a file cannot be read.
+     */
+    void restoreDeferredFiles() const;
     enum ExportStatus
     {
         NotExporting,
@@ -392,6 +403,13 @@ public:
     bool testStatus(Status pos) const;
     /// set the status bits
     void setStatus(Status pos, bool on);
+    /** Return the profiler of this document
+     *
+     * If enabled, it records the recompute of every object together with the
+     * phases profiled inside, e.g. expression evaluation or boolean operations,
+     * and the saving and restoring of the document.
+     */
+    Base::Profiler& getProfiler() const;
     //@}
 
 
@@ -584,6 +602,8 @@ public:
 
     /// Indicate if there is any document restoring/importing
     static bool isAnyRestoring();
+    /// Indicate if meshes are written in the compressed format when saving or auto-saving
+    static bool isCompressedMeshEnabled();
 
     friend class Application;
     /// because of transaction handling
@@ -618,6 +638,24 @@ protected:
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
+    /// helper which executes the feature, a thrown exception is passed back in \a error
+    DocumentObjectExecReturn* _executeFeature(DocumentObject* Feat, std::exception_ptr& error);
+    /// helper which reports the result of _executeFeature() in the recompute log
+    /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
+    int _reportFeature(DocumentObject* Feat,
+                       DocumentObjectExecReturn* returnCode,
+                       const std::exception_ptr& error);
+    /// helper which recomputes the objects in the order of the dependency graph with worker threads
+    /// @return -1 if aborted by user, 0 otherwise
+    int _recomputeParallel(const std::vector<App::DocumentObject*>& topoSortedObjects,
+                           std::set<App::DocumentObject*>& filter,
+                           Base::SequencerLauncher* seq,
+                           int& objectCount,
+                           bool* hasError);
+    /** Run \a func in the main thread if called from a worker thread of a parallel recompute
+     * @return false if not called from a recompute worker thread, \a func is not run then.
+     */
+    bool _callInMainThread(const std::function<void()>& func);
     void _clearRedos();
 
     /// refresh the internal dependency graph
@@ -219,7 +219,12 @@ void DocumentObject::touch(bool noRecompute)
     }
     StatusBits.set(ObjectStatus::Touch);
     if (_pDoc) {
-        _pDoc->signalTouchedObject(*this);
+        auto notify = [this]() {
+            _pDoc->signalTouchedObject(*this);
+        };
+        if (!_pDoc->_callInMainThread(notify)) {
+            notify();
+        }
     }
 }
 
@@ -807,11 +812,16 @@ void DocumentObject::onBeforeChange(const Property* prop)
     if (prop == &Label)
         oldLabel = Label.getStrValue();
 
-    if (_pDoc){
-        onBeforeChangeProperty(_pDoc, prop);
+    // During a parallel recompute the notification is forwarded to the main thread
+    auto notify = [this, prop]() {
+        if (_pDoc) {
+            onBeforeChangeProperty(_pDoc, prop);
+        }
+        signalBeforeChange(*this, *prop);
+    };
+    if (!_pDoc || !_pDoc->_callInMainThread(notify)) {
+        notify();
     }
-
-    signalBeforeChange(*this, *prop);
 }
 
 void DocumentObject::onEarlyChange(const Property* prop)
@@ -879,12 +889,17 @@ void DocumentObject::onChanged(const Property* prop)
     // call the parent for appropriate handling
     TransactionalObject::onChanged(prop);
 
-    // Now signal the view provider
-    if (_pDoc) {
-        _pDoc->onChangedProperty(this, prop);
+    // Now signal the view provider. During a parallel recompute the
+    // notification is forwarded to the main thread.
+    auto notify = [this, prop]() {
+        if (_pDoc) {
+            _pDoc->onChangedProperty(this, prop);
+        }
+        signalChanged(*this, *prop);
+    };
+    if (!_pDoc || !_pDoc->_callInMainThread(notify)) {
+        notify();
     }
-
-    signalChanged(*this, *prop);
 }
 
 void DocumentObject::clearOutListCache() const
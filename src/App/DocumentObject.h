@@ -70,6 +70,7 @@ enum ObjectStatus
     RecomputeExtension = 19,        // mark the object to recompute its extensions
     TouchOnColorChange = 20,        // inform view provider touch object on color change
     Freeze = 21,                    // do not recompute ever
+    ConcurrentRecompute = 22,       // object may be recomputed in a worker thread, see canRecomputeConcurrently()
 };
 // clang-format on
 
@@ -508,6 +509,23 @@ public:
         return false;
     }
 
+    /** Return true if this object can be recomputed in a worker thread
+     *
+     * If parallel recomputation is enabled for a document (parameter
+     * 'ParallelRecompute'), objects returning true here are recomputed in a
+     * worker thread as soon as all objects of their OutList are done. All other
+     * objects are recomputed in the main thread.
+     *
+     * An object returning true must only read its own and its dependencies'
+     * properties and must only modify its own properties in execute(). Property
+     * change notifications are forwarded to the main thread. The default
+     * implementation returns the ObjectStatus::ConcurrentRecompute status bit.
+     */
+    virtual bool canRecomputeConcurrently() const
+    {
+        return testStatus(ObjectStatus::ConcurrentRecompute);
+    }
+
     /* Return true to bypass duplicate label checking */
     virtual bool allowDuplicateLabel() const
     {
@@ -1005,3 +1005,13 @@ void DocumentObjectPy::setNoTouch(Py::Boolean value)
 {
     getDocumentObjectPtr()->setStatus(ObjectStatus::NoTouch, value.isTrue());
 }
+
+Py::Boolean DocumentObjectPy::getConcurrentRecompute() const
+{
+    return {getDocumentObjectPtr()->canRecomputeConcurrently()};
+}
+
+void DocumentObjectPy::setConcurrentRecompute(Py::Boolean value)
+{
+    getDocumentObjectPtr()->setStatus(ObjectStatus::ConcurrentRecompute, value.isTrue());
+}
@@ -25,6 +25,7 @@
 
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
+#include <Base/Profiler.h>
 #include <Base/Stream.h>
 
 #include "Document.h"
@@ -963,6 +964,86 @@ Py::String DocumentPy::getName() const
     return {getDocumentPtr()->getName()};
 }
 
+Py::Boolean DocumentPy::getRecomputeProfiling() const
+{
+    return {getDocumentPtr()->getProfiler().isEnabled()};
+}
+
+void DocumentPy::setRecomputeProfiling(Py::Boolean arg)
+{
+    getDocumentPtr()->getProfiler().setEnabled(arg.isTrue());
+}
+
+Py::List DocumentPy::getRecomputeProfile() const
+{
+    Py::List res;
+    for (const auto& event : getDocumentPtr()->getProfiler().getEvents()) {
+        Py::Dict dict;
+        dict.setItem("Category", Py::String(event.category));
+        dict.setItem("Name", Py::String(event.name));
+        dict.setItem("Type", Py::String(event.type));
+        dict.setItem("Start", Py::Float(event.start * 1e-6));
+        dict.setItem("Duration", Py::Float(event.duration * 1e-6));
+        dict.setItem("Thread", Py::Long(event.thread));
+        dict.setItem("Depth", Py::Long(event.depth));
+        res.append(dict);
+    }
+    return res;
+}
+
+PyObject* DocumentPy::exportRecomputeProfile(PyObject* args, PyObject* kwd)
+{
+    char* fn = nullptr;
+    const char* format = "chrome";
+    static const std::array<const char*, 3> kwlist {"filename", "format", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args, kwd, "|zs", kwlist, &fn, &format)) {
+        return nullptr;
+    }
+
+    bool csv = false;
+    if (strcmp(format, "csv") == 0) {
+        csv = true;
+    }
+    else if (strcmp(format, "chrome") != 0) {
+        PyErr_SetString(PyExc_ValueError, "format must be 'chrome' or 'csv'");
+        return nullptr;
+    }
+
+    auto write = [this, csv](std::ostream& str) {
+        const auto& profiler = getDocumentPtr()->getProfiler();
+        if (csv) {
+            profiler.exportCsv(str);
+        }
+        else {
+            profiler.exportChromeTrace(str);
+        }
+    };
+
+    PY_TRY
+    {
+        if (fn) {
+            Base::FileInfo fi(fn);
+            Base::ofstream str(fi);
+            write(str);
+            str.close();
+            Py_Return;
+        }
+        std::stringstream str;
+        write(str);
+        return PyUnicode_FromString(str.str().c_str());
+    }
+    PY_CATCH
+}
+
+PyObject* DocumentPy::clearRecomputeProfile(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->getProfiler().clear();
+    Py_Return;
+}
+
 Py::Boolean DocumentPy::getRecomputesFrozen() const
 {
     return {getDocumentPtr()->testStatus(Document::Status::SkipRecompute)};
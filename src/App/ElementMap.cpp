@@ -1,5 +1,6 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -380,6 +381,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
         stream >> std::hex;
 
         indices.names.resize(outerCount);
+        this->mappedNames.reserve(this->mappedNames.size() + outerCount);
         for (int j = 0; j < outerCount; ++j) {
             idx.setIndex(j);
             auto* ref = &indices.names[j];
@@ -442,7 +444,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                     }
                 }
 
-                this->mappedNames.emplace(ref->name, idx);
+                this->mappedNames.insert(ref->name, idx);
 
                 if (!hasherRef) {
                     if (offset + 1 < (int)tokens.size()) {
@@ -509,25 +511,27 @@ MappedName ElementMap::addName(MappedName& name,
         if (overwrite) {
             erase(idx);
         }
-        auto ret = mappedNames.insert(std::make_pair(name, idx));
+        auto ret = mappedNames.insert(name, idx);
         if (ret.second) {                // element just inserted did not exist yet in the map
-            ret.first->first.compact();  // FIXME see MappedName.cpp
-            mappedRef(idx).append(ret.first->first, sids);
+            ret.first->name.compact();  // FIXME see MappedName.cpp
+            mappedRef(idx).append(ret.first->name, sids);
             FC_TRACE(idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return ret.first->name;
         }
-        if (ret.first->second == idx) {
+        if (ret.first->index == idx) {
             FC_TRACE("duplicate " << idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return ret.first->name;
         }
         if (!overwrite) {
             if (existing) {
-                *existing = ret.first->second;
+                *existing = ret.first->index;
             }
             return {};
         }
 
-        erase(ret.first->first);
+        // erasing moves the table entries, so don't pass a reference into it
+        MappedName other = ret.first->name;
+        erase(other);
     };
 }
 
@@ -777,16 +781,16 @@ MappedName ElementMap::renameDuplicateElement(int index,
 
 void ElementMap::erase(const MappedName& name)
 {
-    auto it = this->mappedNames.find(name);
-    if (it == this->mappedNames.end()) {
+    auto entry = this->mappedNames.find(name);
+    if (!entry) {
         return;
     }
-    MappedNameRef* ref = findMappedRef(it->second);
+    MappedNameRef* ref = findMappedRef(entry->index);
     if (!ref) {
         return;
     }
     ref->erase(name);
-    this->mappedNames.erase(it);
+    this->mappedNames.erase(name);
 }
 
 void ElementMap::erase(const IndexedName& idx)
@@ -818,8 +822,8 @@ bool ElementMap::empty() const
 
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    auto entry = mappedNames.find(name);
+    if (!entry) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -856,7 +860,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
     }
 
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
+        const MappedNameRef* ref = findMappedRef(entry->index);
         for (; ref; ref = ref->next.get()) {
             if (ref->name == name) {
                 if (sids->empty()) {
@@ -869,7 +873,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
             }
         }
     }
-    return nameIter->second;
+    return entry->index;
 }
 
 MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
@@ -1072,8 +1076,18 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    // The postfix indices are saved with the map, add them in name order to keep
+    // the output independent of the hash table layout.
+    std::vector<const MappedName*> names;
+    names.reserve(this->mappedNames.size());
+    this->mappedNames.forEach([&names](const MappedNameTable::Entry& entry) {
+        names.push_back(&entry.name);
+    });
+    std::sort(names.begin(), names.end(), [](const MappedName* a, const MappedName* b) {
+        return *a < *b;
+    });
+    for (auto name : names) {
+        addPostfix(name->constPostfix(), postfixMap, postfixes);
     }
 
     childMaps.push_back(this);
@@ -1299,9 +1313,12 @@ std::vector<MappedElement> ElementMap::getAll() const
 {
     std::vector<MappedElement> ret;
     ret.reserve(size());
-    for (auto& mappedName : this->mappedNames) {
-        ret.emplace_back(mappedName.first, mappedName.second);
-    }
+    this->mappedNames.forEach([&ret](const MappedNameTable::Entry& entry) {
+        ret.emplace_back(entry.name, entry.index);
+    });
+    std::sort(ret.begin(), ret.end(), [](const MappedElement& a, const MappedElement& b) {
+        return a.name < b.name;
+    });
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
@@ -1324,6 +1341,44 @@ std::vector<MappedElement> ElementMap::getAll() const
     return ret;
 }
 
+ElementMap::MemoryUsage ElementMap::getMemoryUsage() const
+{
+    // rough size of a node of std::map, on top of its value
+    constexpr std::size_t mapNodeOverhead = 4 * sizeof(void*);
+
+    MemoryUsage usage;
+    usage.names = this->mappedNames.size();
+    usage.tableSlots = this->mappedNames.capacity();
+    usage.tableBytes = this->mappedNames.memoryUsage();
+    this->mappedNames.forEach([&usage](const MappedNameTable::Entry& entry) {
+        usage.nameBytes += entry.name.dataBytes().size() + entry.name.postfixBytes().size();
+    });
+
+    for (auto& indexedName : this->indexedNames) {
+        const auto& indices = indexedName.second;
+        usage.indexedBytes +=
+            sizeof(*this->indexedNames.begin()) + mapNodeOverhead
+            + indices.names.capacity() * sizeof(MappedNameRef);
+        for (auto& ref : indices.names) {
+            for (auto nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
+                if (nameRef != &ref) {
+                    usage.indexedBytes += sizeof(MappedNameRef);
+                }
+                usage.indexedBytes += nameRef->sids.size() * sizeof(::App::StringIDRef);
+            }
+        }
+        usage.childBytes +=
+            indices.children.size() * (sizeof(*indices.children.begin()) + mapNodeOverhead);
+    }
+
+    usage.childElements = this->childElements.size();
+    for (auto it = this->childElements.begin(); it != this->childElements.end(); ++it) {
+        usage.childBytes += sizeof(ChildMapInfo) + it.key().size()
+            + it.value().mapIndices.size() * (sizeof(std::pair<ElementMap*, int>) + mapNodeOverhead);
+    }
+    return usage;
+}
+
 long ElementMap::getElementHistory(const MappedName& name,
                                    long masterTag,
                                    MappedName* original,
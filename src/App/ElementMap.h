@@ -30,13 +30,14 @@
 
 #include "Application.h"
 #include "MappedElement.h"
+#include "MappedNameTable.h"
 #include "StringHasher.h"
 
 #include <cstring>
-#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 
 namespace Data
@@ -63,10 +64,10 @@ typedef std::function<bool(const MappedName&, int, long, long)> TraceCallback;
 /* This class provides for ComplexGeoData's ability to provide proper naming.
  * Specifically, ComplexGeoData uses this class for it's `_id` property.
  * Most of the operations work with the `indexedNames` and `mappedNames` maps.
- * `indexedNames` maps a string to both a name queue and children.
+ * `indexedNames` maps a string to both a contiguous array of names and children.
  *   each of those children store an IndexedName, offset details, postfix, ids, and
  *   possibly a recursive elementmap
- * `mappedNames` maps a MappedName to a specific IndexedName.
+ * `mappedNames` is a flat hash table mapping a MappedName to a specific IndexedName.
  */
 class AppExport ElementMap
     : public std::enable_shared_from_this<ElementMap>  // TODO can remove shared_from_this?
@@ -195,8 +196,35 @@ public:
 
     std::vector<MappedChildElements> getChildElements() const;
 
+    /// Returns all the mapped names, sorted by name, followed by the child elements
     std::vector<MappedElement> getAll() const;
 
+    /// Memory used by an element map, excluding its child element maps
+    struct MemoryUsage
+    {
+        /// Number of mapped names
+        std::size_t names = 0;
+        /// Number of slots in the mapped name hash table
+        std::size_t tableSlots = 0;
+        /// Bytes used by the mapped name hash table
+        std::size_t tableBytes = 0;
+        /// Bytes used by the indexed name arrays, including the extra names of an element
+        std::size_t indexedBytes = 0;
+        /// Bytes of the mapped name strings
+        std::size_t nameBytes = 0;
+        /// Number of child element mappings
+        std::size_t childElements = 0;
+        /// Bytes used by the child element mappings
+        std::size_t childBytes = 0;
+
+        std::size_t totalBytes() const
+        {
+            return tableBytes + indexedBytes + nameBytes + childBytes;
+        }
+    };
+
+    MemoryUsage getMemoryUsage() const;
+
     long getElementHistory(const MappedName& name,
                            long masterTag,
                            MappedName* original = nullptr,
@@ -297,13 +325,13 @@ private:
 
     struct IndexedElements
     {
-        std::deque<MappedNameRef> names;
+        std::vector<MappedNameRef> names;
         std::map<int, MappedChildElements> children;
     };
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    MappedNameTable mappedNames;
 
     struct ChildMapInfo
     {
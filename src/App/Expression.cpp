@@ -49,6 +49,7 @@
 #include <Base/RotationPy.h>
 #include <Base/VectorPy.h>
 
+#include "ExpressionCompiler.h"
 #include "ExpressionParser.h"
 
 
@@ -950,6 +951,10 @@ public:
         this->getIdentifiers(e,deps);
     }
 
+    bool isReadOnly() const override {
+        return true;
+    }
+
     std::map<App::ObjectIdentifier,bool> &deps;
 };
 
@@ -1079,6 +1084,10 @@ public:
             this->renameObjectIdentifier(e,paths,dummy);
     }
 
+    bool isReadOnly() const override {
+        return collect;
+    }
+
     const DocumentObject *parent;
     DocumentObject *oldObj;
     DocumentObject *newObj;
@@ -1107,6 +1116,10 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
 }
 
 App::any Expression::getValueAsAny() const {
+    CompiledExpression::Value value;
+    if(getCompiled()->evaluate(value))
+        return value.toAny();
+
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
@@ -1125,12 +1138,28 @@ Py::Object Expression::getPyValue() const {
     return Py::Object();
 }
 
+std::shared_ptr<const CompiledExpression> Expression::getCompiled() const {
+    std::shared_ptr<const CompiledExpression> res = std::atomic_load(&compiled);
+    if(res)
+        return res;
+
+    std::shared_ptr<const CompiledExpression> compiledExpr = CompiledExpression::compile(this);
+    // Another thread may have compiled it in the mean time
+    if(std::atomic_compare_exchange_strong(&compiled, &res, compiledExpr))
+        return compiledExpr;
+    return res;
+}
+
 void Expression::addComponent(Component *component) {
     assert(component);
     components.push_back(component);
+    std::atomic_store(&compiled, std::shared_ptr<const CompiledExpression>());
 }
 
 void Expression::visit(ExpressionVisitor &v) {
+    // the visitor may modify the expression, evaluations still running keep the old tree
+    if(!v.isReadOnly())
+        std::atomic_store(&compiled, std::shared_ptr<const CompiledExpression>());
     _visit(v);
     for(auto &c : components)
         c->visit(v);
@@ -1138,6 +1167,10 @@ void Expression::visit(ExpressionVisitor &v) {
 }
 
 Expression* Expression::eval() const {
+    CompiledExpression::Value value;
+    if(getCompiled()->evaluate(value))
+        return value.toExpression(owner);
+
     Base::PyGILStateLocker lock;
     return expressionFromPy(owner,getPyValue());
 }
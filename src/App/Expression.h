@@ -24,6 +24,7 @@
 #define EXPRESSION_H
 
 #include <deque>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -44,6 +45,7 @@ namespace App  {
 class DocumentObject;
 class Expression;
 class Document;
+class CompiledExpression;
 
 using ExpressionPtr = std::unique_ptr<Expression>;
 
@@ -62,6 +64,8 @@ public:
     virtual void aboutToChange() {}
     virtual int changed() const { return 0;}
     virtual void reset() {}
+    /// Returns true if the visitor doesn't modify the expressions it visits
+    virtual bool isReadOnly() const { return false; }
     virtual App::PropertyLinkBase* getPropertyLink() {return nullptr;}
 
 protected:
@@ -185,6 +189,11 @@ public:
 
     Py::Object getPyValue() const;
 
+    /** Returns the native form of the expression, compiled on first use. Visitors that modify
+     * the expression discard it, the returned pointer keeps it alive while it's evaluated.
+     */
+    std::shared_ptr<const CompiledExpression> getCompiled() const;
+
     bool isSame(const Expression &other, bool checkComment=true) const;
 
     friend class ExpressionVisitor;
@@ -219,6 +228,10 @@ protected:
 
     ComponentList components;
 
+private:
+    // accessed with std::atomic_load() and std::atomic_store()
+    mutable std::shared_ptr<const CompiledExpression> compiled;
+
 public:
     std::string comment;
     // clang-format on
@@ -0,0 +1,986 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <array>
+#include <climits>
+#include <cmath>
+#include <vector>
+#endif
+
+#include <boost/math/special_functions/round.hpp>
+#include <boost/math/special_functions/trunc.hpp>
+
+#include <Base/Interpreter.h>
+#include <Base/QuantityPy.h>
+
+#include "ExpressionCompiler.h"
+#include "ExpressionParser.h"
+#include "PropertyStandard.h"
+#include "PropertyUnits.h"
+
+
+using namespace App;
+using Base::Quantity;
+using Base::Unit;
+
+using ValueType = CompiledExpression::Value::Type;
+
+struct CompiledExpression::Node
+{
+    enum class Kind
+    {
+        Constant,
+        Variable,
+        PyValue,
+        Unary,
+        Binary,
+        Conditional,
+        Function,
+    };
+
+    Kind kind {Kind::Constant};
+    int op {0};  // OperatorExpression::Operator or FunctionExpression::Function
+    const Expression* expr {nullptr};
+    Value value;
+    std::vector<std::unique_ptr<Node>> args;
+};
+
+namespace
+{
+
+// Largest magnitude of an integer that converts to double without rounding
+constexpr long maxExactInt = 1L << 53;
+
+bool isInt(const CompiledExpression::Value& value)
+{
+    return value.type == ValueType::Bool || value.type == ValueType::Int;
+}
+
+bool isExactDouble(long value)
+{
+    return value >= -maxExactInt && value <= maxExactInt;
+}
+
+// Same as PyFloat_AsDouble() on the equivalent Python object
+double toDouble(const CompiledExpression::Value& value)
+{
+    switch (value.type) {
+        case ValueType::Bool:
+        case ValueType::Int:
+            return static_cast<double>(value.intValue);
+        case ValueType::Float:
+            return value.floatValue;
+        case ValueType::Quantity:
+            break;
+    }
+    return value.quantity.getValue();
+}
+
+// Same as pyToQuantity() on the equivalent Python object
+Quantity toQuantity(const CompiledExpression::Value& value)
+{
+    if (value.type == ValueType::Quantity) {
+        return value.quantity;
+    }
+    return Quantity(toDouble(value));
+}
+
+bool isTrue(const CompiledExpression::Value& value)
+{
+    return toDouble(value) != 0.0;
+}
+
+void setBool(CompiledExpression::Value& res, bool value)
+{
+    res.type = ValueType::Bool;
+    res.intValue = value ? 1 : 0;
+}
+
+void setInt(CompiledExpression::Value& res, long value)
+{
+    res.type = ValueType::Int;
+    res.intValue = value;
+}
+
+void setFloat(CompiledExpression::Value& res, double value)
+{
+    res.type = ValueType::Float;
+    res.floatValue = value;
+}
+
+void setQuantity(CompiledExpression::Value& res, const Quantity& value)
+{
+    res.type = ValueType::Quantity;
+    res.quantity = value;
+}
+
+/** Converts a Python object the same way the Python operators would see it
+ *
+ * Returns false for anything that isn't a number or quantity.
+ */
+bool fromPy(const Py::Object& pyobj, CompiledExpression::Value& res)
+{
+    PyObject* obj = pyobj.ptr();
+    if (PyObject_TypeCheck(obj, &Base::QuantityPy::Type)) {
+        setQuantity(res, *static_cast<Base::QuantityPy*>(obj)->getQuantityPtr());
+        return true;
+    }
+    if (PyBool_Check(obj)) {
+        setBool(res, obj == Py_True);
+        return true;
+    }
+    if (PyLong_Check(obj)) {
+        long value = PyLong_AsLong(obj);
+        if (value == -1 && PyErr_Occurred()) {
+            PyErr_Clear();
+            return false;
+        }
+        setInt(res, value);
+        return true;
+    }
+    if (PyFloat_Check(obj)) {
+        setFloat(res, PyFloat_AsDouble(obj));
+        return true;
+    }
+    return false;
+}
+
+bool addInt(long a, long b, long& res)
+{
+    if ((b > 0 && a > LONG_MAX - b) || (b < 0 && a < LONG_MIN - b)) {
+        return false;
+    }
+    res = a + b;
+    return true;
+}
+
+bool subInt(long a, long b, long& res)
+{
+    if ((b < 0 && a > LONG_MAX + b) || (b > 0 && a < LONG_MIN + b)) {
+        return false;
+    }
+    res = a - b;
+    return true;
+}
+
+bool mulInt(long a, long b, long& res)
+{
+    if (a > 0) {
+        if ((b > 0 && a > LONG_MAX / b) || (b < 0 && b < LONG_MIN / a)) {
+            return false;
+        }
+    }
+    else if (a < 0) {
+        if ((b > 0 && a < LONG_MIN / b) || (b < 0 && b < LONG_MAX / a)) {
+            return false;
+        }
+    }
+    res = a * b;
+    return true;
+}
+
+// Python's float modulo, the result has the sign of the divisor
+bool pyFloatRem(double a, double b, double& res)
+{
+    if (b == 0.0) {
+        return false;  // ZeroDivisionError
+    }
+    res = std::fmod(a, b);
+    if (res != 0.0) {
+        if ((b < 0) != (res < 0)) {
+            res += b;
+        }
+    }
+    else {
+        res = std::copysign(0.0, b);
+    }
+    return true;
+}
+
+// Python's float power, the special cases are left to Python
+bool pyFloatPow(double a, double b, double& res)
+{
+    if (!std::isfinite(a) || !std::isfinite(b) || a == 0.0) {
+        return false;
+    }
+    if (a < 0.0 && b != std::floor(b)) {
+        return false;  // complex result
+    }
+    res = std::pow(a, b);
+    return std::isfinite(res);  // or else OverflowError
+}
+
+bool pyIntPow(long a, long b, CompiledExpression::Value& res)
+{
+    if (b < 0) {
+        double value {};
+        if (!pyFloatPow(static_cast<double>(a), static_cast<double>(b), value)) {
+            return false;
+        }
+        setFloat(res, value);
+        return true;
+    }
+
+    long value = 1;
+    while (b > 0) {
+        if ((b & 1) != 0 && !mulInt(value, a, value)) {
+            return false;
+        }
+        b >>= 1;
+        if (b > 0 && !mulInt(a, a, a)) {
+            return false;
+        }
+    }
+    setInt(res, value);
+    return true;
+}
+
+template<typename T>
+bool compare(int op, const T& a, const T& b, CompiledExpression::Value& res)
+{
+    switch (op) {
+        case OperatorExpression::EQ:
+            setBool(res, a == b);
+            return true;
+        case OperatorExpression::NEQ:
+            setBool(res, a != b);
+            return true;
+        case OperatorExpression::LT:
+            setBool(res, a < b);
+            return true;
+        case OperatorExpression::GT:
+            setBool(res, a > b);
+            return true;
+        case OperatorExpression::LTE:
+            setBool(res, a <= b);
+            return true;
+        case OperatorExpression::GTE:
+            setBool(res, a >= b);
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
+bool isComparison(int op)
+{
+    switch (op) {
+        case OperatorExpression::EQ:
+        case OperatorExpression::NEQ:
+        case OperatorExpression::LT:
+        case OperatorExpression::GT:
+        case OperatorExpression::LTE:
+        case OperatorExpression::GTE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// int and bool operands, see the number protocol of Python's int
+bool intOperator(int op, long a, long b, CompiledExpression::Value& res)
+{
+    long value {};
+    switch (op) {
+        case OperatorExpression::ADD:
+            if (!addInt(a, b, value)) {
+                return false;
+            }
+            setInt(res, value);
+            return true;
+        case OperatorExpression::SUB:
+            if (!subInt(a, b, value)) {
+                return false;
+            }
+            setInt(res, value);
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            if (!mulInt(a, b, value)) {
+                return false;
+            }
+            setInt(res, value);
+            return true;
+        case OperatorExpression::DIV:
+            if (b == 0 || !isExactDouble(a) || !isExactDouble(b)) {
+                return false;
+            }
+            setFloat(res, static_cast<double>(a) / static_cast<double>(b));
+            return true;
+        case OperatorExpression::MOD:
+            if (b == 0) {
+                return false;
+            }
+            value = b == -1 ? 0 : a % b;
+            if (value != 0 && ((value < 0) != (b < 0))) {
+                value += b;
+            }
+            setInt(res, value);
+            return true;
+        case OperatorExpression::POW:
+            return pyIntPow(a, b, res);
+        default:
+            return compare(op, a, b, res);
+    }
+}
+
+// at least one float operand, see the number protocol of Python's float
+bool floatOperator(int op,
+                   const CompiledExpression::Value& l,
+                   const CompiledExpression::Value& r,
+                   CompiledExpression::Value& res)
+{
+    // Python compares int and float exactly
+    if ((isInt(l) && !isExactDouble(l.intValue)) || (isInt(r) && !isExactDouble(r.intValue))) {
+        return false;
+    }
+
+    double a = toDouble(l);
+    double b = toDouble(r);
+    double value {};
+    switch (op) {
+        case OperatorExpression::ADD:
+            setFloat(res, a + b);
+            return true;
+        case OperatorExpression::SUB:
+            setFloat(res, a - b);
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            setFloat(res, a * b);
+            return true;
+        case OperatorExpression::DIV:
+            if (b == 0.0) {
+                return false;
+            }
+            setFloat(res, a / b);
+            return true;
+        case OperatorExpression::MOD:
+            if (!pyFloatRem(a, b, value)) {
+                return false;
+            }
+            setFloat(res, value);
+            return true;
+        case OperatorExpression::POW:
+            if (b == 0.0) {
+                setFloat(res, 1.0);
+                return true;
+            }
+            if (!pyFloatPow(a, b, value)) {
+                return false;
+            }
+            setFloat(res, value);
+            return true;
+        default:
+            return compare(op, a, b, res);
+    }
+}
+
+// at least one quantity operand, see the number protocol of QuantityPy
+bool quantityOperator(int op,
+                      const CompiledExpression::Value& l,
+                      const CompiledExpression::Value& r,
+                      CompiledExpression::Value& res)
+{
+    switch (op) {
+        case OperatorExpression::ADD:
+            setQuantity(res, toQuantity(l) + toQuantity(r));
+            return true;
+        case OperatorExpression::SUB:
+            setQuantity(res, toQuantity(l) - toQuantity(r));
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            setQuantity(res, toQuantity(l) * toQuantity(r));
+            return true;
+        case OperatorExpression::DIV:
+            setQuantity(res, toQuantity(l) / toQuantity(r));
+            return true;
+        case OperatorExpression::MOD: {
+            if (l.type != ValueType::Quantity) {
+                return false;
+            }
+            double value {};
+            if (!pyFloatRem(l.quantity.getValue(), toDouble(r), value)) {
+                return false;
+            }
+            setQuantity(res, Quantity(value, l.quantity.getUnit()));
+            return true;
+        }
+        case OperatorExpression::POW:
+            if (l.type != ValueType::Quantity) {
+                return false;
+            }
+            if (r.type == ValueType::Quantity) {
+                setQuantity(res, l.quantity.pow(r.quantity));
+            }
+            else {
+                setQuantity(res, l.quantity.pow(toDouble(r)));
+            }
+            return true;
+        default:
+            break;
+    }
+
+    if (l.type != ValueType::Quantity || r.type != ValueType::Quantity) {
+        return compare(op, toDouble(l), toDouble(r), res);
+    }
+
+    const Quantity& a = l.quantity;
+    const Quantity& b = r.quantity;
+    switch (op) {
+        case OperatorExpression::EQ:
+            setBool(res, a == b);
+            return true;
+        case OperatorExpression::NEQ:
+            setBool(res, !(a == b));
+            return true;
+        case OperatorExpression::LT:
+            setBool(res, a < b);
+            return true;
+        case OperatorExpression::GT:
+            setBool(res, !(a < b) && !(a == b));
+            return true;
+        case OperatorExpression::LTE:
+            setBool(res, (a < b) || (a == b));
+            return true;
+        case OperatorExpression::GTE:
+            setBool(res, !(a < b));
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
+bool binaryOperator(int op,
+                    const CompiledExpression::Value& l,
+                    const CompiledExpression::Value& r,
+                    CompiledExpression::Value& res)
+{
+    if (l.type == ValueType::Quantity || r.type == ValueType::Quantity) {
+        return quantityOperator(op, l, r, res);
+    }
+    if (isInt(l) && isInt(r)) {
+        return intOperator(op, l.intValue, r.intValue, res);
+    }
+    return floatOperator(op, l, r, res);
+}
+
+bool unaryOperator(int op, const CompiledExpression::Value& l, CompiledExpression::Value& res)
+{
+    switch (l.type) {
+        case ValueType::Bool:
+        case ValueType::Int:
+            if (op == OperatorExpression::NEG) {
+                if (l.intValue == LONG_MIN) {
+                    return false;
+                }
+                setInt(res, -l.intValue);
+            }
+            else {
+                setInt(res, l.intValue);
+            }
+            return true;
+        case ValueType::Float:
+            setFloat(res, op == OperatorExpression::NEG ? -l.floatValue : l.floatValue);
+            return true;
+        case ValueType::Quantity:
+            setQuantity(res, op == OperatorExpression::NEG ? l.quantity * -1.0 : l.quantity);
+            return true;
+    }
+    return false;
+}
+
+bool needsSecondArgument(int f)
+{
+    switch (f) {
+        case FunctionExpression::ATAN2:
+        case FunctionExpression::CATH:
+        case FunctionExpression::HYPOT:
+        case FunctionExpression::MOD:
+        case FunctionExpression::POW:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool isNativeFunction(int f)
+{
+    switch (f) {
+        case FunctionExpression::ABS:
+        case FunctionExpression::ACOS:
+        case FunctionExpression::ASIN:
+        case FunctionExpression::ATAN:
+        case FunctionExpression::ATAN2:
+        case FunctionExpression::CATH:
+        case FunctionExpression::CBRT:
+        case FunctionExpression::CEIL:
+        case FunctionExpression::COS:
+        case FunctionExpression::COSH:
+        case FunctionExpression::EXP:
+        case FunctionExpression::FLOOR:
+        case FunctionExpression::HYPOT:
+        case FunctionExpression::LOG:
+        case FunctionExpression::LOG10:
+        case FunctionExpression::MOD:
+        case FunctionExpression::POW:
+        case FunctionExpression::ROUND:
+        case FunctionExpression::SIN:
+        case FunctionExpression::SINH:
+        case FunctionExpression::SQRT:
+        case FunctionExpression::TAN:
+        case FunctionExpression::TANH:
+        case FunctionExpression::TRUNC:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Mirrors the scalar part of FunctionExpression::evaluate()
+bool scalarFunction(int f, const std::array<Quantity, 3>& v, std::size_t count, Quantity& res)
+{
+    const Quantity& v1 = v[0];
+    const Quantity& v2 = v[1];
+    const Quantity& v3 = v[2];
+
+    Unit unit;
+    double scaler = 1;
+    double value = v1.getValue();
+
+    switch (f) {
+        case FunctionExpression::COS:
+        case FunctionExpression::SIN:
+        case FunctionExpression::TAN:
+            if (!(v1.isDimensionlessOrUnit(Unit::Angle))) {
+                return false;
+            }
+            value *= M_PI / 180.0;
+            break;
+        case FunctionExpression::ACOS:
+        case FunctionExpression::ASIN:
+        case FunctionExpression::ATAN:
+            if (!v1.isDimensionless()) {
+                return false;
+            }
+            unit = Unit::Angle;
+            scaler = 180.0 / M_PI;
+            break;
+        case FunctionExpression::EXP:
+        case FunctionExpression::LOG:
+        case FunctionExpression::LOG10:
+        case FunctionExpression::SINH:
+        case FunctionExpression::TANH:
+        case FunctionExpression::COSH:
+            if (!v1.isDimensionless()) {
+                return false;
+            }
+            break;
+        case FunctionExpression::ROUND:
+        case FunctionExpression::TRUNC:
+        case FunctionExpression::CEIL:
+        case FunctionExpression::FLOOR:
+        case FunctionExpression::ABS:
+            unit = v1.getUnit();
+            break;
+        case FunctionExpression::SQRT:
+            unit = v1.getUnit().sqrt();
+            break;
+        case FunctionExpression::CBRT:
+            unit = v1.getUnit().cbrt();
+            break;
+        case FunctionExpression::ATAN2:
+            if (v1.getUnit() != v2.getUnit()) {
+                return false;
+            }
+            unit = Unit::Angle;
+            scaler = 180.0 / M_PI;
+            break;
+        case FunctionExpression::MOD:
+            unit = v1.getUnit() / v2.getUnit();
+            break;
+        case FunctionExpression::POW: {
+            if (!v2.isDimensionless()) {
+                return false;
+            }
+            double exponent = v2.getValue();
+            if (!v1.isDimensionless()) {
+                if (exponent - boost::math::round(exponent) >= 1e-9) {
+                    return false;
+                }
+                unit = v1.getUnit().pow(exponent);
+            }
+            break;
+        }
+        case FunctionExpression::HYPOT:
+        case FunctionExpression::CATH:
+            if (v1.getUnit() != v2.getUnit()) {
+                return false;
+            }
+            if (count > 2 && v2.getUnit() != v3.getUnit()) {
+                return false;
+            }
+            unit = v1.getUnit();
+            break;
+        default:
+            return false;
+    }
+
+    double output {};
+    switch (f) {
+        case FunctionExpression::ACOS:
+            output = acos(value);
+            break;
+        case FunctionExpression::ASIN:
+            output = asin(value);
+            break;
+        case FunctionExpression::ATAN:
+            output = atan(value);
+            break;
+        case FunctionExpression::ABS:
+            output = fabs(value);
+            break;
+        case FunctionExpression::EXP:
+            output = exp(value);
+            break;
+        case FunctionExpression::LOG:
+            output = log(value);
+            break;
+        case FunctionExpression::LOG10:
+            output = log(value) / log(10.0);
+            break;
+        case FunctionExpression::SIN:
+            output = sin(value);
+            break;
+        case FunctionExpression::SINH:
+            output = sinh(value);
+            break;
+        case FunctionExpression::TAN:
+            output = tan(value);
+            break;
+        case FunctionExpression::TANH:
+            output = tanh(value);
+            break;
+        case FunctionExpression::SQRT:
+            output = sqrt(value);
+            break;
+        case FunctionExpression::CBRT:
+            output = cbrt(value);
+            break;
+        case FunctionExpression::COS:
+            output = cos(value);
+            break;
+        case FunctionExpression::COSH:
+            output = cosh(value);
+            break;
+        case FunctionExpression::MOD:
+            output = fmod(value, v2.getValue());
+            break;
+        case FunctionExpression::ATAN2:
+            output = atan2(value, v2.getValue());
+            break;
+        case FunctionExpression::POW:
+            output = pow(value, v2.getValue());
+            break;
+        case FunctionExpression::HYPOT:
+            output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2)
+                          + (count > 2 ? pow(v3.getValue(), 2) : 0));
+            break;
+        case FunctionExpression::CATH:
+            output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2)
+                          - (count > 2 ? pow(v3.getValue(), 2) : 0));
+            break;
+        case FunctionExpression::ROUND:
+            output = boost::math::round(value);
+            break;
+        case FunctionExpression::TRUNC:
+            output = boost::math::trunc(value);
+            break;
+        case FunctionExpression::CEIL:
+            output = ceil(value);
+            break;
+        case FunctionExpression::FLOOR:
+            output = floor(value);
+            break;
+        default:
+            return false;
+    }
+
+    res = Quantity(scaler * output, unit);
+    return true;
+}
+
+using Node = CompiledExpression::Node;
+
+std::unique_ptr<Node> lower(const Expression* expr)
+{
+    if (!expr || expr->hasComponent()) {
+        return {};
+    }
+
+    auto node = std::make_unique<Node>();
+    node->expr = expr;
+
+    Base::Type type = expr->getTypeId();
+    if (type == UnitExpression::getClassTypeId() || type == NumberExpression::getClassTypeId()
+        || type == ConstantExpression::getClassTypeId()) {
+        // Take the value from Python once, so that integers, floats and
+        // constants like True are exactly what the Python evaluation sees
+        Base::PyGILStateLocker lock;
+        try {
+            if (!fromPy(expr->getPyValue(), node->value)) {
+                return {};
+            }
+        }
+        catch (Base::Exception&) {
+            return {};
+        }
+        node->kind = Node::Kind::Constant;
+        return node;
+    }
+
+    if (type == VariableExpression::getClassTypeId()) {
+        node->kind = Node::Kind::Variable;
+        return node;
+    }
+
+    if (type == OperatorExpression::getClassTypeId()) {
+        auto opExpr = static_cast<const OperatorExpression*>(expr);
+        node->op = opExpr->getOperator();
+        if (node->op == OperatorExpression::NEG || node->op == OperatorExpression::POS) {
+            // the right operand of an unary operator is not evaluated
+            node->kind = Node::Kind::Unary;
+            node->args.push_back(lower(opExpr->getLeft()));
+        }
+        else if (node->op != OperatorExpression::NONE) {
+            node->kind = Node::Kind::Binary;
+            node->args.push_back(lower(opExpr->getLeft()));
+            node->args.push_back(lower(opExpr->getRight()));
+        }
+        else {
+            return {};
+        }
+    }
+    else if (type == ConditionalExpression::getClassTypeId()) {
+        auto condExpr = static_cast<const ConditionalExpression*>(expr);
+        node->kind = Node::Kind::Conditional;
+        node->args.push_back(lower(condExpr->getCondition()));
+        node->args.push_back(lower(condExpr->getTrueExpression()));
+        node->args.push_back(lower(condExpr->getFalseExpression()));
+    }
+    else if (type == FunctionExpression::getClassTypeId()) {
+        auto funcExpr = static_cast<const FunctionExpression*>(expr);
+        int f = funcExpr->getFunction();
+        const auto& args = funcExpr->getArgs();
+        if (!expr->getOwner() || args.empty()) {
+            return {};
+        }
+        if (f == FunctionExpression::HIDDENREF || f == FunctionExpression::HREF) {
+            // only changes the dependency
+            return lower(args[0]);
+        }
+        if (f > FunctionExpression::AGGREGATES && f < FunctionExpression::LAST) {
+            // Aggregates always return a number, ranges are only resolved by Python
+            node->kind = Node::Kind::PyValue;
+            return node;
+        }
+        if (!isNativeFunction(f) || args.size() > 3
+            || (args.size() < 2 && needsSecondArgument(f))) {
+            return {};
+        }
+        node->kind = Node::Kind::Function;
+        node->op = f;
+        for (auto arg : args) {
+            node->args.push_back(lower(arg));
+        }
+    }
+    else {
+        return {};
+    }
+
+    for (const auto& arg : node->args) {
+        if (!arg) {
+            return {};
+        }
+    }
+    return node;
+}
+
+}  // namespace
+
+App::any CompiledExpression::Value::toAny() const
+{
+    switch (type) {
+        case Type::Bool:
+        case Type::Int:
+            return App::any(intValue);
+        case Type::Float:
+            return App::any(floatValue);
+        case Type::Quantity:
+            break;
+    }
+    return App::any(quantity);
+}
+
+Expression* CompiledExpression::Value::toExpression(const DocumentObject* owner) const
+{
+    switch (type) {
+        case Type::Bool:
+            if (intValue != 0) {
+                return new ConstantExpression(owner, "True", Quantity(1.0));
+            }
+            return new ConstantExpression(owner, "False", Quantity(0.0));
+        case Type::Int:
+        case Type::Float:
+            return new NumberExpression(owner, toQuantity(*this));
+        case Type::Quantity:
+            break;
+    }
+    return new NumberExpression(owner, quantity);
+}
+
+CompiledExpression::~CompiledExpression() = default;
+
+std::unique_ptr<CompiledExpression> CompiledExpression::compile(const Expression* expr)
+{
+    std::unique_ptr<CompiledExpression> res(new CompiledExpression);
+    res->root = lower(expr);
+    return res;
+}
+
+namespace
+{
+
+bool evaluateNode(const Node& node, CompiledExpression::Value& res, bool& pythonOnly)
+{
+    switch (node.kind) {
+        case Node::Kind::Constant:
+            res = node.value;
+            return true;
+
+        case Node::Kind::Variable: {
+            auto var = static_cast<const VariableExpression*>(node.expr);
+            const Property* prop = var->getWholeProperty();
+            if (prop) {
+                if (prop->isDerivedFrom<PropertyQuantity>()) {
+                    setQuantity(res, static_cast<const PropertyQuantity*>(prop)->getQuantityValue());
+                    return true;
+                }
+                if (prop->isDerivedFrom<PropertyFloat>()) {
+                    setFloat(res, static_cast<const PropertyFloat*>(prop)->getValue());
+                    return true;
+                }
+                if (prop->isDerivedFrom<PropertyInteger>()) {
+                    setInt(res, static_cast<const PropertyInteger*>(prop)->getValue());
+                    return true;
+                }
+                if (prop->isDerivedFrom<PropertyBool>()) {
+                    setBool(res, static_cast<const PropertyBool*>(prop)->getValue());
+                    return true;
+                }
+            }
+        }
+            // any other reference is read through Python
+            [[fallthrough]];
+
+        case Node::Kind::PyValue: {
+            Base::PyGILStateLocker lock;
+            if (!fromPy(node.expr->getPyValue(), res)) {
+                pythonOnly = true;
+                return false;
+            }
+            return true;
+        }
+
+        case Node::Kind::Unary: {
+            CompiledExpression::Value l;
+            return evaluateNode(*node.args[0], l, pythonOnly) && unaryOperator(node.op, l, res);
+        }
+
+        case Node::Kind::Binary: {
+            CompiledExpression::Value l;
+            CompiledExpression::Value r;
+            return evaluateNode(*node.args[0], l, pythonOnly)
+                && evaluateNode(*node.args[1], r, pythonOnly)
+                && binaryOperator(node.op, l, r, res);
+        }
+
+        case Node::Kind::Conditional: {
+            CompiledExpression::Value cond;
+            if (!evaluateNode(*node.args[0], cond, pythonOnly)) {
+                return false;
+            }
+            return evaluateNode(*node.args[isTrue(cond) ? 1 : 2], res, pythonOnly);
+        }
+
+        case Node::Kind::Function: {
+            std::array<Quantity, 3> args;
+            for (std::size_t i = 0; i < node.args.size(); ++i) {
+                CompiledExpression::Value arg;
+                if (!evaluateNode(*node.args[i], arg, pythonOnly)) {
+                    return false;
+                }
+                args[i] = toQuantity(arg);
+            }
+            Quantity value;
+            if (!scalarFunction(node.op, args, node.args.size(), value)) {
+                return false;
+            }
+            setQuantity(res, value);
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+bool CompiledExpression::evaluate(Value& result) const
+{
+    if (!isNative()) {
+        return false;
+    }
+
+    bool needPython = false;
+    try {
+        if (evaluateNode(*root, result, needPython)) {
+            return true;
+        }
+    }
+    catch (Base::Exception&) {
+        // e.g. mismatching units, Python reports it with the expression context
+    }
+    catch (std::exception&) {
+    }
+
+    if (needPython) {
+        pythonOnly = true;
+    }
+    return false;
+}
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef APP_EXPRESSIONCOMPILER_H
+#define APP_EXPRESSIONCOMPILER_H
+
+#include <atomic>
+#include <memory>
+
+#include <App/Expression.h>
+#include <Base/Quantity.h>
+
+namespace App
+{
+
+class DocumentObject;
+
+/**
+ * Native form of an expression.
+ *
+ * The parsed expression tree is lowered into a tree of nodes that evaluates
+ * plain arithmetic on numbers and quantities, comparisons, conditionals, the
+ * scalar functions and references to numeric properties without creating any
+ * Python object. The results are the same as those of Expression::getPyValue(),
+ * including the distinction between integers, floats, booleans and quantities.
+ *
+ * Everything else is left to Python. An expression containing any other kind
+ * of node, e.g. a PyObjectExpression, a string or a function returning a vector,
+ * is not compiled at all. References to other properties, sub-paths and
+ * aggregates are read through Python inside the native tree.
+ *
+ * Whenever the native evaluation cannot reproduce the Python semantics, e.g.
+ * on a division by zero, an integer overflow or mismatching units, evaluate()
+ * returns false and the caller evaluates the expression through Python. This
+ * also produces the usual error message.
+ */
+class AppExport CompiledExpression
+{
+public:
+    /// Result of a native evaluation
+    struct Value
+    {
+        enum class Type
+        {
+            Bool,
+            Int,
+            Float,
+            Quantity,
+        };
+
+        Type type {Type::Int};
+        long intValue {0};
+        double floatValue {0.0};
+        Base::Quantity quantity;
+
+        /// Returns the value as pyObjectToAny() would for the equivalent Python object
+        App::any toAny() const;
+        /// Returns the value as expressionFromPy() would for the equivalent Python object
+        Expression* toExpression(const DocumentObject* owner) const;
+    };
+
+    /// Lowers \a expr, the result is not native if the expression needs Python
+    static std::unique_ptr<CompiledExpression> compile(const Expression* expr);
+
+    ~CompiledExpression();
+
+    /// Returns true if the expression can be evaluated natively
+    bool isNative() const
+    {
+        return root != nullptr && !pythonOnly;
+    }
+
+    /// Evaluates the expression, returns false if it must be evaluated by Python
+    bool evaluate(Value& result) const;
+
+    struct Node;
+
+private:
+    CompiledExpression() = default;
+
+    std::unique_ptr<Node> root;
+    // Set once a referenced property returned a value that can't be used natively
+    mutable std::atomic<bool> pythonOnly {false};
+};
+
+}  // namespace App
+
+#endif  // APP_EXPRESSIONCOMPILER_H
@@ -270,6 +270,21 @@ public:
 
     int priority() const override;
 
+    Expression* getCondition() const
+    {
+        return condition;
+    }
+
+    Expression* getTrueExpression() const
+    {
+        return trueExpr;
+    }
+
+    Expression* getFalseExpression() const
+    {
+        return falseExpr;
+    }
+
 protected:
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
@@ -466,6 +481,12 @@ public:
 
     const App::Property* getProperty() const;
 
+    /// Returns the referenced property if the whole value of it is referenced
+    const App::Property* getWholeProperty() const
+    {
+        return var.getWholeProperty();
+    }
+
     void addComponent(Component* component) override;
 
 protected:
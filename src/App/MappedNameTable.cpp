@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#endif
+
+#include "MappedNameTable.h"
+
+using namespace Data;
+
+namespace
+{
+constexpr std::size_t minCapacity = 16;
+
+// FNV-1a
+constexpr std::uint64_t hashBasis = 14695981039346656037ULL;
+constexpr std::uint64_t hashPrime = 1099511628211ULL;
+
+std::uint64_t hashBytes(std::uint64_t hash, const QByteArray& bytes)
+{
+    const char* data = bytes.constData();
+    for (int i = 0, size = bytes.size(); i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= hashPrime;
+    }
+    return hash;
+}
+
+bool exceedsLoad(std::size_t count, std::size_t capacity)
+{
+    // keep the load factor at or below 3/4
+    return count * 4 > capacity * 3;
+}
+}  // namespace
+
+std::uint64_t MappedNameTable::hashName(const MappedName& name)
+{
+    std::uint64_t hash = hashBytes(hashBytes(hashBasis, name.dataBytes()), name.postfixBytes());
+    return hash != 0 ? hash : 1;
+}
+
+std::size_t MappedNameTable::findSlot(const MappedName& name, std::uint64_t hash) const
+{
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t pos = hash & mask;; pos = (pos + 1) & mask) {
+        const auto& slot = slots[pos];
+        if (slot.hash == 0 || (slot.hash == hash && slot.name == name)) {
+            return pos;
+        }
+    }
+}
+
+const MappedNameTable::Entry* MappedNameTable::find(const MappedName& name) const
+{
+    if (count == 0) {
+        return nullptr;
+    }
+    const auto& slot = slots[findSlot(name, hashName(name))];
+    return slot.hash != 0 ? &slot : nullptr;
+}
+
+std::pair<const MappedNameTable::Entry*, bool> MappedNameTable::insert(const MappedName& name,
+                                                                       const IndexedName& index)
+{
+    if (exceedsLoad(count + 1, slots.size())) {
+        rehash(std::max(minCapacity, slots.size() * 2));
+    }
+    std::uint64_t hash = hashName(name);
+    auto& slot = slots[findSlot(name, hash)];
+    if (slot.hash != 0) {
+        return {&slot, false};
+    }
+    slot.hash = hash;
+    slot.name = name;
+    slot.index = index;
+    ++count;
+    return {&slot, true};
+}
+
+bool MappedNameTable::erase(const MappedName& name)
+{
+    if (count == 0) {
+        return false;
+    }
+    const std::size_t mask = slots.size() - 1;
+    std::size_t hole = findSlot(name, hashName(name));
+    if (slots[hole].hash == 0) {
+        return false;
+    }
+    // Move back every following entry of the probe sequence whose home slot
+    // does not lie between the hole and itself, so lookups never see a gap.
+    for (std::size_t pos = (hole + 1) & mask; slots[pos].hash != 0; pos = (pos + 1) & mask) {
+        std::size_t home = slots[pos].hash & mask;
+        if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+            slots[hole] = std::move(slots[pos]);
+            hole = pos;
+        }
+    }
+    slots[hole] = Entry();
+    --count;
+    return true;
+}
+
+void MappedNameTable::clear()
+{
+    slots.clear();
+    count = 0;
+}
+
+void MappedNameTable::reserve(std::size_t entries)
+{
+    std::size_t capacity = std::max(minCapacity, slots.size());
+    while (exceedsLoad(entries, capacity)) {
+        capacity *= 2;
+    }
+    if (capacity != slots.size()) {
+        rehash(capacity);
+    }
+}
+
+void MappedNameTable::rehash(std::size_t newCapacity)
+{
+    std::vector<Entry> old(newCapacity);
+    old.swap(slots);
+    const std::size_t mask = slots.size() - 1;
+    for (auto& entry : old) {
+        if (entry.hash == 0) {
+            continue;
+        }
+        std::size_t pos = entry.hash & mask;
+        while (slots[pos].hash != 0) {
+            pos = (pos + 1) & mask;
+        }
+        slots[pos] = std::move(entry);
+    }
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef DATA_MAPPEDNAMETABLE_H
+#define DATA_MAPPEDNAMETABLE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "FCGlobal.h"
+#include "IndexedName.h"
+#include "MappedName.h"
+
+namespace Data
+{
+
+/** Flat hash table mapping a MappedName to its IndexedName
+ *
+ * All entries live in one contiguous array using open addressing with linear
+ * probing. Each slot caches the hash of its name, so probing only compares the
+ * names whose hashes are equal, and erasing shifts the following entries back
+ * instead of leaving tombstones behind.
+ *
+ * The hash covers the concatenation of the data and postfix bytes, so that it
+ * is consistent with MappedName::operator==(), which does not care where the
+ * name is split. Most names stored in an element map are already shortened by
+ * App::StringHasher, which keeps the hashed keys short.
+ *
+ * Pointers to entries are invalidated by insert() and erase().
+ */
+class AppExport MappedNameTable
+{
+public:
+    struct Entry
+    {
+        /// Hash of the name, zero for an empty slot
+        std::uint64_t hash = 0;
+        MappedName name;
+        IndexedName index;
+    };
+
+    /** Inserts a mapping from \a name to \a index if \a name is not in the table yet
+     *
+     * @return the entry of the name and true if it was inserted, or the
+     * existing entry and false otherwise.
+     */
+    std::pair<const Entry*, bool> insert(const MappedName& name, const IndexedName& index);
+
+    /// Returns the entry of \a name or nullptr if it is not in the table
+    const Entry* find(const MappedName& name) const;
+
+    /// Removes \a name, returns false if it is not in the table
+    bool erase(const MappedName& name);
+
+    void clear();
+
+    /// Makes room for at least \a entries without rehashing
+    void reserve(std::size_t entries);
+
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    /// Number of slots
+    std::size_t capacity() const
+    {
+        return slots.size();
+    }
+
+    /// Bytes used by the slots, without the name data
+    std::size_t memoryUsage() const
+    {
+        return slots.capacity() * sizeof(Entry);
+    }
+
+    /// Calls \a func with every entry, in no particular order
+    template<typename Func>
+    void forEach(Func func) const
+    {
+        for (const auto& slot : slots) {
+            if (slot.hash != 0) {
+                func(slot);
+            }
+        }
+    }
+
+    /// Hash of the concatenated bytes of \a name, never zero
+    static std::uint64_t hashName(const MappedName& name);
+
+private:
+    std::size_t findSlot(const MappedName& name, std::uint64_t hash) const;
+    void rehash(std::size_t newCapacity);
+
+    std::vector<Entry> slots;
+    std::size_t count = 0;
+};
+
+}  // namespace Data
+
+#endif  // DATA_MAPPEDNAMETABLE_H
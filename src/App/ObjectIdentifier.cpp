@@ -1412,6 +1412,25 @@ Property* ObjectIdentifier::getProperty(int* ptype) const
     return result.resolvedProperty;
 }
 
+/**
+ * @brief Get the property if this object identifier refers to its whole value.
+ * @return Pointer to the property, or 0 if the path is a pseudo property,
+ * refers into the property or cannot be resolved.
+ */
+
+Property* ObjectIdentifier::getWholeProperty() const
+{
+    ResolveResults result(*this);
+    if (!result.resolvedProperty || result.propertyType != PseudoNone
+        || (int)components.size() - result.propertyIndex != 1) {
+        return nullptr;
+    }
+    if (!subObjectName.getString().empty() && !result.resolvedSubObject) {
+        return nullptr;
+    }
+    return result.resolvedProperty;
+}
+
 Property* ObjectIdentifier::resolveProperty(const App::DocumentObject* obj,
                                             const char* propertyName,
                                             App::DocumentObject*& sobj,
@@ -420,6 +420,8 @@ public:
 
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    App::Property* getWholeProperty() const;
+
     App::ObjectIdentifier canonicalPath() const;
 
     // Document-centric functions
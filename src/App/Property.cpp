@@ -232,13 +232,14 @@ struct PropertyCleaner
 
     Property* prop;
 
-    static std::vector<Property*> _RemovedProps;
-    static int _PropCleanerCounter;
+    // per thread, properties may be changed by worker threads of a parallel recompute
+    static thread_local std::vector<Property*> _RemovedProps;
+    static thread_local int _PropCleanerCounter;
 };
 }  // namespace App
 
-std::vector<Property*> PropertyCleaner::_RemovedProps;
-int PropertyCleaner::_PropCleanerCounter = 0;
+thread_local std::vector<Property*> PropertyCleaner::_RemovedProps;
+thread_local int PropertyCleaner::_PropCleanerCounter = 0;
 
 void Property::destroy(Property* p)
 {
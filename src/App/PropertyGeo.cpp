@@ -23,6 +23,9 @@
 
 #include "PreCompiled.h"
 
+#include <zipios++/zipfile.h>
+
+#include <Base/Console.h>
 #include <Base/MatrixPy.h>
 #include <Base/PlacementPy.h>
 #include <Base/Reader.h>
@@ -1291,6 +1294,13 @@ PropertyGeometry::~PropertyGeometry() = default;
 
 TYPESYSTEM_SOURCE_ABSTRACT(App::PropertyComplexGeoData, App::PropertyGeometry)
 
+struct PropertyComplexGeoData::DeferredFile
+{
+    std::shared_ptr<zipios::ZipFile> archive;
+    std::string fileName;
+    int fileVersion;
+};
+
 PropertyComplexGeoData::PropertyComplexGeoData() = default;
 
 PropertyComplexGeoData::~PropertyComplexGeoData() = default;
@@ -1337,7 +1347,9 @@ bool PropertyComplexGeoData::checkElementMapVersion(const char* ver) const
 
 void PropertyComplexGeoData::afterRestore()
 {
-    auto data = getComplexData();
+    // Only the element map restored with the document is checked here, the
+    // deferred data file must not be read for it
+    auto data = peekComplexData();
     if (data && data->isRestoreFailed()) {
         data->resetRestoreFailure();
         auto owner = Base::freecad_dynamic_cast<DocumentObject>(getContainer());
@@ -1348,3 +1360,77 @@ void PropertyComplexGeoData::afterRestore()
     }
     PropertyGeometry::afterRestore();
 }
+
+const Data::ComplexGeoData* PropertyComplexGeoData::peekComplexData() const
+{
+    return getComplexData();
+}
+
+bool PropertyComplexGeoData::canRestoreDocFileDeferred() const
+{
+    return false;
+}
+
+void PropertyComplexGeoData::deferRestoreDocFile(const std::shared_ptr<zipios::ZipFile>& archive,
+                                                 const std::string& fileName,
+                                                 int fileVersion)
+{
+    std::lock_guard<std::recursive_mutex> lock(deferredMutex);
+    deferredFile = std::make_unique<DeferredFile>(DeferredFile {archive, fileName, fileVersion});
+    deferred = true;
+}
+
+bool PropertyComplexGeoData::isRestoreDeferred() const
+{
+    return deferred;
+}
+
+void PropertyComplexGeoData::restoreDeferred() const
+{
+    if (!deferred) {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(deferredMutex);
+    // already read by another thread or a nested call
+    if (!deferredFile) {
+        return;
+    }
+
+    std::unique_ptr<DeferredFile> file = std::move(deferredFile);
+    try {
+        std::unique_ptr<std::istream> str(file->archive->getInputStream(file->fileName));
+        if (str) {
+            Base::Reader reader(*str, file->fileName, file->fileVersion);
+            const_cast<PropertyComplexGeoData*>(this)->RestoreDocFileDeferred(reader);
+        }
+    }
+    catch (...) {
+        // keep the file, so that the data isn't taken as restored
+        Base::Console().Error("Reading failed from embedded file: %s\n", file->fileName.c_str());
+        deferredFile = std::move(file);
+        throw;
+    }
+    deferred = false;
+}
+
+void PropertyComplexGeoData::RestoreDocFileDeferred(Base::Reader& reader)
+{
+    RestoreDocFile(reader);
+}
+
+void PropertyComplexGeoData::aboutToSetValue()
+{
+    // A modification may change the data only partially and an undo transaction
+    // copies the old value, so the deferred data is read first. If it can't be read
+    // the new value replaces the data like after a failed restore.
+    try {
+        restoreDeferred();
+    }
+    catch (...) {
+        std::lock_guard<std::recursive_mutex> lock(deferredMutex);
+        deferredFile.reset();
+        deferred = false;
+    }
+    PropertyGeometry::aboutToSetValue();
+}
@@ -33,12 +33,21 @@
 #include "PropertyLinks.h"
 #include <FCGlobal.h>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 
 namespace Base
 {
 class Writer;
 }
 
+namespace zipios
+{
+class ZipFile;
+}
+
 namespace Data
 {
 class ComplexGeoData;
@@ -574,6 +583,50 @@ public:
     virtual bool checkElementMapVersion(const char* ver) const;
 
     void afterRestore() override;
+
+    /** @name Deferred restore
+     * The data file of the property may be read on first access to the data instead
+     * of when the document is restored. All accessors of the data in a subclass must
+     * call restoreDeferred() first.
+     */
+    //@{
+    /// Returns true if the data file may be read on first access to the data
+    virtual bool canRestoreDocFileDeferred() const;
+    /// Defers reading the data file \a fileName from \a archive until the data is accessed
+    void deferRestoreDocFile(const std::shared_ptr<zipios::ZipFile>& archive,
+                             const std::string& fileName,
+                             int fileVersion);
+    /// Returns true if the data file has not been read yet
+    bool isRestoreDeferred() const;
+    /** Reads the data file if reading it was deferred
+     *
+     * If reading fails the data file stays deferred and the exception is passed on.
+     */
+    void restoreDeferred() const;
+    //@}
+
+protected:
+    /** Returns the data without reading a deferred data file
+     *
+     * Subclasses that defer reading their data file must override it. The default
+     * implementation calls getComplexData().
+     */
+    virtual const Data::ComplexGeoData* peekComplexData() const;
+    /** Reads the deferred data file
+     *
+     * Unlike RestoreDocFile() the data must be read without notifying the container,
+     * the property only gets the value the document was restored with. The default
+     * implementation calls RestoreDocFile().
+     */
+    virtual void RestoreDocFileDeferred(Base::Reader& reader);
+    void aboutToSetValue() override;
+
+private:
+    struct DeferredFile;
+    mutable std::unique_ptr<DeferredFile> deferredFile;
+    mutable std::atomic<bool> deferred {false};
+    // the data may be accessed by worker threads, a nested call may happen while reading
+    mutable std::recursive_mutex deferredMutex;
 };
 
 }  // namespace App
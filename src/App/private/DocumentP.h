@@ -30,9 +30,16 @@
 #include <App/DocumentObject.h>
 #include <App/DocumentObserver.h>
 #include <App/StringHasher.h>
+#include <Base/Profiler.h>
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -58,6 +65,30 @@ namespace App
 using HasherMap = boost::bimap<StringHasherRef, int>;
 class Transaction;
 
+/// State shared by the main thread and the worker threads of a parallel recompute
+struct ParallelRecompute
+{
+    /// A function forwarded by a worker thread to be run in the main thread
+    struct Call
+    {
+        const std::function<void()>* func;
+        std::exception_ptr error;
+        bool done {false};
+    };
+
+    std::thread::id mainThread {std::this_thread::get_id()};
+    std::mutex mutex;
+    std::condition_variable cond;
+    /// indices of the objects finished by a worker thread
+    std::deque<std::size_t> finished;
+    std::deque<Call*> calls;
+
+    /// called by a worker thread, blocks until \a func was run in the main thread
+    void callInMainThread(const std::function<void()>& func);
+    /// called by the main thread, runs the forwarded functions
+    void processCalls(std::unique_lock<std::mutex>& lock);
+};
+
 // Pimpl class
 struct DocumentP
 {
@@ -93,6 +124,8 @@ struct DocumentP
         _RecomputeLog;
 
     StringHasherRef Hasher;
+    ParallelRecompute* parallelRecompute {nullptr};
+    Base::Profiler profiler;
 
     DocumentP();
 
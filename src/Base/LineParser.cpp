@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <cerrno>
+#include <cstdlib>
+#include <istream>
+#endif
+
+// defines __cpp_lib_to_chars if from_chars() supports floating point numbers
+#include <charconv>
+
+#include "LineParser.h"
+
+
+using namespace Base;
+
+namespace
+{
+
+bool isDigit(char ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+std::size_t skipDigits(std::string_view token, std::size_t pos)
+{
+    while (pos < token.size() && isDigit(token[pos])) {
+        ++pos;
+    }
+    return pos;
+}
+
+std::size_t skipSign(std::string_view token, std::size_t pos)
+{
+    if (pos < token.size() && (token[pos] == '-' || token[pos] == '+')) {
+        ++pos;
+    }
+    return pos;
+}
+
+/** Checks for the grammar [-+]?([0-9]+|[0-9]*\.[0-9]+)([eE][-+]?[0-9]+)? if \a pointWithoutDigits
+ * is false, otherwise a point directly before the exponent or the end is accepted, too.
+ */
+bool isNumber(std::string_view token, bool pointWithoutDigits)
+{
+    std::size_t pos = skipSign(token, 0);
+    std::size_t start = pos;
+    pos = skipDigits(token, pos);
+    std::size_t intDigits = pos - start;
+    if (pos < token.size() && token[pos] == '.') {
+        start = ++pos;
+        pos = skipDigits(token, pos);
+        std::size_t fracDigits = pos - start;
+        if (fracDigits == 0 && (!pointWithoutDigits || intDigits == 0)) {
+            return false;
+        }
+    }
+    else if (intDigits == 0) {
+        return false;
+    }
+
+    if (pos < token.size() && (token[pos] == 'e' || token[pos] == 'E')) {
+        pos = skipSign(token, pos + 1);
+        start = pos;
+        pos = skipDigits(token, pos);
+        if (pos == start) {
+            return false;
+        }
+    }
+
+    return pos == token.size();
+}
+
+// from_chars() doesn't accept a leading plus sign
+std::string_view skipPlus(std::string_view token)
+{
+    if (!token.empty() && token.front() == '+') {
+        token.remove_prefix(1);
+    }
+    return token;
+}
+
+#if !defined(__cpp_lib_to_chars)
+template<typename T>
+T strtoReal(const char* str, char** end);
+
+template<>
+float strtoReal<float>(const char* str, char** end)
+{
+    return std::strtof(str, end);
+}
+
+template<>
+double strtoReal<double>(const char* str, char** end)
+{
+    return std::strtod(str, end);
+}
+
+// The token is copied because the C functions need a terminated string
+template<typename T>
+std::errc toRealTerminated(std::string_view token, T& value)
+{
+    std::string str(token);
+    char* end = nullptr;
+    errno = 0;
+    T result = strtoReal<T>(str.c_str(), &end);
+    if (end != str.c_str() + str.size()) {
+        return std::errc::invalid_argument;
+    }
+    if (errno == ERANGE) {
+        return std::errc::result_out_of_range;
+    }
+    value = result;
+    return {};
+}
+#endif
+
+template<typename T>
+std::errc toReal(std::string_view token, T& value)
+{
+#if defined(__cpp_lib_to_chars)
+    token = skipPlus(token);
+    auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+    if (result.ec == std::errc() && result.ptr != token.data() + token.size()) {
+        return std::errc::invalid_argument;
+    }
+    return result.ec;
+#else
+    return toRealTerminated(token, value);
+#endif
+}
+
+template<typename T>
+bool toInteger(std::string_view token, T& value)
+{
+    token = skipPlus(token);
+    auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+    return result.ec == std::errc() && result.ptr == token.data() + token.size();
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+LineBlockReader::LineBlockReader(std::istream& input, std::size_t blockSize)
+    : input(input)
+    , blockSize(blockSize)
+{}
+
+bool LineBlockReader::next()
+{
+    lineViews.clear();
+    buffer.swap(carry);
+    carry.clear();
+
+    // read until the block contains at least one line break, unless the stream ends before
+    while (input) {
+        std::size_t size = buffer.size();
+        buffer.resize(size + blockSize);
+        input.read(&buffer[size], static_cast<std::streamsize>(blockSize));
+        buffer.resize(size + static_cast<std::size_t>(input.gcount()));
+
+        std::size_t lineEnd = buffer.rfind('\n');
+        if (lineEnd != std::string::npos && lineEnd >= size) {
+            carry.assign(buffer, lineEnd + 1, std::string::npos);
+            buffer.resize(lineEnd + 1);
+            break;
+        }
+    }
+
+    numBytes += buffer.size();
+    std::string_view text(buffer);
+    while (!text.empty()) {
+        std::size_t lineEnd = text.find('\n');
+        if (lineEnd == std::string_view::npos) {
+            lineViews.push_back(text);
+            break;
+        }
+        lineViews.push_back(text.substr(0, lineEnd));
+        text.remove_prefix(lineEnd + 1);
+    }
+
+    return !lineViews.empty();
+}
+
+// ----------------------------------------------------------------------------
+
+bool LineScanner::skipSpace()
+{
+    std::size_t start = pos;
+    while (pos < line.size() && isSpace(line[pos])) {
+        ++pos;
+    }
+    return pos > start;
+}
+
+bool LineScanner::atEnd()
+{
+    skipSpace();
+    return pos == line.size();
+}
+
+bool LineScanner::keyword(std::string_view keyword, bool ignoreCase)
+{
+    if (line.size() - pos <= keyword.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < keyword.size(); i++) {
+        char ch = line[pos + i];
+        if (ignoreCase && ch >= 'a' && ch <= 'z') {
+            ch = static_cast<char>(ch - 'a' + 'A');
+        }
+        if (ch != keyword[i]) {
+            return false;
+        }
+    }
+    if (!isSpace(line[pos + keyword.size()])) {
+        return false;
+    }
+    pos += keyword.size();
+    return true;
+}
+
+std::string_view LineScanner::token()
+{
+    skipSpace();
+    std::size_t start = pos;
+    while (pos < line.size() && !isSpace(line[pos])) {
+        ++pos;
+    }
+    return line.substr(start, pos - start);
+}
+
+bool LineScanner::parseDecimal(std::string_view token, double& value)
+{
+    if (!isNumber(token, false)) {
+        return false;
+    }
+    // std::atof() returns the overflown or underflown value
+    std::errc error = toReal(token, value);
+    if (error == std::errc::result_out_of_range) {
+        value = std::strtod(std::string(token).c_str(), nullptr);
+        return true;
+    }
+    return error == std::errc();
+}
+
+bool LineScanner::parseNumber(std::string_view token, float& value)
+{
+    return isNumber(token, true) && toReal(token, value) == std::errc();
+}
+
+bool LineScanner::parseNumber(std::string_view token, double& value)
+{
+    return isNumber(token, true) && toReal(token, value) == std::errc();
+}
+
+bool LineScanner::parseNumber(std::string_view token, int& value)
+{
+    std::size_t pos = skipSign(token, 0);
+    return pos < token.size() && isDigit(token[pos]) && toInteger(token, value);
+}
+
+bool LineScanner::parseNumber(std::string_view token, unsigned int& value)
+{
+    // a stream accepts a sign for unsigned values but wraps negative ones around
+    return !token.empty() && isDigit(token.front()) && toInteger(token, value);
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_LINEPARSER_H
+#define BASE_LINEPARSER_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace Base
+{
+
+/** Reads a text stream in large blocks of complete lines.
+ *
+ * Reading starts at the current position of the stream. The lines are split like
+ * std::getline() does, i.e. without the '\n' and with a final line only if it isn't empty.
+ * The lines of a block stay valid until the next call of next().
+ */
+class BaseExport LineBlockReader
+{
+public:
+    static constexpr std::size_t defaultBlockSize = std::size_t(8) << 20;
+
+    explicit LineBlockReader(std::istream& input, std::size_t blockSize = defaultBlockSize);
+
+    /// Reads the next block, returns false if there are no lines left
+    bool next();
+
+    const std::vector<std::string_view>& lines() const
+    {
+        return lineViews;
+    }
+    /// Returns the number of bytes of all blocks read so far
+    std::size_t bytesRead() const
+    {
+        return numBytes;
+    }
+
+private:
+    std::istream& input;
+    std::size_t blockSize;
+    std::size_t numBytes {0};
+    std::string buffer;
+    std::string carry;
+    std::vector<std::string_view> lineViews;
+};
+
+/** Scans the whitespace separated tokens of a line.
+ *
+ * Whitespace is what std::isspace() returns in the "C" locale, so a trailing '\r' of a
+ * file with Windows line endings is ignored.
+ *
+ * The number parsers accept exactly the grammar of the regular expressions or stream
+ * extractions they replace in the mesh and point cloud readers and return the same values.
+ * They return false for anything else, including values out of range, so that a reader can
+ * fall back to its former handling of the line.
+ */
+class BaseExport LineScanner
+{
+public:
+    explicit LineScanner(std::string_view line)
+        : line(line)
+    {}
+
+    static bool isSpace(char ch)
+    {
+        return ch == ' ' || (ch >= '\t' && ch <= '\r');
+    }
+
+    /// Skips whitespace, returns true if at least one character was skipped
+    bool skipSpace();
+    /// Returns true if there is nothing but whitespace left
+    bool atEnd();
+    /** Consumes \a keyword if it is followed by at least one whitespace character.
+     * Leading whitespace must be skipped before if it is allowed. If \a ignoreCase is true
+     * \a keyword must be upper case.
+     */
+    bool keyword(std::string_view keyword, bool ignoreCase = false);
+    /// Skips whitespace and returns the next token, an empty token at the end of the line
+    std::string_view token();
+    /// Returns the unscanned rest of the line
+    std::string_view rest() const
+    {
+        return line.substr(pos);
+    }
+
+    /** Parses a token of the form [-+]?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)? like std::atof(),
+     * values out of range included.
+     */
+    static bool parseDecimal(std::string_view token, double& value);
+    /// Parses a token like operator>>() of a stream does, values out of range are rejected
+    static bool parseNumber(std::string_view token, float& value);
+    static bool parseNumber(std::string_view token, double& value);
+    static bool parseNumber(std::string_view token, int& value);
+    static bool parseNumber(std::string_view token, unsigned int& value);
+
+private:
+    std::string_view line;
+    std::size_t pos = 0;
+};
+
+}  // namespace Base
+
+#endif  // BASE_LINEPARSER_H
@@ -26,8 +26,10 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <memory>
+#include <mutex>
 #include <xercesc/dom/DOM.hpp>
 #include <xercesc/framework/LocalFileFormatTarget.hpp>
 #include <xercesc/framework/LocalFileInputSource.hpp>
@@ -38,6 +40,8 @@
 #include <xercesc/sax/SAXParseException.hpp>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #endif
 
@@ -156,6 +160,77 @@ public:
     void operator=(DOMPrintErrorHandler&&) = delete;
 };
 
+/** Cache of the typed parameter values of a group
+ *
+ * There is one hash map per parameter type. An entry is created on the first
+ * lookup of a parameter and remembers whether it exists, so reading a missing
+ * parameter doesn't search the DOM again either. The key is a view on the name
+ * owned by the entry, so a lookup doesn't allocate.
+ *
+ * The cache has its own lock because parameters are read from worker threads.
+ */
+class ParameterValueCache
+{
+public:
+    using ParamType = ParameterGrp::ParamType;
+
+    struct Entry
+    {
+        std::string name;
+        bool exists {false};
+        bool boolValue {false};
+        long intValue {0};
+        unsigned long uintValue {0};
+        double floatValue {0.0};
+        std::string textValue;
+    };
+
+    /** Returns the cached value of \a name or \a preset if the parameter doesn't exist
+     *
+     * On a cache miss \a read is called to fill in the entry from the DOM.
+     */
+    template<typename T, typename Read>
+    T get(ParamType type, const char* name, T preset, T Entry::*member, Read&& read)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Map& map = maps[static_cast<std::size_t>(type)];
+        auto it = map.find(std::string_view(name));
+        if (it == map.end()) {
+            auto entry = std::make_unique<Entry>();
+            entry->name = name;
+            read(*entry);
+            std::string_view key(entry->name);
+            it = map.emplace(key, std::move(entry)).first;
+        }
+        const Entry& entry = *it->second;
+        return entry.exists ? entry.*member : preset;
+    }
+
+    /// Drops the entry of \a name, or all entries if \a name is null
+    void erase(ParamType type, const char* name)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!name || type == ParamType::FCGroup) {
+            for (auto& map : maps) {
+                map.clear();
+            }
+            return;
+        }
+        maps[static_cast<std::size_t>(type)].erase(std::string_view(name));
+    }
+
+    void clear()
+    {
+        erase(ParamType::FCInvalid, nullptr);
+    }
+
+private:
+    using Map = std::unordered_map<std::string_view, std::unique_ptr<Entry>>;
+
+    std::mutex mutex;
+    std::array<Map, static_cast<std::size_t>(ParamType::FCGroup) + 1> maps;
+};
+
 
 inline bool DOMTreeErrorReporter::getSawErrors() const
 {
@@ -180,6 +255,7 @@ ParameterGrp::ParameterGrp(XERCES_CPP_NAMESPACE_QUALIFIER DOMElement* GroupNode,
                            ParameterGrp* Parent)
     : _pGroupNode(GroupNode)
     , _Parent(Parent)
+    , _Cache(std::make_unique<ParameterValueCache>())
 {
     if (sName) {
         _cName = sName;
@@ -432,6 +508,12 @@ Base::Reference<ParameterGrp> ParameterGrp::_GetGroup(const char* Name)
         return rParamGrp;
     }
 
+    // a known group that is still attached to this one needs no DOM lookup
+    auto it = _GroupMap.find(Name);
+    if (it != _GroupMap.end() && it->second.isValid() && !it->second->_Detached) {
+        return it->second;
+    }
+
     DOMElement* pcTemp {};
 
     // search if Group node already there
@@ -678,6 +760,8 @@ ParameterGrp::GetAttributeMap(ParamType Type, const char* sFilter) const
 
 void ParameterGrp::_Notify(ParamType Type, const char* Name, const char* Value)
 {
+    // drop the cached value before any observer can read it
+    _Cache->erase(Type, Name);
     if (_Manager) {
         _Manager->signalParamChanged(this, Type, Name, Value);
     }
@@ -713,6 +797,10 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
             // trigger observer
             _Notify(T, Name, Value);
         }
+        else {
+            // the element may have been created just now with an empty value
+            _Cache->erase(T, Name);
+        }
         // For backward compatibility, old observer gets notified regardless of
         // value changes or not.
         Notify(Name);
@@ -725,16 +813,23 @@ bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
         return bPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return preset
-    if (!pcElem) {
-        return bPreset;
-    }
-
-    // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), "1")
-            == 0);
+    return _Cache->get(ParamType::FCBool,
+                       Name,
+                       bPreset,
+                       &ParameterValueCache::Entry::boolValue,
+                       [this, Name](ParameterValueCache::Entry& entry) {
+                           // check if Element in group
+                           DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
+                           if (pcElem) {
+                               entry.exists = true;
+                               entry.boolValue =
+                                   strcmp(StrX(pcElem->getAttribute(
+                                                   XStrLiteral("Value").unicodeForm()))
+                                              .c_str(),
+                                          "1")
+                                   == 0;
+                           }
+                       });
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -804,14 +899,20 @@ long ParameterGrp::GetInt(const char* Name, long lPreset) const
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-    // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return _Cache->get(
+        ParamType::FCInt,
+        Name,
+        lPreset,
+        &ParameterValueCache::Entry::intValue,
+        [this, Name](ParameterValueCache::Entry& entry) {
+            // check if Element in group
+            DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
+            if (pcElem) {
+                entry.exists = true;
+                entry.intValue =
+                    atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+            }
+        });
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -873,18 +974,23 @@ unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset)
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-
-    // if yes check the value and return
-    const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(),
-                   nullptr,
-                   base);
+    return _Cache->get(
+        ParamType::FCUInt,
+        Name,
+        lPreset,
+        &ParameterValueCache::Entry::uintValue,
+        [this, Name](ParameterValueCache::Entry& entry) {
+            // check if Element in group
+            DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
+            if (pcElem) {
+                const int base = 10;
+                entry.exists = true;
+                entry.uintValue =
+                    strtoul(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(),
+                            nullptr,
+                            base);
+            }
+        });
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -953,14 +1059,20 @@ double ParameterGrp::GetFloat(const char* Name, double dPreset) const
         return dPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
-        return dPreset;
-    }
-    // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return _Cache->get(
+        ParamType::FCFloat,
+        Name,
+        dPreset,
+        &ParameterValueCache::Entry::floatValue,
+        [this, Name](ParameterValueCache::Entry& entry) {
+            // check if Element in group
+            DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
+            if (pcElem) {
+                entry.exists = true;
+                entry.floatValue =
+                    atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+            }
+        });
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1065,21 +1177,21 @@ std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
         return pPreset ? pPreset : "";
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
-        if (!pPreset) {
-            return {};
-        }
-        return {pPreset};
-    }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
-    }
-    return {};
+    return _Cache->get(ParamType::FCText,
+                       Name,
+                       std::string(pPreset ? pPreset : ""),
+                       &ParameterValueCache::Entry::textValue,
+                       [this, Name](ParameterValueCache::Entry& entry) {
+                           // check if Element in group
+                           DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
+                           if (pcElem) {
+                               entry.exists = true;
+                               DOMNode* pcElem2 = pcElem->getFirstChild();
+                               if (pcElem2) {
+                                   entry.textValue = StrXUTF8(pcElem2->getNodeValue()).c_str();
+                               }
+                           }
+                       });
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1541,11 +1653,20 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    _Cache->clear();
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
 }
 
+void ParameterGrp::_ClearCache()
+{
+    _Cache->clear();
+    for (auto& v : _GroupMap) {
+        v.second->_ClearCache();
+    }
+}
+
 //**************************************************************************
 //**************************************************************************
 // ParameterSerializer
@@ -1870,6 +1991,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
     }
 
     _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    _ClearCache();
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1996,6 +2118,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStrLiteral("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStrLiteral("Name").unicodeForm(), XStrLiteral("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _ClearCache();
 }
 
 void ParameterManager::CheckDocument() const
@@ -50,6 +50,7 @@ using PyObject = struct _object;
 #endif
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <boost_signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -87,6 +88,7 @@ XERCES_CPP_NAMESPACE_END
 #endif
 
 class ParameterManager;
+class ParameterValueCache;
 
 
 /** The parameter container class
@@ -344,6 +346,8 @@ protected:
     bool ShouldRemove() const;
 
     void _Reset();
+    /// drops the cached values of this group and all its sub-groups
+    void _ClearCache();
 
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
@@ -387,7 +391,7 @@ protected:
     /// the own name
     std::string _cName;
     /// map of already exported groups
-    std::map<std::string, Base::Reference<ParameterGrp>> _GroupMap;
+    std::map<std::string, Base::Reference<ParameterGrp>, std::less<>> _GroupMap;
     ParameterGrp* _Parent = nullptr;
     ParameterManager* _Manager = nullptr;
     /// Means this group xml element has not been added to its parent yet.
@@ -397,6 +401,12 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+    /** Typed values of the parameters read so far
+     *
+     * Parameters are looked up in the DOM on first access only. Entries are
+     * dropped in _Notify() whenever a parameter changes.
+     */
+    std::unique_ptr<ParameterValueCache> _Cache;
 };
 
 /** The parameter serializer class
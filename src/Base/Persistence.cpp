@@ -69,9 +69,24 @@ void Persistence::Restore(XMLReader& /*reader*/)
 void Persistence::SaveDocFile(Writer& /*writer*/) const
 {}
 
+bool Persistence::canSaveDocFileConcurrently(const Writer& /*writer*/) const
+{
+    return false;
+}
+
 void Persistence::RestoreDocFile(Reader& /*reader*/)
 {}
 
+bool Persistence::canRestoreDocFileConcurrently() const
+{
+    return false;
+}
+
+std::function<void()> Persistence::RestoreDocFileConcurrently(Reader& /*reader*/)
+{
+    return {};
+}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
     std::string tmp;
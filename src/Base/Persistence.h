@@ -24,6 +24,8 @@
 #ifndef APP_PERSISTENCE_H
 #define APP_PERSISTENCE_H
 
+#include <functional>
+
 #include "BaseClass.h"
 
 namespace Base
@@ -112,6 +114,15 @@ public:
      * ostream).
      */
     virtual void SaveDocFile(Writer& /*writer*/) const;
+    /** This method tells whether SaveDocFile() can be called from a worker thread.
+     * If a Base::ZipWriter writes its additional files concurrently, the files of
+     * objects returning true are serialized and compressed by worker threads. In this
+     * case SaveDocFile() must only read the object's own data and must only use the
+     * passed writer. The files of all other objects are serialized in the calling
+     * thread and only compressed by worker threads. The default implementation
+     * returns false.
+     */
+    virtual bool canSaveDocFileConcurrently(const Writer& /*writer*/) const;
     /** This method is used to restore large amounts of data from a file
      * In this method you simply stream in your SaveDocFile() saved data.
      * Again you have to apply for the call of this method in the Restore() call:
@@ -142,6 +153,18 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** This method tells whether RestoreDocFileConcurrently() can be used instead of
+     * RestoreDocFile(). The default implementation returns false.
+     */
+    virtual bool canRestoreDocFileConcurrently() const;
+    /** This method is used to read an additional file in a worker thread.
+     * If a Base::XMLReader restores its files concurrently, this method is called
+     * instead of RestoreDocFile() for objects returning true in
+     * canRestoreDocFileConcurrently(). It must only parse the reader into temporary
+     * data and must not modify the object. The returned function is then called in
+     * the main thread, in the order the files were registered, to apply the data.
+     */
+    virtual std::function<void()> RestoreDocFileConcurrently(Reader& reader);
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
 
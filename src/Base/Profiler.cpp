@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <cstdio>
+#include <ostream>
+#include <string>
+#endif
+
+#include "Profiler.h"
+
+using namespace Base;
+
+namespace
+{
+thread_local Profiler* currentProfiler = nullptr;
+thread_local int currentDepth = 0;
+thread_local int threadNumber = 0;
+std::atomic<int> threadCount {0};
+
+int getThreadNumber()
+{
+    if (threadNumber == 0) {
+        threadNumber = ++threadCount;
+    }
+    return threadNumber;
+}
+
+void writeJsonString(std::ostream& str, const std::string& text)
+{
+    str << '"';
+    for (char ch : text) {
+        switch (ch) {
+            case '"':
+                str << "\\\"";
+                break;
+            case '\\':
+                str << "\\\\";
+                break;
+            case '\n':
+                str << "\\n";
+                break;
+            case '\t':
+                str << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(ch) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(ch));
+                    str << buf;
+                }
+                else {
+                    str << ch;
+                }
+        }
+    }
+    str << '"';
+}
+
+// Microseconds with a fixed precision, the default stream format switches to exponents
+std::string formatTime(double time)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.3f", time);
+    return buf;
+}
+
+void writeCsvField(std::ostream& str, const std::string& text)
+{
+    if (text.find_first_of(",\"\n") == std::string::npos) {
+        str << text;
+        return;
+    }
+    str << '"';
+    for (char ch : text) {
+        if (ch == '"') {
+            str << '"';
+        }
+        str << ch;
+    }
+    str << '"';
+}
+}  // namespace
+
+Profiler::Profiler()
+    : epoch(Clock::now())
+{}
+
+void Profiler::setEnabled(bool on)
+{
+    enabled = on;
+}
+
+void Profiler::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    events.clear();
+    epoch = Clock::now();
+}
+
+std::vector<Profiler::Event> Profiler::getEvents() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return events;
+}
+
+void Profiler::exportChromeTrace(std::ostream& str) const
+{
+    auto list = getEvents();
+    str << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& event : list) {
+        str << (first ? "\n" : ",\n");
+        first = false;
+        str << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+            << ",\"ts\":" << formatTime(event.start) << ",\"dur\":" << formatTime(event.duration)
+            << ",\"cat\":";
+        writeJsonString(str, event.category);
+        str << ",\"name\":";
+        writeJsonString(str, event.name);
+        if (!event.type.empty()) {
+            str << ",\"args\":{\"type\":";
+            writeJsonString(str, event.type);
+            str << '}';
+        }
+        str << '}';
+    }
+    str << "\n]}\n";
+}
+
+void Profiler::exportCsv(std::ostream& str) const
+{
+    auto list = getEvents();
+    str << "category,name,type,thread,depth,start_us,duration_us\n";
+    for (const auto& event : list) {
+        writeCsvField(str, event.category);
+        str << ',';
+        writeCsvField(str, event.name);
+        str << ',';
+        writeCsvField(str, event.type);
+        str << ',' << event.thread << ',' << event.depth << ',' << formatTime(event.start) << ','
+            << formatTime(event.duration) << '\n';
+    }
+}
+
+Profiler* Profiler::current()
+{
+    return currentProfiler;
+}
+
+Profiler::Activate::Activate(Profiler* profiler)
+    : previous(currentProfiler)
+{
+    currentProfiler = profiler;
+}
+
+Profiler::Activate::~Activate()
+{
+    currentProfiler = previous;
+}
+
+Profiler::Scope::Scope(const char* category, const char* name, const char* type)
+    : profiler(currentProfiler)
+{
+    if (!profiler || !profiler->isEnabled()) {
+        profiler = nullptr;
+        return;
+    }
+    event.category = category ? category : "";
+    event.name = name ? name : "";
+    event.type = type ? type : "";
+    event.thread = getThreadNumber();
+    event.depth = currentDepth++;
+    begin = Clock::now();
+}
+
+Profiler::Scope::~Scope()
+{
+    if (!profiler) {
+        return;
+    }
+    auto end = Clock::now();
+    --currentDepth;
+    using Microseconds = std::chrono::duration<double, std::micro>;
+    event.duration = Microseconds(end - begin).count();
+    {
+        std::lock_guard<std::mutex> lock(profiler->mutex);
+        event.start = Microseconds(begin - profiler->epoch).count();
+        profiler->events.push_back(std::move(event));
+    }
+}
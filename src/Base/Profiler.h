@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_PROFILER_H
+#define BASE_PROFILER_H
+
+#include <FCGlobal.h>
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Base
+{
+
+/**
+ * Collects timed and nested scopes, e.g. the objects of a document recompute.
+ *
+ * A thread records into the profiler activated on it with Profiler::Activate,
+ * so code that doesn't know the owner of the profiler, e.g. a boolean operation
+ * inside a feature, can add its phases with FC_PROFILE_SCOPE(). A scope costs a
+ * thread local lookup if no enabled profiler is active.
+ *
+ * @code
+ *  Base::Profiler::Activate active(&profiler);
+ *  {
+ *      FC_PROFILE_SCOPE("boolean", "Fuse");
+ *      ...
+ *  }
+ * @endcode
+ *
+ * The events can be exported as Chrome trace, to be loaded by chrome://tracing
+ * or https://ui.perfetto.dev, or as CSV.
+ */
+class BaseExport Profiler
+{
+public:
+    struct Event
+    {
+        /// Category of the event, e.g. "recompute" or "boolean"
+        std::string category;
+        /// Name of the event, e.g. the name of an object
+        std::string name;
+        /// Optional type of the profiled item, e.g. the type of an object
+        std::string type;
+        /// Start time in microseconds since the profiler was created or cleared
+        double start {0.0};
+        /// Wall time in microseconds
+        double duration {0.0};
+        /// Number of the recording thread, the first thread recording anything is 1
+        int thread {0};
+        /// Number of enclosing scopes on the same thread
+        int depth {0};
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    Profiler();
+
+    void setEnabled(bool on);
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /// Discards all events and restarts the time
+    void clear();
+
+    /// Returns the finished events, in the order their scopes ended
+    std::vector<Event> getEvents() const;
+
+    /// Writes the events in the Chrome trace event JSON format
+    void exportChromeTrace(std::ostream& str) const;
+    /// Writes the events as comma separated values with a header line
+    void exportCsv(std::ostream& str) const;
+
+    /// Returns the profiler activated on the calling thread, or nullptr
+    static Profiler* current();
+
+    /// Activates a profiler on the calling thread for the lifetime of this object
+    class BaseExport Activate
+    {
+    public:
+        explicit Activate(Profiler* profiler);
+        ~Activate();
+
+        Activate(const Activate&) = delete;
+        Activate(Activate&&) = delete;
+        Activate& operator=(const Activate&) = delete;
+        Activate& operator=(Activate&&) = delete;
+
+    private:
+        Profiler* previous;
+    };
+
+    /// Records its lifetime as an event of the profiler activated on the calling thread
+    class BaseExport Scope
+    {
+    public:
+        Scope(const char* category, const char* name, const char* type = nullptr);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        Profiler* profiler;
+        Event event;
+        Clock::time_point begin;
+    };
+
+private:
+    mutable std::mutex mutex;
+    std::vector<Event> events;
+    Clock::time_point epoch;
+    std::atomic<bool> enabled {false};
+};
+
+}  // namespace Base
+
+#define FC_PROFILE_CONCAT_(_a, _b) _a##_b
+#define FC_PROFILE_CONCAT(_a, _b) FC_PROFILE_CONCAT_(_a, _b)
+
+/// Records the rest of the enclosing block in the profiler active on the thread
+#define FC_PROFILE_SCOPE(_category, _name)                                                         \
+    Base::Profiler::Scope FC_PROFILE_CONCAT(_fc_profile_scope_, __LINE__)(_category, _name)
+
+#endif  // BASE_PROFILER_H
@@ -28,6 +28,8 @@
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #endif
 
+#include <condition_variable>
+#include <deque>
 #include <locale>
 
 #include "Reader.h"
@@ -38,11 +40,13 @@
 #include "Persistence.h"
 #include "Sequencer.h"
 #include "Stream.h"
+#include "ThreadPool.h"
 #include "XMLTools.h"
 
 #ifdef _MSC_VER
 #include <zipios++/zipios-config.h>
 #endif
+#include <zipios++/inflateinputstreambuf.h>
 #include <zipios++/zipinputstream.h>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -391,8 +395,28 @@ void Base::XMLReader::readBinFile(const char* filename)
     to.close();
 }
 
+void Base::XMLReader::setConcurrentFiles(unsigned int threads, std::size_t bufferSize)
+{
+#ifndef FC_USE_EXTERNAL_ZIPIOS
+    concurrentFiles = true;
+    concurrentThreads = threads;
+    concurrentBufferSize = bufferSize;
+#else
+    // an external zipios++ cannot read entries without inflating them
+    (void)threads;
+    (void)bufferSize;
+#endif
+}
+
 void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
 {
+#ifndef FC_USE_EXTERNAL_ZIPIOS
+    if (concurrentFiles) {
+        readFilesConcurrently(zipstream);
+        return;
+    }
+#endif
+
     // It's possible that not all objects inside the document could be created, e.g. if a module
     // is missing that would know these object types. So, there may be data files inside the zip
     // file that cannot be read. We simply ignore these files.
@@ -456,6 +480,199 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
     }
 }
 
+#ifndef FC_USE_EXTERNAL_ZIPIOS
+namespace
+{
+// Reads from a memory buffer
+class MemoryStreambuf: public std::streambuf
+{
+public:
+    explicit MemoryStreambuf(std::string& data)
+    {
+        setg(data.data(), data.data(), data.data() + data.size());
+    }
+
+protected:
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode /*mode*/ = std::ios::in) override
+    {
+        off_type pos = off;
+        if (dir == std::ios_base::cur) {
+            pos += gptr() - eback();
+        }
+        else if (dir == std::ios_base::end) {
+            pos += egptr() - eback();
+        }
+        if (pos < 0 || pos > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+    pos_type seekpos(pos_type pos, std::ios_base::openmode mode = std::ios::in) override
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, mode);
+    }
+};
+
+// A registered file whose data is parsed by a worker thread
+struct PendingFile
+{
+    std::string fileName;
+    Base::Persistence* object {nullptr};
+    std::string data;
+    bool deflated {false};
+    std::function<void()> apply;
+    bool failed {false};
+    bool done {false};
+};
+}  // namespace
+
+void Base::XMLReader::readFilesConcurrently(zipios::ZipInputStream& zipstream) const
+{
+    zipios::ConstEntryPointer entry;
+    try {
+        entry = zipstream.getNextEntry();
+    }
+    catch (const std::exception&) {
+        // There is no further file at all. This can happen if the
+        // project file was created without GUI
+        return;
+    }
+
+    std::mutex mutex;
+    std::condition_variable fileDone;
+    std::deque<std::unique_ptr<PendingFile>> pending;
+    std::size_t bufferedBytes = 0;
+
+    // declared after the state it uses, so that it is destroyed first
+    Base::ThreadPool pool(concurrentThreads);
+
+    // apply the oldest file in the main thread
+    auto applyFile = [&]() {
+        std::unique_ptr<PendingFile> file = std::move(pending.front());
+        pending.pop_front();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            fileDone.wait(lock, [&file]() {
+                return file->done;
+            });
+        }
+
+        if (!file->failed && file->apply) {
+            try {
+                file->apply();
+            }
+            catch (...) {
+                file->failed = true;
+            }
+        }
+        if (file->failed) {
+            Base::Console().Error("Reading failed from embedded file: %s\n",
+                                  file->fileName.c_str());
+            FailedFiles.push_back(file->fileName);
+        }
+        bufferedBytes -= file->data.size();
+    };
+
+    auto parseFile = [this, &mutex, &fileDone](PendingFile& file) {
+        try {
+            MemoryStreambuf raw(file.data);
+            std::istream str(&raw);
+            std::unique_ptr<zipios::InflateInputStreambuf> inflater;
+            if (file.deflated) {
+                inflater = std::make_unique<zipios::InflateInputStreambuf>(&raw);
+                str.rdbuf(inflater.get());
+            }
+            Base::Reader reader(str, file.fileName, FileVersion);
+            file.apply = file.object->RestoreDocFileConcurrently(reader);
+        }
+        catch (...) {
+            file.failed = true;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        file.done = true;
+        fileDone.notify_all();
+    };
+
+    // As in readFiles() the order of the registered files is kept
+    std::vector<FileEntry>::const_iterator it = FileList.begin();
+    Base::SequencerLauncher seq("Importing project files...", FileList.size());
+    while (entry->isValid() && it != FileList.end()) {
+        std::vector<FileEntry>::const_iterator jt = it;
+        while (jt != FileList.end() && entry->getName() != jt->FileName) {
+            ++jt;
+        }
+        if (jt != FileList.end()) {
+            if (jt->Object->canRestoreDocFileConcurrently()) {
+                pending.push_back(std::make_unique<PendingFile>());
+                PendingFile& file = *pending.back();
+                file.fileName = jt->FileName;
+                file.object = jt->Object;
+                file.deflated = entry->getMethod() == zipios::DEFLATED;
+                try {
+                    zipstream.readRawEntry(file.data);
+                    if (file.deflated) {
+                        // a raw deflate stream may need a byte after its end
+                        file.data.push_back('\0');
+                    }
+                    bufferedBytes += file.data.size();
+                    pool.submit([&file, &parseFile]() {
+                        parseFile(file);
+                    });
+                }
+                catch (...) {
+                    file.failed = true;
+                    file.done = true;
+                }
+
+                while (!pending.empty() && bufferedBytes > concurrentBufferSize) {
+                    applyFile();
+                }
+            }
+            else {
+                // keep the order in which the data is applied
+                while (!pending.empty()) {
+                    applyFile();
+                }
+
+                try {
+                    Base::Reader reader(zipstream, jt->FileName, FileVersion);
+                    jt->Object->RestoreDocFile(reader);
+                    if (reader.getLocalReader()) {
+                        reader.getLocalReader()->readFiles(zipstream);
+                    }
+                }
+                catch (...) {
+                    Base::Console().Error("Reading failed from embedded file: %s\n",
+                                          entry->toString().c_str());
+                    FailedFiles.push_back(jt->FileName);
+                }
+            }
+            // Go to the next registered file name
+            it = jt + 1;
+        }
+
+        seq.next();
+
+        // In either case we must go to the next entry
+        try {
+            entry = zipstream.getNextEntry();
+        }
+        catch (const std::exception&) {
+            // there is no further entry
+            break;
+        }
+    }
+
+    while (!pending.empty()) {
+        applyFile();
+    }
+}
+#endif
+
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
 {
     FileEntry temp;
@@ -251,6 +251,16 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** Read the registered files with worker threads
+     * The data of files whose objects can be restored concurrently (see
+     * Persistence::canRestoreDocFileConcurrently()) is inflated and parsed by worker
+     * threads while the archive is read. The results are applied in the order of the
+     * registered files. All other files are read as usual.
+     * @param threads: number of worker threads, 0 means one per hardware thread
+     * @param bufferSize: number of compressed bytes that may be held in memory by
+     * files that are not applied yet
+     */
+    void setConcurrentFiles(unsigned int threads, std::size_t bufferSize);
     /// get all registered file names
     const std::vector<std::string>& getFilenames() const;
     /// returns true if reading the file \a filename has failed
@@ -325,6 +335,9 @@ protected:
     void resetErrors() override;
     //@}
 
+private:
+    void readFilesConcurrently(zipios::ZipInputStream& zipstream) const;
+
 private:
     int Level {0};
     std::string LocalName;
@@ -367,6 +380,10 @@ private:
     std::vector<std::string> FileNames;
     mutable std::vector<std::string> FailedFiles;
 
+    bool concurrentFiles {false};
+    unsigned int concurrentThreads {0};
+    std::size_t concurrentBufferSize {0};
+
     std::bitset<32> StatusBits;
 
     std::unique_ptr<std::istream> CharStream;
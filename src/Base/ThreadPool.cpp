@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#endif
+
+#include "ThreadPool.h"
+
+using namespace Base;
+
+namespace
+{
+// The pool and worker index of the calling thread
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local std::size_t currentIndex = 0;
+}  // namespace
+
+ThreadPool::ThreadPool(unsigned int threads)
+{
+    if (threads == 0) {
+        threads = defaultThreadCount();
+    }
+
+    queues.reserve(threads);
+    for (unsigned int i = 0; i < threads; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+
+    workers.reserve(threads);
+    for (unsigned int i = 0; i < threads; ++i) {
+        workers.emplace_back(&ThreadPool::run, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        tasksDone.wait(lock, [this]() {
+            return pending == 0;
+        });
+        stop = true;
+    }
+    taskAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+unsigned int ThreadPool::defaultThreadCount()
+{
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+
+std::size_t ThreadPool::size() const
+{
+    return workers.size();
+}
+
+int ThreadPool::currentWorker() const
+{
+    if (currentPool != this) {
+        return -1;
+    }
+    return static_cast<int>(currentIndex);
+}
+
+void ThreadPool::submit(Task task)
+{
+    {
+        // The task is queued and counted under the pool lock so that a worker taking it
+        // right away cannot decrement the counter before it was incremented
+        std::lock_guard<std::mutex> lock(mutex);
+        std::size_t index {};
+        if (currentPool == this) {
+            index = currentIndex;
+        }
+        else {
+            index = nextQueue++ % queues.size();
+        }
+
+        Queue& queue = *queues[index];
+        {
+            std::lock_guard<std::mutex> queueLock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        ++queued;
+        ++pending;
+    }
+    taskAvailable.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::exception_ptr exc;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        tasksDone.wait(lock, [this]() {
+            return pending == 0;
+        });
+        std::swap(exc, error);
+    }
+    if (exc) {
+        std::rethrow_exception(exc);
+    }
+}
+
+bool ThreadPool::takeTask(std::size_t index, Task& task)
+{
+    // newest task of the own queue first
+    {
+        Queue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // then steal the oldest task of another worker
+    for (std::size_t i = 1; i < queues.size(); ++i) {
+        Queue& queue = *queues[(index + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::run(std::size_t index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    for (;;) {
+        Task task;
+        if (takeTask(index, task)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                --queued;
+            }
+
+            std::exception_ptr exc;
+            try {
+                task();
+            }
+            catch (...) {
+                exc = std::current_exception();
+            }
+
+            // destroy the task and its captures before reporting it as done
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (exc && !error) {
+                error = exc;
+            }
+            if (--pending == 0) {
+                tasksDone.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        taskAvailable.wait(lock, [this]() {
+            return stop || queued > 0;
+        });
+        if (stop && queued == 0) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_THREADPOOL_H
+#define BASE_THREADPOOL_H
+
+#include <FCGlobal.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Base
+{
+
+/**
+ * A small work-stealing thread pool.
+ *
+ * Every worker owns a queue of tasks. A task submitted from inside a worker of the
+ * pool is put into the worker's own queue and the worker takes its newest task first.
+ * A task submitted from any other thread is distributed round-robin. An idle worker
+ * steals the oldest task from the queues of the other workers.
+ *
+ * If a task throws, the first exception is kept and re-thrown by wait().
+ *
+ * @code
+ *  Base::ThreadPool pool;
+ *  for (auto& item : items) {
+ *      pool.submit([&item]() { item.compute(); });
+ *  }
+ *  pool.wait();
+ * @endcode
+ */
+class BaseExport ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    /// Creates a pool with \a threads workers, 0 means one worker per hardware thread
+    explicit ThreadPool(unsigned int threads = 0);
+    /// Waits for all pending tasks and joins the workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// Queues \a task for execution
+    void submit(Task task);
+    /// Blocks until all submitted tasks have finished, re-throws the first task exception
+    void wait();
+    /// Returns the number of worker threads
+    std::size_t size() const;
+    /// Returns the index of the calling worker, or -1 if not called from a worker of this pool
+    int currentWorker() const;
+
+    /// Returns the number of threads to use if 0 is passed to the constructor
+    static unsigned int defaultThreadCount();
+
+private:
+    void run(std::size_t index);
+    bool takeTask(std::size_t index, Task& task);
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable tasksDone;
+    std::size_t queued {0};   // tasks waiting in a queue, guarded by mutex
+    std::size_t pending {0};  // tasks not finished yet, guarded by mutex
+    std::size_t nextQueue {0};
+    std::exception_ptr error;
+    bool stop {false};
+};
+
+/** Calls \a func(begin, end) for consecutive ranges covering [0, count) on the workers of
+ * \a pool and waits for them. Every range but the last one has at least \a minChunk items.
+ */
+template<class Func>
+void parallel_for(ThreadPool& pool, std::size_t count, Func&& func, std::size_t minChunk = 1)
+{
+    std::size_t chunk = std::max<std::size_t>(minChunk, count / (pool.size() * 4));
+    for (std::size_t begin = 0; begin < count; begin += chunk) {
+        std::size_t end = std::min(begin + chunk, count);
+        pool.submit([&func, begin, end]() {
+            func(begin, end);
+        });
+    }
+    pool.wait();
+}
+
+/** Calls \a func(begin, end) for consecutive ranges covering [0, count). With at least \a
+ * minParallel items the ranges are processed concurrently by a thread pool, otherwise \a func is
+ * called once with the whole range.
+ */
+template<class Func>
+void parallel_for(std::size_t count, std::size_t minParallel, Func&& func)
+{
+    if (count < minParallel || count < 2) {
+        if (count > 0) {
+            func(std::size_t(0), count);
+        }
+        return;
+    }
+
+    ThreadPool pool;
+    parallel_for(pool, count, std::forward<Func>(func));
+}
+
+}  // namespace Base
+
+#endif  // BASE_THREADPOOL_H
@@ -23,6 +23,10 @@
 
 #include "PreCompiled.h"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <limits>
 #include <locale>
 #include <iomanip>
@@ -34,9 +38,11 @@
 #include "FileInfo.h"
 #include "Persistence.h"
 #include "Stream.h"
+#include "ThreadPool.h"
 #include "Tools.h"
 
 #include <boost/iostreams/filtering_stream.hpp>
+#include <zipios++/deflateoutputstreambuf.h>
 
 using namespace Base;
 using namespace std;
@@ -358,8 +364,28 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
     ZipStream.putNextEntry(file);
 }
 
+void ZipWriter::setConcurrentFiles(unsigned int threads, std::size_t bufferSize)
+{
+#ifndef FC_USE_EXTERNAL_ZIPIOS
+    concurrentFiles = true;
+    concurrentThreads = threads;
+    concurrentBufferSize = bufferSize;
+#else
+    // an external zipios++ cannot append pre-compressed entries
+    (void)threads;
+    (void)bufferSize;
+#endif
+}
+
 void ZipWriter::writeFiles()
 {
+#ifndef FC_USE_EXTERNAL_ZIPIOS
+    if (concurrentFiles) {
+        writeFilesConcurrently();
+        return;
+    }
+#endif
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
@@ -373,6 +399,251 @@ void ZipWriter::writeFiles()
     }
 }
 
+#ifndef FC_USE_EXTERNAL_ZIPIOS
+namespace
+{
+// Appends everything written to it to a string
+class StringOutputStreambuf: public std::streambuf
+{
+public:
+    explicit StringOutputStreambuf(std::string& str)
+        : str(str)
+    {}
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            str.push_back(traits_type::to_char_type(ch));
+        }
+        return traits_type::not_eof(ch);
+    }
+    std::streamsize xsputn(const char* data, std::streamsize count) override
+    {
+        str.append(data, static_cast<std::size_t>(count));
+        return count;
+    }
+
+private:
+    std::string& str;
+};
+}  // namespace
+
+/// An additional file of the archive that is serialized and compressed into memory
+struct ZipWriter::PendingFile
+{
+    std::string fileName;
+    const Base::Persistence* object {nullptr};
+
+    // uncompressed content if serialized by the main thread
+    std::string content;
+    // estimated size while serialized by a worker thread
+    std::size_t estimate {0};
+    // deflated content
+    std::string data;
+    zipios::uint32 size {0};
+    zipios::uint32 crc {0};
+
+    // files added while serializing, and errors reported
+    std::vector<FileEntry> files;
+    std::vector<std::string> errors;
+    std::exception_ptr error;
+    bool done {false};
+};
+
+/// The writer an additional file is serialized with when writing concurrently
+class ZipWriter::EntryWriter: public Writer
+{
+public:
+    EntryWriter(ZipWriter& parent, std::mutex& mutex, const std::string& fileName, std::streambuf* buf)
+        : parent(parent)
+        , mutex(mutex)
+        , stream(buf)
+    {
+#ifdef _MSC_VER
+        stream.imbue(std::locale::empty());
+#else
+        stream.imbue(std::locale::classic());
+#endif
+        stream.precision(std::numeric_limits<double>::digits10 + 1);
+        stream.setf(ios::fixed, ios::floatfield);
+
+        setModes(parent.getModes());
+        setFileVersion(parent.getFileVersion());
+        ObjectName = fileName;
+    }
+
+    void writeFiles() override
+    {}
+
+    std::ostream& Stream() override
+    {
+        return stream;
+    }
+
+    void takeResults(PendingFile& file)
+    {
+        file.files = std::move(FileList);
+        file.errors = std::move(Errors);
+    }
+
+protected:
+    std::string getUniqueFileName(const char* Name) override
+    {
+        // the file names must be unique over the whole archive
+        std::lock_guard<std::mutex> lock(mutex);
+        std::string name = parent.getUniqueFileName(Name);
+        parent.FileNames.push_back(name);
+        return name;
+    }
+
+private:
+    ZipWriter& parent;
+    std::mutex& mutex;
+    std::ostream stream;
+};
+
+void ZipWriter::writeFilesConcurrently()
+{
+    std::mutex mutex;
+    std::condition_variable fileDone;
+    std::size_t bufferedBytes = 0;  // guarded by mutex
+    std::deque<std::unique_ptr<PendingFile>> pending;
+
+    auto finish = [&](PendingFile& file, std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(mutex);
+        bufferedBytes += file.data.size();
+        bufferedBytes -= file.content.size() + file.estimate;
+        file.estimate = 0;
+        file.content.clear();
+        file.content.shrink_to_fit();
+        file.error = error;
+        file.done = true;
+        fileDone.notify_all();
+    };
+
+    auto deflate = [this](PendingFile& file, const std::function<void(std::streambuf*)>& write) {
+        StringOutputStreambuf out(file.data);
+        zipios::DeflateOutputStreambuf deflater(&out);
+        deflater.init(compressionLevel);
+        write(&deflater);
+        deflater.closeStream();
+        file.size = deflater.getCount();
+        file.crc = deflater.getCrc32();
+    };
+
+    // declared after the state it uses, so that it is destroyed first
+    Base::ThreadPool pool(concurrentThreads);
+    const std::size_t maxPending = 2 * pool.size();
+
+    // use a while loop because it is possible that while
+    // processing the files new ones can be added
+    std::size_t index = 0;
+    while (index < FileList.size() || !pending.empty()) {
+        // start files as long as the memory budget allows it
+        while (index < FileList.size() && pending.size() < maxPending) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!pending.empty() && bufferedBytes >= concurrentBufferSize) {
+                    break;
+                }
+            }
+
+            pending.push_back(std::make_unique<PendingFile>());
+            PendingFile& file = *pending.back();
+            file.fileName = FileList[index].FileName;
+            file.object = FileList[index].Object;
+            ++index;
+
+            if (file.object->canSaveDocFileConcurrently(*this)) {
+                // count the file before its size is known
+                file.estimate = file.object->getMemSize();
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    bufferedBytes += file.estimate;
+                }
+
+                pool.submit([this, &file, &mutex, &finish, &deflate]() {
+                    std::exception_ptr error;
+                    try {
+                        deflate(file, [&](std::streambuf* buf) {
+                            EntryWriter writer(*this, mutex, file.fileName, buf);
+                            file.object->SaveDocFile(writer);
+                            writer.Stream().flush();
+                            writer.takeResults(file);
+                        });
+                    }
+                    catch (...) {
+                        error = std::current_exception();
+                    }
+                    finish(file, error);
+                });
+            }
+            else {
+                // serialize here, only compress in the pool
+                StringOutputStreambuf out(file.content);
+                EntryWriter writer(*this, mutex, file.fileName, &out);
+                file.object->SaveDocFile(writer);
+                writer.Stream().flush();
+                writer.takeResults(file);
+                FileList.insert(FileList.end(), file.files.begin(), file.files.end());
+                file.files.clear();
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    bufferedBytes += file.content.size();
+                }
+
+                pool.submit([&file, &finish, &deflate]() {
+                    std::exception_ptr error;
+                    try {
+                        deflate(file, [&](std::streambuf* buf) {
+                            buf->sputn(file.content.data(),
+                                       static_cast<std::streamsize>(file.content.size()));
+                        });
+                    }
+                    catch (...) {
+                        error = std::current_exception();
+                    }
+                    finish(file, error);
+                });
+            }
+        }
+
+        if (pending.empty()) {
+            continue;
+        }
+
+        // append the files to the archive in the order they were added
+        std::unique_ptr<PendingFile> file = std::move(pending.front());
+        pending.pop_front();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            fileDone.wait(lock, [&file]() {
+                return file->done;
+            });
+        }
+
+        if (file->error) {
+            std::rethrow_exception(file->error);
+        }
+
+        ObjectName = file->fileName;
+        ZipStream.putRawEntry(file->fileName,
+                              file->data.data(),
+                              static_cast<zipios::uint32>(file->data.size()),
+                              file->size,
+                              file->crc);
+        FileList.insert(FileList.end(), file->files.begin(), file->files.end());
+        for (const auto& error : file->errors) {
+            addError(error);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        bufferedBytes -= file->data.size();
+    }
+}
+#endif
+
 ZipWriter::~ZipWriter()
 {
     ZipStream.close();
@@ -151,7 +151,7 @@ public:
     std::string ObjectName;
 
 protected:
-    std::string getUniqueFileName(const char* Name);
+    virtual std::string getUniqueFileName(const char* Name);
     struct FileEntry
     {
         std::string FileName;
@@ -208,16 +208,40 @@ public:
     void setLevel(int level)
     {
         ZipStream.setLevel(level);
+        compressionLevel = level;
     }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
+    /** Write the additional files with worker threads
+     * The additional files are serialized and compressed into memory by worker
+     * threads and then appended to the archive in the order they were added.
+     * The files of objects that cannot be saved concurrently (see
+     * Persistence::canSaveDocFileConcurrently()) are serialized by the calling
+     * thread and only compressed by the worker threads.
+     * @param threads: number of worker threads, 0 means one per hardware thread
+     * @param bufferSize: number of bytes the files being written and waiting to
+     * be appended to the archive may occupy before no further files are started,
+     * the size of a file serialized by a worker thread is estimated with
+     * Persistence::getMemSize() until it is done
+     */
+    void setConcurrentFiles(unsigned int threads, std::size_t bufferSize);
+
     ZipWriter(const ZipWriter&) = delete;
     ZipWriter(ZipWriter&&) = delete;
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
 private:
+    void writeFilesConcurrently();
+
+    class EntryWriter;
+    struct PendingFile;
+
     zipios::ZipOutputStream ZipStream;
+    int compressionLevel {6};
+    bool concurrentFiles {false};
+    unsigned int concurrentThreads {0};
+    std::size_t concurrentBufferSize {0};
 };
 
 /** The StringWriter class
@@ -182,6 +182,8 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
                 // So, always force binary format because ASCII
                 // is not reentrant. See PropertyPartShape::SaveDocFile
                 writer.setMode("BinaryBrep");
+                if (App::Document::isCompressedMeshEnabled())
+                    writer.setMode("CompressedMesh");
 
                 writer.putNextEntry("Document.xml");
 
@@ -204,6 +206,8 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
                     Base::ZipWriter writer(file);
                     if (hGrp->GetBool("SaveBinaryBrep", true))
                         writer.setMode("BinaryBrep");
+                    if (App::Document::isCompressedMeshEnabled())
+                        writer.setMode("CompressedMesh");
 
                     writer.setComment("AutoRecovery file");
                     writer.setLevel(1); // apparently the fastest compression
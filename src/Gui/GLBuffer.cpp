@@ -126,6 +126,17 @@ void OpenGLBuffer::allocate(const void *data, int count)
     }
 }
 
+/*!
+ * \brief OpenGLBuffer::write replaces \a count bytes of the bound buffer
+ * starting at \a offset. The buffer must have been allocated before.
+ */
+void OpenGLBuffer::write(int offset, const void *data, int count)
+{
+    if (bufferId > 0) {
+        cc_glglue_glBufferSubData(glue, target, offset, count, data);
+    }
+}
+
 bool OpenGLBuffer::bind()
 {
     if (bufferId) {
@@ -255,6 +266,13 @@ void OpenGLMultiBuffer::allocate(const void *data, int count)
     }
 }
 
+void OpenGLMultiBuffer::write(int offset, const void *data, int count)
+{
+    if (currentBuf && *currentBuf) {
+        cc_glglue_glBufferSubData(glue, target, offset, count, data);
+    }
+}
+
 bool OpenGLMultiBuffer::bind()
 {
     if (currentBuf && *currentBuf) {
@@ -44,6 +44,7 @@ public:
 
     void destroy();
     void allocate(const void *data, int count);
+    void write(int offset, const void *data, int count);
     bool bind();
     void release();
     GLuint getBufferId() const;
@@ -73,6 +74,7 @@ public:
 
     void destroy();
     void allocate(const void *data, int count);
+    void write(int offset, const void *data, int count);
     bool bind();
     void release();
     GLuint getBufferId() const;
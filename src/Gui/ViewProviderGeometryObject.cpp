@@ -176,19 +176,14 @@ void ViewProviderGeometryObject::attach(App::DocumentObject* pcObj)
 void ViewProviderGeometryObject::updateData(const App::Property* prop)
 {
     if (prop->isDerivedFrom<App::PropertyComplexGeoData>()) {
-        Base::BoundBox3d box =
-            static_cast<const App::PropertyComplexGeoData*>(prop)->getBoundingBox();
-        pcBoundingBox->minBounds.setValue(box.MinX, box.MinY, box.MinZ);
-        pcBoundingBox->maxBounds.setValue(box.MaxX, box.MaxY, box.MaxZ);
+        updateBoundingBox(static_cast<const App::PropertyComplexGeoData*>(prop));
     }
     else if (prop->isDerivedFrom<App::PropertyPlacement>()) {
         auto geometry = getObject<App::GeoFeature>();
         if (geometry && prop == &geometry->Placement) {
             const App::PropertyComplexGeoData* data = geometry->getPropertyOfGeometry();
             if (data) {
-                Base::BoundBox3d box = data->getBoundingBox();
-                pcBoundingBox->minBounds.setValue(box.MinX, box.MinY, box.MinZ);
-                pcBoundingBox->maxBounds.setValue(box.MaxX, box.MaxY, box.MaxZ);
+                updateBoundingBox(data);
             }
         }
     }
@@ -293,8 +288,32 @@ float getBoundBoxFontSize()
 }
 }  // namespace
 
+void ViewProviderGeometryObject::updateBoundingBox(const App::PropertyComplexGeoData* data,
+                                                   bool force)
+{
+    // Data whose reading was deferred on restore is not read only for the
+    // bounding box before the box is shown
+    boundingBoxOutdated = !force && data->isRestoreDeferred();
+    if (boundingBoxOutdated) {
+        return;
+    }
+
+    Base::BoundBox3d box = data->getBoundingBox();
+    pcBoundingBox->minBounds.setValue(box.MinX, box.MinY, box.MinZ);
+    pcBoundingBox->maxBounds.setValue(box.MaxX, box.MaxY, box.MaxZ);
+}
+
 void ViewProviderGeometryObject::showBoundingBox(bool show)
 {
+    if (show && boundingBoxOutdated) {
+        auto geometry = getObject<App::GeoFeature>();
+        const App::PropertyComplexGeoData* data =
+            geometry ? geometry->getPropertyOfGeometry() : nullptr;
+        if (data) {
+            updateBoundingBox(data, true);
+        }
+    }
+
     if (!pcBoundSwitch && show) {
         unsigned long bbcol = getBoundColor();
         float red {};
@@ -34,6 +34,11 @@ class SoSensor;
 class SbVec2s;
 class SoBaseColor;
 
+namespace App
+{
+class PropertyComplexGeoData;
+}
+
 namespace Gui
 {
 
@@ -111,6 +116,7 @@ protected:
 
 private:
     bool isSelectionEnabled() const;
+    void updateBoundingBox(const App::PropertyComplexGeoData* data, bool force = false);
 
 protected:
     SoMaterial* pcShapeMaterial {nullptr};
@@ -120,6 +126,9 @@ protected:
     SoPickStyle* pickStyle {nullptr};
 
     App::Material materialAppearance;
+
+private:
+    bool boundingBoxOutdated {false};
 };
 
 }  // namespace Gui
@@ -23,16 +23,33 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
 #include <boost/core/ignore_unused.hpp>
+#include <memory>
+#include <mutex>
 #include <numeric>
 
-#include <BRepBuilderAPI_MakeVertex.hxx>
-#include <BRepClass3d_SolidClassifier.hxx>
-#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepGProp_Face.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <BRepTopAdaptor_FClass2d.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Poly_Triangle.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
 #include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+#include <gp_Vec.hxx>
 
 #include <QEventLoop>
 #include <QFuture>
@@ -51,6 +68,7 @@
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/PointsGrid.h>
 
@@ -199,7 +217,9 @@ protected:
         assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
     }
 
-    void AddFacet(const MeshCore::MeshGeomFacet& rclFacet, unsigned long ulFacetIndex)
+    void AddFacet(const MeshCore::MeshGeomFacet& rclFacet,
+                  unsigned long ulFacetIndex,
+                  std::vector<CellEntry>& entries) const
     {
         unsigned long ulX1;
         unsigned long ulY1;
@@ -222,21 +242,19 @@ protected:
                 for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
                     for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                         if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                            _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                            entries.emplace_back(CellIndex(ulX, ulY, ulZ), ulFacetIndex);
                         }
                     }
                 }
             }
         }
         else {
-            _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+            entries.emplace_back(CellIndex(ulX1, ulY1, ulZ1), ulFacetIndex);
         }
     }
 
     void InitGrid() override
     {
-        unsigned long i, j;
-
         Base::BoundBox3f clBBMesh = _pclMesh->GetBoundBox().Transformed(_transform);
 
         float fLengthX = clBBMesh.LengthX();
@@ -252,14 +270,8 @@ protected:
         _fGridLenZ = (1.0f + fLengthZ) / float(_ulCtGridsZ);
         _fMinZ = clBBMesh.MinZ - 0.5f;
 
-        _aulGrid.clear();
-        _aulGrid.resize(_ulCtGridsX);
-        for (i = 0; i < _ulCtGridsX; i++) {
-            _aulGrid[i].resize(_ulCtGridsY);
-            for (j = 0; j < _ulCtGridsY; j++) {
-                _aulGrid[i][j].resize(_ulCtGridsZ);
-            }
-        }
+        _aulCellOffsets.assign(std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ + 1, 0);
+        _aulCellElements.clear();
     }
 
     void RebuildGrid() override
@@ -267,12 +279,15 @@ protected:
         _ulCtElements = _pclMesh->CountFacets();
         InitGrid();
 
-        unsigned long i = 0;
-        MeshCore::MeshFacetIterator clFIter(*_pclMesh);
-        clFIter.Transform(_transform);
-        for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-            AddFacet(*clFIter, i++);
-        }
+        BuildCells(_ulCtElements,
+                   [this](unsigned long begin, unsigned long end, std::vector<CellEntry>& entries) {
+                       MeshCore::MeshFacetIterator clFIter(*_pclMesh);
+                       clFIter.Transform(_transform);
+                       for (unsigned long i = begin; i < end; i++) {
+                           clFIter.Set(i);
+                           AddFacet(*clFIter, i, entries);
+                       }
+                   });
     }
 
 private:
@@ -471,86 +486,380 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
-    : _rShape(shape)
+namespace
+{
+unsigned long columnIndex(float value, float min, float len, unsigned long count)
 {
-    distss = new BRepExtrema_DistShapeShape();
-    distss->LoadS1(_rShape);
+    if (len <= 0.0F) {
+        return 0;
+    }
+    auto index = static_cast<long>((value - min) / len * float(count));
+    return static_cast<unsigned long>(std::clamp<long>(index, 0, long(count) - 1));
+}
+
+/**
+ * Checks if the line through (x, y) parallel to the z-axis hits the triangle and returns the
+ * height of the hit. A point on an edge or vertex shared by several triangles is assigned to
+ * exactly one of them (top-left rule) so that the crossings of a closed tessellation are
+ * neither missed nor counted twice.
+ */
+bool hitColumn(const MeshCore::MeshGeomFacet& facet, double x, double y, double& z)
+{
+    std::array<const Base::Vector3f*, 3> pts {&facet._aclPoints[0],
+                                              &facet._aclPoints[1],
+                                              &facet._aclPoints[2]};
+    // The edge function is computed relative to (x, y), so it exactly changes its sign if
+    // the edge is reversed. A shared edge is then assigned to one of its triangles even if
+    // the rounding error is larger than the distance of (x, y) from the edge.
+    auto cross = [x, y](const Base::Vector3f& p, const Base::Vector3f& q) {
+        double px = double(p.x) - x;
+        double py = double(p.y) - y;
+        double qx = double(q.x) - x;
+        double qy = double(q.y) - y;
+        return px * qy - py * qx;
+    };
 
-    // When having a solid then use its shell because otherwise the distance
-    // for inner points will always be zero
-    if (!_rShape.IsNull() && _rShape.ShapeType() == TopAbs_SOLID) {
-        TopExp_Explorer xp;
-        xp.Init(_rShape, TopAbs_SHELL);
-        if (xp.More()) {
-            distss->LoadS1(xp.Current());
-            isSolid = true;
+    double area = (double(pts[1]->x) - pts[0]->x) * (double(pts[2]->y) - pts[0]->y)
+        - (double(pts[1]->y) - pts[0]->y) * (double(pts[2]->x) - pts[0]->x);
+    if (area == 0.0) {
+        return false;
+    }
+    if (area < 0.0) {
+        std::swap(pts[1], pts[2]);
+    }
+
+    std::array<double, 3> weights {};
+    for (std::size_t i = 0; i < 3; i++) {
+        const Base::Vector3f& p = *pts[(i + 1) % 3];
+        const Base::Vector3f& q = *pts[(i + 2) % 3];
+        double w = cross(p, q);
+        if (w < 0.0) {
+            return false;
         }
+        if (w == 0.0) {
+            bool topLeft = q.y < p.y || (q.y == p.y && q.x < p.x);
+            if (!topLeft) {
+                return false;
+            }
+        }
+        weights[i] = w;
+    }
+
+    double sum = weights[0] + weights[1] + weights[2];
+    if (sum <= 0.0) {
+        return false;
     }
-    // distss->SetDeflection(radius);
+    z = (weights[0] * pts[0]->z + weights[1] * pts[1]->z + weights[2] * pts[2]->z) / sum;
+    return true;
 }
+}  // namespace
 
-InspectNominalShape::~InspectNominalShape()
+namespace Inspection
 {
-    delete distss;
-}
+class InspectNominalShape::Private
+{
+public:
+    /// The exact queries of a face. They cache data and thus must not be shared by threads.
+    struct FaceQuery
+    {
+        explicit FaceQuery(const TopoDS_Face& face)
+            : classifier(face, Precision::Confusion())
+        {
+            Standard_Real u1 {}, u2 {}, v1 {}, v2 {};
+            BRepTools::UVBounds(face, u1, u2, v1, v2);
+            projector.Init(BRep_Tool::Surface(face), u1, u2, v1, v2);
+            props.Load(face);
+        }
 
-float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+        GeomAPI_ProjectPointOnSurf projector;
+        BRepTopAdaptor_FClass2d classifier;
+        BRepGProp_Face props;
+    };
+    /// The face queries of a thread, created on first use
+    using QueryState = std::vector<std::unique_ptr<FaceQuery>>;
+
+    void tessellate(const TopoDS_Shape& nominal);
+    void buildRayGrid();
+    bool isInside(const Base::Vector3f& point) const;
+    bool refine(QueryState& state,
+                std::size_t face,
+                const Base::Vector3f& point,
+                float& dist,
+                bool& below) const;
+    std::unique_ptr<QueryState> acquireState();
+    void releaseState(std::unique_ptr<QueryState> state);
+
+    std::vector<TopoDS_Face> faces;
+    // the faces with a lower index belong to a solid
+    std::size_t numSolidFaces {0};
+    MeshCore::MeshKernel mesh;
+    std::vector<std::size_t> facetToFace;
+    std::unique_ptr<MeshCore::MeshFacetGrid> grid;
+    Base::BoundBox3f box;
+    float radius {0.0F};
+    float deflection {0.0F};
+
+    // the triangles of solids sorted into columns parallel to the z-axis
+    Base::BoundBox3f rayBox;
+    unsigned long rayCountX {0};
+    unsigned long rayCountY {0};
+    std::vector<std::size_t> rayOffsets;
+    std::vector<MeshCore::FacetIndex> rayFacets;
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<QueryState>> states;
+};
+}  // namespace Inspection
+
+void InspectNominalShape::Private::tessellate(const TopoDS_Shape& nominal)
 {
-    gp_Pnt pnt3d(point.x, point.y, point.z);
-    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
-    distss->LoadS2(mkVert.Vertex());
+    // The meshing stores the triangulation in the faces. The nominal may be shared with
+    // a document object and other threads so a copy of its topology is meshed.
+    TopoDS_Shape shape = BRepBuilderAPI_Copy(nominal, Standard_False).Shape();
+
+    // add the faces of solids first so that they can be told apart from loose faces
+    TopTools_IndexedMapOfShape mapOfFaces;
+    for (TopExp_Explorer xp(shape, TopAbs_SOLID); xp.More(); xp.Next()) {
+        TopExp::MapShapes(xp.Current(), TopAbs_FACE, mapOfFaces);
+    }
+    numSolidFaces = static_cast<std::size_t>(mapOfFaces.Extent());
+    TopExp::MapShapes(shape, TopAbs_FACE, mapOfFaces);
+    if (mapOfFaces.IsEmpty()) {
+        return;
+    }
 
-    float fMinDist = FLT_MAX;
-    if (distss->Perform() && distss->NbSolution() > 0) {
-        fMinDist = (float)distss->Value();
-        // the shape is a solid, check if the vertex is inside
-        if (isSolid) {
-            if (isInsideSolid(pnt3d)) {
-                fMinDist = -fMinDist;
+    // The tessellation is only used to find the nearest face and for the inside test. The
+    // distance itself is computed on the exact surface so a coarse tessellation is sufficient.
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    double diagonal = bounds.IsVoid() ? 0.0 : std::sqrt(bounds.SquareExtent());
+    double linear = std::max({0.1 * radius, 0.0001 * diagonal, Precision::Confusion()});
+    deflection = static_cast<float>(linear);
+    BRepMesh_IncrementalMesh(shape, linear, Standard_False, 0.5, Standard_True);
+
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    std::vector<gp_Pnt> nodes;
+    std::vector<Poly_Triangle> triangles;
+    faces.reserve(mapOfFaces.Extent());
+    for (int i = 1; i <= mapOfFaces.Extent(); i++) {
+        const TopoDS_Face& face = TopoDS::Face(mapOfFaces(i));
+        faces.push_back(face);
+
+        nodes.clear();
+        triangles.clear();
+        if (!Part::Tools::getTriangulation(face, nodes, triangles)) {
+            continue;
+        }
+
+        MeshCore::PointIndex offset = points.size();
+        for (const auto& pnt : nodes) {
+            points.push_back(MeshCore::MeshPoint(float(pnt.X()), float(pnt.Y()), float(pnt.Z())));
+        }
+        for (const auto& tria : triangles) {
+            Standard_Integer n1 {}, n2 {}, n3 {};
+            tria.Get(n1, n2, n3);
+            facets.push_back(MeshCore::MeshFacet(offset + n1, offset + n2, offset + n3));
+            facetToFace.push_back(faces.size() - 1);
+        }
+    }
+
+    mesh.Adopt(points, facets);
+    if (mesh.CountFacets() == 0) {
+        return;
+    }
+
+    // Max. limit of grid elements
+    float fMaxGridElements = 8000000.0f;
+    box = mesh.GetBoundBox();
+    float fMinGridLen =
+        (float)pow((box.LengthX() * box.LengthY() * box.LengthZ() / fMaxGridElements), 0.3333f);
+    float fGridLen = 5.0f * MeshCore::MeshAlgorithm(mesh).GetAverageEdgeLength();
+    fGridLen = std::max<float>(fMinGridLen, fGridLen);
+    grid = std::make_unique<MeshCore::MeshFacetGrid>(mesh, fGridLen);
+    box.Enlarge(radius + deflection);
+}
+
+void InspectNominalShape::Private::buildRayGrid()
+{
+    std::vector<MeshCore::FacetIndex> solidFacets;
+    for (MeshCore::FacetIndex index = 0; index < facetToFace.size(); index++) {
+        if (facetToFace[index] < numSolidFaces) {
+            solidFacets.push_back(index);
+            MeshCore::MeshGeomFacet facet = mesh.GetFacet(index);
+            for (const auto& pnt : facet._aclPoints) {
+                rayBox.Add(pnt);
             }
         }
-        else if (fMinDist > 0) {
-            // check if the distance was computed from a face
-            if (isBelowFace(pnt3d)) {
-                fMinDist = -fMinDist;
+    }
+    if (solidFacets.empty()) {
+        return;
+    }
+
+    // about as many columns as triangles
+    double area = std::max(double(rayBox.LengthX()) * double(rayBox.LengthY()), DBL_MIN);
+    double cellLen = std::sqrt(area / double(solidFacets.size()));
+    auto numCells = [cellLen](float len) {
+        return static_cast<unsigned long>(std::clamp(double(len) / cellLen, 1.0, 1024.0));
+    };
+    rayCountX = numCells(rayBox.LengthX());
+    rayCountY = numCells(rayBox.LengthY());
+
+    auto forEachColumn = [this](const MeshCore::MeshGeomFacet& facet, auto&& func) {
+        Base::BoundBox3f bound = facet.GetBoundBox();
+        unsigned long x1 = columnIndex(bound.MinX, rayBox.MinX, rayBox.LengthX(), rayCountX);
+        unsigned long x2 = columnIndex(bound.MaxX, rayBox.MinX, rayBox.LengthX(), rayCountX);
+        unsigned long y1 = columnIndex(bound.MinY, rayBox.MinY, rayBox.LengthY(), rayCountY);
+        unsigned long y2 = columnIndex(bound.MaxY, rayBox.MinY, rayBox.LengthY(), rayCountY);
+        for (unsigned long y = y1; y <= y2; y++) {
+            for (unsigned long x = x1; x <= x2; x++) {
+                func(y * rayCountX + x);
             }
         }
+    };
+
+    // count the triangles per column first and then fill in the indices
+    rayOffsets.assign(rayCountX * rayCountY + 1, 0);
+    for (MeshCore::FacetIndex index : solidFacets) {
+        forEachColumn(mesh.GetFacet(index), [this](std::size_t column) {
+            rayOffsets[column + 1]++;
+        });
+    }
+    std::partial_sum(rayOffsets.begin(), rayOffsets.end(), rayOffsets.begin());
+
+    std::vector<std::size_t> fill(rayOffsets.begin(), rayOffsets.end() - 1);
+    rayFacets.resize(rayOffsets.back());
+    for (MeshCore::FacetIndex index : solidFacets) {
+        forEachColumn(mesh.GetFacet(index), [this, &fill, index](std::size_t column) {
+            rayFacets[fill[column]++] = index;
+        });
     }
-    return fMinDist;
 }
 
-bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
+bool InspectNominalShape::Private::isInside(const Base::Vector3f& point) const
 {
-    const Standard_Real tol = 0.001;
-    BRepClass3d_SolidClassifier classifier(_rShape);
-    classifier.Perform(pnt3d, tol);
-    return (classifier.State() == TopAbs_IN);
+    if (rayFacets.empty()) {
+        return false;
+    }
+    if (point.x < rayBox.MinX || point.x > rayBox.MaxX || point.y < rayBox.MinY
+        || point.y > rayBox.MaxY || point.z > rayBox.MaxZ) {
+        return false;
+    }
+
+    // count the crossings of a ray in +z direction
+    unsigned long x = columnIndex(point.x, rayBox.MinX, rayBox.LengthX(), rayCountX);
+    unsigned long y = columnIndex(point.y, rayBox.MinY, rayBox.LengthY(), rayCountY);
+    std::size_t column = y * rayCountX + x;
+    int crossings = 0;
+    for (std::size_t i = rayOffsets[column]; i < rayOffsets[column + 1]; i++) {
+        double z {};
+        if (hitColumn(mesh.GetFacet(rayFacets[i]), point.x, point.y, z) && z > point.z) {
+            crossings++;
+        }
+    }
+
+    return (crossings % 2) == 1;
 }
 
-bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
+bool InspectNominalShape::Private::refine(QueryState& state,
+                                          std::size_t face,
+                                          const Base::Vector3f& point,
+                                          float& dist,
+                                          bool& below) const
 {
-    // check if the distance was computed from a face
-    for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-        if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-            TopoDS_Shape face = distss->SupportOnShape1(index);
-            Standard_Real u, v;
-            distss->ParOnFaceS1(index, u, v);
-            // gp_Pnt pnt = distss->PointOnShape1(index);
-            BRepGProp_Face props(TopoDS::Face(face));
-            gp_Vec normal;
-            gp_Pnt center;
-            props.Normal(u, v, center, normal);
-            gp_Vec dir(center, pnt3d);
-            Standard_Real scalar = normal.Dot(dir);
-            if (scalar < 0) {
-                return true;
-            }
-            break;
+    std::unique_ptr<FaceQuery>& query = state[face];
+    if (!query) {
+        query = std::make_unique<FaceQuery>(faces[face]);
+    }
+
+    gp_Pnt pnt3d(point.x, point.y, point.z);
+    query->projector.Perform(pnt3d);
+    if (query->projector.NbPoints() == 0) {
+        return false;
+    }
+
+    // if the foot point is outside the face the nearest point lies on one of its edges
+    Standard_Real u {}, v {};
+    query->projector.LowerDistanceParameters(u, v);
+    if (query->classifier.Perform(gp_Pnt2d(u, v)) == TopAbs_OUT) {
+        return false;
+    }
+
+    gp_Vec normal;
+    gp_Pnt center;
+    query->props.Normal(u, v, center, normal);
+    dist = static_cast<float>(query->projector.LowerDistance());
+    below = normal.Dot(gp_Vec(center, pnt3d)) < 0;
+    return true;
+}
+
+std::unique_ptr<InspectNominalShape::Private::QueryState>
+InspectNominalShape::Private::acquireState()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (states.empty()) {
+        return std::make_unique<QueryState>(faces.size());
+    }
+
+    std::unique_ptr<QueryState> state = std::move(states.back());
+    states.pop_back();
+    return state;
+}
+
+void InspectNominalShape::Private::releaseState(std::unique_ptr<QueryState> state)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    states.push_back(std::move(state));
+}
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float radius)
+    : d(std::make_unique<Private>())
+{
+    d->radius = radius;
+    if (!shape.IsNull()) {
+        d->tessellate(shape);
+        d->buildRayGrid();
+    }
+}
+
+InspectNominalShape::~InspectNominalShape() = default;
+
+float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+{
+    if (!d->grid || !d->box.IsInBox(point)) {
+        return FLT_MAX;  // must be inside bbox
+    }
+
+    MeshCore::FacetIndex facet = d->grid->SearchNearestFromPoint(point, d->radius + d->deflection);
+    if (facet == MeshCore::FACET_INDEX_MAX) {
+        return d->isInside(point) ? -FLT_MAX : FLT_MAX;
+    }
+
+    MeshCore::MeshGeomFacet geomFace = d->mesh.GetFacet(facet);
+    float fMinDist = geomFace.DistanceToPoint(point);
+    bool below = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) < 0;
+
+    // refine the distance on the exact surface, near edges the distance to the tessellation
+    // is kept which differs by at most the deflection
+    std::size_t face = d->facetToFace[facet];
+    std::unique_ptr<Private::QueryState> state = d->acquireState();
+    try {
+        float fDist {};
+        bool faceBelow {};
+        if (d->refine(*state, face, point, fDist, faceBelow)) {
+            fMinDist = fDist;
+            below = faceBelow;
         }
     }
+    catch (const Standard_Failure&) {
+        // keep the distance to the tessellation
+    }
+    d->releaseState(std::move(state));
 
-    return false;
+    if (face < d->numSolidFaces) {
+        below = d->isInside(point);
+    }
+    return below ? -fMinDist : fMinDist;
 }
 
 // ----------------------------------------------------------------
@@ -832,7 +1141,6 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
             nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
         }
@@ -23,6 +23,8 @@
 #ifndef INSPECTION_FEATURE_H
 #define INSPECTION_FEATURE_H
 
+#include <memory>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
 
@@ -31,8 +33,6 @@
 
 
 class TopoDS_Shape;
-class BRepExtrema_DistShapeShape;
-class gp_Pnt;
 
 namespace MeshCore
 {
@@ -159,6 +159,12 @@ private:
     Points::PointsGrid* _pGrid;
 };
 
+/**
+ * The shape is tessellated once and the nearest triangle to a point is looked up in a grid.
+ * If it lies within the search radius the distance is refined against the exact surface of
+ * the face the triangle belongs to. For solids a point is inside if a ray from it crosses the
+ * tessellation an odd number of times. getDistance() can be called from several threads.
+ */
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
 {
 public:
@@ -166,14 +172,14 @@ public:
     ~InspectNominalShape() override;
     float getDistance(const Base::Vector3f&) const override;
 
-private:
-    bool isInsideSolid(const gp_Pnt&) const;
-    bool isBelowFace(const gp_Pnt&) const;
+    InspectNominalShape(const InspectNominalShape&) = delete;
+    InspectNominalShape(InspectNominalShape&&) = delete;
+    InspectNominalShape& operator=(const InspectNominalShape&) = delete;
+    InspectNominalShape& operator=(InspectNominalShape&&) = delete;
 
 private:
-    BRepExtrema_DistShapeShape* distss;
-    const TopoDS_Shape& _rShape;
-    bool isSolid {false};
+    class Private;
+    std::unique_ptr<Private> d;
 };
 
 class InspectionExport PropertyDistanceList: public App::PropertyLists
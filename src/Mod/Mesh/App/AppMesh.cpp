@@ -31,6 +31,7 @@
 #include "Exporter.h"
 #include "FacetPy.h"
 #include "FeatureMeshCurvature.h"
+#include "FeatureMeshDecimate.h"
 #include "FeatureMeshDefects.h"
 #include "FeatureMeshExport.h"
 #include "FeatureMeshImport.h"
@@ -109,6 +110,7 @@ PyMOD_INIT_FUNC(Mesh)
     Mesh::FixIndices            ::init();
     Mesh::FillHoles             ::init();
     Mesh::RemoveComponents      ::init();
+    Mesh::Decimate              ::init();
 
     Mesh::Sphere                ::init();
     Mesh::Ellipsoid             ::init();
@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#endif
+
+#include <Base/ThreadPool.h>
+
+#include "Adjacency.h"
+#include "Approximation.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// number of rows or facets from which a table is built in parallel
+constexpr std::size_t minParallelRows = 50000;
+
+/* Fills a table whose rows are scattered over the facets. The number of entries of each row is
+ * counted in a first pass, the entries are then written to the reserved slots in a second pass.
+ * emit(facet, add) calls add(row, index) for every entry of a facet.
+ */
+template<class Index, class Emit>
+void scatterRows(const MeshFacetArray& facets,
+                 std::size_t rows,
+                 std::vector<std::size_t>& offsets,
+                 std::vector<Index>& indices,
+                 Emit emit)
+{
+    std::vector<std::atomic<std::size_t>> next(rows);
+    Base::parallel_for(facets.size(), minParallelRows, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            emit(facets[i], [&next](std::size_t row, Index) {
+                next[row].fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+    });
+
+    offsets.resize(rows + 1);
+    offsets[0] = 0;
+    for (std::size_t row = 0; row < rows; row++) {
+        std::size_t count = next[row].load(std::memory_order_relaxed);
+        next[row].store(offsets[row], std::memory_order_relaxed);
+        offsets[row + 1] = offsets[row] + count;
+    }
+
+    indices.resize(offsets[rows]);
+    Base::parallel_for(facets.size(), minParallelRows, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            emit(facets[i], [&next, &indices](std::size_t row, Index index) {
+                indices[next[row].fetch_add(1, std::memory_order_relaxed)] = index;
+            });
+        }
+    });
+}
+}  // namespace
+
+template<class Index>
+void MeshAdjacencyTable<Index>::SortRows()
+{
+    const std::size_t rows = size();
+    std::vector<std::size_t> sizes(rows);
+    Base::parallel_for(rows, minParallelRows, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t row = begin; row < end; row++) {
+            auto first = _indices.begin() + _offsets[row];
+            auto last = _indices.begin() + _offsets[row + 1];
+            std::sort(first, last);
+            sizes[row] = std::unique(first, last) - first;
+        }
+    });
+
+    // move the rows with removed duplicates together
+    std::size_t pos = 0;
+    for (std::size_t row = 0; row < rows; row++) {
+        std::size_t first = _offsets[row];
+        _offsets[row] = pos;
+        if (pos != first) {
+            std::copy(_indices.begin() + first,
+                      _indices.begin() + first + sizes[row],
+                      _indices.begin() + pos);
+        }
+        pos += sizes[row];
+    }
+
+    if (rows > 0) {
+        _offsets[rows] = pos;
+    }
+    _indices.resize(pos);
+    _indices.shrink_to_fit();
+}
+
+// ----------------------------------------------------------------------------
+
+MeshPointFacetAdjacency::MeshPointFacetAdjacency(const MeshKernel& rclM)
+{
+    Rebuild(rclM);
+}
+
+void MeshPointFacetAdjacency::Rebuild(const MeshKernel& rclM)
+{
+    const MeshFacetArray& rFacets = rclM.GetFacets();
+    scatterRows<FacetIndex>(rFacets,
+                            rclM.CountPoints(),
+                            _offsets,
+                            _indices,
+                            [&rFacets](const MeshFacet& facet, auto add) {
+                                FacetIndex index = &facet - &rFacets[0];
+                                for (PointIndex point : facet._aulPoints) {
+                                    add(point, index);
+                                }
+                            });
+    SortRows();
+}
+
+std::vector<FacetIndex> MeshPointFacetAdjacency::GetIndices(PointIndex pos1,
+                                                            PointIndex pos2) const
+{
+    std::vector<FacetIndex> intersection;
+    Range set1 = (*this)[pos1];
+    Range set2 = (*this)[pos2];
+    std::set_intersection(set1.begin(),
+                          set1.end(),
+                          set2.begin(),
+                          set2.end(),
+                          std::back_inserter(intersection));
+    return intersection;
+}
+
+std::vector<FacetIndex>
+MeshPointFacetAdjacency::GetIndices(PointIndex pos1, PointIndex pos2, PointIndex pos3) const
+{
+    std::vector<FacetIndex> intersection;
+    std::vector<FacetIndex> set1 = GetIndices(pos1, pos2);
+    Range set2 = (*this)[pos3];
+    std::set_intersection(set1.begin(),
+                          set1.end(),
+                          set2.begin(),
+                          set2.end(),
+                          std::back_inserter(intersection));
+    return intersection;
+}
+
+std::set<PointIndex> MeshPointFacetAdjacency::NeighbourPoints(const MeshKernel& rclM,
+                                                              PointIndex pos) const
+{
+    std::set<PointIndex> p;
+    const MeshFacetArray& rFacets = rclM.GetFacets();
+    for (FacetIndex it : (*this)[pos]) {
+        for (PointIndex point : rFacets[it]._aulPoints) {
+            if (point != pos) {
+                p.insert(point);
+            }
+        }
+    }
+
+    return p;
+}
+
+Base::Vector3f MeshPointFacetAdjacency::GetNormal(const MeshKernel& rclM, PointIndex pos) const
+{
+    Base::Vector3f normal;
+    MeshGeomFacet f;
+    for (FacetIndex it : (*this)[pos]) {
+        f = rclM.GetFacet(it);
+        normal += f.Area() * f.GetNormal();
+    }
+
+    normal.Normalize();
+    return normal;
+}
+
+// ----------------------------------------------------------------------------
+
+MeshPointPointAdjacency::MeshPointPointAdjacency(const MeshKernel& rclM)
+{
+    Rebuild(rclM);
+}
+
+void MeshPointPointAdjacency::Rebuild(const MeshKernel& rclM)
+{
+    scatterRows<PointIndex>(rclM.GetFacets(),
+                            rclM.CountPoints(),
+                            _offsets,
+                            _indices,
+                            [](const MeshFacet& facet, auto add) {
+                                PointIndex ulP0 = facet._aulPoints[0];
+                                PointIndex ulP1 = facet._aulPoints[1];
+                                PointIndex ulP2 = facet._aulPoints[2];
+                                add(ulP0, ulP1);
+                                add(ulP0, ulP2);
+                                add(ulP1, ulP0);
+                                add(ulP1, ulP2);
+                                add(ulP2, ulP0);
+                                add(ulP2, ulP1);
+                            });
+    SortRows();
+}
+
+Base::Vector3f MeshPointPointAdjacency::GetNormal(const MeshKernel& rclM, PointIndex pos) const
+{
+    const MeshPointArray& rPoints = rclM.GetPoints();
+    MeshCore::PlaneFit pf;
+    pf.AddPoint(rPoints[pos]);
+    for (PointIndex it : (*this)[pos]) {
+        pf.AddPoint(rPoints[it]);
+    }
+
+    pf.Fit();
+
+    Base::Vector3f normal = pf.GetNormal();
+    normal.Normalize();
+    return normal;
+}
+
+float MeshPointPointAdjacency::GetAverageEdgeLength(const MeshKernel& rclM, PointIndex pos) const
+{
+    const MeshPointArray& rPoints = rclM.GetPoints();
+    float len = 0.0F;
+    Range n = (*this)[pos];
+    const Base::Vector3f& p = rPoints[pos];
+    for (PointIndex it : n) {
+        len += Base::Distance(p, rPoints[it]);
+    }
+    return (len / n.size());
+}
+
+// ----------------------------------------------------------------------------
+
+MeshFacetFacetAdjacency::MeshFacetFacetAdjacency(const MeshKernel& rclM)
+{
+    Rebuild(rclM, MeshPointFacetAdjacency(rclM));
+}
+
+MeshFacetFacetAdjacency::MeshFacetFacetAdjacency(const MeshKernel& rclM,
+                                                 const MeshPointFacetAdjacency& rclPF)
+{
+    Rebuild(rclM, rclPF);
+}
+
+void MeshFacetFacetAdjacency::Rebuild(const MeshKernel& rclM, const MeshPointFacetAdjacency& rclPF)
+{
+    // the rows are the concatenated facets of the three points of a facet
+    const MeshFacetArray& rFacets = rclM.GetFacets();
+    const std::size_t rows = rFacets.size();
+    _offsets.resize(rows + 1);
+    _offsets[0] = 0;
+    for (std::size_t i = 0; i < rows; i++) {
+        std::size_t count = 0;
+        for (PointIndex point : rFacets[i]._aulPoints) {
+            count += rclPF[point].size();
+        }
+        _offsets[i + 1] = _offsets[i] + count;
+    }
+
+    _indices.resize(_offsets[rows]);
+    Base::parallel_for(rows, minParallelRows, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            auto out = _indices.begin() + _offsets[i];
+            for (PointIndex point : rFacets[i]._aulPoints) {
+                Range faces = rclPF[point];
+                out = std::copy(faces.begin(), faces.end(), out);
+            }
+        }
+    });
+    SortRows();
+}
+
+std::vector<FacetIndex> MeshFacetFacetAdjacency::GetIndices(FacetIndex pos1,
+                                                            FacetIndex pos2) const
+{
+    std::vector<FacetIndex> intersection;
+    Range set1 = (*this)[pos1];
+    Range set2 = (*this)[pos2];
+    std::set_intersection(set1.begin(),
+                          set1.end(),
+                          set2.begin(),
+                          set2.end(),
+                          std::back_inserter(intersection));
+    return intersection;
+}
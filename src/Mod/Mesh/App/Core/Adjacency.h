@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_ADJACENCY_H
+#define MESH_ADJACENCY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * A read-only view on the sorted indices of one row of a MeshAdjacencyTable.
+ */
+template<class Index>
+class MeshIndexRange
+{
+public:
+    MeshIndexRange(const Index* first, const Index* last)
+        : _first(first)
+        , _last(last)
+    {}
+
+    const Index* begin() const
+    {
+        return _first;
+    }
+    const Index* end() const
+    {
+        return _last;
+    }
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(_last - _first);
+    }
+    bool empty() const
+    {
+        return _first == _last;
+    }
+    Index operator[](std::size_t pos) const
+    {
+        return _first[pos];
+    }
+    /// Checks with a binary search if \a index is in the range
+    bool contains(Index index) const
+    {
+        return std::binary_search(_first, _last, index);
+    }
+
+private:
+    const Index* _first;
+    const Index* _last;
+};
+
+/**
+ * The MeshAdjacencyTable stores the adjacent elements of each mesh element in compressed
+ * sparse row format: the indices of all rows are kept in one array and the rows are addressed
+ * by an offset array. The indices of a row are sorted and unique, so a row is iterated in the
+ * same order as the std::set of the corresponding MeshRef* class.
+ * The table only depends on the point indices of the facets. It must be rebuilt if they change
+ * but stays valid if points are moved.
+ */
+template<class Index>
+class MeshAdjacencyTable
+{
+public:
+    using Range = MeshIndexRange<Index>;
+
+    /// Returns the number of rows
+    std::size_t size() const
+    {
+        return _offsets.empty() ? 0 : _offsets.size() - 1;
+    }
+    /// Returns the sorted indices of row \a pos
+    Range operator[](std::size_t pos) const
+    {
+        const Index* data = _indices.data();
+        return Range(data + _offsets[pos], data + _offsets[pos + 1]);
+    }
+    /// Returns the number of required memory in bytes
+    std::size_t GetMemSize() const
+    {
+        return _offsets.size() * sizeof(std::size_t) + _indices.size() * sizeof(Index);
+    }
+
+protected:
+    /** Sorts the indices of each row, removes duplicates and compacts the arrays. The rows are
+     * processed in parallel for big tables.
+     */
+    void SortRows();
+
+protected:
+    std::vector<std::size_t> _offsets;
+    std::vector<Index> _indices;
+};
+
+/**
+ * The MeshPointFacetAdjacency holds the facets indexing a point. It provides the queries of
+ * MeshRefPointToFacets with contiguous rows and a fraction of its memory.
+ */
+class MeshExport MeshPointFacetAdjacency: public MeshAdjacencyTable<FacetIndex>
+{
+public:
+    /// Construction
+    explicit MeshPointFacetAdjacency(const MeshKernel& rclM);
+
+    /// Rebuilds up data structure
+    void Rebuild(const MeshKernel& rclM);
+    /// Returns the common facets of two points
+    std::vector<FacetIndex> GetIndices(PointIndex, PointIndex) const;
+    /// Returns the common facets of three points
+    std::vector<FacetIndex> GetIndices(PointIndex, PointIndex, PointIndex) const;
+    /// Returns the points that share a facet with the point \a pos
+    std::set<PointIndex> NeighbourPoints(const MeshKernel& rclM, PointIndex pos) const;
+    /// Returns the area-weighted normal of the facets of the point \a pos
+    Base::Vector3f GetNormal(const MeshKernel& rclM, PointIndex pos) const;
+};
+
+/**
+ * The MeshPointPointAdjacency holds the neighbour points of a point. Two points are
+ * neighbours if there is an edge indexing both points. It provides the queries of
+ * MeshRefPointToPoints.
+ */
+class MeshExport MeshPointPointAdjacency: public MeshAdjacencyTable<PointIndex>
+{
+public:
+    /// Construction
+    explicit MeshPointPointAdjacency(const MeshKernel& rclM);
+
+    /// Rebuilds up data structure
+    void Rebuild(const MeshKernel& rclM);
+    /// Returns the normal of the plane fitted through the point \a pos and its neighbours
+    Base::Vector3f GetNormal(const MeshKernel& rclM, PointIndex pos) const;
+    /// Returns the average length of the edges at the point \a pos
+    float GetAverageEdgeLength(const MeshKernel& rclM, PointIndex pos) const;
+};
+
+/**
+ * The MeshFacetFacetAdjacency holds the facets sharing at least one point with a facet,
+ * including the facet itself. It provides the queries of MeshRefFacetToFacets.
+ */
+class MeshExport MeshFacetFacetAdjacency: public MeshAdjacencyTable<FacetIndex>
+{
+public:
+    /// Construction
+    explicit MeshFacetFacetAdjacency(const MeshKernel& rclM);
+    /// Construction from the facets of the points of the mesh
+    MeshFacetFacetAdjacency(const MeshKernel& rclM, const MeshPointFacetAdjacency& rclPF);
+
+    /// Rebuilds up data structure
+    void Rebuild(const MeshKernel& rclM, const MeshPointFacetAdjacency& rclPF);
+    /// Returns the common facets of two facets
+    std::vector<FacetIndex> GetIndices(FacetIndex, FacetIndex) const;
+};
+
+}  // namespace MeshCore
+
+#endif  // MESH_ADJACENCY_H
@@ -31,6 +31,7 @@
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "BVH.h"
 #include "Elements.h"
 #include "Grid.h"
 #include "Iterator.h"
@@ -142,6 +143,15 @@ bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
     return false;
 }
 
+bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
+                                      const Base::Vector3f& rclDir,
+                                      const MeshFacetBVH& rclBVH,
+                                      Base::Vector3f& rclRes,
+                                      FacetIndex& rulFacet) const
+{
+    return rclBVH.NearestFacetOnRay(rclPt, rclDir, rclRes, rulFacet);
+}
+
 bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
                                       const Base::Vector3f& rclDir,
                                       float fMaxSearchArea,
@@ -355,7 +365,7 @@ void MeshAlgorithm::GetMeshBorders(std::list<std::vector<PointIndex>>& rclBorder
 void MeshAlgorithm::GetFacetBorders(const std::vector<FacetIndex>& raulInd,
                                     std::list<std::vector<Base::Vector3f>>& rclBorders) const
 {
-    const MeshPointArray& rclPAry = _rclMesh._aclPointArray;
+    const MeshPointArray& rclPAry = _rclMesh.PointArray();
     std::list<std::vector<PointIndex>> aulBorders;
 
     GetFacetBorders(raulInd, aulBorders, true);
@@ -375,7 +385,7 @@ void MeshAlgorithm::GetFacetBorders(const std::vector<FacetIndex>& raulInd,
                                     std::list<std::vector<PointIndex>>& rclBorders,
                                     bool ignoreOrientation) const
 {
-    const MeshFacetArray& rclFAry = _rclMesh._aclFacetArray;
+    const MeshFacetArray& rclFAry = _rclMesh.FacetArray();
 
     // mark all facets that are in the indices list
     ResetFacetFlag(MeshFacet::VISIT);
@@ -471,7 +481,7 @@ void MeshAlgorithm::GetFacetBorders(const std::vector<FacetIndex>& raulInd,
 
 void MeshAlgorithm::GetFacetBorder(FacetIndex uFacet, std::list<PointIndex>& rBorder) const
 {
-    const MeshFacetArray& rFAry = _rclMesh._aclFacetArray;
+    const MeshFacetArray& rFAry = _rclMesh.FacetArray();
     std::list<std::pair<PointIndex, PointIndex>> openEdges;
     if (uFacet >= rFAry.size()) {
         return;
@@ -509,8 +519,8 @@ void MeshAlgorithm::GetFacetsBorders(const std::vector<FacetIndex>& uFacets,
     SetFacetsFlag(uFacets, MeshFacet::TMP0);
     ResetPointFlag(MeshPoint::TMP0);
 
-    const MeshFacetArray& rFAry = _rclMesh._aclFacetArray;
-    const MeshPointArray& rPAry = _rclMesh._aclPointArray;
+    const MeshFacetArray& rFAry = _rclMesh.FacetArray();
+    const MeshPointArray& rPAry = _rclMesh.PointArray();
     std::list<std::pair<PointIndex, PointIndex>> openEdges;
 
     // add the open edge to the beginning of the list
@@ -606,7 +616,7 @@ void MeshAlgorithm::SplitBoundaryLoops(std::list<std::vector<PointIndex>>& aBord
 {
     // Count the number of open edges for each point
     std::map<PointIndex, int> openPointDegree;
-    for (const auto& jt : _rclMesh._aclFacetArray) {
+    for (const auto& jt : _rclMesh.FacetArray()) {
         for (int i = 0; i < 3; i++) {
             if (jt._aulNeighbours[i] == FACET_INDEX_MAX) {
                 openPointDegree[jt._aulPoints[i]]++;
@@ -698,12 +708,12 @@ bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary,
             return false;  // error, this must be an open edge!
         }
 
-        rFace = _rclMesh._aclFacetArray[f_int.front()];
+        rFace = _rclMesh.FacetArray()[f_int.front()];
         rTriangle = _rclMesh.GetFacet(rFace);
     }
     else {
         bool ready = false;
-        for (auto it = _rclMesh._aclFacetArray.begin(); it != _rclMesh._aclFacetArray.end(); ++it) {
+        for (auto it = _rclMesh.FacetArray().begin(); it != _rclMesh.FacetArray().end(); ++it) {
             for (int i = 0; i < 3; i++) {
                 if (((it->_aulPoints[i] == refPoint0) && (it->_aulPoints[(i + 1) % 3] == refPoint1))
                     || ((it->_aulPoints[i] == refPoint1)
@@ -724,8 +734,8 @@ bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary,
     // add points to the polygon
     std::vector<Base::Vector3f> polygon;
     for (PointIndex jt : boundary) {
-        polygon.push_back(_rclMesh._aclPointArray[jt]);
-        rPoints.push_back(_rclMesh._aclPointArray[jt]);
+        polygon.push_back(_rclMesh.PointArray()[jt]);
+        rPoints.push_back(_rclMesh.PointArray()[jt]);
     }
 
     // remove the last added point if it is duplicated
@@ -747,7 +757,7 @@ bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary,
     if (pP2FStructure && level > 0) {
         std::set<PointIndex> index = pP2FStructure->NeighbourPoints(boundary, level);
         for (PointIndex it : index) {
-            Base::Vector3f pt(_rclMesh._aclPointArray[it]);
+            Base::Vector3f pt(_rclMesh.PointArray()[it]);
             surf_pts.push_back(pt);
         }
     }
@@ -865,7 +875,7 @@ void MeshAlgorithm::SetFacetsProperty(const std::vector<FacetIndex>& raulInds,
 
     auto iP = raulProps.begin();
     for (auto i = raulInds.begin(); i != raulInds.end(); ++i, ++iP) {
-        _rclMesh._aclFacetArray[*i].SetProperty(*iP);
+        _rclMesh.FacetArray()[*i].SetProperty(*iP);
     }
 }
 
@@ -873,7 +883,7 @@ void MeshAlgorithm::SetFacetsFlag(const std::vector<FacetIndex>& raulInds,
                                   MeshFacet::TFlagType tF) const
 {
     for (FacetIndex it : raulInds) {
-        _rclMesh._aclFacetArray[it].SetFlag(tF);
+        _rclMesh.FacetArray()[it].SetFlag(tF);
     }
 }
 
@@ -881,15 +891,15 @@ void MeshAlgorithm::SetPointsFlag(const std::vector<FacetIndex>& raulInds,
                                   MeshPoint::TFlagType tF) const
 {
     for (PointIndex it : raulInds) {
-        _rclMesh._aclPointArray[it].SetFlag(tF);
+        _rclMesh.PointArray()[it].SetFlag(tF);
     }
 }
 
 void MeshAlgorithm::GetFacetsFlag(std::vector<FacetIndex>& raulInds, MeshFacet::TFlagType tF) const
 {
     raulInds.reserve(raulInds.size() + CountFacetFlag(tF));
-    MeshFacetArray::_TConstIterator beg = _rclMesh._aclFacetArray.begin();
-    MeshFacetArray::_TConstIterator end = _rclMesh._aclFacetArray.end();
+    MeshFacetArray::_TConstIterator beg = _rclMesh.FacetArray().begin();
+    MeshFacetArray::_TConstIterator end = _rclMesh.FacetArray().end();
     for (auto it = beg; it != end; ++it) {
         if (it->IsFlag(tF)) {
             raulInds.push_back(it - beg);
@@ -900,8 +910,8 @@ void MeshAlgorithm::GetFacetsFlag(std::vector<FacetIndex>& raulInds, MeshFacet::
 void MeshAlgorithm::GetPointsFlag(std::vector<PointIndex>& raulInds, MeshPoint::TFlagType tF) const
 {
     raulInds.reserve(raulInds.size() + CountPointFlag(tF));
-    MeshPointArray::_TConstIterator beg = _rclMesh._aclPointArray.begin();
-    MeshPointArray::_TConstIterator end = _rclMesh._aclPointArray.end();
+    MeshPointArray::_TConstIterator beg = _rclMesh.PointArray().begin();
+    MeshPointArray::_TConstIterator end = _rclMesh.PointArray().end();
     for (auto it = beg; it != end; ++it) {
         if (it->IsFlag(tF)) {
             raulInds.push_back(it - beg);
@@ -913,7 +923,7 @@ void MeshAlgorithm::ResetFacetsFlag(const std::vector<FacetIndex>& raulInds,
                                     MeshFacet::TFlagType tF) const
 {
     for (FacetIndex it : raulInds) {
-        _rclMesh._aclFacetArray[it].ResetFlag(tF);
+        _rclMesh.FacetArray()[it].ResetFlag(tF);
     }
 }
 
@@ -921,35 +931,35 @@ void MeshAlgorithm::ResetPointsFlag(const std::vector<FacetIndex>& raulInds,
                                     MeshPoint::TFlagType tF) const
 {
     for (PointIndex it : raulInds) {
-        _rclMesh._aclPointArray[it].ResetFlag(tF);
+        _rclMesh.PointArray()[it].ResetFlag(tF);
     }
 }
 
 void MeshAlgorithm::SetFacetFlag(MeshFacet::TFlagType tF) const
 {
-    _rclMesh._aclFacetArray.SetFlag(tF);
+    _rclMesh.FacetArray().SetFlag(tF);
 }
 
 void MeshAlgorithm::SetPointFlag(MeshPoint::TFlagType tF) const
 {
-    _rclMesh._aclPointArray.SetFlag(tF);
+    _rclMesh.PointArray().SetFlag(tF);
 }
 
 void MeshAlgorithm::ResetFacetFlag(MeshFacet::TFlagType tF) const
 {
-    _rclMesh._aclFacetArray.ResetFlag(tF);
+    _rclMesh.FacetArray().ResetFlag(tF);
 }
 
 void MeshAlgorithm::ResetPointFlag(MeshPoint::TFlagType tF) const
 {
-    _rclMesh._aclPointArray.ResetFlag(tF);
+    _rclMesh.PointArray().ResetFlag(tF);
 }
 
 unsigned long MeshAlgorithm::CountFacetFlag(MeshFacet::TFlagType tF) const
 {
     MeshIsFlag<MeshFacet> flag;
-    return std::count_if(_rclMesh._aclFacetArray.begin(),
-                         _rclMesh._aclFacetArray.end(),
+    return std::count_if(_rclMesh.FacetArray().begin(),
+                         _rclMesh.FacetArray().end(),
                          [flag, tF](const MeshFacet& f) {
                              return flag(f, tF);
                          });
@@ -958,8 +968,8 @@ unsigned long MeshAlgorithm::CountFacetFlag(MeshFacet::TFlagType tF) const
 unsigned long MeshAlgorithm::CountPointFlag(MeshPoint::TFlagType tF) const
 {
     MeshIsFlag<MeshPoint> flag;
-    return std::count_if(_rclMesh._aclPointArray.begin(),
-                         _rclMesh._aclPointArray.end(),
+    return std::count_if(_rclMesh.PointArray().begin(),
+                         _rclMesh.PointArray().end(),
                          [flag, tF](const MeshPoint& f) {
                              return flag(f, tF);
                          });
@@ -1386,7 +1396,7 @@ void MeshAlgorithm::CutBorderFacets(std::vector<FacetIndex>& raclFacetIndices,
 unsigned long MeshAlgorithm::CountBorderEdges() const
 {
     unsigned long cnt = 0;
-    const MeshFacetArray& rclFAry = _rclMesh._aclFacetArray;
+    const MeshFacetArray& rclFAry = _rclMesh.FacetArray();
     auto end = rclFAry.end();
     for (auto it = rclFAry.begin(); it != end; ++it) {
         for (FacetIndex facetIndex : it->_aulNeighbours) {
@@ -1406,7 +1416,7 @@ void MeshAlgorithm::CheckBorderFacets(const std::vector<FacetIndex>& raclFacetIn
     ResetFacetFlag(MeshFacet::TMP0);
     SetFacetsFlag(raclFacetIndices, MeshFacet::TMP0);
 
-    const MeshFacetArray& rclFAry = _rclMesh._aclFacetArray;
+    const MeshFacetArray& rclFAry = _rclMesh.FacetArray();
 
     for (unsigned short usL = 0; usL < usLevel; usL++) {
         for (FacetIndex facetIndex : raclFacetIndices) {
@@ -1432,7 +1442,7 @@ void MeshAlgorithm::GetBorderPoints(const std::vector<FacetIndex>& raclFacetIndi
     ResetFacetFlag(MeshFacet::TMP0);
     SetFacetsFlag(raclFacetIndices, MeshFacet::TMP0);
 
-    const MeshFacetArray& rclFAry = _rclMesh._aclFacetArray;
+    const MeshFacetArray& rclFAry = _rclMesh.FacetArray();
 
     for (FacetIndex facetIndex : raclFacetIndices) {
         for (int i = 0; i < 3; i++) {
@@ -1516,6 +1526,21 @@ bool MeshAlgorithm::NearestPointFromPoint(const Base::Vector3f& rclPt,
     return true;
 }
 
+bool MeshAlgorithm::NearestPointFromPoint(const Base::Vector3f& rclPt,
+                                          const MeshFacetBVH& rclBVH,
+                                          FacetIndex& rclResFacetIndex,
+                                          Base::Vector3f& rclResPoint) const
+{
+    FacetIndex ulInd = rclBVH.NearestFacetToPoint(rclPt, rclResPoint);
+
+    if (ulInd == FACET_INDEX_MAX) {
+        return false;
+    }
+
+    rclResFacetIndex = ulInd;
+    return true;
+}
+
 bool MeshAlgorithm::CutWithPlane(const Base::Vector3f& clBase,
                                  const Base::Vector3f& clNormal,
                                  const MeshFacetGrid& rclGrid,
@@ -1772,8 +1797,8 @@ void MeshAlgorithm::GetFacetsFromPlane(const MeshFacetGrid& rclGrid,
 void MeshAlgorithm::PointsFromFacetsIndices(const std::vector<FacetIndex>& rvecIndices,
                                             std::vector<Base::Vector3f>& rvecPoints) const
 {
-    const MeshFacetArray& rclFAry = _rclMesh._aclFacetArray;
-    const MeshPointArray& rclPAry = _rclMesh._aclPointArray;
+    const MeshFacetArray& rclFAry = _rclMesh.FacetArray();
+    const MeshPointArray& rclPAry = _rclMesh.PointArray();
 
     std::set<PointIndex> setPoints;
 
@@ -1794,8 +1819,8 @@ bool MeshAlgorithm::Distance(const Base::Vector3f& rclPt,
                              float fMaxDistance,
                              float& rfDistance) const
 {
-    const MeshFacetArray& rclFAry = _rclMesh._aclFacetArray;
-    const MeshPointArray& rclPAry = _rclMesh._aclPointArray;
+    const MeshFacetArray& rclFAry = _rclMesh.FacetArray();
+    const MeshPointArray& rclPAry = _rclMesh.PointArray();
     const PointIndex* pulIdx = rclFAry[ulFacetIdx]._aulPoints;
 
     BoundBox3f clBB;
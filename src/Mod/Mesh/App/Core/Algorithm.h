@@ -46,6 +46,7 @@ class MeshGeomFacet;
 class MeshGeomEdge;
 class MeshKernel;
 class MeshFacetGrid;
+class MeshFacetBVH;
 class MeshFacetArray;
 class MeshRefPointToFacets;
 class AbstractPolygonTriangulator;
@@ -99,6 +100,19 @@ public:
                            const MeshFacetGrid& rclGrid,
                            Base::Vector3f& rclRes,
                            FacetIndex& rulFacet) const;
+    /**
+     * Searches for the nearest facet to the ray defined by
+     * (\a rclPt, \a rclDir).
+     * The point \a rclRes holds the intersection point with the ray and the
+     * nearest facet with index \a rulFacet.
+     * \note This method is optimized by using a bounding volume hierarchy. Unlike the grid
+     * it doesn't suffer from an uneven distribution of the facets.
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& rclPt,
+                           const Base::Vector3f& rclDir,
+                           const MeshFacetBVH& rclBVH,
+                           Base::Vector3f& rclRes,
+                           FacetIndex& rulFacet) const;
     /**
      * Searches for the nearest facet to the ray defined by
      * (\a rclPt, \a rclDir).
@@ -356,6 +370,10 @@ public:
                                float fMaxSearchArea,
                                FacetIndex& rclResFacetIndex,
                                Base::Vector3f& rclResPoint) const;
+    bool NearestPointFromPoint(const Base::Vector3f& rclPt,
+                               const MeshFacetBVH& rclBVH,
+                               FacetIndex& rclResFacetIndex,
+                               Base::Vector3f& rclResPoint) const;
     /** Cuts the mesh with a plane. The result is a list of polylines. */
     bool CutWithPlane(const Base::Vector3f& clBase,
                       const Base::Vector3f& clNormal,
@@ -0,0 +1,583 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/ThreadPool.h>
+
+#include "BVH.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// number of facets or rays from which the work is split over several threads
+constexpr std::size_t minParallelFacets = 50000;
+constexpr std::size_t minParallelRays = 1024;
+// number of bins per axis to evaluate the surface area heuristic
+constexpr int numBins = 16;
+// a node with at most this number of facets becomes a leaf if a split doesn't pay off
+constexpr std::size_t maxLeafSize = 8;
+// relative cost of traversing an inner node compared to a ray/triangle test
+constexpr float traversalCost = 1.0F;
+// from this depth on nodes are split in the middle to bound the depth of the tree
+constexpr std::uint32_t maxSAHDepth = 64;
+// the depth is at most maxSAHDepth plus the depth of a balanced tree over 2^32 facets
+constexpr int maxStackSize = 128;
+
+struct Bounds
+{
+    float bmin[3] {FLOAT_MAX, FLOAT_MAX, FLOAT_MAX};
+    float bmax[3] {-FLOAT_MAX, -FLOAT_MAX, -FLOAT_MAX};
+
+    void Add(const float* pmin, const float* pmax)
+    {
+        for (int k = 0; k < 3; k++) {
+            bmin[k] = std::min(bmin[k], pmin[k]);
+            bmax[k] = std::max(bmax[k], pmax[k]);
+        }
+    }
+    void Add(const Bounds& b)
+    {
+        Add(b.bmin, b.bmax);
+    }
+    float HalfArea() const
+    {
+        float dx = bmax[0] - bmin[0];
+        float dy = bmax[1] - bmin[1];
+        float dz = bmax[2] - bmin[2];
+        if (dx < 0.0F) {
+            return 0.0F;
+        }
+        return dx * dy + dy * dz + dz * dx;
+    }
+};
+
+struct Primitive
+{
+    Bounds box;
+    float center[3];
+};
+
+struct Bin
+{
+    Bounds box;
+    std::size_t count {0};
+};
+
+/* The squared distance of a point to a box, zero if the point is inside. */
+inline float distanceSquared(const float* bmin, const float* bmax, const Base::Vector3f& pt)
+{
+    float dx = std::max({bmin[0] - pt.x, 0.0F, pt.x - bmax[0]});
+    float dy = std::max({bmin[1] - pt.y, 0.0F, pt.y - bmax[1]});
+    float dz = std::max({bmin[2] - pt.z, 0.0F, pt.z - bmax[2]});
+    return dx * dx + dy * dy + dz * dz;
+}
+}  // namespace
+
+struct MeshFacetBVH::Ray
+{
+    Ray(const Base::Vector3f& pt, const Base::Vector3f& dir)
+        : org {pt.x, pt.y, pt.z}
+        , dir {dir.x, dir.y, dir.z}
+    {
+        // a large finite value instead of infinity avoids 0 * inf in the slab test
+        for (int k = 0; k < 3; k++) {
+            inv[k] = this->dir[k] != 0.0F ? 1.0F / this->dir[k] : std::numeric_limits<float>::max();
+        }
+    }
+
+    /* Slab test, returns the entry parameter or FLOAT_MAX if the box is missed or is behind
+     * the nearest hit found so far.
+     */
+    float Entry(const Node& node) const
+    {
+        float tmin = 0.0F;
+        float tmax = tnear;
+        for (int k = 0; k < 3; k++) {
+            float t1 = (node.bmin[k] - org[k]) * inv[k];
+            float t2 = (node.bmax[k] - org[k]) * inv[k];
+            tmin = std::max(tmin, std::min(t1, t2));
+            tmax = std::min(tmax, std::max(t1, t2));
+        }
+        return tmin <= tmax ? tmin : FLOAT_MAX;
+    }
+
+    float org[3];
+    float dir[3];
+    float inv[3];
+    float tnear {FLOAT_MAX};
+    std::uint32_t hit {std::numeric_limits<std::uint32_t>::max()};
+};
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& rclM)
+    : _rclMesh(rclM)
+{
+    Rebuild();
+}
+
+void MeshFacetBVH::Rebuild()
+{
+    _nodes.clear();
+    _facets.clear();
+    for (auto& it : _triangles) {
+        it.clear();
+    }
+
+    const MeshPointArray& rPoints = _rclMesh.GetPoints();
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    const std::size_t count = rFacets.size();
+    if (count == 0) {
+        return;
+    }
+    if (count >= std::numeric_limits<std::uint32_t>::max() / 2) {
+        throw Base::ValueError("Too many facets for a bounding volume hierarchy");
+    }
+
+    std::vector<Primitive> prims(count);
+    Base::parallel_for(count, minParallelFacets, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            Primitive& prim = prims[i];
+            for (PointIndex index : rFacets[i]._aulPoints) {
+                const MeshPoint& pnt = rPoints[index];
+                float coords[3] = {pnt.x, pnt.y, pnt.z};
+                prim.box.Add(coords, coords);
+            }
+            for (int k = 0; k < 3; k++) {
+                prim.center[k] = 0.5F * (prim.box.bmin[k] + prim.box.bmax[k]);
+            }
+        }
+    });
+
+    _facets.resize(count);
+    std::iota(_facets.begin(), _facets.end(), FacetIndex(0));
+    _nodes.reserve(2 * count);
+    _nodes.emplace_back();
+
+    struct Task
+    {
+        std::uint32_t node;
+        std::uint32_t depth;
+        std::size_t begin;
+        std::size_t end;
+    };
+    std::vector<Task> tasks;
+    tasks.push_back({0, 0, 0, count});
+
+    while (!tasks.empty()) {
+        Task task = tasks.back();
+        tasks.pop_back();
+        const std::size_t num = task.end - task.begin;
+
+        Bounds box;
+        Bounds centers;
+        for (std::size_t i = task.begin; i < task.end; i++) {
+            const Primitive& prim = prims[_facets[i]];
+            box.Add(prim.box);
+            centers.Add(prim.center, prim.center);
+        }
+
+        Node& node = _nodes[task.node];
+        std::copy(box.bmin, box.bmin + 3, node.bmin);
+        std::copy(box.bmax, box.bmax + 3, node.bmax);
+        node.first = static_cast<std::uint32_t>(task.begin);
+        node.count = static_cast<std::uint32_t>(num);
+        if (num <= 2) {
+            continue;
+        }
+
+        // evaluate the surface area heuristic for the bin borders of all three axes
+        int bestAxis = -1;
+        int bestSplit = 0;
+        float bestCost = FLOAT_MAX;
+        for (int axis = 0; axis < 3 && task.depth < maxSAHDepth; axis++) {
+            float extent = centers.bmax[axis] - centers.bmin[axis];
+            if (extent <= 0.0F) {
+                continue;
+            }
+
+            float scale = numBins / extent;
+            Bin bins[numBins];
+            for (std::size_t i = task.begin; i < task.end; i++) {
+                const Primitive& prim = prims[_facets[i]];
+                int b = std::min(numBins - 1,
+                                 int((prim.center[axis] - centers.bmin[axis]) * scale));
+                bins[b].box.Add(prim.box);
+                bins[b].count++;
+            }
+
+            float rightArea[numBins];
+            std::size_t rightCount[numBins];
+            Bounds right;
+            std::size_t numRight = 0;
+            for (int b = numBins - 1; b > 0; b--) {
+                right.Add(bins[b].box);
+                numRight += bins[b].count;
+                rightArea[b] = right.HalfArea();
+                rightCount[b] = numRight;
+            }
+
+            Bounds left;
+            std::size_t numLeft = 0;
+            for (int b = 0; b < numBins - 1; b++) {
+                left.Add(bins[b].box);
+                numLeft += bins[b].count;
+                if (numLeft == 0 || rightCount[b + 1] == 0) {
+                    continue;
+                }
+                float cost = float(numLeft) * left.HalfArea()
+                    + float(rightCount[b + 1]) * rightArea[b + 1];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = b;
+                }
+            }
+        }
+
+        std::size_t mid = task.begin;
+        if (bestAxis >= 0) {
+            float area = box.HalfArea();
+            float splitCost = area > 0.0F ? traversalCost + bestCost / area : 0.0F;
+            if (num <= maxLeafSize && splitCost >= float(num)) {
+                continue;
+            }
+
+            float extent = centers.bmax[bestAxis] - centers.bmin[bestAxis];
+            float scale = numBins / extent;
+            float cmin = centers.bmin[bestAxis];
+            auto it = std::partition(_facets.begin() + task.begin,
+                                     _facets.begin() + task.end,
+                                     [&](FacetIndex f) {
+                                         int b = std::min(numBins - 1,
+                                                          int((prims[f].center[bestAxis] - cmin)
+                                                              * scale));
+                                         return b <= bestSplit;
+                                     });
+            mid = it - _facets.begin();
+        }
+        else if (num <= maxLeafSize) {
+            continue;
+        }
+
+        // all centroids coincide, the binning failed or the tree is too deep, split in the middle
+        if (mid == task.begin || mid == task.end) {
+            mid = task.begin + num / 2;
+        }
+
+        auto left = static_cast<std::uint32_t>(_nodes.size());
+        _nodes[task.node].first = left;
+        _nodes[task.node].count = 0;
+        _nodes.emplace_back();
+        _nodes.emplace_back();
+        tasks.push_back({left + 1, task.depth + 1, mid, task.end});
+        tasks.push_back({left, task.depth + 1, task.begin, mid});
+    }
+    _nodes.shrink_to_fit();
+
+    // store corner and edges of the facets in leaf order
+    for (auto& it : _triangles) {
+        it.resize(count);
+    }
+    Base::parallel_for(count, minParallelFacets, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& face = rFacets[_facets[i]];
+            const MeshPoint& p0 = rPoints[face._aulPoints[0]];
+            const MeshPoint& p1 = rPoints[face._aulPoints[1]];
+            const MeshPoint& p2 = rPoints[face._aulPoints[2]];
+            _triangles[0][i] = p0.x;
+            _triangles[1][i] = p0.y;
+            _triangles[2][i] = p0.z;
+            _triangles[3][i] = p1.x - p0.x;
+            _triangles[4][i] = p1.y - p0.y;
+            _triangles[5][i] = p1.z - p0.z;
+            _triangles[6][i] = p2.x - p0.x;
+            _triangles[7][i] = p2.y - p0.y;
+            _triangles[8][i] = p2.z - p0.z;
+        }
+    });
+}
+
+void MeshFacetBVH::IntersectLeaf(const Node& node, Ray& ray) const
+{
+    const float* v0x = _triangles[0].data();
+    const float* v0y = _triangles[1].data();
+    const float* v0z = _triangles[2].data();
+    const float* e1x = _triangles[3].data();
+    const float* e1y = _triangles[4].data();
+    const float* e1z = _triangles[5].data();
+    const float* e2x = _triangles[6].data();
+    const float* e2y = _triangles[7].data();
+    const float* e2z = _triangles[8].data();
+    const float dx = ray.dir[0];
+    const float dy = ray.dir[1];
+    const float dz = ray.dir[2];
+    const float dd = dx * dx + dy * dy + dz * dz;
+
+    // Möller-Trumbore, the loop body is free of early exits so that it can be vectorized
+    const std::uint32_t last = node.first + node.count;
+    for (std::uint32_t i = node.first; i < last; i++) {
+        float px = dy * e2z[i] - dz * e2y[i];
+        float py = dz * e2x[i] - dx * e2z[i];
+        float pz = dx * e2y[i] - dy * e2x[i];
+        float det = e1x[i] * px + e1y[i] * py + e1z[i] * pz;
+
+        // the same parallelism check as MeshGeomFacet::Foraminate
+        float nx = e1y[i] * e2z[i] - e1z[i] * e2y[i];
+        float ny = e1z[i] * e2x[i] - e1x[i] * e2z[i];
+        float nz = e1x[i] * e2y[i] - e1y[i] * e2x[i];
+        float nn = nx * nx + ny * ny + nz * nz;
+        bool parallel = det * det <= 1.0e-6F * dd * nn;
+        float inv = parallel ? 0.0F : 1.0F / det;
+
+        float tx = ray.org[0] - v0x[i];
+        float ty = ray.org[1] - v0y[i];
+        float tz = ray.org[2] - v0z[i];
+        float u = (tx * px + ty * py + tz * pz) * inv;
+
+        float qx = ty * e1z[i] - tz * e1y[i];
+        float qy = tz * e1x[i] - tx * e1z[i];
+        float qz = tx * e1y[i] - ty * e1x[i];
+        float v = (dx * qx + dy * qy + dz * qz) * inv;
+        float t = (e2x[i] * qx + e2y[i] * qy + e2z[i] * qz) * inv;
+
+        bool hit = !parallel && u >= 0.0F && v >= 0.0F && u + v <= 1.0F && t >= 0.0F
+            && t < ray.tnear;
+        ray.tnear = hit ? t : ray.tnear;
+        ray.hit = hit ? i : ray.hit;
+    }
+}
+
+void MeshFacetBVH::Intersect(Ray& ray) const
+{
+    if (_nodes.empty() || ray.Entry(_nodes[0]) == FLOAT_MAX) {
+        return;
+    }
+
+    std::uint32_t stack[maxStackSize];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Node& node = _nodes[stack[--top]];
+        if (node.count > 0) {
+            IntersectLeaf(node, ray);
+            continue;
+        }
+
+        // visit the nearer child first so that the farther one can be culled
+        std::uint32_t near = node.first;
+        std::uint32_t far = node.first + 1;
+        float tnear = ray.Entry(_nodes[near]);
+        float tfar = ray.Entry(_nodes[far]);
+        if (tfar < tnear) {
+            std::swap(near, far);
+            std::swap(tnear, tfar);
+        }
+        if (tfar < ray.tnear) {
+            stack[top++] = far;
+        }
+        if (tnear < ray.tnear) {
+            stack[top++] = near;
+        }
+    }
+}
+
+bool MeshFacetBVH::NearestFacetOnRay(const Base::Vector3f& rclPt,
+                                     const Base::Vector3f& rclDir,
+                                     Base::Vector3f& rclRes,
+                                     FacetIndex& rulFacet) const
+{
+    Ray ray(rclPt, rclDir);
+    Intersect(ray);
+    if (ray.hit == std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+
+    rulFacet = _facets[ray.hit];
+    rclRes = rclPt + ray.tnear * rclDir;
+    return true;
+}
+
+std::vector<MeshFacetBVH::RayHit>
+MeshFacetBVH::NearestFacetsOnRays(const std::vector<Base::Vector3f>& rclPts,
+                                  const Base::Vector3f& rclDir) const
+{
+    std::vector<RayHit> hits(rclPts.size());
+    Base::parallel_for(rclPts.size(), minParallelRays, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            RayHit& hit = hits[i];
+            if (!NearestFacetOnRay(rclPts[i], rclDir, hit.point, hit.facet)) {
+                hit.facet = FACET_INDEX_MAX;
+            }
+        }
+    });
+    return hits;
+}
+
+std::vector<MeshFacetBVH::RayHit>
+MeshFacetBVH::NearestFacetsOnRays(const std::vector<Base::Vector3f>& rclPts,
+                                  const std::vector<Base::Vector3f>& rclDirs) const
+{
+    if (rclPts.size() != rclDirs.size()) {
+        throw Base::ValueError("Number of points and directions doesn't match");
+    }
+
+    std::vector<RayHit> hits(rclPts.size());
+    Base::parallel_for(rclPts.size(), minParallelRays, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            RayHit& hit = hits[i];
+            if (!NearestFacetOnRay(rclPts[i], rclDirs[i], hit.point, hit.facet)) {
+                hit.facet = FACET_INDEX_MAX;
+            }
+        }
+    });
+    return hits;
+}
+
+std::vector<MeshFacetBVH::RayHit>
+MeshFacetBVH::NearestFacetsOnLines(const std::vector<Base::Vector3f>& rclPts,
+                                   const Base::Vector3f& rclDir) const
+{
+    std::vector<RayHit> hits(rclPts.size());
+    Base::parallel_for(rclPts.size(), minParallelRays, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            RayHit& hit = hits[i];
+            if (!NearestFacetOnRay(rclPts[i], rclDir, hit.point, hit.facet)) {
+                hit.facet = FACET_INDEX_MAX;
+            }
+
+            // take the hit behind the point if it's nearer
+            RayHit back;
+            if (NearestFacetOnRay(rclPts[i], -rclDir, back.point, back.facet)
+                && (hit.facet == FACET_INDEX_MAX
+                    || Base::DistanceP2(back.point, rclPts[i])
+                        < Base::DistanceP2(hit.point, rclPts[i]))) {
+                hit = back;
+            }
+        }
+    });
+    return hits;
+}
+
+FacetIndex MeshFacetBVH::NearestFacetToPoint(const Base::Vector3f& rclPt,
+                                             Base::Vector3f& rclRes,
+                                             float fMaxDist) const
+{
+    FacetIndex facet = FACET_INDEX_MAX;
+    if (_nodes.empty()) {
+        return facet;
+    }
+
+    float fMinDist = fMaxDist;
+    float fMinDist2 = fMaxDist * fMaxDist;
+    Base::Vector3f res;
+
+    struct Entry
+    {
+        std::uint32_t node;
+        float dist2;
+    };
+    std::vector<Entry> stack;
+    stack.push_back({0, distanceSquared(_nodes[0].bmin, _nodes[0].bmax, rclPt)});
+    while (!stack.empty()) {
+        Entry entry = stack.back();
+        stack.pop_back();
+        if (entry.dist2 >= fMinDist2) {
+            continue;
+        }
+
+        const Node& node = _nodes[entry.node];
+        if (node.count > 0) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; i++) {
+                float dist = _rclMesh.GetFacet(_facets[i]).DistanceToPoint(rclPt, res);
+                if (dist < fMinDist) {
+                    fMinDist = dist;
+                    fMinDist2 = dist * dist;
+                    facet = _facets[i];
+                    rclRes = res;
+                }
+            }
+            continue;
+        }
+
+        // push the farther child first so that the nearer one is searched first
+        Entry first {node.first, distanceSquared(_nodes[node.first].bmin,
+                                                 _nodes[node.first].bmax,
+                                                 rclPt)};
+        Entry second {node.first + 1, distanceSquared(_nodes[node.first + 1].bmin,
+                                                      _nodes[node.first + 1].bmax,
+                                                      rclPt)};
+        if (first.dist2 < second.dist2) {
+            std::swap(first, second);
+        }
+        stack.push_back(first);
+        stack.push_back(second);
+    }
+
+    return facet;
+}
+
+void MeshFacetBVH::Inside(const Base::BoundBox3f& rclBB, std::vector<FacetIndex>& raulElements) const
+{
+    std::vector<FacetIndex> candidates;
+    Search([&rclBB](const Base::BoundBox3f& box) { return box && rclBB; }, candidates);
+
+    // the leaves may contain facets outside of the box
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    const MeshPointArray& rPoints = _rclMesh.GetPoints();
+    for (FacetIndex index : candidates) {
+        Base::BoundBox3f box;
+        for (PointIndex point : rFacets[index]._aulPoints) {
+            box.Add(rPoints[point]);
+        }
+        if (box && rclBB) {
+            raulElements.push_back(index);
+        }
+    }
+}
+
+Base::BoundBox3f MeshFacetBVH::GetBoundBox() const
+{
+    if (_nodes.empty()) {
+        return Base::BoundBox3f();
+    }
+    return _nodes[0].GetBoundBox();
+}
+
+std::size_t MeshFacetBVH::GetMemSize() const
+{
+    std::size_t size = _nodes.capacity() * sizeof(Node) + _facets.capacity() * sizeof(FacetIndex);
+    for (const auto& it : _triangles) {
+        size += it.capacity() * sizeof(float);
+    }
+    return size;
+}
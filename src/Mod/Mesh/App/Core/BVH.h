@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_BVH_H
+#define MESH_BVH_H
+
+#include <cstdint>
+#include <vector>
+
+#include <Base/BoundBox.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshFacetBVH is a bounding volume hierarchy over the facets of a mesh. It's an
+ * alternative to the MeshFacetGrid for ray casting and nearest facet searches that doesn't
+ * depend on an even distribution of the facets, e.g. for scans with dense and sparse regions.
+ *
+ * The tree is built with the surface area heuristic over binned facet centroids. The nodes
+ * are stored in one array with both children of a node next to each other, the corner and
+ * edge vectors of the facets are stored per coordinate in leaf order so that the intersection
+ * tests of a leaf run over contiguous arrays.
+ *
+ * \note If the underlying mesh kernel gets changed the tree becomes invalid and must be rebuilt.
+ * \code
+ * MeshFacetBVH bvh(kernel);
+ * Base::Vector3f hit;
+ * FacetIndex facet;
+ * if (bvh.NearestFacetOnRay(point, dir, hit, facet)) {
+ *     ...
+ * }
+ * \endcode
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    /// The result of a ray query, facet is FACET_INDEX_MAX if the ray misses the mesh
+    struct RayHit
+    {
+        FacetIndex facet {FACET_INDEX_MAX};
+        Base::Vector3f point;
+    };
+
+    /** @name Construction */
+    //@{
+    explicit MeshFacetBVH(const MeshKernel& rclM);
+    /// Rebuilds the tree after the mesh has changed
+    void Rebuild();
+    //@}
+
+    /** @name Search */
+    //@{
+    /** Searches for the nearest facet hit by the ray starting at \a rclPt in direction
+     * \a rclDir. The point \a rclRes holds the intersection point and \a rulFacet the index of
+     * the facet. Returns false if the ray doesn't hit the mesh.
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& rclPt,
+                           const Base::Vector3f& rclDir,
+                           Base::Vector3f& rclRes,
+                           FacetIndex& rulFacet) const;
+    /** Casts a ray in direction \a rclDir from each of the points \a rclPts. The rays are
+     * processed in parallel for big batches.
+     */
+    std::vector<RayHit> NearestFacetsOnRays(const std::vector<Base::Vector3f>& rclPts,
+                                            const Base::Vector3f& rclDir) const;
+    /** Casts a ray from each of the points \a rclPts in the corresponding direction of
+     * \a rclDirs. Both arrays must have the same size.
+     */
+    std::vector<RayHit> NearestFacetsOnRays(const std::vector<Base::Vector3f>& rclPts,
+                                            const std::vector<Base::Vector3f>& rclDirs) const;
+    /** Like NearestFacetsOnRays() but the facets behind the points are found too, i.e. the
+     * nearest facet cut by the line through each of the points \a rclPts in direction
+     * \a rclDir is searched. This is what the ray search on a MeshFacetGrid does.
+     */
+    std::vector<RayHit> NearestFacetsOnLines(const std::vector<Base::Vector3f>& rclPts,
+                                             const Base::Vector3f& rclDir) const;
+    /** Searches for the facet nearest to the point \a rclPt with a distance lower than
+     * \a fMaxDist. The point \a rclRes holds the nearest point on the facet. Returns
+     * FACET_INDEX_MAX if no facet is found.
+     */
+    FacetIndex NearestFacetToPoint(const Base::Vector3f& rclPt,
+                                   Base::Vector3f& rclRes,
+                                   float fMaxDist = FLOAT_MAX) const;
+    /** Returns the indices of all facets whose bounding box intersects \a rclBB. */
+    void Inside(const Base::BoundBox3f& rclBB, std::vector<FacetIndex>& raulElements) const;
+    /** Returns the indices of all facets in leaves whose bounding box and the bounding boxes of
+     * all parent nodes pass \a test. The test is called with a Base::BoundBox3f.
+     */
+    template<class Test>
+    void Search(Test test, std::vector<FacetIndex>& raulElements) const;
+    //@}
+
+    /// Returns the bounding box of all facets
+    Base::BoundBox3f GetBoundBox() const;
+    /// Returns the number of required memory in bytes
+    std::size_t GetMemSize() const;
+
+private:
+    struct Node
+    {
+        float bmin[3];
+        float bmax[3];
+        /// index of the left child, the right child follows, or of the first facet of a leaf
+        std::uint32_t first;
+        /// the number of facets of a leaf, 0 for an inner node
+        std::uint32_t count;
+
+        Base::BoundBox3f GetBoundBox() const
+        {
+            return Base::BoundBox3f(bmin[0], bmin[1], bmin[2], bmax[0], bmax[1], bmax[2]);
+        }
+    };
+
+    struct Ray;
+    void Intersect(Ray& ray) const;
+    void IntersectLeaf(const Node& node, Ray& ray) const;
+
+private:
+    const MeshKernel& _rclMesh; /**< The mesh kernel. */
+    std::vector<Node> _nodes;
+    std::vector<FacetIndex> _facets;  /**< The facet indices in leaf order. */
+    std::vector<float> _triangles[9]; /**< Corner, first and second edge per coordinate. */
+};
+
+template<class Test>
+void MeshFacetBVH::Search(Test test, std::vector<FacetIndex>& raulElements) const
+{
+    if (_nodes.empty()) {
+        return;
+    }
+
+    std::vector<std::uint32_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (!test(node.GetBoundBox())) {
+            continue;
+        }
+        if (node.count > 0) {
+            raulElements.insert(raulElements.end(),
+                                _facets.begin() + node.first,
+                                _facets.begin() + node.first + node.count);
+        }
+        else {
+            stack.push_back(node.first + 1);
+            stack.push_back(node.first);
+        }
+    }
+}
+
+}  // namespace MeshCore
+
+#endif  // MESH_BVH_H
@@ -24,10 +24,14 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
 #endif
 
 #include <Base/Exception.h>
 #include <Base/Sequencer.h>
+#include <Base/ThreadPool.h>
 
 #include "Builder.h"
 #include "Functional.h"
@@ -67,7 +71,7 @@ void MeshBuilder::Initialize(size_t ctFacets, bool deletion)
         //       This usually happens if its elements are added without specifying its final size.
         //       Later on it's a bit tricky to free the wasted memory. So we're strived to avoid the
         //       wastage of memory.
-        _meshKernel._aclFacetArray.reserve(ctFacets);
+        _meshKernel.FacetArray().reserve(ctFacets);
 
         // Usually the number of vertices is the half of the number of facets. So we reserve this
         // memory with 10% surcharge To save memory we hold an array with iterators that point to
@@ -77,7 +81,7 @@ void MeshBuilder::Initialize(size_t ctFacets, bool deletion)
         _ptIdx = 0;
     }
     else {
-        for (const auto& it1 : _meshKernel._aclPointArray) {
+        for (const auto& it1 : _meshKernel.PointArray()) {
             MeshPointIterator pit = _points.insert(it1);
             _pointsIterator.push_back(pit);
         }
@@ -85,15 +89,15 @@ void MeshBuilder::Initialize(size_t ctFacets, bool deletion)
 
         // As we have a copy of our vertices in the set we must clear them from our array now  But
         // we can keep its memory as we reuse it later on anyway.
-        _meshKernel._aclPointArray.clear();
+        _meshKernel.PointArray().clear();
         // additional memory
-        size_t newCtFacets = _meshKernel._aclFacetArray.size() + ctFacets;
-        _meshKernel._aclFacetArray.reserve(newCtFacets);
+        size_t newCtFacets = _meshKernel.FacetArray().size() + ctFacets;
+        _meshKernel.FacetArray().reserve(newCtFacets);
         size_t ctPoints = newCtFacets / 2;
         _pointsIterator.reserve(static_cast<size_t>(float(ctPoints) * 1.10F));
     }
 
-    this->_seq = new Base::SequencerLauncher("create mesh structure...", ctFacets * 2);
+    this->_seq = new Base::SequencerLauncher("create mesh structure...", ctFacets);
 }
 
 void MeshBuilder::AddFacet(const MeshGeomFacet& facet, bool takeFlag, bool takeProperty)
@@ -162,63 +166,28 @@ void MeshBuilder::AddFacet(Base::Vector3f* facetPoints, unsigned char flag, unsi
         return;
     }
 
-    _meshKernel._aclFacetArray.push_back(mf);
+    _meshKernel.FacetArray().push_back(mf);
 }
 
 void MeshBuilder::SetNeighbourhood()
 {
-    std::set<Edge> edges;
-    FacetIndex facetIdx = 0;
-
-    for (auto& mf : _meshKernel._aclFacetArray) {
-        this->_seq->next(true);  // allow one to cancel
-        for (int i = 0; i < 3; i++) {
-            Edge edge(mf._aulPoints[i], mf._aulPoints[(i + 1) % 3], facetIdx);
-            std::set<Edge>::iterator e = edges.find(edge);
-            if (e != edges.end()) {  // edge exists, set neighbourhood
-                MeshFacet& mf1 = _meshKernel._aclFacetArray[e->facetIdx];
-                if (mf1._aulPoints[0] == edge.pt1) {
-                    if (mf1._aulPoints[1] == edge.pt2) {
-                        mf1._aulNeighbours[0] = facetIdx;
-                    }
-                    else {
-                        mf1._aulNeighbours[2] = facetIdx;
-                    }
-                }
-                else if (mf1._aulPoints[0] == edge.pt2) {
-                    if (mf1._aulPoints[1] == edge.pt1) {
-                        mf1._aulNeighbours[0] = facetIdx;
-                    }
-                    else {
-                        mf1._aulNeighbours[2] = facetIdx;
-                    }
-                }
-                else {
-                    mf1._aulNeighbours[1] = facetIdx;
-                }
-
-                mf._aulNeighbours[i] = e->facetIdx;
-            }
-            else {  // new edge
-                edges.insert(edge);
-            }
-        }
-
-        facetIdx++;
-    }
+    MeshTopologyBuilder topology(_meshKernel.FacetArray());
+    // the first facet at a non-manifold edge has always got the last one as neighbour here
+    topology.SetNonManifoldNeighbours(MeshTopologyBuilder::NonManifoldFirstToLast);
+    topology.SetNeighbourhood();
 }
 
 void MeshBuilder::RemoveUnreferencedPoints()
 {
-    _meshKernel._aclPointArray.SetFlag(MeshPoint::INVALID);
-    for (const auto& it : _meshKernel._aclFacetArray) {
+    _meshKernel.PointArray().SetFlag(MeshPoint::INVALID);
+    for (const auto& it : _meshKernel.FacetArray()) {
         for (PointIndex point : it._aulPoints) {
-            _meshKernel._aclPointArray[point].ResetInvalid();
+            _meshKernel.PointArray()[point].ResetInvalid();
         }
     }
 
-    unsigned long uValidPts = std::count_if(_meshKernel._aclPointArray.begin(),
-                                            _meshKernel._aclPointArray.end(),
+    unsigned long uValidPts = std::count_if(_meshKernel.PointArray().begin(),
+                                            _meshKernel.PointArray().end(),
                                             [](const MeshPoint& p) {
                                                 return p.IsValid();
                                             });
@@ -232,9 +201,9 @@ void MeshBuilder::Finish(bool freeMemory)
     // now we can resize the vertex array to the exact size and copy the vertices with their correct
     // positions in the array
     PointIndex i = 0;
-    _meshKernel._aclPointArray.resize(_pointsIterator.size());
+    _meshKernel.PointArray().resize(_pointsIterator.size());
     for (const auto& it : _pointsIterator) {
-        _meshKernel._aclPointArray[i++] = *(it.first);
+        _meshKernel.PointArray()[i++] = *(it.first);
     }
 
     // free all memory of the internal structures
@@ -248,23 +217,24 @@ void MeshBuilder::Finish(bool freeMemory)
 #endif
     _points.clear();
 
+    _meshKernel.InvalidateAdjacency();
     SetNeighbourhood();
     RemoveUnreferencedPoints();
 
     // if AddFacet() has been called more often (or even less) as specified in Initialize() we have
     // a wastage of memory
     if (freeMemory) {
-        size_t cap = _meshKernel._aclFacetArray.capacity();
-        size_t siz = _meshKernel._aclFacetArray.size();
+        size_t cap = _meshKernel.FacetArray().capacity();
+        size_t siz = _meshKernel.FacetArray().size();
         // wastage of more than 5%
         if (cap > siz + siz / 20) {
             try {
                 FacetIndex i = 0;
                 MeshFacetArray faces(siz);
-                for (const auto& it : _meshKernel._aclFacetArray) {
+                for (const auto& it : _meshKernel.FacetArray()) {
                     faces[i++] = it;
                 }
-                _meshKernel._aclFacetArray.swap(faces);
+                _meshKernel.FacetArray().swap(faces);
             }
             catch (const Base::MemoryException&) {
                 // sorry, we cannot reduce the memory
@@ -400,3 +370,354 @@ void MeshFastBuilder::Finish()
 
     _meshKernel.Adopt(rPoints, rFacets, true);
 }
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+// number of edges from which they are sorted and paired in parallel
+constexpr std::size_t minParallelEdges = std::size_t(1) << 17;
+constexpr int radixBits = 11;
+constexpr std::size_t radixSize = std::size_t(1) << radixBits;
+
+std::size_t chunkBegin(std::size_t count, std::size_t numChunks, std::size_t chunk)
+{
+    return count * chunk / numChunks;
+}
+
+// Calls func(chunk) for all chunks, in parallel if there is a thread pool
+template<class Func>
+void forEachChunk(Base::ThreadPool* pool, std::size_t numChunks, Func&& func)
+{
+    if (!pool) {
+        for (std::size_t chunk = 0; chunk < numChunks; chunk++) {
+            func(chunk);
+        }
+        return;
+    }
+    for (std::size_t chunk = 0; chunk < numChunks; chunk++) {
+        pool->submit([&func, chunk]() {
+            func(chunk);
+        });
+    }
+    pool->wait();
+}
+
+// The edges with both point indices packed into one key, the smaller index in the high bits
+struct PackedEdges
+{
+    std::vector<std::uint64_t> keys;
+    std::vector<std::uint32_t> facets;
+    int pointBits {0};
+
+    std::size_t size() const
+    {
+        return keys.size();
+    }
+    bool isEqual(std::size_t i, std::size_t j) const
+    {
+        return keys[i] == keys[j];
+    }
+    PointIndex point0(std::size_t i) const
+    {
+        return static_cast<PointIndex>(keys[i] >> pointBits);
+    }
+    PointIndex point1(std::size_t i) const
+    {
+        return static_cast<PointIndex>(keys[i] & ((std::uint64_t(1) << pointBits) - 1));
+    }
+    FacetIndex facet(std::size_t i) const
+    {
+        return facets[i];
+    }
+};
+
+// The edges of meshes whose indices don't fit into a packed key
+struct IndexedEdges
+{
+    struct Edge
+    {
+        PointIndex p0;
+        PointIndex p1;
+        FacetIndex f;
+
+        bool operator<(const Edge& e) const
+        {
+            return (p0 == e.p0) ? (p1 < e.p1) : (p0 < e.p0);
+        }
+    };
+
+    std::vector<Edge> edges;
+
+    std::size_t size() const
+    {
+        return edges.size();
+    }
+    bool isEqual(std::size_t i, std::size_t j) const
+    {
+        return edges[i].p0 == edges[j].p0 && edges[i].p1 == edges[j].p1;
+    }
+    PointIndex point0(std::size_t i) const
+    {
+        return edges[i].p0;
+    }
+    PointIndex point1(std::size_t i) const
+    {
+        return edges[i].p1;
+    }
+    FacetIndex facet(std::size_t i) const
+    {
+        return edges[i].f;
+    }
+};
+
+// Stable LSD radix sort of the keys, digits that are equal for all keys are skipped
+void radixSort(PackedEdges& edges, Base::ThreadPool* pool, std::size_t numChunks)
+{
+    const std::size_t count = edges.size();
+    const int keyBits = 2 * edges.pointBits;
+    std::vector<std::uint64_t> keys(count);
+    std::vector<std::uint32_t> facets(count);
+    std::vector<std::array<std::size_t, radixSize>> offsets(numChunks);
+
+    for (int shift = 0; shift < keyBits; shift += radixBits) {
+        auto digit = [shift](std::uint64_t key) {
+            return static_cast<std::size_t>(key >> shift) & (radixSize - 1);
+        };
+
+        forEachChunk(pool, numChunks, [&](std::size_t chunk) {
+            auto& histogram = offsets[chunk];
+            histogram.fill(0);
+            std::size_t end = chunkBegin(count, numChunks, chunk + 1);
+            for (std::size_t i = chunkBegin(count, numChunks, chunk); i < end; i++) {
+                histogram[digit(edges.keys[i])]++;
+            }
+        });
+
+        // turn the histograms into the positions of the chunks in the output
+        bool equalDigits = false;
+        std::size_t pos = 0;
+        for (std::size_t value = 0; value < radixSize; value++) {
+            std::size_t start = pos;
+            for (auto& it : offsets) {
+                std::size_t num = it[value];
+                it[value] = pos;
+                pos += num;
+            }
+            if (pos - start == count) {
+                equalDigits = true;
+            }
+        }
+        if (equalDigits) {
+            continue;
+        }
+
+        forEachChunk(pool, numChunks, [&](std::size_t chunk) {
+            auto& next = offsets[chunk];
+            std::size_t end = chunkBegin(count, numChunks, chunk + 1);
+            for (std::size_t i = chunkBegin(count, numChunks, chunk); i < end; i++) {
+                std::size_t j = next[digit(edges.keys[i])]++;
+                keys[j] = edges.keys[i];
+                facets[j] = edges.facets[i];
+            }
+        });
+
+        edges.keys.swap(keys);
+        edges.facets.swap(facets);
+    }
+}
+
+bool isDegenerated(const MeshFacet& facet)
+{
+    return facet._aulPoints[0] == facet._aulPoints[1] || facet._aulPoints[0] == facet._aulPoints[2]
+        || facet._aulPoints[1] == facet._aulPoints[2];
+}
+
+// Returns the end of the run of equal edges starting at first
+template<class Edges>
+std::size_t equalRange(const Edges& edges, std::size_t first)
+{
+    std::size_t last = first + 1;
+    while (last < edges.size() && edges.isEqual(first, last)) {
+        last++;
+    }
+    return last;
+}
+
+template<class Edges>
+void setNeighbours(MeshFacetArray& facets,
+                   const Edges& edges,
+                   std::size_t first,
+                   std::size_t last,
+                   MeshTopologyBuilder::NonManifoldMode nonManifold)
+{
+    PointIndex p0 = edges.point0(first);
+    PointIndex p1 = edges.point1(first);
+
+    // for more than two facets we have a non-manifold that is ignored here unless each
+    // facet should get the first of the other facets, this also covers degenerated facets
+    if (nonManifold != MeshTopologyBuilder::NonManifoldUnchanged && last - first > 1) {
+        FacetIndex min0 = FACET_INDEX_MAX;
+        FacetIndex min1 = FACET_INDEX_MAX;
+        FacetIndex max0 = 0;
+        for (std::size_t i = first; i < last; i++) {
+            FacetIndex index = edges.facet(i);
+            if (index < min0) {
+                min1 = min0;
+                min0 = index;
+            }
+            else if (index != min0 && index < min1) {
+                min1 = index;
+            }
+            max0 = std::max(max0, index);
+        }
+        // the first facet may get the last one instead of the second one
+        FacetIndex next = min1;
+        if (nonManifold == MeshTopologyBuilder::NonManifoldFirstToLast && max0 != min0) {
+            next = max0;
+        }
+        for (std::size_t i = first; i < last; i++) {
+            FacetIndex index = edges.facet(i);
+            MeshFacet& rFace = facets[index];
+            rFace._aulNeighbours[rFace.Side(p0, p1)] = index == min0 ? next : min0;
+        }
+    }
+    else if (last - first == 2) {
+        FacetIndex f0 = edges.facet(first);
+        FacetIndex f1 = edges.facet(first + 1);
+        MeshFacet& rFace0 = facets[f0];
+        MeshFacet& rFace1 = facets[f1];
+        unsigned short side0 = rFace0.Side(p0, p1);
+        unsigned short side1 = rFace1.Side(p0, p1);
+        rFace0._aulNeighbours[side0] = f1;
+        rFace1._aulNeighbours[side1] = f0;
+    }
+    else if (last - first == 1) {
+        MeshFacet& rFace = facets[edges.facet(first)];
+        unsigned short side = rFace.Side(p0, p1);
+        rFace._aulNeighbours[side] = FACET_INDEX_MAX;
+    }
+}
+
+/* Every chunk handles the runs of equal edges starting in it. The side of an edge of a
+ * non-degenerated facet is unique, so the runs of different chunks never set the same
+ * neighbour. The runs with a degenerated facet are handled afterwards in sorted order.
+ */
+template<class Edges>
+void pairEdges(MeshFacetArray& facets,
+               const Edges& edges,
+               MeshTopologyBuilder::NonManifoldMode nonManifold,
+               Base::ThreadPool* pool,
+               std::size_t numChunks)
+{
+    const std::size_t count = edges.size();
+    std::vector<std::vector<std::size_t>> degenerated(numChunks);
+
+    forEachChunk(pool, numChunks, [&](std::size_t chunk) {
+        std::size_t first = chunkBegin(count, numChunks, chunk);
+        std::size_t end = chunkBegin(count, numChunks, chunk + 1);
+        while (first > 0 && first < end && edges.isEqual(first - 1, first)) {
+            first++;
+        }
+        while (first < end) {
+            std::size_t last = equalRange(edges, first);
+            bool hasDegenerated = false;
+            for (std::size_t i = first; i < last; i++) {
+                hasDegenerated = hasDegenerated || isDegenerated(facets[edges.facet(i)]);
+            }
+            if (hasDegenerated) {
+                degenerated[chunk].push_back(first);
+            }
+            else {
+                setNeighbours(facets, edges, first, last, nonManifold);
+            }
+            first = last;
+        }
+    });
+
+    for (const auto& it : degenerated) {
+        for (std::size_t first : it) {
+            setNeighbours(facets, edges, first, equalRange(edges, first), nonManifold);
+        }
+    }
+}
+}  // namespace
+
+MeshTopologyBuilder::MeshTopologyBuilder(MeshFacetArray& facets)
+    : _facets(facets)
+{}
+
+void MeshTopologyBuilder::SetNonManifoldNeighbours(NonManifoldMode mode)
+{
+    _nonManifold = mode;
+}
+
+void MeshTopologyBuilder::SetNeighbourhood(FacetIndex index)
+{
+    if (index >= _facets.size()) {
+        return;
+    }
+
+    const std::size_t numFacets = _facets.size() - index;
+    const std::size_t numEdges = 3 * numFacets;
+    std::unique_ptr<Base::ThreadPool> pool;
+    std::size_t numChunks = 1;
+    if (numEdges >= minParallelEdges) {
+        pool = std::make_unique<Base::ThreadPool>();
+        numChunks = pool->size();
+    }
+
+    std::vector<PointIndex> maxPoints(numChunks, 0);
+    forEachChunk(pool.get(), numChunks, [&](std::size_t chunk) {
+        std::size_t end = index + chunkBegin(numFacets, numChunks, chunk + 1);
+        for (std::size_t i = index + chunkBegin(numFacets, numChunks, chunk); i < end; i++) {
+            for (PointIndex point : _facets[i]._aulPoints) {
+                maxPoints[chunk] = std::max(maxPoints[chunk], point);
+            }
+        }
+    });
+
+    int pointBits = 1;
+    PointIndex maxPoint = *std::max_element(maxPoints.begin(), maxPoints.end());
+    while (pointBits < 64 && (maxPoint >> pointBits) != 0) {
+        pointBits++;
+    }
+
+    if (pointBits <= 32 && _facets.size() <= UINT32_MAX) {
+        PackedEdges edges;
+        edges.pointBits = pointBits;
+        edges.keys.resize(numEdges);
+        edges.facets.resize(numEdges);
+        forEachChunk(pool.get(), numChunks, [&](std::size_t chunk) {
+            std::size_t end = chunkBegin(numFacets, numChunks, chunk + 1);
+            for (std::size_t i = chunkBegin(numFacets, numChunks, chunk); i < end; i++) {
+                const MeshFacet& facet = _facets[index + i];
+                for (std::size_t j = 0; j < 3; j++) {
+                    std::uint64_t p0 = facet._aulPoints[j];
+                    std::uint64_t p1 = facet._aulPoints[(j + 1) % 3];
+                    edges.keys[3 * i + j] = (std::min(p0, p1) << pointBits) | std::max(p0, p1);
+                    edges.facets[3 * i + j] = static_cast<std::uint32_t>(index + i);
+                }
+            }
+        });
+
+        radixSort(edges, pool.get(), numChunks);
+        pairEdges(_facets, edges, _nonManifold, pool.get(), numChunks);
+    }
+    else {
+        IndexedEdges edges;
+        edges.edges.reserve(numEdges);
+        for (std::size_t i = index; i < _facets.size(); i++) {
+            const MeshFacet& facet = _facets[i];
+            for (int j = 0; j < 3; j++) {
+                PointIndex p0 = facet._aulPoints[j];
+                PointIndex p1 = facet._aulPoints[(j + 1) % 3];
+                edges.edges.push_back({std::min(p0, p1), std::max(p0, p1), i});
+            }
+        }
+
+        int threads = int(std::thread::hardware_concurrency());
+        MeshCore::parallel_sort(edges.edges.begin(), edges.edges.end(), std::less<>(), threads);
+        pairEdges(_facets, edges, _nonManifold, pool.get(), numChunks);
+    }
+}
@@ -228,6 +228,48 @@ private:
     Private* p;
 };
 
+/**
+ * Class for setting the neighbourhood of facets that only reference their points, e.g. after
+ * reading them from a file or appending them to a mesh.
+ * The edges of the facets are sorted by their point indices so that the facets sharing an edge
+ * follow each other. For big meshes the edges are radix sorted and paired in parallel.
+ * \code
+ * MeshTopologyBuilder topology(facets);
+ * topology.SetNeighbourhood();
+ * \endcode
+ */
+class MeshExport MeshTopologyBuilder
+{
+public:
+    /// The neighbours the facets at a non-manifold edge get
+    enum NonManifoldMode
+    {
+        /// the neighbours are left unchanged
+        NonManifoldUnchanged,
+        /// every facet gets the facet with the lowest index of the other facets, this is how
+        /// the mesh readers have always connected non-manifold edges
+        NonManifoldToFirst,
+        /// like NonManifoldToFirst but the facet with the lowest index gets the one with the
+        /// highest index, this is how MeshBuilder has always connected non-manifold edges
+        NonManifoldFirstToLast
+    };
+
+    explicit MeshTopologyBuilder(MeshFacetArray& facets);
+
+    /** Sets the neighbourhood of the facets starting at \a index, only the edges of these facets
+     * are matched. Two facets sharing an edge become neighbours and an edge of a single facet
+     * becomes open. The neighbours at a non-manifold edge, i.e. an edge of more than two facets,
+     * are set as specified with SetNonManifoldNeighbours().
+     */
+    void SetNeighbourhood(FacetIndex index = 0);
+    /// Sets how the facets at a non-manifold edge are connected, the default is to leave them
+    void SetNonManifoldNeighbours(NonManifoldMode mode);
+
+private:
+    MeshFacetArray& _facets;
+    NonManifoldMode _nonManifold {NonManifoldUnchanged};
+};
+
 }  // namespace MeshCore
 
 #endif
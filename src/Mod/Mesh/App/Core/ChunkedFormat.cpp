@@ -0,0 +1,327 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+#include <zlib.h>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/ThreadPool.h>
+
+#include "ChunkedFormat.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// the number of chunks per thread encoded or decoded at once, limits the buffered data
+constexpr std::size_t chunksPerThread = 4;
+
+using Buffer = std::vector<unsigned char>;
+
+void writeUInt32(std::ostream& out, std::uint32_t value)
+{
+    unsigned char bytes[4] = {static_cast<unsigned char>(value),
+                              static_cast<unsigned char>(value >> 8),
+                              static_cast<unsigned char>(value >> 16),
+                              static_cast<unsigned char>(value >> 24)};
+    out.write(reinterpret_cast<const char*>(bytes), 4);  // NOLINT
+}
+
+std::uint32_t readUInt32(std::istream& in)
+{
+    unsigned char bytes[4] {};
+    if (!in.read(reinterpret_cast<char*>(bytes), 4)) {  // NOLINT
+        throw Base::BadFormatError("Reading from stream failed");
+    }
+    return std::uint32_t(bytes[0]) | (std::uint32_t(bytes[1]) << 8)
+        | (std::uint32_t(bytes[2]) << 16) | (std::uint32_t(bytes[3]) << 24);
+}
+
+std::uint32_t zigzag(std::uint32_t delta)
+{
+    return (delta << 1) ^ (0U - (delta >> 31));
+}
+
+std::uint32_t unzigzag(std::uint32_t value)
+{
+    return (value >> 1) ^ (0U - (value & 1));
+}
+
+void putVarint(Buffer& data, std::uint32_t value)
+{
+    while (value >= 0x80) {
+        data.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    data.push_back(static_cast<unsigned char>(value));
+}
+
+std::uint32_t getVarint(const Buffer& data, std::size_t& pos)
+{
+    std::uint32_t value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (pos >= data.size()) {
+            throw Base::BadFormatError("Invalid data structure");
+        }
+        unsigned char byte = data[pos++];
+        value |= std::uint32_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw Base::BadFormatError("Invalid data structure");
+}
+
+/* A chunk as stored in the stream */
+struct Chunk
+{
+    std::uint32_t rawSize {0};
+    Buffer data;
+};
+
+Buffer encodePoints(const MeshPointArray& points, std::size_t begin, std::size_t end)
+{
+    const std::size_t count = end - begin;
+    Buffer raw(count * 12);
+    for (int coord = 0; coord < 3; coord++) {
+        unsigned char* plane = raw.data() + coord * 4 * count;
+        std::uint32_t prev = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            float value = points[begin + i][coord];
+            std::uint32_t bits {};
+            std::memcpy(&bits, &value, sizeof(bits));
+            std::uint32_t delta = zigzag(bits - prev);
+            prev = bits;
+            for (int byte = 0; byte < 4; byte++) {
+                plane[byte * count + i] = static_cast<unsigned char>(delta >> (8 * byte));
+            }
+        }
+    }
+    return raw;
+}
+
+void decodePoints(const Buffer& raw, MeshPointArray& points, std::size_t begin, std::size_t end)
+{
+    const std::size_t count = end - begin;
+    if (raw.size() != count * 12) {
+        throw Base::BadFormatError("Invalid data structure");
+    }
+    for (int coord = 0; coord < 3; coord++) {
+        const unsigned char* plane = raw.data() + coord * 4 * count;
+        std::uint32_t prev = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            std::uint32_t delta = 0;
+            for (int byte = 0; byte < 4; byte++) {
+                delta |= std::uint32_t(plane[byte * count + i]) << (8 * byte);
+            }
+            prev += unzigzag(delta);
+            float value {};
+            std::memcpy(&value, &prev, sizeof(value));
+            points[begin + i][coord] = value;
+        }
+    }
+}
+
+Buffer encodeFacets(const MeshFacetArray& facets, std::size_t begin, std::size_t end)
+{
+    Buffer raw;
+    raw.reserve((end - begin) * 4);
+    std::uint32_t prev = 0;
+    for (std::size_t i = begin; i < end; i++) {
+        const auto& pts = facets[i]._aulPoints;
+        auto p0 = static_cast<std::uint32_t>(pts[0]);
+        putVarint(raw, zigzag(p0 - prev));
+        putVarint(raw, zigzag(static_cast<std::uint32_t>(pts[1]) - p0));
+        putVarint(raw, zigzag(static_cast<std::uint32_t>(pts[2]) - p0));
+        prev = p0;
+    }
+    return raw;
+}
+
+void decodeFacets(const Buffer& raw,
+                  MeshFacetArray& facets,
+                  std::size_t begin,
+                  std::size_t end,
+                  std::size_t numPoints)
+{
+    std::size_t pos = 0;
+    std::uint32_t prev = 0;
+    for (std::size_t i = begin; i < end; i++) {
+        std::uint32_t p0 = prev + unzigzag(getVarint(raw, pos));
+        std::uint32_t p1 = p0 + unzigzag(getVarint(raw, pos));
+        std::uint32_t p2 = p0 + unzigzag(getVarint(raw, pos));
+        if (p0 >= numPoints || p1 >= numPoints || p2 >= numPoints) {
+            throw Base::BadFormatError("Invalid data structure");
+        }
+        facets[i] = MeshFacet(p0, p1, p2);
+        prev = p0;
+    }
+    if (pos != raw.size()) {
+        throw Base::BadFormatError("Invalid data structure");
+    }
+}
+
+Chunk compressChunk(const Buffer& raw)
+{
+    Chunk chunk;
+    chunk.rawSize = static_cast<std::uint32_t>(raw.size());
+    uLongf size = compressBound(static_cast<uLong>(raw.size()));
+    chunk.data.resize(size);
+    if (compress2(chunk.data.data(),
+                  &size,
+                  raw.data(),
+                  static_cast<uLong>(raw.size()),
+                  Z_DEFAULT_COMPRESSION)
+        != Z_OK) {
+        throw Base::RuntimeError("Failed to compress mesh data");
+    }
+    chunk.data.resize(size);
+    return chunk;
+}
+
+Buffer uncompressChunk(const Chunk& chunk)
+{
+    Buffer raw(chunk.rawSize);
+    uLongf size = chunk.rawSize;
+    if (uncompress(raw.data(), &size, chunk.data.data(), static_cast<uLong>(chunk.data.size()))
+            != Z_OK
+        || size != chunk.rawSize) {
+        throw Base::BadFormatError("Invalid data structure");
+    }
+    return raw;
+}
+
+/* Encodes the chunks of \a count elements in batches in parallel and writes them in order. */
+template<class Encode>
+void writeChunks(std::ostream& out, std::size_t count, std::size_t chunkSize, Encode encode)
+{
+    const std::size_t numChunks = (count + chunkSize - 1) / chunkSize;
+    const std::size_t batchSize = Base::ThreadPool::defaultThreadCount() * chunksPerThread;
+    std::vector<Chunk> batch;
+    for (std::size_t first = 0; first < numChunks; first += batchSize) {
+        batch.clear();
+        batch.resize(std::min(batchSize, numChunks - first));
+        Base::parallel_for(batch.size(), 2, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                std::size_t start = (first + i) * chunkSize;
+                batch[i] = compressChunk(encode(start, std::min(start + chunkSize, count)));
+            }
+        });
+
+        for (const auto& chunk : batch) {
+            writeUInt32(out, chunk.rawSize);
+            writeUInt32(out, static_cast<std::uint32_t>(chunk.data.size()));
+            out.write(reinterpret_cast<const char*>(chunk.data.data()),  // NOLINT
+                      static_cast<std::streamsize>(chunk.data.size()));
+        }
+    }
+}
+
+/* Reads the chunks of \a count elements in batches and decodes them in parallel. */
+template<class Decode>
+void readChunks(std::istream& in, std::size_t count, std::size_t chunkSize, Decode decode)
+{
+    const std::size_t numChunks = (count + chunkSize - 1) / chunkSize;
+    const std::size_t batchSize = Base::ThreadPool::defaultThreadCount() * chunksPerThread;
+    // a chunk can't be much bigger than its raw data, this avoids huge allocations for corrupted
+    // streams
+    const std::size_t maxRawSize = chunkSize * 15;
+    std::vector<Chunk> batch;
+    for (std::size_t first = 0; first < numChunks; first += batchSize) {
+        batch.clear();
+        batch.resize(std::min(batchSize, numChunks - first));
+        for (auto& chunk : batch) {
+            chunk.rawSize = readUInt32(in);
+            std::uint32_t size = readUInt32(in);
+            if (chunk.rawSize > maxRawSize || size > compressBound(maxRawSize)) {
+                throw Base::BadFormatError("Invalid data structure");
+            }
+            chunk.data.resize(size);
+            if (!in.read(reinterpret_cast<char*>(chunk.data.data()), size)) {  // NOLINT
+                throw Base::BadFormatError("Reading from stream failed");
+            }
+        }
+
+        Base::parallel_for(batch.size(), 2, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                std::size_t start = (first + i) * chunkSize;
+                decode(uncompressChunk(batch[i]), start, std::min(start + chunkSize, count));
+            }
+        });
+    }
+}
+}  // namespace
+
+MeshChunkedFormat::MeshChunkedFormat(std::size_t chunkSize)
+    : chunkSize(std::max<std::size_t>(chunkSize, 1))
+{}
+
+void MeshChunkedFormat::Write(std::ostream& out,
+                              const MeshPointArray& points,
+                              const MeshFacetArray& facets) const
+{
+    writeUInt32(out, static_cast<std::uint32_t>(points.size()));
+    writeUInt32(out, static_cast<std::uint32_t>(facets.size()));
+    writeUInt32(out, static_cast<std::uint32_t>(chunkSize));
+
+    writeChunks(out, points.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+        return encodePoints(points, begin, end);
+    });
+    writeChunks(out, facets.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+        return encodeFacets(facets, begin, end);
+    });
+}
+
+void MeshChunkedFormat::Read(std::istream& in,
+                             MeshPointArray& points,
+                             MeshFacetArray& facets) const
+{
+    std::uint32_t numPoints = readUInt32(in);
+    std::uint32_t numFacets = readUInt32(in);
+    std::uint32_t size = readUInt32(in);
+    if (size == 0 || size > (1U << 24)) {
+        throw Base::BadFormatError("Invalid data structure");
+    }
+
+    MeshPointArray pointArray(numPoints);
+    readChunks(in, numPoints, size, [&](const Buffer& raw, std::size_t begin, std::size_t end) {
+        decodePoints(raw, pointArray, begin, end);
+    });
+
+    MeshFacetArray facetArray(numFacets);
+    readChunks(in, numFacets, size, [&](const Buffer& raw, std::size_t begin, std::size_t end) {
+        decodeFacets(raw, facetArray, begin, end, numPoints);
+    });
+
+    points.swap(pointArray);
+    facets.swap(facetArray);
+}
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_CHUNKED_FORMAT_H
+#define MESH_CHUNKED_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+#include "Elements.h"
+
+
+namespace MeshCore
+{
+
+/**
+ * The MeshChunkedFormat class reads and writes the points and facets of a mesh in a compact
+ * binary format. It's the payload of version 2 of the binary stream of MeshKernel.
+ *
+ * The points and facets are split into chunks that are compressed independently, so they can be
+ * encoded and decoded in parallel while the stream is read or written. The coordinates of a
+ * chunk are stored as differences of the bit patterns of consecutive points, ordered by byte
+ * significance. The point indices of a facet are stored as variable length differences to the
+ * first point of the previous facet. The neighbourhood of the facets isn't stored but must be
+ * rebuilt after reading.
+ */
+class MeshExport MeshChunkedFormat
+{
+public:
+    /// The version of MeshKernel's binary stream using this format
+    static constexpr std::uint32_t Version = 0x020000;
+
+    /// Sets the number of points or facets per chunk
+    explicit MeshChunkedFormat(std::size_t chunkSize = 65536);
+
+    /// Writes the points and facets
+    void Write(std::ostream& out, const MeshPointArray& points, const MeshFacetArray& facets) const;
+    /** Reads the points and facets. The neighbourhood of the facets is not set. A
+     * Base::BadFormatError is thrown if the stream is corrupted.
+     */
+    void Read(std::istream& in, MeshPointArray& points, MeshFacetArray& facets) const;
+
+private:
+    std::size_t chunkSize;
+};
+
+}  // namespace MeshCore
+
+#endif  // MESH_CHUNKED_FORMAT_H
@@ -22,6 +22,17 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#endif
+
+#include <Base/ThreadPool.h>
+
+#include "Adjacency.h"
 #include "Decimation.h"
 #include "MeshKernel.h"
 #include "Simplify.h"
@@ -152,3 +163,768 @@ void MeshSimplify::simplify(int targetSize)
 
     myKernel.Adopt(new_points, new_facets, true);
 }
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+// minimum number of points per task of the parallel loops
+constexpr std::size_t parallelGrainSize = 100000;
+// number of slabs per thread, more slabs balance the load better but leave more border facets
+constexpr unsigned int slabsPerThread = 2;
+// share of the remaining collapses done by the slabs in a pass, the rest is left to the serial
+// pass where the costliest collapses compete across the whole mesh
+constexpr double slabShare = 0.75;
+// number of bins of the histogram to place the slab borders
+constexpr std::size_t numSlabBins = 4096;
+// the normal of a facet must not change by more than about 80 degree by a collapse
+constexpr float minNormalCosine = 0.2F;
+// marks an index into the overflow array of a slab
+constexpr std::size_t overflowBit = std::size_t(1) << (sizeof(std::size_t) * 8 - 1);
+
+/* A symmetric 4x4 matrix holding the sum of the squared distances to a set of planes. */
+struct Quadric
+{
+    // a2, ab, ac, ad, b2, bc, bd, c2, cd, d2
+    double m[10] {};
+
+    Quadric() = default;
+    Quadric(const Base::Vector3d& n, double d, double w)
+        : m {w * n.x * n.x,
+             w * n.x * n.y,
+             w * n.x * n.z,
+             w * n.x * d,
+             w * n.y * n.y,
+             w * n.y * n.z,
+             w * n.y * d,
+             w * n.z * n.z,
+             w * n.z * d,
+             w * d * d}
+    {}
+
+    Quadric& operator+=(const Quadric& q)
+    {
+        for (int i = 0; i < 10; i++) {
+            m[i] += q.m[i];
+        }
+        return *this;
+    }
+
+    double Evaluate(const Base::Vector3d& p) const
+    {
+        double x = p.x;
+        double y = p.y;
+        double z = p.z;
+        return m[0] * x * x + 2 * m[1] * x * y + 2 * m[2] * x * z + 2 * m[3] * x + m[4] * y * y
+            + 2 * m[5] * y * z + 2 * m[6] * y + m[7] * z * z + 2 * m[8] * z + m[9];
+    }
+
+    /* Computes the point with the minimum error, returns false if it's not unique. */
+    bool Minimize(Base::Vector3d& p) const
+    {
+        double c00 = m[4] * m[7] - m[5] * m[5];
+        double c01 = m[2] * m[5] - m[1] * m[7];
+        double c02 = m[1] * m[5] - m[2] * m[4];
+        double det = m[0] * c00 + m[1] * c01 + m[2] * c02;
+        double trace = m[0] + m[4] + m[7];
+        if (std::fabs(det) <= 1e-10 * trace * trace * trace) {
+            return false;
+        }
+
+        double c11 = m[0] * m[7] - m[2] * m[2];
+        double c12 = m[1] * m[2] - m[0] * m[5];
+        double c22 = m[0] * m[4] - m[1] * m[1];
+        double inv = -1.0 / det;
+        p.x = inv * (c00 * m[3] + c01 * m[6] + c02 * m[8]);
+        p.y = inv * (c01 * m[3] + c11 * m[6] + c12 * m[8]);
+        p.z = inv * (c02 * m[3] + c12 * m[6] + c22 * m[8]);
+        return true;
+    }
+};
+
+class QuadricDecimator
+{
+public:
+    QuadricDecimator(MeshPointArray& points,
+                     MeshFacetArray& facets,
+                     const MeshQuadricDecimation::Parameters& params)
+        : points(points)
+        , facets(facets)
+        , params(params)
+    {}
+
+    void Run()
+    {
+        for (auto& it : facets) {
+            it.ResetInvalid();
+        }
+
+        std::size_t live = facets.size();
+        BuildReferences(1);
+        InitPoints();
+
+        std::vector<double> shifts;
+        unsigned int threads = params.threads;
+        if (threads == 0) {
+            threads = Base::ThreadPool::defaultThreadCount();
+        }
+        if (threads > 1 && live >= params.minParallelSize) {
+            shifts = {0.0, 0.5};
+        }
+
+        for (double shift : shifts) {
+            std::size_t numSlabs = SplitIntoSlabs(threads * slabsPerThread, shift);
+            BuildReferences(numSlabs);
+            std::size_t toRemove = Remaining(live);
+            if (toRemove == 0) {
+                return;
+            }
+
+            // each slab gets a share of the facets to remove according to its size
+            std::vector<std::size_t> goals = CountInteriorFacets(numSlabs);
+            for (auto& goal : goals) {
+                if (params.targetSize > 0) {
+                    goal = static_cast<std::size_t>(slabShare * double(toRemove) * double(goal)
+                                                    / double(live));
+                }
+            }
+
+            std::vector<std::size_t> removed(numSlabs, 0);
+            Base::parallel_for(numSlabs, 2, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t slab = begin; slab < end; slab++) {
+                    removed[slab] = DecimateSlab(static_cast<std::uint16_t>(slab), goals[slab]);
+                }
+            });
+            for (std::size_t count : removed) {
+                live -= count;
+            }
+        }
+
+        // the remaining collapses including the slab borders
+        std::size_t toRemove = Remaining(live);
+        if (toRemove > 0) {
+            std::fill(slabs.begin(), slabs.end(), 0);
+            BuildReferences(1);
+            MarkInterior();
+            DecimateSlab(0, toRemove);
+        }
+    }
+
+private:
+    enum Flag : unsigned char
+    {
+        Locked = 1,
+        Border = 2,
+        Removed = 4,
+        Interior = 8
+    };
+
+    struct Entry
+    {
+        float error;
+        std::uint32_t stamp;
+        PointIndex from;
+        PointIndex to;
+
+        bool operator<(const Entry& other) const
+        {
+            // std::push_heap builds a max-heap
+            return error > other.error;
+        }
+    };
+
+    struct Scratch
+    {
+        std::vector<PointIndex> ring1;
+        std::vector<PointIndex> ring2;
+        std::vector<PointIndex> changed;
+        std::vector<FacetIndex> refs;
+        std::vector<Entry> heap;
+    };
+
+    using Range = MeshIndexRange<FacetIndex>;
+
+    std::size_t Remaining(std::size_t live) const
+    {
+        if (params.targetSize == 0) {
+            return live;
+        }
+        return live > params.targetSize ? live - params.targetSize : 0;
+    }
+
+    /* Builds the facets of each point from the valid facets. The lists of a point changed by a
+     * collapse are appended to the overflow array of its slab.
+     */
+    void BuildReferences(std::size_t numSlabs)
+    {
+        const std::size_t numPoints = points.size();
+        refStart.assign(numPoints, 0);
+        refCount.assign(numPoints, 0);
+        for (const auto& face : facets) {
+            if (face.IsValid()) {
+                for (PointIndex point : face._aulPoints) {
+                    refCount[point]++;
+                }
+            }
+        }
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < numPoints; i++) {
+            refStart[i] = offset;
+            offset += refCount[i];
+            refCount[i] = 0;
+        }
+
+        refs.clear();
+        refs.shrink_to_fit();
+        refs.resize(offset);
+        for (std::size_t index = 0; index < facets.size(); index++) {
+            const MeshFacet& face = facets[index];
+            if (face.IsValid()) {
+                for (PointIndex point : face._aulPoints) {
+                    refs[refStart[point] + refCount[point]++] = index;
+                }
+            }
+        }
+
+        overflow.clear();
+        overflow.resize(numSlabs);
+        slabs.resize(numPoints, 0);
+    }
+
+    Range References(PointIndex point) const
+    {
+        std::size_t start = refStart[point];
+        const FacetIndex* data = (start & overflowBit)
+            ? overflow[slabs[point]].data() + (start & ~overflowBit)
+            : refs.data() + start;
+        return {data, data + refCount[point]};
+    }
+
+    /* Sets up the quadrics and locks the points of open, non-manifold and sharp edges. */
+    void InitPoints()
+    {
+        const std::size_t numPoints = points.size();
+        quadrics.assign(numPoints, Quadric());
+        flags.assign(numPoints, 0);
+        stamps.assign(numPoints, 0);
+
+        const float minCosine = std::cos(params.featureAngle);
+        auto computeQuadrics = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t point = begin; point < end; point++) {
+                Quadric& quadric = quadrics[point];
+                unsigned char& flag = flags[point];
+                for (FacetIndex index : References(point)) {
+                    const MeshFacet& face = facets[index];
+                    Base::Vector3d normal = Normal(face);
+                    Base::Vector3d base = Base::toVector<double>(points[face._aulPoints[0]]);
+                    quadric += Quadric(normal, -(normal * base), 1.0);
+                    if (face._aulPoints[0] == face._aulPoints[1]
+                        || face._aulPoints[1] == face._aulPoints[2]
+                        || face._aulPoints[2] == face._aulPoints[0]) {
+                        flag |= Locked;
+                    }
+
+                    for (int side = 0; side < 3; side++) {
+                        PointIndex p0 = face._aulPoints[side];
+                        PointIndex p1 = face._aulPoints[(side + 1) % 3];
+                        if (p0 != point && p1 != point) {
+                            continue;
+                        }
+
+                        FacetIndex neighbour = face._aulNeighbours[side];
+                        unsigned short back = neighbour < facets.size()
+                            ? facets[neighbour].Side(p0, p1)
+                            : std::numeric_limits<unsigned short>::max();
+                        if (neighbour == FACET_INDEX_MAX) {
+                            flag |= Border;
+                            if (params.lockBoundary) {
+                                flag |= Locked;
+                            }
+                            else {
+                                // keep the border in place by a plane perpendicular to the facet
+                                Base::Vector3d v0 = Base::toVector<double>(points[p0]);
+                                Base::Vector3d v1 = Base::toVector<double>(points[p1]);
+                                Base::Vector3d dir = (v1 - v0) % normal;
+                                if (dir.Sqr() > 0.0) {
+                                    dir.Normalize();
+                                    quadric += Quadric(dir, -(dir * v0), 1.0);
+                                }
+                            }
+                        }
+                        else if (back > 2 || facets[neighbour]._aulNeighbours[back] != index) {
+                            // non-manifold edge
+                            flag |= Locked;
+                        }
+                        else if (params.featureAngle > 0.0F) {
+                            Base::Vector3d other = Normal(facets[neighbour]);
+                            if (normal * other < double(minCosine)) {
+                                flag |= Locked;
+                            }
+                        }
+                    }
+                }
+            }
+        };
+        Base::parallel_for(numPoints, parallelGrainSize, computeQuadrics);
+    }
+
+    Base::Vector3d Normal(const MeshFacet& face) const
+    {
+        Base::Vector3d v0 = Base::toVector<double>(points[face._aulPoints[0]]);
+        Base::Vector3d v1 = Base::toVector<double>(points[face._aulPoints[1]]);
+        Base::Vector3d v2 = Base::toVector<double>(points[face._aulPoints[2]]);
+        Base::Vector3d normal = (v1 - v0) % (v2 - v0);
+        double len = normal.Length();
+        if (len > 0.0) {
+            normal /= len;
+        }
+        return normal;
+    }
+
+    /* Assigns the points to slabs of about the same number of points along the longest axis.
+     * With a shift of 0.5 the borders lie in the middle of the slabs of a shift of 0.
+     */
+    std::size_t SplitIntoSlabs(std::size_t numSlabs, double shift)
+    {
+        Base::BoundBox3f box;
+        for (std::size_t i = 0; i < points.size(); i++) {
+            if (refCount[i] > 0 && !(flags[i] & Removed)) {
+                box.Add(points[i]);
+            }
+        }
+
+        int axis = 0;
+        if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+            axis = 1;
+        }
+        else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+            axis = 2;
+        }
+
+        float minValue = axis == 0 ? box.MinX : (axis == 1 ? box.MinY : box.MinZ);
+        float length = axis == 0 ? box.LengthX() : (axis == 1 ? box.LengthY() : box.LengthZ());
+        float scale = length > 0.0F ? float(numSlabBins) / length : 0.0F;
+        auto binOf = [&](const MeshPoint& pnt) {
+            auto bin = static_cast<std::size_t>((pnt[axis] - minValue) * scale);
+            return std::min(bin, numSlabBins - 1);
+        };
+
+        std::vector<std::size_t> histogram(numSlabBins, 0);
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < points.size(); i++) {
+            if (refCount[i] > 0 && !(flags[i] & Removed)) {
+                histogram[binOf(points[i])]++;
+                total++;
+            }
+        }
+
+        // the first bin of each slab
+        std::vector<std::size_t> borders;
+        std::size_t sum = 0;
+        std::size_t bin = 0;
+        for (std::size_t slab = 1; slab <= numSlabs; slab++) {
+            double fraction = (double(slab) - shift) / double(numSlabs);
+            if (fraction >= 1.0) {
+                break;
+            }
+            auto limit = static_cast<std::size_t>(fraction * double(total));
+            while (bin < numSlabBins && sum + histogram[bin] <= limit) {
+                sum += histogram[bin++];
+            }
+            if (borders.empty() || borders.back() < bin) {
+                borders.push_back(bin);
+            }
+        }
+
+        slabs.assign(points.size(), 0);
+        for (std::size_t i = 0; i < points.size(); i++) {
+            std::size_t slab =
+                std::upper_bound(borders.begin(), borders.end(), binOf(points[i])) - borders.begin();
+            slabs[i] = static_cast<std::uint16_t>(slab);
+        }
+
+        return borders.size() + 1;
+    }
+
+    /* Marks the points whose facets lie completely in the slab of the point. Only these points
+     * are changed when decimating a slab, so slabs can be processed concurrently.
+     */
+    void MarkInterior()
+    {
+        auto markInterior = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t point = begin; point < end; point++) {
+                bool interior = true;
+                for (FacetIndex index : References(point)) {
+                    for (PointIndex other : facets[index]._aulPoints) {
+                        interior = interior && slabs[other] == slabs[point];
+                    }
+                }
+                if (interior) {
+                    flags[point] |= Interior;
+                }
+                else {
+                    flags[point] &= ~Interior;
+                }
+            }
+        };
+        Base::parallel_for(points.size(), parallelGrainSize, markInterior);
+    }
+
+    std::vector<std::size_t> CountInteriorFacets(std::size_t numSlabs)
+    {
+        MarkInterior();
+        std::vector<std::size_t> counts(numSlabs, 0);
+        for (const auto& face : facets) {
+            if (face.IsValid()) {
+                std::uint16_t slab = slabs[face._aulPoints[0]];
+                if (slabs[face._aulPoints[1]] == slab && slabs[face._aulPoints[2]] == slab) {
+                    counts[slab]++;
+                }
+            }
+        }
+        return counts;
+    }
+
+    bool IsCandidate(PointIndex point) const
+    {
+        return (flags[point] & (Locked | Removed | Interior)) == Interior;
+    }
+
+    void Ring(PointIndex point, std::vector<PointIndex>& ring) const
+    {
+        ring.clear();
+        for (FacetIndex index : References(point)) {
+            const MeshFacet& face = facets[index];
+            ring.insert(ring.end(), std::begin(face._aulPoints), std::end(face._aulPoints));
+        }
+        std::sort(ring.begin(), ring.end());
+        ring.erase(std::unique(ring.begin(), ring.end()), ring.end());
+        ring.erase(std::remove(ring.begin(), ring.end(), point), ring.end());
+    }
+
+    /* Computes the position and error of collapsing the point \a from into \a to. */
+    double Position(PointIndex from, PointIndex to, Base::Vector3f& pos) const
+    {
+        Quadric quadric = quadrics[from];
+        quadric += quadrics[to];
+        Base::Vector3d p0 = Base::toVector<double>(points[from]);
+        Base::Vector3d p1 = Base::toVector<double>(points[to]);
+        Base::Vector3d best = p1;
+        if (!(flags[to] & Locked)) {
+            Base::Vector3d mid = 0.5 * (p0 + p1);
+            Base::Vector3d opt;
+            if (quadric.Minimize(opt) && Base::Distance(opt, mid) <= Base::Distance(p0, p1)) {
+                best = opt;
+            }
+            else {
+                double error = quadric.Evaluate(best);
+                for (const Base::Vector3d& pnt : {p0, mid}) {
+                    double value = quadric.Evaluate(pnt);
+                    if (value < error) {
+                        error = value;
+                        best = pnt;
+                    }
+                }
+            }
+        }
+
+        pos = Base::toVector<float>(best);
+        return std::max(0.0, quadric.Evaluate(best));
+    }
+
+    /* Checks that moving the point \a moved of the facet to \a pos doesn't flip it. */
+    bool Flips(const MeshFacet& face, PointIndex moved, const Base::Vector3f& pos) const
+    {
+        Base::Vector3f p[3];
+        for (int i = 0; i < 3; i++) {
+            p[i] = points[face._aulPoints[i]];
+        }
+        Base::Vector3f n0 = (p[1] - p[0]) % (p[2] - p[0]);
+        for (int i = 0; i < 3; i++) {
+            if (face._aulPoints[i] == moved) {
+                p[i] = pos;
+            }
+        }
+        Base::Vector3f n1 = (p[1] - p[0]) % (p[2] - p[0]);
+        float len = n0.Length() * n1.Length();
+        return len <= 0.0F || n0 * n1 < minNormalCosine * len;
+    }
+
+    /* Checks that collapsing \a from into \a to keeps the mesh manifold and doesn't flip facets.
+     * The ring of \a from is passed in ring1.
+     */
+    bool IsValid(PointIndex from, PointIndex to, const Base::Vector3f& pos, Scratch& scratch) const
+    {
+        int shared = 0;
+        for (FacetIndex index : References(from)) {
+            const MeshFacet& face = facets[index];
+            if (face.HasPoint(to)) {
+                shared++;
+            }
+            else if (Flips(face, from, pos)) {
+                return false;
+            }
+        }
+        if (shared == 0 || shared > 2) {
+            return false;
+        }
+        // an inner edge connecting two border points
+        if (shared == 2 && (flags[from] & Border) && (flags[to] & Border)) {
+            return false;
+        }
+
+        for (FacetIndex index : References(to)) {
+            const MeshFacet& face = facets[index];
+            if (!face.HasPoint(from) && Flips(face, to, pos)) {
+                return false;
+            }
+        }
+
+        // link condition: the common neighbours are the opposite points of the edge facets
+        Ring(to, scratch.ring2);
+        const auto& ring1 = scratch.ring1;
+        const auto& ring2 = scratch.ring2;
+        std::size_t common = 0;
+        auto it = ring1.begin();
+        auto jt = ring2.begin();
+        while (it != ring1.end() && jt != ring2.end()) {
+            if (*it < *jt) {
+                ++it;
+            }
+            else if (*jt < *it) {
+                ++jt;
+            }
+            else {
+                common++;
+                ++it;
+                ++jt;
+            }
+        }
+        if (common != std::size_t(shared)) {
+            return false;
+        }
+
+        // avoid collapsing closed parts into less than a tetrahedron
+        std::size_t degree = ring1.size() + ring2.size() - common - 2;
+        return degree >= 3 || (flags[from] & Border) || (flags[to] & Border);
+    }
+
+    /* Searches for the cheapest collapse of \a point into one of its neighbours. */
+    bool BestCollapse(PointIndex point, bool validate, Scratch& scratch, Entry& entry) const
+    {
+        Ring(point, scratch.ring1);
+        bool found = false;
+        entry.error = FLOAT_MAX;
+        for (PointIndex other : scratch.ring1) {
+            if ((flags[other] & (Interior | Removed)) != Interior) {
+                continue;
+            }
+            Base::Vector3f pos;
+            auto error = static_cast<float>(Position(point, other, pos));
+            if (error < entry.error && (!validate || IsValid(point, other, pos, scratch))) {
+                entry.error = error;
+                entry.to = other;
+                found = true;
+            }
+        }
+        entry.from = point;
+        entry.stamp = stamps[point];
+        return found;
+    }
+
+    void Push(std::vector<Entry>& heap, const Entry& entry) const
+    {
+        heap.push_back(entry);
+        std::push_heap(heap.begin(), heap.end());
+    }
+
+    /* Collapses \a from into \a to and returns the number of removed facets. */
+    std::size_t Collapse(PointIndex from, PointIndex to, const Base::Vector3f& pos, Scratch& scratch)
+    {
+        auto& list = scratch.refs;
+        list.clear();
+        for (FacetIndex index : References(to)) {
+            if (!facets[index].HasPoint(from)) {
+                list.push_back(index);
+            }
+        }
+        for (FacetIndex index : References(from)) {
+            if (!facets[index].HasPoint(to)) {
+                list.push_back(index);
+            }
+        }
+
+        std::vector<FacetIndex>& extra = overflow[slabs[to]];
+        std::size_t start = extra.size();
+        extra.insert(extra.end(), list.begin(), list.end());
+
+        std::size_t removed = 0;
+        for (FacetIndex index : References(from)) {
+            MeshFacet& face = facets[index];
+            if (face.HasPoint(to)) {
+                face.SetInvalid();
+                removed++;
+            }
+            else {
+                face.Transpose(from, to);
+            }
+        }
+
+        refStart[to] = start | overflowBit;
+        refCount[to] = static_cast<std::uint32_t>(list.size());
+        refCount[from] = 0;
+
+        // the opposite points of the removed facets lose them
+        for (PointIndex point : scratch.ring1) {
+            list.clear();
+            for (FacetIndex index : References(point)) {
+                if (facets[index].IsValid()) {
+                    list.push_back(index);
+                }
+            }
+            if (list.size() < refCount[point]) {
+                refStart[point] = extra.size() | overflowBit;
+                refCount[point] = static_cast<std::uint32_t>(list.size());
+                extra.insert(extra.end(), list.begin(), list.end());
+            }
+        }
+
+        points[to].Set(pos.x, pos.y, pos.z);
+        quadrics[to] += quadrics[from];
+        flags[to] |= flags[from] & Border;
+        flags[from] |= Removed;
+        stamps[from]++;
+        return removed;
+    }
+
+    std::size_t DecimateSlab(std::uint16_t slab, std::size_t goal)
+    {
+        Scratch scratch;
+        auto& heap = scratch.heap;
+        for (std::size_t point = 0; point < points.size(); point++) {
+            Entry entry {};
+            if (slabs[point] == slab && IsCandidate(point)
+                && BestCollapse(point, false, scratch, entry)) {
+                heap.push_back(entry);
+            }
+        }
+        std::make_heap(heap.begin(), heap.end());
+
+        std::size_t removed = 0;
+        while (removed < goal && !heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end());
+            Entry entry = heap.back();
+            heap.pop_back();
+            if (entry.stamp != stamps[entry.from] || !IsCandidate(entry.from)) {
+                continue;
+            }
+            if (entry.error > params.maxError) {
+                break;
+            }
+
+            Base::Vector3f pos;
+            Position(entry.from, entry.to, pos);
+            Ring(entry.from, scratch.ring1);
+            if (!IsValid(entry.from, entry.to, pos, scratch)) {
+                // try the cheapest valid collapse instead
+                if (BestCollapse(entry.from, true, scratch, entry)) {
+                    Push(heap, entry);
+                }
+                continue;
+            }
+
+            removed += Collapse(entry.from, entry.to, pos, scratch);
+
+            // the costs of the point and its neighbours have changed
+            auto& changed = scratch.changed;
+            Ring(entry.to, changed);
+            changed.push_back(entry.to);
+            for (PointIndex point : changed) {
+                stamps[point]++;
+                Entry update {};
+                if (IsCandidate(point) && BestCollapse(point, false, scratch, update)) {
+                    Push(heap, update);
+                }
+            }
+        }
+
+        return removed;
+    }
+
+private:
+    MeshPointArray& points;
+    MeshFacetArray& facets;
+    const MeshQuadricDecimation::Parameters& params;
+
+    std::vector<Quadric> quadrics;
+    std::vector<unsigned char> flags;
+    std::vector<std::uint32_t> stamps;
+    std::vector<std::uint16_t> slabs;
+    std::vector<std::size_t> refStart;
+    std::vector<std::uint32_t> refCount;
+    std::vector<FacetIndex> refs;
+    std::vector<std::vector<FacetIndex>> overflow;
+};
+
+/* Removes the invalid facets and the points not referenced any more. */
+void compact(MeshPointArray& points, MeshFacetArray& facets)
+{
+    facets.erase(std::remove_if(facets.begin(),
+                                facets.end(),
+                                [](const MeshFacet& face) {
+                                    return !face.IsValid();
+                                }),
+                 facets.end());
+
+    std::vector<PointIndex> remap(points.size(), POINT_INDEX_MAX);
+    for (const auto& face : facets) {
+        for (PointIndex point : face._aulPoints) {
+            remap[point] = 0;
+        }
+    }
+
+    PointIndex count = 0;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (remap[i] != POINT_INDEX_MAX) {
+            remap[i] = count;
+            points[count++] = points[i];
+        }
+    }
+    points.resize(count);
+
+    for (auto& face : facets) {
+        for (PointIndex& point : face._aulPoints) {
+            point = remap[point];
+        }
+    }
+}
+}  // namespace
+
+MeshQuadricDecimation::MeshQuadricDecimation(MeshKernel& mesh)
+    : myKernel(mesh)
+{}
+
+std::size_t MeshQuadricDecimation::Decimate(const Parameters& params)
+{
+    // take over the arrays of the kernel to avoid a copy
+    MeshPointArray points;
+    MeshFacetArray facets;
+    myKernel.Adopt(points, facets);
+    const std::size_t count = facets.size();
+
+    try {
+        QuadricDecimator decimator(points, facets, params);
+        decimator.Run();
+    }
+    catch (...) {
+        // collapses are complete when an exception is thrown, so the mesh is still consistent
+        compact(points, facets);
+        myKernel.Adopt(points, facets, true);
+        throw;
+    }
+
+    compact(points, facets);
+    myKernel.Adopt(points, facets, true);
+    return count - myKernel.CountFacets();
+}
@@ -24,8 +24,12 @@
 #ifndef MESH_DECIMATION_H
 #define MESH_DECIMATION_H
 
+#include <cstddef>
+
 #include <Mod/Mesh/MeshGlobal.h>
 
+#include "Definitions.h"
+
 namespace MeshCore
 {
 class MeshKernel;
@@ -41,6 +45,45 @@ private:
     MeshKernel& myKernel;
 };
 
+/**
+ * The MeshQuadricDecimation class reduces the number of facets by edge collapses ordered by the
+ * quadric error metric. Unlike MeshSimplify it works on the arrays of the mesh kernel without
+ * copying them.
+ *
+ * The mesh is split into slabs along its longest axis which are decimated in parallel, each
+ * with its own priority queue. Facets with points in two slabs are kept and decimated in a
+ * second pass with shifted slabs, the remaining collapses are done in a final pass over the
+ * whole mesh.
+ */
+class MeshExport MeshQuadricDecimation
+{
+public:
+    struct Parameters
+    {
+        /// The number of facets to reduce the mesh to, 0 to only stop at the maximum error
+        std::size_t targetSize {0};
+        /** The maximum error of a collapse. It's the sum of the squared distances of the new
+         * point to the planes of the original facets around the collapsed points. */
+        float maxError {FLOAT_MAX};
+        /// Keeps the points of open edges
+        bool lockBoundary {false};
+        /** Keeps the points of edges whose facet normals enclose an angle higher than this
+         * angle in radian, zero disables the check. */
+        float featureAngle {0.0F};
+        /// The number of facets from which the mesh is split into slabs decimated in parallel
+        std::size_t minParallelSize {100000};
+        /// The number of threads for the slabs, 0 for the number of hardware threads
+        unsigned int threads {0};
+    };
+
+    explicit MeshQuadricDecimation(MeshKernel&);
+    /// Decimates the mesh and returns the number of removed facets
+    std::size_t Decimate(const Parameters&);
+
+private:
+    MeshKernel& myKernel;
+};
+
 }  // namespace MeshCore
 
 
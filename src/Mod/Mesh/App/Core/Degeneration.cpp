@@ -207,7 +207,7 @@ bool MeshFixDuplicatePoints::Fixup()
     }
 
     // now set all facets to the correct index
-    MeshFacetArray& rFacets = _rclMesh._aclFacetArray;
+    MeshFacetArray& rFacets = _rclMesh.FacetArray();
     for (auto& it : rFacets) {
         for (PointIndex& point : it._aulPoints) {
             auto pt = mapPointIndex.find(point);
@@ -24,14 +24,23 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <vector>
 #endif
 
 #include <Base/Matrix.h>
 #include <Base/Sequencer.h>
+#include <Base/ThreadPool.h>
 
+#include "Adjacency.h"
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "BVH.h"
+#include "Builder.h"
 #include "Evaluation.h"
 #include "Functional.h"
 #include "Grid.h"
@@ -335,56 +344,41 @@ struct Edge_Less
 
 bool MeshEvalTopology::Evaluate()
 {
-    // Using and sorting a vector seems to be faster and more memory-efficient
-    // than a map.
-    const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * rclFAry.size());
-
-    // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    Base::SequencerLauncher seq("Checking topology...", rclFAry.size());
-    for (pI = rclFAry.begin(); pI != rclFAry.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - rclFAry.begin();
-            edges.push_back(item);
-        }
-
-        seq.next();
-    }
-
-    // sort the edges
-    std::sort(edges.begin(), edges.end(), Edge_Less());
+    // The facets of an edge are the common facets of its end points. The adjacency
+    // tables are cached by the kernel and shared with other evaluations.
+    const MeshPointPointAdjacency& pointPoints = _rclMesh.GetPointPointAdjacency();
+    const MeshPointFacetAdjacency& pointFacets = _rclMesh.GetPointFacetAdjacency();
 
     // search for non-manifold edges
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
     nonManifoldList.clear();
     nonManifoldFacets.clear();
 
-    int count = 0;
+    PointIndex ctPoints = pointPoints.size();
     std::vector<FacetIndex> facets;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            count++;
-            facets.push_back(pE->f);
-        }
-        else {
-            if (count > 2) {
+    Base::SequencerLauncher seq("Checking topology...", ctPoints);
+    for (PointIndex p0 = 0; p0 < ctPoints; p0++) {
+        MeshPointFacetAdjacency::Range facets0 = pointFacets[p0];
+        for (PointIndex p1 : pointPoints[p0]) {
+            // visit every edge once
+            if (p1 <= p0) {
+                continue;
+            }
+
+            MeshPointFacetAdjacency::Range facets1 = pointFacets[p1];
+            facets.clear();
+            std::set_intersection(facets0.begin(),
+                                  facets0.end(),
+                                  facets1.begin(),
+                                  facets1.end(),
+                                  std::back_inserter(facets));
+            if (facets.size() > 2) {
                 // Edge that is shared by more than 2 facets
                 nonManifoldList.emplace_back(p0, p1);
                 nonManifoldFacets.push_back(facets);
             }
-
-            p0 = pE->p0;
-            p1 = pE->p1;
-            facets.clear();
-            facets.push_back(pE->f);
-            count = 1;
         }
+
+        seq.next();
     }
 
     return nonManifoldList.empty();
@@ -476,16 +470,16 @@ bool MeshEvalPointManifolds::Evaluate()
     this->nonManifoldPoints.clear();
     this->facetsOfNonManifoldPoints.clear();
 
-    MeshCore::MeshRefPointToPoints vv_it(_rclMesh);
-    MeshCore::MeshRefPointToFacets vf_it(_rclMesh);
+    const MeshCore::MeshPointPointAdjacency& vv_it = _rclMesh.GetPointPointAdjacency();
+    const MeshCore::MeshPointFacetAdjacency& vf_it = _rclMesh.GetPointFacetAdjacency();
 
     unsigned long ctPoints = _rclMesh.CountPoints();
     for (PointIndex index = 0; index < ctPoints; index++) {
         // get the local neighbourhood of the point
-        const std::set<FacetIndex>& nf = vf_it[index];
-        const std::set<PointIndex>& np = vv_it[index];
+        MeshPointFacetAdjacency::Range nf = vf_it[index];
+        MeshPointPointAdjacency::Range np = vv_it[index];
 
-        std::set<unsigned long>::size_type sp {}, sf {};
+        std::size_t sp {}, sf {};
         sp = np.size();
         sf = nf.size();
         // for an inner point the number of adjacent points is equal to the number of shared faces
@@ -598,104 +592,63 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
-                    }
-                }
-            }
+// number of grid cells or facets from which the pairs are tested in parallel
+constexpr std::size_t minParallelSelfIntersection = 256;
+// number of steps reported to the sequencer
+constexpr std::size_t numSelfIntersectionSteps = 100;
+
+// If the facets share a common vertex we do not check for self-intersections because they
+// could but usually do not intersect each other and the algorithm would detect false-positives,
+// otherwise
+bool shareVertex(const MeshFacet& rface1, const MeshFacet& rface2)
+{
+    for (PointIndex point : rface1._aulPoints) {
+        if (point == rface2._aulPoints[0] || point == rface2._aulPoints[1]
+            || point == rface2._aulPoints[2]) {
+            return true;
         }
     }
+    return false;
+}
+}  // namespace
 
-    return true;
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    std::vector<std::pair<FacetIndex, FacetIndex>> intersection;
+    CollectIntersections(intersection, true);
+    return intersection.empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
     const std::vector<std::pair<FacetIndex, FacetIndex>>& indices,
     std::vector<std::pair<Base::Vector3f, Base::Vector3f>>& intersection) const
 {
-    intersection.reserve(indices.size());
-    MeshFacetIterator cMF1(_rclMesh);
-    MeshFacetIterator cMF2(_rclMesh);
-
-    Base::Vector3f pt1, pt2;
-    std::vector<std::pair<FacetIndex, FacetIndex>>::const_iterator it;
-    for (it = indices.begin(); it != indices.end(); ++it) {
-        cMF1.Set(it->first);
-        cMF2.Set(it->second);
-
-        Base::BoundBox3f box1 = cMF1->GetBoundBox();
-        Base::BoundBox3f box2 = cMF2->GetBoundBox();
-        if (box1 && box2) {
-            int ret = cMF1->IntersectWithFacet(*cMF2, pt1, pt2);
-            if (ret == 2) {
-                intersection.emplace_back(pt1, pt2);
-            }
+    using Section = std::pair<Base::Vector3f, Base::Vector3f>;
+    std::vector<Section> sections(indices.size());
+    std::vector<char> valid(indices.size(), 0);
+    Base::parallel_for(indices.size(),
+                       minParallelSelfIntersection,
+                       [&](std::size_t begin, std::size_t end) {
+                           Base::Vector3f pt1, pt2;
+                           for (std::size_t i = begin; i < end; i++) {
+                               MeshGeomFacet facet1 = _rclMesh.GetFacet(indices[i].first);
+                               MeshGeomFacet facet2 = _rclMesh.GetFacet(indices[i].second);
+                               if (facet1.GetBoundBox() && facet2.GetBoundBox()) {
+                                   int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
+                                   if (ret == 2) {
+                                       sections[i] = std::make_pair(pt1, pt2);
+                                       valid[i] = 1;
+                                   }
+                               }
+                           }
+                       });
+
+    intersection.reserve(intersection.size() + indices.size());
+    for (std::size_t i = 0; i < sections.size(); i++) {
+        if (valid[i]) {
+            intersection.push_back(sections[i]);
         }
     }
 }
@@ -703,77 +656,163 @@ void MeshEvalSelfIntersection::GetIntersections(
 void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
+    std::vector<std::pair<FacetIndex, FacetIndex>> pairs;
+    CollectIntersections(pairs, false);
+    intersection.insert(intersection.end(), pairs.begin(), pairs.end());
+}
 
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
+void MeshEvalSelfIntersection::CollectIntersections(
+    std::vector<std::pair<FacetIndex, FacetIndex>>& intersection,
+    bool stopAtFirst) const
+{
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
 
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
+    // Contains bounding boxes for every facet
+    std::vector<Base::BoundBox3f> boxes(rFaces.size());
+    auto computeBoxes = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            boxes[i] = _rclMesh.GetFacet(i).GetBoundBox();
+        }
+    };
+    Base::parallel_for(rFaces.size(), minParallelSelfIntersection, computeBoxes);
+
+    // The pairs of a chunk are collected in an own buffer and appended at the end of the chunk
+    std::atomic<bool> found {false};
+    std::mutex mutex;
+    auto appendPairs = [&](std::vector<std::pair<FacetIndex, FacetIndex>>& pairs) {
+        if (!pairs.empty()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            intersection.insert(intersection.end(), pairs.begin(), pairs.end());
+        }
+    };
+
+    // Tests the pair of facets, index1 must be lower than index2
+    auto testPair = [&](const MeshGeomFacet& facet1,
+                        FacetIndex index1,
+                        FacetIndex index2,
+                        std::vector<std::pair<FacetIndex, FacetIndex>>& pairs) {
+        if (shareVertex(rFaces[index1], rFaces[index2]) || !(boxes[index1] && boxes[index2])) {
+            return;
         }
-
-        MeshGeomFacet facet1, facet2;
         Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
+        MeshGeomFacet facet2 = _rclMesh.GetFacet(index2);
+        if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+            pairs.emplace_back(index1, index2);
+            found = true;
+        }
+    };
+
+    std::size_t count {};
+    std::function<void(std::size_t, std::size_t)> task;
+    std::unique_ptr<MeshFacetGrid> grid;
+    std::unique_ptr<MeshFacetBVH> bvh;
+    if (useBVH) {
+        // Searches for each facet the facets with a higher index whose boxes overlap
+        bvh = std::make_unique<MeshFacetBVH>(_rclMesh);
+        count = rFaces.size();
+        task = [&](std::size_t begin, std::size_t end) {
+            std::vector<std::pair<FacetIndex, FacetIndex>> pairs;
+            std::vector<FacetIndex> candidates;
+            for (std::size_t i = begin; i < end && !(stopAtFirst && found); i++) {
+                const Base::BoundBox3f& box1 = boxes[i];
+                candidates.clear();
+                bvh->Search(
+                    [&box1](const Base::BoundBox3f& box) {
+                        return box && box1;
+                    },
+                    candidates);
+
+                MeshGeomFacet facet1 = _rclMesh.GetFacet(i);
+                for (FacetIndex j : candidates) {
+                    if (j > i) {
+                        testPair(facet1, i, j, pairs);
+                    }
                 }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
+            }
+            appendPairs(pairs);
+        };
+    }
+    else {
+        // Splits the mesh using grid for speeding up the calculation. A pair of facets lies in
+        // several grid elements if its boxes overlap them, it's only tested in the first grid
+        // element containing both facets.
+        grid = std::make_unique<MeshFacetGrid>(_rclMesh);
+        unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
+        grid->GetCtGrids(ulGridX, ulGridY, ulGridZ);
+        count = ulGridX * ulGridY * ulGridZ;
+
+        auto isOwner = [&](unsigned long ulX,
+                           unsigned long ulY,
+                           unsigned long ulZ,
+                           FacetIndex index1,
+                           FacetIndex index2) {
+            const Base::BoundBox3f& box1 = boxes[index1];
+            const Base::BoundBox3f& box2 = boxes[index2];
+            Base::Vector3f minPt(std::max(box1.MinX, box2.MinX),
+                                 std::max(box1.MinY, box2.MinY),
+                                 std::max(box1.MinZ, box2.MinZ));
+            Base::Vector3f maxPt(std::min(box1.MaxX, box2.MaxX),
+                                 std::min(box1.MaxY, box2.MaxY),
+                                 std::min(box1.MaxZ, box2.MaxZ));
+            unsigned long ulX1 {}, ulY1 {}, ulZ1 {}, ulX2 {}, ulY2 {}, ulZ2 {};
+            grid->Position(minPt, ulX1, ulY1, ulZ1);
+            grid->Position(maxPt, ulX2, ulY2, ulZ2);
+            for (unsigned long z = ulZ1; z <= ulZ2; z++) {
+                for (unsigned long y = ulY1; y <= ulY2; y++) {
+                    for (unsigned long x = ulX1; x <= ulX2; x++) {
+                        if (x == ulX && y == ulY && z == ulZ) {
+                            return true;
+                        }
+                        MeshGridCell cell = grid->GetCell(x, y, z);
+                        if (std::binary_search(cell.begin(), cell.end(), index1)
+                            && std::binary_search(cell.begin(), cell.end(), index2)) {
+                            return false;
+                        }
+                    }
                 }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
+            }
+            return true;
+        };
+
+        task = [&](std::size_t begin, std::size_t end) {
+            std::vector<std::pair<FacetIndex, FacetIndex>> pairs;
+            for (std::size_t id = begin; id < end && !(stopAtFirst && found); id++) {
+                unsigned long ulX {}, ulY {}, ulZ {};
+                grid->GetPositionToIndex(id, ulX, ulY, ulZ);
+                // the indices of a grid element are sorted
+                MeshGridCell cell = grid->GetCell(ulX, ulY, ulZ);
+                for (auto it = cell.begin(); it != cell.end(); ++it) {
+                    MeshGeomFacet facet1 = _rclMesh.GetFacet(*it);
+                    for (auto jt = it + 1; jt != cell.end(); ++jt) {
+                        if (boxes[*it] && boxes[*jt] && isOwner(ulX, ulY, ulZ, *it, *jt)) {
+                            testPair(facet1, *it, *jt, pairs);
+                        }
                     }
                 }
             }
+            appendPairs(pairs);
+        };
+    }
+
+    // Calculates the intersections, the work is split into blocks to report the progress
+    const std::size_t steps = std::min(count, numSelfIntersectionSteps);
+    Base::SequencerLauncher seq("Checking for self-intersections...", steps);
+    for (std::size_t step = 0; step < steps; step++) {
+        std::size_t offset = step * count / steps;
+        std::size_t length = (step + 1) * count / steps - offset;
+        Base::parallel_for(length,
+                           minParallelSelfIntersection,
+                           [&](std::size_t begin, std::size_t end) {
+                               task(offset + begin, offset + end);
+                           });
+        if (stopAtFirst && found) {
+            break;
         }
+        seq.next(!stopAtFirst);
     }
+
+    // the order of the chunks depends on the scheduling
+    std::sort(intersection.begin(), intersection.end());
 }
 
 std::vector<FacetIndex> MeshFixSelfIntersection::GetFacets() const
@@ -969,74 +1008,8 @@ bool MeshFixNeighbourhood::Fixup()
 
 void MeshKernel::RebuildNeighbours(FacetIndex index)
 {
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * (this->_aclFacetArray.size() - index));
-
-    // build up an array of edges
-    auto pB = this->_aclFacetArray.begin();
-    for (auto pI = pB + index; pI != this->_aclFacetArray.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - pB;
-            edges.push_back(item);
-        }
-    }
-
-    // sort the edges
-    // std::sort(edges.begin(), edges.end(), Edge_Less());
-    int threads = int(std::thread::hardware_concurrency());
-    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
-
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
-        }
-        else {
-            // we handle only the cases for 1 and 2, for all higher
-            // values we have a non-manifold that is ignored here
-            if (count == 2) {
-                MeshFacet& rFace0 = this->_aclFacetArray[f0];
-                MeshFacet& rFace1 = this->_aclFacetArray[f1];
-                unsigned short side0 = rFace0.Side(p0, p1);
-                unsigned short side1 = rFace1.Side(p0, p1);
-                rFace0._aulNeighbours[side0] = f1;
-                rFace1._aulNeighbours[side1] = f0;
-            }
-            else if (count == 1) {
-                MeshFacet& rFace = this->_aclFacetArray[f0];
-                unsigned short side = rFace.Side(p0, p1);
-                rFace._aulNeighbours[side] = FACET_INDEX_MAX;
-            }
-
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
-        }
-    }
-
-    // we handle only the cases for 1 and 2, for all higher
-    // values we have a non-manifold that is ignored here
-    if (count == 2) {
-        MeshFacet& rFace0 = this->_aclFacetArray[f0];
-        MeshFacet& rFace1 = this->_aclFacetArray[f1];
-        unsigned short side0 = rFace0.Side(p0, p1);
-        unsigned short side1 = rFace1.Side(p0, p1);
-        rFace0._aulNeighbours[side0] = f1;
-        rFace1._aulNeighbours[side1] = f0;
-    }
-    else if (count == 1) {
-        MeshFacet& rFace = this->_aclFacetArray[f0];
-        unsigned short side = rFace.Side(p0, p1);
-        rFace._aulNeighbours[side] = FACET_INDEX_MAX;
-    }
+    MeshTopologyBuilder topology(this->FacetArray());
+    topology.SetNeighbourhood(index);
 }
 
 void MeshKernel::RebuildNeighbours()
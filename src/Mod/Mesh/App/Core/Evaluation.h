@@ -81,7 +81,10 @@ class MeshExport MeshValidation
 public:
     explicit MeshValidation(MeshKernel& rclB)
         : _rclMesh(rclB)
-    {}
+    {
+        // references to the arrays taken by a fixup must stay valid
+        _rclMesh.Detach();
+    }
     virtual ~MeshValidation() = default;
 
     MeshValidation(const MeshValidation&) = delete;
@@ -322,21 +325,33 @@ private:
 
 /**
  * The MeshEvalSelfIntersection class checks the mesh for self intersection.
+ * The candidate pairs are taken from a grid or, if \a useBVH is true, from a bounding volume
+ * hierarchy which copes better with unevenly distributed facets. The pairs are tested in
+ * parallel.
  * @author Werner Mayer
  */
 class MeshExport MeshEvalSelfIntersection: public MeshEvaluation
 {
 public:
-    explicit MeshEvalSelfIntersection(const MeshKernel& rclB)
+    explicit MeshEvalSelfIntersection(const MeshKernel& rclB, bool useBVH = false)
         : MeshEvaluation(rclB)
+        , useBVH(useBVH)
     {}
-    /// Evaluate the mesh and return if true if there are self intersections
+    /// Evaluate the mesh and return false if there are self intersections, stops at the first one
     bool Evaluate() override;
     /// collect all intersection lines
     void GetIntersections(const std::vector<std::pair<FacetIndex, FacetIndex>>&,
                           std::vector<std::pair<Base::Vector3f, Base::Vector3f>>&) const;
-    /// collect the index of all facets with self intersections
+    /** collect the index of all facets with self intersections, the pairs are sorted and
+     * the first index of a pair is lower than the second one */
     void GetIntersections(std::vector<std::pair<FacetIndex, FacetIndex>>&) const;
+
+private:
+    void CollectIntersections(std::vector<std::pair<FacetIndex, FacetIndex>>&,
+                              bool stopAtFirst) const;
+
+private:
+    bool useBVH;
 };
 
 /**
@@ -24,9 +24,13 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <memory>
 #endif
 
+#include <Base/ThreadPool.h>
+
 #include "Algorithm.h"
 #include "Grid.h"
 #include "Iterator.h"
@@ -71,7 +75,8 @@ void MeshGrid::Attach(const MeshKernel& rclM)
 
 void MeshGrid::Clear()
 {
-    _aulGrid.clear();
+    _aulCellOffsets.clear();
+    _aulCellElements.clear();
     _pclMesh = nullptr;
 }
 
@@ -129,13 +134,86 @@ void MeshGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
+    _aulCellOffsets.assign(std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ + 1, 0);
+    _aulCellElements.clear();
+}
+
+namespace
+{
+// Below this number of elements building the grid isn't worth starting threads
+constexpr MeshCore::ElementIndex minParallelElements = 100000;
+}  // namespace
+
+void MeshGrid::BuildCells(ElementIndex count, const CellCollector& collect)
+{
+    const std::size_t numCells = _aulCellOffsets.size() - 1;
+
+    std::unique_ptr<Base::ThreadPool> pool;
+    if (count >= minParallelElements) {
+        pool = std::make_unique<Base::ThreadPool>();
+    }
+    auto forEachTask = [&pool](std::size_t tasks, const std::function<void(std::size_t)>& func) {
+        if (!pool) {
+            for (std::size_t i = 0; i < tasks; i++) {
+                func(i);
+            }
+            return;
+        }
+        for (std::size_t i = 0; i < tasks; i++) {
+            pool->submit([&func, i]() {
+                func(i);
+            });
         }
+        pool->wait();
+    };
+
+    // Collect the grid elements of contiguous ranges of elements
+    const std::size_t numChunks = pool ? pool->size() * 4 : 1;
+    const ElementIndex chunkSize = (count + numChunks - 1) / numChunks;
+    std::vector<std::vector<CellEntry>> chunks(numChunks);
+    forEachTask(numChunks, [&](std::size_t chunk) {
+        ElementIndex begin = std::min<ElementIndex>(chunk * chunkSize, count);
+        ElementIndex end = std::min<ElementIndex>(begin + chunkSize, count);
+        collect(begin, end, chunks[chunk]);
+    });
+
+    // Count the elements of each grid element
+    std::vector<std::atomic<std::size_t>> cursors(numCells);
+    forEachTask(numChunks, [&](std::size_t chunk) {
+        for (const auto& entry : chunks[chunk]) {
+            cursors[entry.first].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < numCells; i++) {
+        _aulCellOffsets[i] = offset;
+        offset += cursors[i].load(std::memory_order_relaxed);
+        cursors[i].store(_aulCellOffsets[i], std::memory_order_relaxed);
+    }
+    _aulCellOffsets[numCells] = offset;
+
+    // Scatter the elements to their grid elements
+    _aulCellElements.resize(offset);
+    forEachTask(numChunks, [&](std::size_t chunk) {
+        for (const auto& entry : chunks[chunk]) {
+            std::size_t pos = cursors[entry.first].fetch_add(1, std::memory_order_relaxed);
+            _aulCellElements[pos] = entry.second;
+        }
+        std::vector<CellEntry>().swap(chunks[chunk]);
+    });
+
+    // Concurrent scattering doesn't preserve the order within a grid element
+    if (pool) {
+        const std::size_t cellsPerTask = (numCells + numChunks - 1) / numChunks;
+        forEachTask(numChunks, [&](std::size_t task) {
+            std::size_t first = std::min(task * cellsPerTask, numCells);
+            std::size_t last = std::min(first + cellsPerTask, numCells);
+            for (std::size_t i = first; i < last; i++) {
+                std::sort(_aulCellElements.begin() + _aulCellOffsets[i],
+                          _aulCellElements.begin() + _aulCellOffsets[i + 1]);
+            }
+        });
     }
 }
 
@@ -159,9 +237,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                MeshGridCell cell = GetCell(i, j, k);
+                raulElements.insert(raulElements.end(), cell.begin(), cell.end());
             }
         }
     }
@@ -201,9 +278,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    MeshGridCell cell = GetCell(i, j, k);
+                    raulElements.insert(raulElements.end(), cell.begin(), cell.end());
                 }
             }
         }
@@ -238,7 +314,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                MeshGridCell cell = GetCell(i, j, k);
+                raulElements.insert(cell.begin(), cell.end());
             }
         }
     }
@@ -462,7 +539,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            MeshGridCell cell = GetCell(nX, i, j);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nX++;
@@ -474,7 +552,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            MeshGridCell cell = GetCell(nX, i, j);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nX++;
@@ -486,7 +565,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            MeshGridCell cell = GetCell(i, nY, j);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nY++;
@@ -498,7 +578,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            MeshGridCell cell = GetCell(i, nY, j);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nY--;
@@ -510,7 +591,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            MeshGridCell cell = GetCell(i, j, nZ);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nZ++;
@@ -522,7 +604,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            MeshGridCell cell = GetCell(i, j, nZ);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nZ--;
@@ -610,10 +693,10 @@ unsigned long MeshGrid::GetElements(unsigned long ulX,
                                     unsigned long ulZ,
                                     std::set<ElementIndex>& raclInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    if (!rclSet.empty()) {
-        raclInd.insert(rclSet.begin(), rclSet.end());
-        return rclSet.size();
+    MeshGridCell cell = GetCell(ulX, ulY, ulZ);
+    if (!cell.empty()) {
+        raclInd.insert(cell.begin(), cell.end());
+        return cell.size();
     }
 
     return 0;
@@ -629,9 +712,8 @@ unsigned long MeshGrid::GetElements(const Base::Vector3f& rclPoint,
         return 0;
     }
 
-    aulFacets.resize(_aulGrid[ulX][ulY][ulZ].size());
-
-    std::copy(_aulGrid[ulX][ulY][ulZ].begin(), _aulGrid[ulX][ulY][ulZ].end(), aulFacets.begin());
+    MeshGridCell cell = GetCell(ulX, ulY, ulZ);
+    aulFacets.assign(cell.begin(), cell.end());
     return aulFacets.size();
 }
 
@@ -748,13 +830,12 @@ void MeshFacetGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-    MeshFacetIterator clFIter(*_pclMesh);
-
-    unsigned long i = 0;
-    for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-        //    AddFacet(*clFIter, i++, 2.0f);
-        AddFacet(*clFIter, i++);
-    }
+    BuildCells(_ulCtElements,
+               [this](ElementIndex begin, ElementIndex end, std::vector<CellEntry>& entries) {
+                   for (ElementIndex i = begin; i < end; i++) {
+                       AddFacet(_pclMesh->GetFacet(i), i, entries);
+                   }
+               });
 }
 
 unsigned long MeshFacetGrid::SearchNearestFromPoint(const Base::Vector3f& rclPt) const
@@ -985,8 +1066,7 @@ void MeshFacetGrid::SearchNearestFacetInGrid(unsigned long ulX,
                                              float& rfMinDist,
                                              ElementIndex& rulFacetInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    for (ElementIndex pI : rclSet) {
+    for (ElementIndex pI : GetCell(ulX, ulY, ulZ)) {
         float fDist = _pclMesh->GetFacet(pI).DistanceToPoint(rclPt);
         if (fDist < rfMinDist) {
             rfMinDist = fDist;
@@ -1029,15 +1109,16 @@ MeshPointGrid::MeshPointGrid(const MeshKernel& rclM, float fGridLen)
             std::max<unsigned long>(static_cast<unsigned long>(clBBMesh.LengthZ() / fGridLen), 1));
 }
 
-void MeshPointGrid::AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon)
+void MeshPointGrid::AddPoint(const MeshPoint& rclPt,
+                             ElementIndex ulPtIndex,
+                             std::vector<CellEntry>& entries) const
 {
-    (void)fEpsilon;
     unsigned long ulX {};
     unsigned long ulY {};
     unsigned long ulZ {};
     Pos(Base::Vector3f(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
     if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
+        entries.emplace_back(CellIndex(ulX, ulY, ulZ), ulPtIndex);
     }
 }
 
@@ -1094,13 +1175,15 @@ void MeshPointGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-
-    MeshPointIterator cPIter(*_pclMesh);
-
-    unsigned long i = 0;
-    for (cPIter.Init(); cPIter.More(); cPIter.Next()) {
-        AddPoint(*cPIter, i++);
-    }
+    const MeshPointArray& points = _pclMesh->GetPoints();
+    auto collect = [this, &points](ElementIndex begin,
+                                   ElementIndex end,
+                                   std::vector<CellEntry>& entries) {
+        for (ElementIndex i = begin; i < end; i++) {
+            AddPoint(points[i], i, entries);
+        }
+    };
+    BuildCells(_ulCtElements, collect);
 }
 
 void MeshPointGrid::Pos(const Base::Vector3f& rclPoint,
@@ -1165,9 +1248,8 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // Determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        MeshGridCell cell = _rclGrid.GetCell(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
         _bValidRay = true;
     }
     else {  // Start point outside
@@ -1182,9 +1264,8 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            MeshGridCell cell = _rclGrid.GetCell(_ulX, _ulY, _ulZ);
+            raulElements.insert(raulElements.end(), cell.begin(), cell.end());
             _bValidRay = true;
         }
     }
@@ -1248,9 +1329,8 @@ bool MeshGridIterator::NextOnRay(std::vector<ElementIndex>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        MeshGridCell cell = _rclGrid.GetCell(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     else {
         _bValidRay = false;  // Beam leaked
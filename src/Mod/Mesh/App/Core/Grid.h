@@ -23,7 +23,10 @@
 #ifndef MESH_GRID_H
 #define MESH_GRID_H
 
+#include <functional>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <Base/BoundBox.h>
 
@@ -44,6 +47,41 @@ class MeshGrid;
 
 static constexpr float MESHGRID_BBOX_EXTENSION = 10.0F;
 
+/**
+ * Read-only view on the element indices of one grid element. The indices are
+ * sorted in ascending order and unique.
+ */
+class MeshGridCell
+{
+public:
+    using const_iterator = const ElementIndex*;
+
+    MeshGridCell(const ElementIndex* first, const ElementIndex* last)
+        : _first(first)
+        , _last(last)
+    {}
+    const_iterator begin() const
+    {
+        return _first;
+    }
+    const_iterator end() const
+    {
+        return _last;
+    }
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(_last - _first);
+    }
+    bool empty() const
+    {
+        return _first == _last;
+    }
+
+private:
+    const ElementIndex* _first;
+    const ElementIndex* _last;
+};
+
 /**
  * The MeshGrid allows one to divide a global mesh object into smaller regions
  * of elements (e.g. facets, points or edges) depending on the resolution
@@ -51,6 +89,10 @@ static constexpr float MESHGRID_BBOX_EXTENSION = 10.0F;
  *
  * Grids can be used within algorithms to avoid to iterate through all elements,
  * so grids can speed up algorithms dramatically.
+ *
+ * The element indices of all grid elements are stored in one array, ordered by
+ * grid element, and an offset array points to the first index of each grid
+ * element. Sub-classes fill the grid with BuildCells().
  */
 class MeshExport MeshGrid
 {
@@ -151,7 +193,14 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return static_cast<unsigned long>(_aulGrid[ulX][ulY][ulZ].size());
+        return static_cast<unsigned long>(GetCell(ulX, ulY, ulZ).size());
+    }
+    /** Returns the sorted indices of the elements in a given grid. */
+    MeshGridCell GetCell(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+    {
+        std::size_t cell = CellIndex(ulX, ulY, ulZ);
+        const ElementIndex* data = _aulCellElements.data();
+        return {data + _aulCellOffsets[cell], data + _aulCellOffsets[cell + 1]};
     }
     /** Validates the grid structure and rebuilds it if needed. Must be implemented in sub-classes.
      */
@@ -193,10 +242,27 @@ protected:
     /** Returns the number of stored elements. Must be implemented in sub-classes. */
     virtual unsigned long HasElements() const = 0;
 
+    /// Index of a grid element and index of a mesh element lying in it
+    using CellEntry = std::pair<unsigned long, ElementIndex>;
+    /** Appends a CellEntry for every grid element the mesh elements in the range [begin, end)
+     * lie in. It is called concurrently for disjoint ranges. */
+    using CellCollector = std::function<
+        void(ElementIndex begin, ElementIndex end, std::vector<CellEntry>& entries)>;
+    /** Fills the grid elements, initialized by InitGrid(), with the \a count elements reported by
+     * \a collect. Large grids are filled in parallel, first counting the elements of each grid
+     * element and then scattering them to their position. */
+    void BuildCells(ElementIndex count, const CellCollector& collect);
+    /** Returns the index of the grid element at the given valid grid position. */
+    unsigned long CellIndex(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+    {
+        return (ulZ * _ulCtGridsY + ulY) * _ulCtGridsX + ulX;
+    }
+
 protected:
     // NOLINTBEGIN
-    std::vector<std::vector<std::vector<std::set<ElementIndex>>>>
-        _aulGrid;                /**< Grid data structure. */
+    std::vector<std::size_t> _aulCellOffsets;   /**< Start of each grid element. */
+    std::vector<ElementIndex> _aulCellElements; /**< Element indices of all grid elements. */
+
     const MeshKernel* _pclMesh;  /**< The mesh kernel. */
     unsigned long _ulCtElements; /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;   /**< Number of grid elements in z. */
@@ -287,8 +353,9 @@ protected:
     /** Adds a new facet element to the grid structure. \a rclFacet is the geometric facet and \a
      * ulFacetIndex the corresponding index in the mesh kernel. The facet is added to each grid
      * element that intersects the facet. */
-    inline void
-    AddFacet(const MeshGeomFacet& rclFacet, ElementIndex ulFacetIndex, float fEpsilon = 0.0F);
+    inline void AddFacet(const MeshGeomFacet& rclFacet,
+                         ElementIndex ulFacetIndex,
+                         std::vector<CellEntry>& entries) const;
     /** Returns the number of stored elements. */
     unsigned long HasElements() const override
     {
@@ -338,7 +405,9 @@ public:
 protected:
     /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
      * ulPtIndex the corresponding index in the mesh kernel. */
-    void AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon = 0.0F);
+    void AddPoint(const MeshPoint& rclPt,
+                  ElementIndex ulPtIndex,
+                  std::vector<CellEntry>& entries) const;
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3f& rclPoint,
              unsigned long& rulX,
@@ -370,9 +439,8 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<ElementIndex>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        MeshGridCell cell = _rclGrid.GetCell(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     /** Returns the number of elements in the current grid. */
     unsigned long GetCtElements() const
@@ -562,7 +630,7 @@ inline void MeshFacetGrid::PosWithCheck(const Base::Vector3f& rclPoint,
 
 inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
                                     ElementIndex ulFacetIndex,
-                                    float /*fEpsilon*/)
+                                    std::vector<CellEntry>& entries) const
 {
     unsigned long ulX {};
     unsigned long ulY {};
@@ -604,14 +672,14 @@ inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
             for (ulY = ulY1; ulY <= ulY2; ulY++) {
                 for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                     if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                        _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                        entries.emplace_back(CellIndex(ulX, ulY, ulZ), ulFacetIndex);
                     }
                 }
             }
         }
     }
     else {
-        _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+        entries.emplace_back(CellIndex(ulX1, ulY1, ulZ1), ulFacetIndex);
     }
 }
 
@@ -30,6 +30,7 @@
 #include <xercesc/parsers/XercesDOMParser.hpp>
 #endif
 
+#include "Core/Builder.h"
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
 #include <Base/InputSource.h>
@@ -392,8 +393,9 @@ void Reader3MF::LoadMesh(DOMNodeList* nodes, int id, const Component& comp)
 
             MeshCleanup meshCleanup(points, facets);
             meshCleanup.RemoveInvalids();
-            MeshPointFacetAdjacency meshAdj(points.size(), facets);
-            meshAdj.SetFacetNeighbourhood();
+            MeshTopologyBuilder topology(facets);
+            topology.SetNonManifoldNeighbours(MeshTopologyBuilder::NonManifoldToFirst);
+            topology.SetNeighbourhood();
 
             Base::Matrix4D mat = comp.transform;
             MeshKernel kernel;
@@ -22,59 +22,217 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
 #include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
 #include <boost/tokenizer.hpp>
+#include <cstdlib>
 #include <istream>
 #endif
 
+#include "Core/Builder.h"
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
+#include <Base/LineParser.h>
+#include <Base/ThreadPool.h>
 #include <Base/Tools.h>
 
 #include "ReaderOBJ.h"
 
 
 using namespace MeshCore;
+using Base::LineBlockReader;
+using Base::LineScanner;
 
 ReaderOBJ::ReaderOBJ(MeshKernel& kernel, Material* material)
     : _kernel(kernel)
     , _material(material)
 {}
 
-bool ReaderOBJ::Load(std::istream& str)
+namespace
+{
+// Minimum number of lines of a block to parse them concurrently
+constexpr std::size_t minParallelLines = 10000;
+
+/** A parsed line of an OBJ file. Names refer to the rest of the line, starting with the name.
+ */
+struct LineOBJ
+{
+    enum Type
+    {
+        None,
+        Point,
+        PointWithColor,
+        Group,
+        Library,
+        Material,
+        Face
+    };
+
+    Type type {None};
+    bool hasColor {false};
+    int numIndexes {0};
+    std::array<float, 3> point {};
+    std::array<float, 3> color {};
+    std::array<int, 4> index {};
+    std::string_view name;
+};
+
+bool parsePoint(const std::array<std::string_view, 6>& tokens, std::array<float, 3>& point)
+{
+    std::array<double, 3> values {};
+    for (std::size_t i = 0; i < values.size(); i++) {
+        if (!LineScanner::parseDecimal(tokens[i], values[i])) {
+            return false;
+        }
+    }
+    for (std::size_t i = 0; i < values.size(); i++) {
+        point[i] = static_cast<float>(values[i]);
+    }
+    return true;
+}
+
+// Checks for a color value [0-9]{1,3}
+bool isColorInt(std::string_view token)
+{
+    return !token.empty() && token.size() <= 3
+        && std::all_of(token.begin(), token.end(), [](char ch) {
+               return ch >= '0' && ch <= '9';
+           });
+}
+
+// Checks for a name [\x21-\x7E]+ with nothing but whitespace behind it
+bool parseName(LineScanner& scanner, std::string_view line, LineOBJ& item)
+{
+    std::string_view name = scanner.token();
+    bool valid = !name.empty() && std::all_of(name.begin(), name.end(), [](char ch) {
+        return ch >= 0x21 && ch <= 0x7E;
+    });
+    if (!valid || !scanner.atEnd()) {
+        return false;
+    }
+    item.name = line.substr(name.data() - line.data());
+    return true;
+}
+
+// Checks for a face vertex ([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]* and returns the first number
+bool parseFaceVertex(std::string_view token, int& index)
+{
+    auto skipSign = [&token](std::size_t pos) {
+        return pos < token.size() && (token[pos] == '-' || token[pos] == '+') ? pos + 1 : pos;
+    };
+    auto skipDigits = [&token](std::size_t pos) {
+        while (pos < token.size() && token[pos] >= '0' && token[pos] <= '9') {
+            ++pos;
+        }
+        return pos;
+    };
+
+    std::size_t pos = skipSign(0);
+    std::size_t digits = skipDigits(pos);
+    if (digits == pos) {
+        return false;
+    }
+    std::string_view number = token.substr(0, digits);
+    pos = digits;
+    for (int i = 0; i < 2; i++) {
+        if (pos < token.size() && token[pos] == '/') {
+            ++pos;
+        }
+        pos = skipDigits(skipSign(pos));
+    }
+    if (pos != token.size()) {
+        return false;
+    }
+
+    // like std::atoi()
+    if (!LineScanner::parseNumber(number, index)) {
+        index = static_cast<int>(std::strtol(std::string(number).c_str(), nullptr, 10));
+    }
+    return true;
+}
+
+void parseLineOBJ(std::string_view line, LineOBJ& item)
 {
-    boost::regex rx_m("^mtllib\\s+(.+)\\s*$");
-    boost::regex rx_u(R"(^usemtl\s+([\x21-\x7E]+)\s*$)");
-    boost::regex rx_g(R"(^g\s+([\x21-\x7E]+)\s*$)");
-    boost::regex rx_p("^v\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    boost::regex rx_c("^v\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+(\\d{1,3})\\s+(\\d{1,3})\\s+(\\d{1,3})\\s*$");
-    boost::regex rx_t("^v\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    boost::regex rx_f3("^f\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*\\s*$");
-    boost::regex rx_f4("^f\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*\\s*$");
-    boost::cmatch what;
+    item.type = LineOBJ::None;
+    LineScanner scanner(line);
+    if (scanner.keyword("v")) {
+        std::array<std::string_view, 6> tokens;
+        std::size_t count = 0;
+        while (count < tokens.size() && !scanner.atEnd()) {
+            tokens[count++] = scanner.token();
+        }
+        if ((count != 3 && count != 6) || !scanner.atEnd() || !parsePoint(tokens, item.point)) {
+            return;
+        }
+        item.type = LineOBJ::Point;
+        item.hasColor = count == 6;
+        if (!item.hasColor) {
+            return;
+        }
+
+        if (isColorInt(tokens[3]) && isColorInt(tokens[4]) && isColorInt(tokens[5])) {
+            for (std::size_t i = 0; i < item.color.size(); i++) {
+                int value {};
+                LineScanner::parseNumber(tokens[i + 3], value);
+                item.color[i] = static_cast<float>(std::min<int>(value, 255)) / 255.0F;
+            }
+            return;
+        }
+
+        for (std::size_t i = 0; i < item.color.size(); i++) {
+            double value {};
+            if (!LineScanner::parseDecimal(tokens[i + 3], value)) {
+                item.type = LineOBJ::None;
+                return;
+            }
+            item.color[i] = static_cast<float>(value);
+        }
+    }
+    else if (scanner.keyword("g")) {
+        if (parseName(scanner, line, item)) {
+            item.type = LineOBJ::Group;
+        }
+    }
+    else if (scanner.keyword("mtllib")) {
+        // as the regular expression ^mtllib\s+(.+)\s*$ the name is the rest of the line, or the
+        // last whitespace character if there is nothing else
+        std::string_view spaces = scanner.rest();
+        if (!scanner.atEnd()) {
+            item.name = scanner.rest();
+            item.type = LineOBJ::Library;
+        }
+        else if (spaces.size() > 1) {
+            item.name = spaces.substr(spaces.size() - 1);
+            item.type = LineOBJ::Library;
+        }
+    }
+    else if (scanner.keyword("usemtl")) {
+        if (parseName(scanner, line, item)) {
+            item.type = LineOBJ::Material;
+        }
+    }
+    else if (scanner.keyword("f")) {
+        int count = 0;
+        while (count < 4 && !scanner.atEnd()) {
+            if (!parseFaceVertex(scanner.token(), item.index[count++])) {
+                return;
+            }
+        }
+        if (count >= 3 && scanner.atEnd()) {
+            item.numIndexes = count;
+            item.type = LineOBJ::Face;
+        }
+    }
+}
+}  // namespace
 
+bool ReaderOBJ::Load(std::istream& str)
+{
     unsigned long segment = 0;
     MeshPointArray meshPoints;
     MeshFacetArray meshFacets;
 
-    std::string line;
-    float fX {}, fY {}, fZ {};
     int i1 = 1, i2 = 1, i3 = 1, i4 = 1;
     MeshFacet item;
 
@@ -93,110 +251,82 @@ bool ReaderOBJ::Load(std::istream& str)
     std::string materialName;
     unsigned long countMaterialFacets = 0;
 
-    while (std::getline(str, line)) {
-        if (boost::regex_match(line.c_str(), what, rx_p)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_c)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            float r = std::min<int>(std::atof(what[10].first), 255) / 255.0F;
-            float g = std::min<int>(std::atof(what[11].first), 255) / 255.0F;
-            float b = std::min<int>(std::atof(what[12].first), 255) / 255.0F;
-            meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
-
-            App::Color c(r, g, b);
-            unsigned long prop = static_cast<uint32_t>(c.getPackedValue());
-            meshPoints.back().SetProperty(prop);
-            rgb_value = MeshIO::PER_VERTEX;
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_t)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            float r = static_cast<float>(std::atof(what[10].first));
-            float g = static_cast<float>(std::atof(what[13].first));
-            float b = static_cast<float>(std::atof(what[16].first));
-            meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
-
-            App::Color c(r, g, b);
-            unsigned long prop = static_cast<uint32_t>(c.getPackedValue());
-            meshPoints.back().SetProperty(prop);
-            rgb_value = MeshIO::PER_VERTEX;
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_g)) {
-            new_segment = true;
-            groupName = Base::Tools::escapedUnicodeToUtf8(what[1].first);
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_m)) {
-            if (_material) {
-                _material->library = Base::Tools::escapedUnicodeToUtf8(what[1].first);
-            }
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_u)) {
-            if (!materialName.empty()) {
-                _materialNames.emplace_back(materialName, countMaterialFacets);
-            }
-            materialName = Base::Tools::escapedUnicodeToUtf8(what[1].first);
-            countMaterialFacets = 0;
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_f3)) {
-            // starts a new segment
-            if (new_segment) {
-                if (!groupName.empty()) {
-                    _groupNames.push_back(groupName);
-                    groupName.clear();
-                }
-                new_segment = false;
-                segment++;
-            }
+    auto pointIndex = [&meshPoints](int index) {
+        return index > 0 ? index - 1 : index + static_cast<int>(meshPoints.size());
+    };
 
-            // 3-vertex face
-            i1 = std::atoi(what[1].first);
-            i1 = i1 > 0 ? i1 - 1 : i1 + static_cast<int>(meshPoints.size());
-            i2 = std::atoi(what[2].first);
-            i2 = i2 > 0 ? i2 - 1 : i2 + static_cast<int>(meshPoints.size());
-            i3 = std::atoi(what[3].first);
-            i3 = i3 > 0 ? i3 - 1 : i3 + static_cast<int>(meshPoints.size());
-            item.SetVertices(i1, i2, i3);
-            item.SetProperty(segment);
-            meshFacets.push_back(item);
-            countMaterialFacets++;
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_f4)) {
-            // starts a new segment
-            if (new_segment) {
-                if (!groupName.empty()) {
-                    _groupNames.push_back(groupName);
-                    groupName.clear();
-                }
-                new_segment = false;
-                segment++;
+    // The lines of a block are parsed concurrently and then added in their order
+    std::vector<LineOBJ> items;
+    LineBlockReader reader(str);
+    while (reader.next()) {
+        const std::vector<std::string_view>& lines = reader.lines();
+        items.resize(lines.size());
+        Base::parallel_for(lines.size(), minParallelLines, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                parseLineOBJ(lines[i], items[i]);
+            }
+        });
+
+        for (const LineOBJ& line : items) {
+            switch (line.type) {
+                case LineOBJ::Point: {
+                    const auto& pnt = line.point;
+                    meshPoints.push_back(MeshPoint(Base::Vector3f(pnt[0], pnt[1], pnt[2])));
+                    if (line.hasColor) {
+                        App::Color c(line.color[0], line.color[1], line.color[2]);
+                        unsigned long prop = static_cast<uint32_t>(c.getPackedValue());
+                        meshPoints.back().SetProperty(prop);
+                        rgb_value = MeshIO::PER_VERTEX;
+                    }
+                } break;
+                case LineOBJ::Group:
+                    new_segment = true;
+                    groupName = Base::Tools::escapedUnicodeToUtf8(std::string(line.name));
+                    break;
+                case LineOBJ::Library:
+                    if (_material) {
+                        _material->library =
+                            Base::Tools::escapedUnicodeToUtf8(std::string(line.name));
+                    }
+                    break;
+                case LineOBJ::Material:
+                    if (!materialName.empty()) {
+                        _materialNames.emplace_back(materialName, countMaterialFacets);
+                    }
+                    materialName = Base::Tools::escapedUnicodeToUtf8(std::string(line.name));
+                    countMaterialFacets = 0;
+                    break;
+                case LineOBJ::Face:
+                    // starts a new segment
+                    if (new_segment) {
+                        if (!groupName.empty()) {
+                            _groupNames.push_back(groupName);
+                            groupName.clear();
+                        }
+                        new_segment = false;
+                        segment++;
+                    }
+
+                    i1 = pointIndex(line.index[0]);
+                    i2 = pointIndex(line.index[1]);
+                    i3 = pointIndex(line.index[2]);
+                    item.SetVertices(i1, i2, i3);
+                    item.SetProperty(segment);
+                    meshFacets.push_back(item);
+                    countMaterialFacets++;
+
+                    // 4-vertex face
+                    if (line.numIndexes == 4) {
+                        i4 = pointIndex(line.index[3]);
+                        item.SetVertices(i3, i4, i1);
+                        item.SetProperty(segment);
+                        meshFacets.push_back(item);
+                        countMaterialFacets++;
+                    }
+                    break;
+                default:
+                    break;
             }
-
-            // 4-vertex face
-            i1 = std::atoi(what[1].first);
-            i1 = i1 > 0 ? i1 - 1 : i1 + static_cast<int>(meshPoints.size());
-            i2 = std::atoi(what[2].first);
-            i2 = i2 > 0 ? i2 - 1 : i2 + static_cast<int>(meshPoints.size());
-            i3 = std::atoi(what[3].first);
-            i3 = i3 > 0 ? i3 - 1 : i3 + static_cast<int>(meshPoints.size());
-            i4 = std::atoi(what[4].first);
-            i4 = i4 > 0 ? i4 - 1 : i4 + static_cast<int>(meshPoints.size());
-
-            item.SetVertices(i1, i2, i3);
-            item.SetProperty(segment);
-            meshFacets.push_back(item);
-            countMaterialFacets++;
-
-            item.SetVertices(i3, i4, i1);
-            item.SetProperty(segment);
-            meshFacets.push_back(item);
-            countMaterialFacets++;
         }
     }
 
@@ -235,8 +365,9 @@ bool ReaderOBJ::Load(std::istream& str)
         meshCleanup.SetMaterial(_material);
     }
     meshCleanup.RemoveInvalids();
-    MeshPointFacetAdjacency meshAdj(meshPoints.size(), meshFacets);
-    meshAdj.SetFacetNeighbourhood();
+    MeshTopologyBuilder topology(meshFacets);
+    topology.SetNonManifoldNeighbours(MeshTopologyBuilder::NonManifoldToFirst);
+    topology.SetNeighbourhood();
     _kernel.Adopt(meshPoints, meshFacets);
 
     return true;
@@ -23,19 +23,26 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <boost/lexical_cast.hpp>
 #include <istream>
+#include <sstream>
 #endif
 
+#include "Core/Builder.h"
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
+#include <Base/LineParser.h>
 #include <Base/Stream.h>
+#include <Base/ThreadPool.h>
 #include <Base/Tools.h>
 
 #include "ReaderPLY.h"
 
 
 using namespace MeshCore;
+using Base::LineBlockReader;
+using Base::LineScanner;
 
 // http://local.wasp.uwa.edu.au/~pbourke/dataformats/ply/
 ReaderPLY::ReaderPLY(MeshKernel& kernel, Material* material)
@@ -400,102 +407,203 @@ void ReaderPLY::CleanupMesh()
         meshCleanup.SetMaterial(_material);
     }
     meshCleanup.RemoveInvalids();
-    MeshPointFacetAdjacency meshAdj(meshPoints.size(), meshFacets);
-    meshAdj.SetFacetNeighbourhood();
+    MeshTopologyBuilder topology(meshFacets);
+    topology.SetNonManifoldNeighbours(MeshTopologyBuilder::NonManifoldToFirst);
+    topology.SetNeighbourhood();
     _kernel.Adopt(meshPoints, meshFacets);
 }
 
-bool ReaderPLY::ReadVertexes(std::istream& input)
+bool ReaderPLY::ReadVertex(std::string_view line, PropertyArray& prop_values) const
 {
-    std::string line;
-    for (std::size_t i = 0; i < v_count && std::getline(input, line); i++) {
-        std::istringstream str(line);
-        str.unsetf(std::ios_base::skipws);
-        str >> std::ws;
+    LineScanner scanner(line);
+    prop_values.fill(0.0F);
+
+    // go through the vertex properties
+    std::size_t count_props = vertex_props.size();
+    for (const auto& it : vertex_props) {
+        std::string_view token = scanner.token();
+        bool valid = false;
+        switch (it.second) {
+            case int8:
+            case int16:
+            case int32: {
+                int vt {};
+                valid = LineScanner::parseNumber(token, vt);
+                prop_values[it.first] = static_cast<float>(vt);
+            } break;
+            case uint8:
+            case uint16:
+            case uint32: {
+                unsigned int vt {};
+                valid = LineScanner::parseNumber(token, vt);
+                prop_values[it.first] = static_cast<float>(vt);
+            } break;
+            case float32: {
+                float vt {};
+                valid = LineScanner::parseNumber(token, vt);
+                prop_values[it.first] = vt;
+            } break;
+            case float64: {
+                double vt {};
+                valid = LineScanner::parseNumber(token, vt);
+                prop_values[it.first] = static_cast<float>(vt);
+            } break;
+            default:
+                return false;
+        }
 
-        // go through the vertex properties
-        PropertyArray prop_values {};
-        std::size_t count_props = vertex_props.size();
-        for (const auto& it : vertex_props) {
-            switch (it.second) {
-                case int8:
-                case int16:
-                case int32: {
-                    int vt {};
-                    str >> vt >> std::ws;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case uint8:
-                case uint16:
-                case uint32: {
-                    unsigned int vt {};
-                    str >> vt >> std::ws;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case float32: {
-                    float vt {};
-                    str >> vt >> std::ws;
-                    prop_values[it.first] = vt;
-                } break;
-                case float64: {
-                    double vt {};
-                    str >> vt >> std::ws;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                default:
-                    return false;
-            }
+        // let the stream handle anything unusual
+        if (!valid) {
+            std::istringstream str {std::string(line)};
+            return ReadVertex(str, prop_values);
+        }
+
+        // does line contain all properties
+        if (--count_props > 0 && scanner.atEnd()) {
+            return false;
+        }
+    }
+
+    return true;
+}
 
-            // does line contain all properties
-            if (--count_props > 0 && str.eof()) {
+bool ReaderPLY::ReadVertex(std::istream& str, PropertyArray& prop_values) const
+{
+    str.unsetf(std::ios_base::skipws);
+    str >> std::ws;
+    prop_values.fill(0.0F);
+
+    // go through the vertex properties
+    std::size_t count_props = vertex_props.size();
+    for (const auto& it : vertex_props) {
+        switch (it.second) {
+            case int8:
+            case int16:
+            case int32: {
+                int vt {};
+                str >> vt >> std::ws;
+                prop_values[it.first] = static_cast<float>(vt);
+            } break;
+            case uint8:
+            case uint16:
+            case uint32: {
+                unsigned int vt {};
+                str >> vt >> std::ws;
+                prop_values[it.first] = static_cast<float>(vt);
+            } break;
+            case float32: {
+                float vt {};
+                str >> vt >> std::ws;
+                prop_values[it.first] = vt;
+            } break;
+            case float64: {
+                double vt {};
+                str >> vt >> std::ws;
+                prop_values[it.first] = static_cast<float>(vt);
+            } break;
+            default:
                 return false;
-            }
         }
 
-        addVertexProperty(prop_values);
+        // does line contain all properties
+        if (--count_props > 0 && str.eof()) {
+            return false;
+        }
     }
 
     return true;
 }
 
-bool ReaderPLY::ReadFaces(std::istream& input)
+bool ReaderPLY::ReadFace(std::string_view line, MeshFacet& facet) const
 {
     constexpr const std::size_t count_props = 4;
-    std::string line;
-    for (std::size_t i = 0; i < f_count && std::getline(input, line); i++) {
-        std::istringstream str(line);
-        str.unsetf(std::ios_base::skipws);
-        str >> std::ws;
-
-        std::array<int, count_props> v_indices {};
-        std::size_t index = count_props;
-        for (int& vt : v_indices) {
-            str >> vt >> std::ws;
-            if (--index > 0 && str.eof()) {
-                return false;
-            }
+    LineScanner scanner(line);
+
+    std::array<int, count_props> v_indices {};
+    std::size_t index = count_props;
+    for (int& vt : v_indices) {
+        if (!LineScanner::parseNumber(scanner.token(), vt)) {
+            // let the stream handle anything unusual
+            std::istringstream str {std::string(line)};
+            return ReadFace(str, facet);
         }
-
-        if (v_indices[0] != 3) {
+        if (--index > 0 && scanner.atEnd()) {
             return false;
         }
+    }
 
-        meshFacets.push_back(MeshFacet(v_indices[1], v_indices[2], v_indices[3]));
+    if (v_indices[0] != 3) {
+        return false;
     }
 
+    facet = MeshFacet(v_indices[1], v_indices[2], v_indices[3]);
     return true;
 }
 
-bool ReaderPLY::LoadAscii(std::istream& input)
+bool ReaderPLY::ReadFace(std::istream& str, MeshFacet& facet) const
 {
-    if (!ReadVertexes(input)) {
-        return false;
+    constexpr const std::size_t count_props = 4;
+    str.unsetf(std::ios_base::skipws);
+    str >> std::ws;
+
+    std::array<int, count_props> v_indices {};
+    std::size_t index = count_props;
+    for (int& vt : v_indices) {
+        str >> vt >> std::ws;
+        if (--index > 0 && str.eof()) {
+            return false;
+        }
     }
 
-    if (!ReadFaces(input)) {
+    if (v_indices[0] != 3) {
         return false;
     }
 
+    facet = MeshFacet(v_indices[1], v_indices[2], v_indices[3]);
+    return true;
+}
+
+bool ReaderPLY::LoadAscii(std::istream& input)
+{
+    // The first v_count lines are vertexes and the next f_count lines are faces. The lines of a
+    // block are parsed concurrently and then added in their order until the first invalid line.
+    struct Line
+    {
+        PropertyArray prop {};
+        MeshFacet facet;
+        bool valid {false};
+    };
+
+    constexpr std::size_t minParallelLines = 10000;
+    const std::size_t numLines = v_count + f_count;
+    std::size_t lineIndex = 0;
+    std::vector<Line> items;
+    LineBlockReader reader(input);
+    while (lineIndex < numLines && reader.next()) {
+        const std::vector<std::string_view>& lines = reader.lines();
+        std::size_t count = std::min(lines.size(), numLines - lineIndex);
+        items.resize(count);
+        Base::parallel_for(count, minParallelLines, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                Line& item = items[i];
+                item.valid = lineIndex + i < v_count ? ReadVertex(lines[i], item.prop)
+                                                     : ReadFace(lines[i], item.facet);
+            }
+        });
+
+        for (std::size_t i = 0; i < count; i++, lineIndex++) {
+            if (!items[i].valid) {
+                return false;
+            }
+            if (lineIndex < v_count) {
+                addVertexProperty(items[i].prop);
+            }
+            else {
+                meshFacets.push_back(items[i].facet);
+            }
+        }
+    }
+
     CleanupMesh();
     return true;
 }
@@ -28,6 +28,7 @@
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/MeshGlobal.h>
 #include <iosfwd>
+#include <string_view>
 
 namespace Base
 {
@@ -64,8 +65,6 @@ private:
     bool ReadProperty(std::istream& str, const std::string& element);
     bool ReadVertexProperty(std::istream& str);
     bool ReadFaceProperty(std::istream& str);
-    bool ReadVertexes(std::istream& input);
-    bool ReadFaces(std::istream& input);
     bool ReadVertexes(Base::InputStream& is);
     bool ReadFaces(Base::InputStream& is);
     bool LoadAscii(std::istream& input);
@@ -88,6 +87,10 @@ private:
     static Property propertyOfName(const std::string& name);
     using PropertyArray = std::array<float, num_props>;
     void addVertexProperty(const PropertyArray& prop);
+    bool ReadVertex(std::string_view line, PropertyArray& prop) const;
+    bool ReadVertex(std::istream& str, PropertyArray& prop) const;
+    bool ReadFace(std::string_view line, MeshFacet& facet) const;
+    bool ReadFace(std::istream& str, MeshFacet& facet) const;
 
     enum Number
     {
@@ -397,8 +397,8 @@ public:
 };
 
 inline MeshFastFacetIterator::MeshFastFacetIterator(const MeshKernel& rclM)
-    : _rclFAry(rclM._aclFacetArray)
-    , _rclPAry(rclM._aclPointArray)
+    : _rclFAry(rclM.FacetArray())
+    , _rclPAry(rclM.PointArray())
     , _clIter(_rclFAry.begin())
 {}
 
@@ -413,17 +413,17 @@ inline void MeshFastFacetIterator::Next()
 
 inline MeshFacetIterator::MeshFacetIterator(const MeshKernel& rclM)
     : _rclMesh(rclM)
-    , _rclFAry(rclM._aclFacetArray)
-    , _rclPAry(rclM._aclPointArray)
-    , _clIter(rclM._aclFacetArray.begin())
+    , _rclFAry(rclM.FacetArray())
+    , _rclPAry(rclM.PointArray())
+    , _clIter(rclM.FacetArray().begin())
     , _bApply(false)
 {}
 
 inline MeshFacetIterator::MeshFacetIterator(const MeshKernel& rclM, FacetIndex ulPos)
     : _rclMesh(rclM)
-    , _rclFAry(rclM._aclFacetArray)
-    , _rclPAry(rclM._aclPointArray)
-    , _clIter(rclM._aclFacetArray.begin() + ulPos)
+    , _rclFAry(rclM.FacetArray())
+    , _rclPAry(rclM.PointArray())
+    , _clIter(rclM.FacetArray().begin() + ulPos)
     , _bApply(false)
 {}
 
@@ -542,7 +542,7 @@ inline void MeshFacetIterator::SetToNeighbour(unsigned short usN)
 
 inline MeshPointIterator::MeshPointIterator(const MeshKernel& rclM)
     : _rclMesh(rclM)
-    , _rclPAry(_rclMesh._aclPointArray)
+    , _rclPAry(_rclMesh.PointArray())
     , _bApply(false)
 {
     _clIter = _rclPAry.begin();
@@ -550,7 +550,7 @@ inline MeshPointIterator::MeshPointIterator(const MeshKernel& rclM)
 
 inline MeshPointIterator::MeshPointIterator(const MeshKernel& rclM, PointIndex ulPos)
     : _rclMesh(rclM)
-    , _rclPAry(_rclMesh._aclPointArray)
+    , _rclPAry(_rclMesh.PointArray())
     , _bApply(false)
 {
     _clIter = _rclPAry.begin() + ulPos;
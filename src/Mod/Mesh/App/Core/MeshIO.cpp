@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iomanip>
 #include <sstream>
@@ -46,10 +47,12 @@
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/LineParser.h>
 #include <Base/Placement.h>
 #include <Base/Reader.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/ThreadPool.h>
 #include <Base/Tools.h>
 #include <Base/Writer.h>
 #include <zipios++/gzipoutputstream.h>
@@ -64,6 +67,8 @@
 
 
 using namespace MeshCore;
+using Base::LineBlockReader;
+using Base::LineScanner;
 
 namespace MeshCore
 {
@@ -466,14 +471,241 @@ bool MeshInput::LoadSMF(std::istream& input)
 
     MeshCleanup meshCleanup(meshPoints, meshFacets);
     meshCleanup.RemoveInvalids();
-    MeshPointFacetAdjacency meshAdj(meshPoints.size(), meshFacets);
-    meshAdj.SetFacetNeighbourhood();
+    MeshTopologyBuilder topology(meshFacets);
+    topology.SetNonManifoldNeighbours(MeshTopologyBuilder::NonManifoldToFirst);
+    topology.SetNeighbourhood();
     this->_rclMesh.Adopt(meshPoints, meshFacets);
 
     return true;
 }
 
 /** Loads an OFF file. */
+namespace
+{
+// Minimum number of lines of a block to parse them concurrently
+constexpr std::size_t minParallelLines = 10000;
+
+/** A parsed vertex or face line of an OFF file. */
+struct LineOFF
+{
+    enum Type
+    {
+        Blank,
+        Invalid,
+        Vertex,
+        Face
+    };
+
+    /// The line was parsed as Vertex or Face
+    Type role {Vertex};
+    Type type {Blank};
+    Base::Vector3f point;
+    std::vector<int> indexes;
+    bool hasColor {false};
+    std::array<float, 4> color {};
+};
+
+void scaleColorOFF(std::array<float, 4>& color)
+{
+    if (std::any_of(color.begin(), color.end(), [](float value) {
+            return value > 1.0F;
+        })) {
+        for (float& value : color) {
+            value = value / 255.0F;
+        }
+    }
+}
+
+// Reads the optional color of a vertex or face as "r g b [a]"
+bool parseColorOFF(LineScanner& scanner, LineOFF& item)
+{
+    item.hasColor = false;
+    if (scanner.atEnd()) {
+        return true;
+    }
+
+    auto& color = item.color;
+    if (!LineScanner::parseNumber(scanner.token(), color[0])
+        || !LineScanner::parseNumber(scanner.token(), color[1])
+        || !LineScanner::parseNumber(scanner.token(), color[2])) {
+        return false;
+    }
+    // no transparency
+    color[3] = 1.0F;
+    if (!scanner.atEnd() && !LineScanner::parseNumber(scanner.token(), color[3])) {
+        return false;
+    }
+
+    scaleColorOFF(color);
+    item.hasColor = true;
+    return true;
+}
+
+// Reads the optional color with a stream the way the former implementation did
+void readColorOFF(std::istream& str, const std::string& line, LineOFF& item)
+{
+    item.hasColor = false;
+    std::size_t pos = std::size_t(str.tellg());
+    if (line.size() > pos) {
+        auto& color = item.color;
+        str >> std::ws >> color[0] >> std::ws >> color[1] >> std::ws >> color[2];
+        if (str) {
+            str >> std::ws >> color[3];
+            // no transparency
+            if (!str) {
+                color[3] = 1.0F;
+            }
+
+            scaleColorOFF(color);
+            item.hasColor = true;
+        }
+    }
+}
+
+/** Parses a vertex line that consists of valid tokens only, returns false for any other line.
+ */
+bool parseVertexOFF(std::string_view line, bool colorPerVertex, LineOFF& item)
+{
+    LineScanner scanner(line);
+    if (scanner.atEnd()) {
+        item.type = LineOFF::Blank;
+        return true;
+    }
+
+    float fX {}, fY {}, fZ {};
+    if (!LineScanner::parseNumber(scanner.token(), fX)
+        || !LineScanner::parseNumber(scanner.token(), fY)
+        || !LineScanner::parseNumber(scanner.token(), fZ)) {
+        return false;
+    }
+
+    item.type = LineOFF::Vertex;
+    item.point.Set(fX, fY, fZ);
+    item.hasColor = false;
+    return !colorPerVertex || parseColorOFF(scanner, item);
+}
+
+void readVertexOFF(const std::string& line, bool colorPerVertex, LineOFF& item)
+{
+    std::istringstream str(line);
+    str.unsetf(std::ios_base::skipws);
+    str >> std::ws;
+    if (str.eof()) {
+        item.type = LineOFF::Blank;
+        return;
+    }
+
+    float fX {}, fY {}, fZ {};
+    str >> fX >> std::ws >> fY >> std::ws >> fZ;
+    item.type = str ? LineOFF::Vertex : LineOFF::Invalid;
+    item.hasColor = false;
+    if (str) {
+        item.point.Set(fX, fY, fZ);
+        if (colorPerVertex) {
+            readColorOFF(str, line, item);
+        }
+    }
+}
+
+/** Parses a face line that consists of valid tokens only, returns false for any other line.
+ */
+bool parseFaceOFF(std::string_view line, LineOFF& item)
+{
+    LineScanner scanner(line);
+    if (scanner.atEnd()) {
+        item.type = LineOFF::Blank;
+        return true;
+    }
+
+    int count {};
+    if (!LineScanner::parseNumber(scanner.token(), count)) {
+        return false;
+    }
+    if (count < 3) {
+        item.type = LineOFF::Invalid;
+        return true;
+    }
+
+    item.indexes.clear();
+    for (int i = 0; i < count; i++) {
+        int index {};
+        if (!LineScanner::parseNumber(scanner.token(), index)) {
+            return false;
+        }
+        item.indexes.push_back(index);
+    }
+
+    item.type = LineOFF::Face;
+    return parseColorOFF(scanner, item);
+}
+
+void readFaceOFF(const std::string& line, LineOFF& item)
+{
+    std::istringstream str(line);
+    str.unsetf(std::ios_base::skipws);
+    str >> std::ws;
+    if (str.eof()) {
+        item.type = LineOFF::Blank;
+        return;
+    }
+
+    int count {}, index {};
+    str >> count;
+    if (count < 3) {
+        item.type = LineOFF::Invalid;
+        return;
+    }
+
+    item.indexes.clear();
+    item.indexes.reserve(count);
+    for (int i = 0; i < count; i++) {
+        str >> std::ws;
+        str >> index;
+        item.indexes.push_back(index);
+    }
+
+    item.type = LineOFF::Face;
+    readColorOFF(str, line, item);
+}
+
+void parseLineOFF(std::string_view line, LineOFF::Type role, bool colorPerVertex, LineOFF& item)
+{
+    item.role = role;
+    if (role == LineOFF::Vertex) {
+        if (!parseVertexOFF(line, colorPerVertex, item)) {
+            readVertexOFF(std::string(line), colorPerVertex, item);
+        }
+    }
+    else {
+        if (!parseFaceOFF(line, item)) {
+            readFaceOFF(std::string(line), item);
+        }
+    }
+}
+
+/** Parses a line of the form "vertex x y z" of an ASCII STL file, the keyword is case
+ * insensitive.
+ */
+bool parseVertexSTL(std::string_view line, Base::Vector3f& point)
+{
+    LineScanner scanner(line);
+    scanner.skipSpace();
+    if (!scanner.keyword("VERTEX", true)) {
+        return false;
+    }
+
+    double x {}, y {}, z {};
+    if (!LineScanner::parseDecimal(scanner.token(), x)
+        || !LineScanner::parseDecimal(scanner.token(), y)
+        || !LineScanner::parseDecimal(scanner.token(), z) || !scanner.atEnd()) {
+        return false;
+    }
+
+    point.Set(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+    return true;
+}
+}  // namespace
+
 bool MeshInput::LoadOFF(std::istream& input)
 {
     // http://edutechwiki.unige.ch/en/3D_file_format
@@ -533,97 +765,58 @@ bool MeshInput::LoadOFF(std::istream& input)
         diffuseColor.reserve(numFaces);
     }
 
+    // The lines of a block are parsed concurrently as vertexes or faces, depending on how many
+    // vertexes are still expected. A line whose role was mispredicted because a preceding vertex
+    // line turned out to be invalid is parsed again while adding the lines in their order.
     int cntPoints = 0;
-    while (cntPoints < numPoints) {
-        if (!std::getline(input, line)) {
-            break;
-        }
-        std::istringstream str(line);
-        str.unsetf(std::ios_base::skipws);
-        str >> std::ws;
-        if (str.eof()) {
-            continue;  // empty line
+    int cntFaces = 0;
+    std::vector<LineOFF> items;
+    LineBlockReader reader(input);
+    while (cntFaces < numFaces && reader.next()) {
+        const std::vector<std::string_view>& lines = reader.lines();
+        items.resize(lines.size());
+        int remaining = numPoints - cntPoints;
+        for (std::size_t i = 0; i < lines.size(); i++) {
+            items[i].role = remaining > 0 ? LineOFF::Vertex : LineOFF::Face;
+            if (remaining > 0 && !LineScanner(lines[i]).atEnd()) {
+                remaining--;
+            }
         }
 
-        float fX {}, fY {}, fZ {};
-        str >> fX >> std::ws >> fY >> std::ws >> fZ;
-        if (str) {
-            meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
-            cntPoints++;
-
-            if (colorPerVertex) {
-                std::size_t pos = std::size_t(str.tellg());
-                if (line.size() > pos) {
-                    float r {}, g {}, b {}, a {};
-                    str >> std::ws >> r >> std::ws >> g >> std::ws >> b;
-                    if (str) {
-                        str >> std::ws >> a;
-                        // no transparency
-                        if (!str) {
-                            a = 1.0F;
-                        }
-
-                        if (r > 1.0F || g > 1.0F || b > 1.0F || a > 1.0F) {
-                            r = static_cast<float>(r) / 255.0F;
-                            g = static_cast<float>(g) / 255.0F;
-                            b = static_cast<float>(b) / 255.0F;
-                            a = static_cast<float>(a) / 255.0F;
-                        }
-                        diffuseColor.emplace_back(r, g, b, a);
-                    }
-                }
+        Base::parallel_for(lines.size(), minParallelLines, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                parseLineOFF(lines[i], items[i].role, colorPerVertex, items[i]);
             }
-        }
-    }
+        });
 
-    int cntFaces = 0;
-    while (cntFaces < numFaces) {
-        if (!std::getline(input, line)) {
-            break;
-        }
-        std::istringstream str(line);
-        str.unsetf(std::ios_base::skipws);
-        str >> std::ws;
-        if (str.eof()) {
-            continue;  // empty line
-        }
-        int count {}, index {};
-        str >> count;
-        if (count >= 3) {
-            std::vector<int> faces;
-            faces.reserve(count);
-
-            for (int i = 0; i < count; i++) {
-                str >> std::ws;
-                str >> index;
-                faces.push_back(index);
+        for (std::size_t i = 0; i < lines.size() && cntFaces < numFaces; i++) {
+            LineOFF::Type role = cntPoints < numPoints ? LineOFF::Vertex : LineOFF::Face;
+            LineOFF& entry = items[i];
+            if (entry.role != role) {
+                parseLineOFF(lines[i], role, colorPerVertex, entry);
             }
 
-            for (int i = 0; i < count - 2; i++) {
-                item.SetVertices(faces[0], faces[i + 1], faces[i + 2]);
-                meshFacets.push_back(item);
+            if (entry.type == LineOFF::Vertex) {
+                meshPoints.push_back(MeshPoint(entry.point));
+                cntPoints++;
+                if (entry.hasColor) {
+                    const auto& c = entry.color;
+                    diffuseColor.emplace_back(c[0], c[1], c[2], c[3]);
+                }
             }
-            cntFaces++;
-
-            std::size_t pos = std::size_t(str.tellg());
-            if (line.size() > pos) {
-                float r {}, g {}, b {}, a {};
-                str >> std::ws >> r >> std::ws >> g >> std::ws >> b;
-                if (str) {
-                    str >> std::ws >> a;
-                    // no transparency
-                    if (!str) {
-                        a = 1.0F;
-                    }
+            else if (entry.type == LineOFF::Face) {
+                const std::vector<int>& faces = entry.indexes;
+                int count = static_cast<int>(faces.size());
+                for (int j = 0; j < count - 2; j++) {
+                    item.SetVertices(faces[0], faces[j + 1], faces[j + 2]);
+                    meshFacets.push_back(item);
+                }
+                cntFaces++;
 
-                    if (r > 1.0F || g > 1.0F || b > 1.0F || a > 1.0F) {
-                        r = static_cast<float>(r) / 255.0F;
-                        g = static_cast<float>(g) / 255.0F;
-                        b = static_cast<float>(b) / 255.0F;
-                        a = static_cast<float>(a) / 255.0F;
-                    }
-                    for (int i = 0; i < count - 2; i++) {
-                        diffuseColor.emplace_back(r, g, b, a);
+                if (entry.hasColor) {
+                    const auto& c = entry.color;
+                    for (int j = 0; j < count - 2; j++) {
+                        diffuseColor.emplace_back(c[0], c[1], c[2], c[3]);
                     }
                 }
             }
@@ -651,8 +844,9 @@ bool MeshInput::LoadOFF(std::istream& input)
         meshCleanup.SetMaterial(_material);
     }
     meshCleanup.RemoveInvalids();
-    MeshPointFacetAdjacency meshAdj(meshPoints.size(), meshFacets);
-    meshAdj.SetFacetNeighbourhood();
+    MeshTopologyBuilder topology(meshFacets);
+    topology.SetNonManifoldNeighbours(MeshTopologyBuilder::NonManifoldToFirst);
+    topology.SetNeighbourhood();
     this->_rclMesh.Adopt(meshPoints, meshFacets);
 
     return true;
@@ -713,8 +907,9 @@ bool MeshInput::LoadMeshNode(std::istream& input)
 
     MeshCleanup meshCleanup(meshPoints, meshFacets);
     meshCleanup.RemoveInvalids();
-    MeshPointFacetAdjacency meshAdj(meshPoints.size(), meshFacets);
-    meshAdj.SetFacetNeighbourhood();
+    MeshTopologyBuilder topology(meshFacets);
+    topology.SetNonManifoldNeighbours(MeshTopologyBuilder::NonManifoldToFirst);
+    topology.SetNeighbourhood();
     this->_rclMesh.Adopt(meshPoints, meshFacets);
 
     return true;
@@ -723,71 +918,43 @@ bool MeshInput::LoadMeshNode(std::istream& input)
 /** Loads an ASCII STL file. */
 bool MeshInput::LoadAsciiSTL(std::istream& input)
 {
-    boost::regex rx_p("^\\s*VERTEX\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    boost::regex rx_f("^\\s*FACET\\s+NORMAL\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    boost::cmatch what;
-
-    std::string line;
-    float fX {}, fY {}, fZ {};
-    unsigned long ulVertexCt {}, ulFacetCt {};
-    MeshGeomFacet clFacet;
-
     if (!input || input.bad()) {
         return false;
     }
 
-    std::streamoff ulSize = 0;
     std::streambuf* buf = input.rdbuf();
-    ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
     buf->pubseekoff(0, std::ios::beg, std::ios::in);
-    ulSize -= 20;
-
-    // count facets
-    while (std::getline(input, line)) {
-        boost::algorithm::to_upper(line);
-        if (line.find("ENDFACET") != std::string::npos) {
-            ulFacetCt++;
-        }
-        // prevent from reading EOF (as I don't know how to reread the file then)
-        if (input.tellg() > ulSize) {
-            break;
-        }
-        if (line.find("ENDSOLID") != std::string::npos) {
-            break;
-        }
-    }
 
-    // restart from the beginning
-    buf->pubseekoff(0, std::ios::beg, std::ios::in);
+    struct Vertex
+    {
+        Base::Vector3f point;
+        bool valid {false};
+    };
 
-#if 0
-    MeshBuilder builder(this->_rclMesh);
-#else
     MeshFastBuilder builder(this->_rclMesh);
-#endif
-    builder.Initialize(ulFacetCt);
+    MeshGeomFacet clFacet;
+    unsigned long ulVertexCt {};
+    std::vector<Vertex> vertexes;
+
+    // The lines of a block are parsed concurrently and the vertexes are added in their order
+    // afterwards. The facet normals are not needed as the builder doesn't use them.
+    LineBlockReader reader(input);
+    while (reader.next()) {
+        const std::vector<std::string_view>& lines = reader.lines();
+        vertexes.resize(lines.size());
+        Base::parallel_for(lines.size(), minParallelLines, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                vertexes[i].valid = parseVertexSTL(lines[i], vertexes[i].point);
+            }
+        });
 
-    ulVertexCt = 0;
-    while (std::getline(input, line)) {
-        boost::algorithm::to_upper(line);
-        if (boost::regex_match(line.c_str(), what, rx_f)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            clFacet.SetNormal(Base::Vector3f(fX, fY, fZ));
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_p)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            clFacet._aclPoints[ulVertexCt++].Set(fX, fY, fZ);
-            if (ulVertexCt == 3) {
-                ulVertexCt = 0;
-                builder.AddFacet(clFacet);
+        for (std::size_t i = 0; i < lines.size(); i++) {
+            if (vertexes[i].valid) {
+                clFacet._aclPoints[ulVertexCt++] = vertexes[i].point;
+                if (ulVertexCt == 3) {
+                    ulVertexCt = 0;
+                    builder.AddFacet(clFacet);
+                }
             }
         }
     }
@@ -956,8 +1123,9 @@ bool MeshInput::LoadInventor(std::istream& input)
 
     MeshCleanup meshCleanup(meshPoints, meshFacets);
     meshCleanup.RemoveInvalids();
-    MeshPointFacetAdjacency meshAdj(meshPoints.size(), meshFacets);
-    meshAdj.SetFacetNeighbourhood();
+    MeshTopologyBuilder topology(meshFacets);
+    topology.SetNonManifoldNeighbours(MeshTopologyBuilder::NonManifoldToFirst);
+    topology.SetNeighbourhood();
     this->_rclMesh.Adopt(meshPoints, meshFacets);
 
     if (loader.isNonIndexed()) {
@@ -2909,63 +3077,3 @@ void MeshCleanup::RemoveInvalidPoints()
         pointArray.swap(copy_points);
     }
 }
-
-// ----------------------------------------------------------------------------
-
-MeshPointFacetAdjacency::MeshPointFacetAdjacency(std::size_t p, MeshFacetArray& f)
-    : numPoints(p)
-    , facets(f)
-{
-    Build();
-}
-
-void MeshPointFacetAdjacency::Build()
-{
-    std::vector<std::size_t> numFacetAdjacency(numPoints);
-    for (const auto& it : facets) {
-        numFacetAdjacency[it._aulPoints[0]]++;
-        numFacetAdjacency[it._aulPoints[1]]++;
-        numFacetAdjacency[it._aulPoints[2]]++;
-    }
-
-    pointFacetAdjacency.resize(numPoints);
-    for (std::size_t i = 0; i < numPoints; i++) {
-        pointFacetAdjacency[i].reserve(numFacetAdjacency[i]);
-    }
-
-    std::size_t numFacets = facets.size();
-    for (std::size_t i = 0; i < numFacets; i++) {
-        for (PointIndex ptIndex : facets[i]._aulPoints) {
-            pointFacetAdjacency[ptIndex].push_back(i);
-        }
-    }
-}
-
-void MeshPointFacetAdjacency::SetFacetNeighbourhood()
-{
-    std::size_t numFacets = facets.size();
-    for (std::size_t index = 0; index < numFacets; index++) {
-        MeshFacet& facet1 = facets[index];
-        for (int i = 0; i < 3; i++) {
-            std::size_t n1 = facet1._aulPoints[i];
-            std::size_t n2 = facet1._aulPoints[(i + 1) % 3];
-
-            bool success = false;
-            const std::vector<std::size_t>& refFacets = pointFacetAdjacency[n1];
-            for (std::size_t it : refFacets) {
-                if (it != index) {
-                    MeshFacet& facet2 = facets[it];
-                    if (facet2.HasPoint(n2)) {
-                        facet1._aulNeighbours[i] = it;
-                        success = true;
-                        break;
-                    }
-                }
-            }
-
-            if (!success) {
-                facet1._aulNeighbours[i] = FACET_INDEX_MAX;
-            }
-        }
-    }
-}
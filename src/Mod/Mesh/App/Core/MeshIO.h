@@ -311,39 +311,6 @@ private:
     Material* materialArray {nullptr};
 };
 
-/*!
-   The MeshPointFacetAdjacency class is a helper class to get all facets per vertex
-   and set the neighbourhood of the facets.
-   At this point the MeshFacetArray only references the points but does not have set
-   the neighbourhood of two adjacent facets.
- */
-class MeshPointFacetAdjacency
-{
-public:
-    /*!
-      \brief Construction.
-      \param p -- the number of points
-      \param f -- the facet array
-     */
-    MeshPointFacetAdjacency(std::size_t p, MeshFacetArray& f);
-
-    /*!
-      \brief Set the neighbourhood of two adjacent facets.
-     */
-    void SetFacetNeighbourhood();
-
-private:
-    /*!
-      \brief Build up the adjacency information.
-     */
-    void Build();
-
-private:
-    std::size_t numPoints;
-    MeshFacetArray& facets;
-    std::vector<std::vector<std::size_t>> pointFacetAdjacency;
-};
-
 
 }  // namespace MeshCore
 
@@ -34,8 +34,10 @@
 #include <Base/Stream.h>
 #include <Base/Swap.h>
 
+#include "Adjacency.h"
 #include "Algorithm.h"
 #include "Builder.h"
+#include "ChunkedFormat.h"
 #include "Evaluation.h"
 #include "Iterator.h"
 #include "MeshIO.h"
@@ -63,10 +65,20 @@ MeshKernel::MeshKernel(MeshKernel&& rclMesh)
 MeshKernel& MeshKernel::operator=(const MeshKernel& rclMesh)
 {
     if (this != &rclMesh) {  // must be a different instance
-        this->_aclPointArray = rclMesh._aclPointArray;
-        this->_aclFacetArray = rclMesh._aclFacetArray;
+        // share the arrays until this kernel accesses them
+        {
+            std::lock_guard<std::mutex> lock(rclMesh._arrayMutex);
+            this->_aclPointArray = rclMesh._aclPointArray;
+            this->_aclFacetArray = rclMesh._aclFacetArray;
+        }
+        this->_detachPoints = true;
+        this->_detachFacets = true;
         this->_clBoundBox = rclMesh._clBoundBox;
         this->_bValid = rclMesh._bValid;
+        std::lock_guard<std::mutex> lock(rclMesh._adjacencyMutex);
+        this->_pointFacets = rclMesh._pointFacets;
+        this->_pointPoints = rclMesh._pointPoints;
+        this->_facetFacets = rclMesh._facetFacets;
     }
     return *this;
 }
@@ -76,8 +88,15 @@ MeshKernel& MeshKernel::operator=(MeshKernel&& rclMesh)
     if (this != &rclMesh) {  // must be a different instance
         this->_aclPointArray = std::move(rclMesh._aclPointArray);
         this->_aclFacetArray = std::move(rclMesh._aclFacetArray);
+        rclMesh._aclPointArray = std::make_shared<MeshPointArray>();
+        rclMesh._aclFacetArray = std::make_shared<MeshFacetArray>();
+        this->_detachPoints = rclMesh._detachPoints.exchange(false);
+        this->_detachFacets = rclMesh._detachFacets.exchange(false);
         this->_clBoundBox = rclMesh._clBoundBox;
         this->_bValid = rclMesh._bValid;
+        this->_pointFacets = std::move(rclMesh._pointFacets);
+        this->_pointPoints = std::move(rclMesh._pointPoints);
+        this->_facetFacets = std::move(rclMesh._facetFacets);
     }
     return *this;
 }
@@ -100,8 +119,11 @@ void MeshKernel::Assign(const MeshPointArray& rPoints,
                         const MeshFacetArray& rFacets,
                         bool checkNeighbourHood)
 {
-    _aclPointArray = rPoints;
-    _aclFacetArray = rFacets;
+    InvalidateAdjacency();
+    _aclPointArray = std::make_shared<MeshPointArray>(rPoints);
+    _aclFacetArray = std::make_shared<MeshFacetArray>(rFacets);
+    _detachPoints = false;
+    _detachFacets = false;
     RecalcBoundBox();
     if (checkNeighbourHood) {
         RebuildNeighbours();
@@ -110,8 +132,9 @@ void MeshKernel::Assign(const MeshPointArray& rPoints,
 
 void MeshKernel::Adopt(MeshPointArray& rPoints, MeshFacetArray& rFacets, bool checkNeighbourHood)
 {
-    _aclPointArray.swap(rPoints);
-    _aclFacetArray.swap(rFacets);
+    InvalidateAdjacency();
+    PointArray().swap(rPoints);
+    FacetArray().swap(rFacets);
     RecalcBoundBox();
     if (checkNeighbourHood) {
         RebuildNeighbours();
@@ -122,7 +145,12 @@ void MeshKernel::Swap(MeshKernel& mesh)
 {
     this->_aclPointArray.swap(mesh._aclPointArray);
     this->_aclFacetArray.swap(mesh._aclFacetArray);
+    this->_detachPoints = mesh._detachPoints.exchange(this->_detachPoints);
+    this->_detachFacets = mesh._detachFacets.exchange(this->_detachFacets);
     this->_clBoundBox = mesh._clBoundBox;
+    this->_pointFacets.swap(mesh._pointFacets);
+    this->_pointPoints.swap(mesh._pointPoints);
+    this->_facetFacets.swap(mesh._facetFacets);
 }
 
 MeshKernel& MeshKernel::operator+=(const MeshGeomFacet& rclSFacet)
@@ -133,25 +161,26 @@ MeshKernel& MeshKernel::operator+=(const MeshGeomFacet& rclSFacet)
 
 void MeshKernel::AddFacet(const MeshGeomFacet& rclSFacet)
 {
+    InvalidateAdjacency();
     MeshFacet clFacet;
 
     // set corner points
     for (int i = 0; i < 3; i++) {
         _clBoundBox.Add(rclSFacet._aclPoints[i]);
-        clFacet._aulPoints[i] = _aclPointArray.GetOrAddIndex(rclSFacet._aclPoints[i]);
+        clFacet._aulPoints[i] = PointArray().GetOrAddIndex(rclSFacet._aclPoints[i]);
     }
 
     // adjust orientation to normal
     AdjustNormal(clFacet, rclSFacet.GetNormal());
 
-    FacetIndex ulCt = _aclFacetArray.size();
+    FacetIndex ulCt = FacetArray().size();
 
     // set neighbourhood
     PointIndex ulP0 = clFacet._aulPoints[0];
     PointIndex ulP1 = clFacet._aulPoints[1];
     PointIndex ulP2 = clFacet._aulPoints[2];
     FacetIndex ulCC = 0;
-    for (auto pF = _aclFacetArray.begin(); pF != _aclFacetArray.end(); ++pF, ulCC++) {
+    for (auto pF = FacetArray().begin(); pF != FacetArray().end(); ++pF, ulCC++) {
         for (int i = 0; i < 3; i++) {
             PointIndex ulP = pF->_aulPoints[i];
             PointIndex ulQ = pF->_aulPoints[(i + 1) % 3];
@@ -171,7 +200,7 @@ void MeshKernel::AddFacet(const MeshGeomFacet& rclSFacet)
     }
 
     // insert facet into array
-    _aclFacetArray.push_back(clFacet);
+    FacetArray().push_back(clFacet);
 }
 
 MeshKernel& MeshKernel::operator+=(const std::vector<MeshGeomFacet>& rclFAry)
@@ -192,6 +221,7 @@ void MeshKernel::AddFacets(const std::vector<MeshGeomFacet>& rclFAry)
 
 unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool checkManifolds)
 {
+    InvalidateAdjacency();
     // Build map of edges of the referencing facets we want to append
 #ifdef FC_DEBUG
     unsigned long countPoints = CountPoints();
@@ -201,18 +231,18 @@ unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool
     if (!checkManifolds) {
         FacetIndex countFacets = CountFacets();
         FacetIndex countValid = rclFAry.size();
-        _aclFacetArray.reserve(countFacets + countValid);
+        FacetArray().reserve(countFacets + countValid);
 
         // just add all faces now
         for (const auto& pF : rclFAry) {
-            _aclFacetArray.push_back(pF);
+            FacetArray().push_back(pF);
         }
 
         RebuildNeighbours(countFacets);
-        return _aclFacetArray.size();
+        return FacetArray().size();
     }
 
-    this->_aclPointArray.ResetInvalid();
+    this->PointArray().ResetInvalid();
     FacetIndex k = CountFacets();
     std::map<std::pair<PointIndex, PointIndex>, std::list<FacetIndex>> edgeMap;
     for (auto pF = rclFAry.begin(); pF != rclFAry.end(); ++pF, k++) {
@@ -222,7 +252,7 @@ unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool
 #ifdef FC_DEBUG
             assert(pF->_aulPoints[i] < countPoints);
 #endif
-            this->_aclPointArray[pF->_aulPoints[i]].SetFlag(MeshPoint::INVALID);
+            this->PointArray()[pF->_aulPoints[i]].SetFlag(MeshPoint::INVALID);
             PointIndex ulT0 = pF->_aulPoints[i];
             PointIndex ulT1 = pF->_aulPoints[(i + 1) % 3];
             PointIndex ulP0 = std::min<PointIndex>(ulT0, ulT1);
@@ -233,11 +263,11 @@ unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool
 
     // Check for the above edges in the current facet array
     k = 0;
-    for (auto pF = _aclFacetArray.begin(); pF != _aclFacetArray.end(); ++pF, k++) {
+    for (auto pF = FacetArray().begin(); pF != FacetArray().end(); ++pF, k++) {
         // if none of the points references one of the edges ignore the facet
-        if (!this->_aclPointArray[pF->_aulPoints[0]].IsFlag(MeshPoint::INVALID)
-            && !this->_aclPointArray[pF->_aulPoints[1]].IsFlag(MeshPoint::INVALID)
-            && !this->_aclPointArray[pF->_aulPoints[2]].IsFlag(MeshPoint::INVALID)) {
+        if (!this->PointArray()[pF->_aulPoints[0]].IsFlag(MeshPoint::INVALID)
+            && !this->PointArray()[pF->_aulPoints[1]].IsFlag(MeshPoint::INVALID)
+            && !this->PointArray()[pF->_aulPoints[2]].IsFlag(MeshPoint::INVALID)) {
             continue;
         }
         for (int i = 0; i < 3; i++) {
@@ -254,7 +284,7 @@ unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool
         }
     }
 
-    this->_aclPointArray.ResetInvalid();
+    this->PointArray().ResetInvalid();
 
     // Now let's see for which edges we might get manifolds, if so we don't add the corresponding
     // candidates
@@ -279,13 +309,13 @@ unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool
         std::count_if(rclFAry.begin(), rclFAry.end(), [flag](const MeshFacet& f) {
             return flag(f, MeshFacet::INVALID);
         });
-    _aclFacetArray.reserve(_aclFacetArray.size() + countValid);
+    FacetArray().reserve(FacetArray().size() + countValid);
     // now start inserting the facets to the data structure and set the correct neighbourhood as
     // well
     FacetIndex startIndex = CountFacets();
     for (const auto& pF : rclFAry) {
         if (!pF.IsFlag(MeshFacet::INVALID)) {
-            _aclFacetArray.push_back(pF);
+            FacetArray().push_back(pF);
             pF.SetProperty(startIndex++);
         }
     }
@@ -309,9 +339,9 @@ unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool
             }
 
             if (ulF0 != FACET_INDEX_MAX) {
-                unsigned short usSide = _aclFacetArray[ulF0].Side(ulP0, ulP1);
+                unsigned short usSide = FacetArray()[ulF0].Side(ulP0, ulP1);
                 assert(usSide != USHRT_MAX);
-                _aclFacetArray[ulF0]._aulNeighbours[usSide] = FACET_INDEX_MAX;
+                FacetArray()[ulF0]._aulNeighbours[usSide] = FACET_INDEX_MAX;
             }
         }
         else if (pE->second.size() == 2)  // normal facet with neighbour
@@ -341,20 +371,20 @@ unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool
             }
 
             if (ulF0 != FACET_INDEX_MAX) {
-                unsigned short usSide = _aclFacetArray[ulF0].Side(ulP0, ulP1);
+                unsigned short usSide = FacetArray()[ulF0].Side(ulP0, ulP1);
                 assert(usSide != USHRT_MAX);
-                _aclFacetArray[ulF0]._aulNeighbours[usSide] = ulF1;
+                FacetArray()[ulF0]._aulNeighbours[usSide] = ulF1;
             }
 
             if (ulF1 != FACET_INDEX_MAX) {
-                unsigned short usSide = _aclFacetArray[ulF1].Side(ulP0, ulP1);
+                unsigned short usSide = FacetArray()[ulF1].Side(ulP0, ulP1);
                 assert(usSide != USHRT_MAX);
-                _aclFacetArray[ulF1]._aulNeighbours[usSide] = ulF0;
+                FacetArray()[ulF1]._aulNeighbours[usSide] = ulF0;
             }
         }
     }
 
-    return _aclFacetArray.size();
+    return FacetArray().size();
 }
 
 unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry,
@@ -364,29 +394,30 @@ unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry,
     for (auto it : rclPAry) {
         _clBoundBox.Add(it);
     }
-    this->_aclPointArray.insert(this->_aclPointArray.end(), rclPAry.begin(), rclPAry.end());
+    this->PointArray().insert(this->PointArray().end(), rclPAry.begin(), rclPAry.end());
     return this->AddFacets(rclFAry, checkManifolds);
 }
 
 void MeshKernel::Merge(const MeshKernel& rKernel)
 {
     if (this != &rKernel) {
-        const MeshPointArray& rPoints = rKernel._aclPointArray;
-        const MeshFacetArray& rFacets = rKernel._aclFacetArray;
+        const MeshPointArray& rPoints = rKernel.PointArray();
+        const MeshFacetArray& rFacets = rKernel.FacetArray();
         Merge(rPoints, rFacets);
     }
 }
 
 void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFaces)
 {
+    InvalidateAdjacency();
     if (rPoints.empty() || rFaces.empty()) {
         return;  // nothing to do
     }
     std::vector<PointIndex> increments(rPoints.size());
 
-    FacetIndex countFacets = this->_aclFacetArray.size();
+    FacetIndex countFacets = this->FacetArray().size();
     // Reserve the additional memory to append the new facets
-    this->_aclFacetArray.reserve(this->_aclFacetArray.size() + rFaces.size());
+    this->FacetArray().reserve(this->FacetArray().size() + rFaces.size());
 
     // Copy the new faces immediately to the facet array
     MeshFacet face;
@@ -397,7 +428,7 @@ void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFac
         }
 
         // append to the facet array
-        this->_aclFacetArray.push_back(face);
+        this->FacetArray().push_back(face);
     }
 
     std::size_t countNewPoints =
@@ -405,8 +436,8 @@ void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFac
             return v > 0;
         });
     // Reserve the additional memory to append the new points
-    PointIndex index = this->_aclPointArray.size();
-    this->_aclPointArray.reserve(this->_aclPointArray.size() + countNewPoints);
+    PointIndex index = this->PointArray().size();
+    this->PointArray().reserve(this->PointArray().size() + countNewPoints);
 
     // Now we can start inserting the points and adjust the point indices of the faces
     for (auto it = increments.begin(); it != increments.end(); ++it) {
@@ -414,12 +445,12 @@ void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFac
             // set the index of the point array
             *it = index++;
             const MeshPoint& rPt = rPoints[it - increments.begin()];
-            this->_aclPointArray.push_back(rPt);
+            this->PointArray().push_back(rPt);
             _clBoundBox.Add(rPt);
         }
     }
 
-    for (auto pF = this->_aclFacetArray.begin() + countFacets; pF != this->_aclFacetArray.end();
+    for (auto pF = this->FacetArray().begin() + countFacets; pF != this->FacetArray().end();
          ++pF) {
         for (PointIndex& index : pF->_aulPoints) {
             index = increments[index];
@@ -435,38 +466,82 @@ void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFac
 
 void MeshKernel::Cleanup()
 {
-    MeshCleanup meshCleanup(_aclPointArray, _aclFacetArray);
+    InvalidateAdjacency();
+    MeshCleanup meshCleanup(PointArray(), FacetArray());
     meshCleanup.RemoveInvalids();
 }
 
 void MeshKernel::Clear()
 {
-    _aclPointArray.clear();
-    _aclFacetArray.clear();
+    InvalidateAdjacency();
 
-    // release memory
-    MeshPointArray().swap(_aclPointArray);
-    MeshFacetArray().swap(_aclFacetArray);
+    // release memory, or the reference to the shared arrays
+    _aclPointArray = std::make_shared<MeshPointArray>();
+    _aclFacetArray = std::make_shared<MeshFacetArray>();
+    _detachPoints = false;
+    _detachFacets = false;
 
     _clBoundBox.SetVoid();
 }
 
+void MeshKernel::Detach()
+{
+    PointArray();
+    FacetArray();
+}
+
+void MeshKernel::DetachPoints() const
+{
+    // Several threads may access a copy for the first time, the first one detaches the array.
+    // If no other kernel uses the array anymore it's taken over, the fence makes the writes of
+    // the kernel that released it visible.
+    std::lock_guard<std::mutex> lock(_arrayMutex);
+    if (_aclPointArray.use_count() > 1) {
+        _aclPointArray = std::make_shared<MeshPointArray>(*_aclPointArray);
+    }
+    else {
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    _detachPoints.store(false, std::memory_order_release);
+}
+
+void MeshKernel::DetachFacets() const
+{
+    // see DetachPoints()
+    std::lock_guard<std::mutex> lock(_arrayMutex);
+    if (_aclFacetArray.use_count() > 1) {
+        _aclFacetArray = std::make_shared<MeshFacetArray>(*_aclFacetArray);
+    }
+    else {
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    _detachFacets.store(false, std::memory_order_release);
+}
+
+unsigned int MeshKernel::GetMemSize() const
+{
+    std::lock_guard<std::mutex> lock(_arrayMutex);
+    return static_cast<unsigned int>(_aclPointArray->size() * sizeof(MeshPoint)
+                                     + _aclFacetArray->size() * sizeof(MeshFacet));
+}
+
 bool MeshKernel::DeleteFacet(const MeshFacetIterator& rclIter)
 {
+    InvalidateAdjacency();
     FacetIndex ulNFacet {}, ulInd {};
 
-    if (rclIter._clIter >= _aclFacetArray.end()) {
+    if (rclIter._clIter >= FacetArray().end()) {
         return false;
     }
 
     // index of the facet to delete
-    ulInd = rclIter._clIter - _aclFacetArray.begin();
+    ulInd = rclIter._clIter - FacetArray().begin();
 
     // invalidate neighbour indices of the neighbour facet to this facet
     for (FacetIndex nbIndex : rclIter._clIter->_aulNeighbours) {
         ulNFacet = nbIndex;
         if (ulNFacet != FACET_INDEX_MAX) {
-            for (FacetIndex& nbOfNb : _aclFacetArray[ulNFacet]._aulNeighbours) {
+            for (FacetIndex& nbOfNb : FacetArray()[ulNFacet]._aulNeighbours) {
                 if (nbOfNb == ulInd) {
                     nbOfNb = FACET_INDEX_MAX;
                     break;
@@ -485,14 +560,14 @@ bool MeshKernel::DeleteFacet(const MeshFacetIterator& rclIter)
     }
 
     // remove facet from array
-    _aclFacetArray.Erase(_aclFacetArray.begin() + rclIter.Position());
+    FacetArray().Erase(FacetArray().begin() + rclIter.Position());
 
     return true;
 }
 
 bool MeshKernel::DeleteFacet(FacetIndex ulInd)
 {
-    if (ulInd >= _aclFacetArray.size()) {
+    if (ulInd >= FacetArray().size()) {
         return false;
     }
 
@@ -504,28 +579,28 @@ bool MeshKernel::DeleteFacet(FacetIndex ulInd)
 
 void MeshKernel::DeleteFacets(const std::vector<FacetIndex>& raulFacets)
 {
-    _aclPointArray.SetProperty(0);
+    PointArray().SetProperty(0);
 
     // number of referencing facets per point
-    for (const auto& pF : _aclFacetArray) {
-        _aclPointArray[pF._aulPoints[0]]._ulProp++;
-        _aclPointArray[pF._aulPoints[1]]._ulProp++;
-        _aclPointArray[pF._aulPoints[2]]._ulProp++;
+    for (const auto& pF : FacetArray()) {
+        PointArray()[pF._aulPoints[0]]._ulProp++;
+        PointArray()[pF._aulPoints[1]]._ulProp++;
+        PointArray()[pF._aulPoints[2]]._ulProp++;
     }
 
     // invalidate facet and adjust number of point references
-    _aclFacetArray.ResetInvalid();
+    FacetArray().ResetInvalid();
     for (FacetIndex index : raulFacets) {
-        MeshFacet& rclFacet = _aclFacetArray[index];
+        MeshFacet& rclFacet = FacetArray()[index];
         rclFacet.SetInvalid();
-        _aclPointArray[rclFacet._aulPoints[0]]._ulProp--;
-        _aclPointArray[rclFacet._aulPoints[1]]._ulProp--;
-        _aclPointArray[rclFacet._aulPoints[2]]._ulProp--;
+        PointArray()[rclFacet._aulPoints[0]]._ulProp--;
+        PointArray()[rclFacet._aulPoints[1]]._ulProp--;
+        PointArray()[rclFacet._aulPoints[2]]._ulProp--;
     }
 
     // invalidate all unreferenced points
-    _aclPointArray.ResetInvalid();
-    for (auto& pP : _aclPointArray) {
+    PointArray().ResetInvalid();
+    for (auto& pP : PointArray()) {
         if (pP._ulProp == 0) {
             pP.SetInvalid();
         }
@@ -537,7 +612,7 @@ void MeshKernel::DeleteFacets(const std::vector<FacetIndex>& raulFacets)
 
 bool MeshKernel::DeletePoint(PointIndex ulInd)
 {
-    if (ulInd >= _aclPointArray.size()) {
+    if (ulInd >= PointArray().size()) {
         return false;
     }
 
@@ -549,12 +624,13 @@ bool MeshKernel::DeletePoint(PointIndex ulInd)
 
 bool MeshKernel::DeletePoint(const MeshPointIterator& rclIter)
 {
+    InvalidateAdjacency();
     MeshFacetIterator pFIter(*this), pFEnd(*this);
     std::vector<MeshFacetIterator> clToDel;
     PointIndex ulInd {};
 
     // index of the point to delete
-    ulInd = rclIter._clIter - _aclPointArray.begin();
+    ulInd = rclIter._clIter - PointArray().begin();
 
     pFIter.Begin();
     pFEnd.End();
@@ -582,17 +658,17 @@ bool MeshKernel::DeletePoint(const MeshPointIterator& rclIter)
 
 void MeshKernel::DeletePoints(const std::vector<PointIndex>& raulPoints)
 {
-    _aclPointArray.ResetInvalid();
+    PointArray().ResetInvalid();
     for (PointIndex ptIndex : raulPoints) {
-        _aclPointArray[ptIndex].SetInvalid();
+        PointArray()[ptIndex].SetInvalid();
     }
 
     // delete facets if at least one corner point is invalid
-    _aclPointArray.SetProperty(0);
-    for (auto& pF : _aclFacetArray) {
-        MeshPoint& rclP0 = _aclPointArray[pF._aulPoints[0]];
-        MeshPoint& rclP1 = _aclPointArray[pF._aulPoints[1]];
-        MeshPoint& rclP2 = _aclPointArray[pF._aulPoints[2]];
+    PointArray().SetProperty(0);
+    for (auto& pF : FacetArray()) {
+        MeshPoint& rclP0 = PointArray()[pF._aulPoints[0]];
+        MeshPoint& rclP1 = PointArray()[pF._aulPoints[1]];
+        MeshPoint& rclP2 = PointArray()[pF._aulPoints[2]];
 
         if (!rclP0.IsValid() || !rclP1.IsValid() || !rclP2.IsValid()) {
             pF.SetInvalid();
@@ -606,7 +682,7 @@ void MeshKernel::DeletePoints(const std::vector<PointIndex>& raulPoints)
     }
 
     // invalidate all unreferenced points to delete them
-    for (auto& pP : _aclPointArray) {
+    for (auto& pP : PointArray()) {
         if (pP._ulProp == 0) {
             pP.SetInvalid();
         }
@@ -618,11 +694,12 @@ void MeshKernel::DeletePoints(const std::vector<PointIndex>& raulPoints)
 
 void MeshKernel::ErasePoint(PointIndex ulIndex, FacetIndex ulFacetIndex, bool bOnlySetInvalid)
 {
+    InvalidateAdjacency();
     std::vector<MeshFacet>::iterator pFIter, pFEnd, pFNot;
 
-    pFIter = _aclFacetArray.begin();
-    pFNot = _aclFacetArray.begin() + ulFacetIndex;
-    pFEnd = _aclFacetArray.end();
+    pFIter = FacetArray().begin();
+    pFNot = FacetArray().begin() + ulFacetIndex;
+    pFEnd = FacetArray().end();
 
     // check all facets
     while (pFIter < pFNot) {
@@ -647,10 +724,10 @@ void MeshKernel::ErasePoint(PointIndex ulIndex, FacetIndex ulFacetIndex, bool bO
 
     if (!bOnlySetInvalid) {
         // completely remove point
-        _aclPointArray.erase(_aclPointArray.begin() + ulIndex);
+        PointArray().erase(PointArray().begin() + ulIndex);
 
         // correct point indices of the facets
-        pFIter = _aclFacetArray.begin();
+        pFIter = FacetArray().begin();
         while (pFIter < pFEnd) {
             for (PointIndex& ptIndex : pFIter->_aulPoints) {
                 if (ptIndex > ulIndex) {
@@ -661,12 +738,13 @@ void MeshKernel::ErasePoint(PointIndex ulIndex, FacetIndex ulFacetIndex, bool bO
         }
     }
     else {  // only invalidate
-        _aclPointArray[ulIndex].SetInvalid();
+        PointArray()[ulIndex].SetInvalid();
     }
 }
 
 void MeshKernel::RemoveInvalids()
 {
+    InvalidateAdjacency();
     std::vector<unsigned long> aulDecrements;
     std::vector<unsigned long>::iterator pDIter;
     unsigned long ulDec {};
@@ -674,11 +752,11 @@ void MeshKernel::RemoveInvalids()
     MeshFacetArray::_TIterator pFIter, pFEnd;
 
     // generate array of decrements
-    aulDecrements.resize(_aclPointArray.size());
+    aulDecrements.resize(PointArray().size());
     pDIter = aulDecrements.begin();
     ulDec = 0;
-    pPEnd = _aclPointArray.end();
-    for (pPIter = _aclPointArray.begin(); pPIter != pPEnd; ++pPIter) {
+    pPEnd = PointArray().end();
+    for (pPIter = PointArray().begin(); pPIter != pPEnd; ++pPIter) {
         *pDIter++ = ulDec;
         if (!pPIter->IsValid()) {
             ulDec++;
@@ -686,8 +764,8 @@ void MeshKernel::RemoveInvalids()
     }
 
     // correct point indices of the facets
-    pFEnd = _aclFacetArray.end();
-    for (pFIter = _aclFacetArray.begin(); pFIter != pFEnd; ++pFIter) {
+    pFEnd = FacetArray().end();
+    for (pFIter = FacetArray().begin(); pFIter != pFEnd; ++pFIter) {
         if (pFIter->IsValid()) {
             pFIter->_aulPoints[0] -= aulDecrements[pFIter->_aulPoints[0]];
             pFIter->_aulPoints[1] -= aulDecrements[pFIter->_aulPoints[1]];
@@ -697,31 +775,31 @@ void MeshKernel::RemoveInvalids()
 
     // delete point, number of valid points
     unsigned long ulNewPts =
-        std::count_if(_aclPointArray.begin(), _aclPointArray.end(), [](const MeshPoint& p) {
+        std::count_if(PointArray().begin(), PointArray().end(), [](const MeshPoint& p) {
             return p.IsValid();
         });
     // tmp. point array
     MeshPointArray aclTempPt(ulNewPts);
     MeshPointArray::_TIterator pPTemp = aclTempPt.begin();
-    pPEnd = _aclPointArray.end();
-    for (pPIter = _aclPointArray.begin(); pPIter != pPEnd; ++pPIter) {
+    pPEnd = PointArray().end();
+    for (pPIter = PointArray().begin(); pPIter != pPEnd; ++pPIter) {
         if (pPIter->IsValid()) {
             *pPTemp++ = *pPIter;
         }
     }
 
     // free memory
-    //_aclPointArray = aclTempPt;
+    //PointArray() = aclTempPt;
     // aclTempPt.clear();
-    _aclPointArray.swap(aclTempPt);
+    PointArray().swap(aclTempPt);
     MeshPointArray().swap(aclTempPt);
 
     // generate array of facet decrements
-    aulDecrements.resize(_aclFacetArray.size());
+    aulDecrements.resize(FacetArray().size());
     pDIter = aulDecrements.begin();
     ulDec = 0;
-    pFEnd = _aclFacetArray.end();
-    for (pFIter = _aclFacetArray.begin(); pFIter != pFEnd; ++pFIter, ++pDIter) {
+    pFEnd = FacetArray().end();
+    for (pFIter = FacetArray().begin(); pFIter != pFEnd; ++pFIter, ++pDIter) {
         *pDIter = ulDec;
         if (!pFIter->IsValid()) {
             ulDec++;
@@ -729,13 +807,13 @@ void MeshKernel::RemoveInvalids()
     }
 
     // correct neighbour indices of the facets
-    pFEnd = _aclFacetArray.end();
-    for (pFIter = _aclFacetArray.begin(); pFIter != pFEnd; ++pFIter) {
+    pFEnd = FacetArray().end();
+    for (pFIter = FacetArray().begin(); pFIter != pFEnd; ++pFIter) {
         if (pFIter->IsValid()) {
             for (FacetIndex& nbIndex : pFIter->_aulNeighbours) {
                 FacetIndex k = nbIndex;
                 if (k != FACET_INDEX_MAX) {
-                    if (_aclFacetArray[k].IsValid()) {
+                    if (FacetArray()[k].IsValid()) {
                         nbIndex -= aulDecrements[k];
                     }
                     else {
@@ -748,21 +826,21 @@ void MeshKernel::RemoveInvalids()
 
     // delete facets, number of valid facets
     unsigned long ulDelFacets =
-        std::count_if(_aclFacetArray.begin(), _aclFacetArray.end(), [](const MeshFacet& f) {
+        std::count_if(FacetArray().begin(), FacetArray().end(), [](const MeshFacet& f) {
             return f.IsValid();
         });
     MeshFacetArray aclFArray(ulDelFacets);
     MeshFacetArray::_TIterator pFTemp = aclFArray.begin();
-    pFEnd = _aclFacetArray.end();
-    for (pFIter = _aclFacetArray.begin(); pFIter != pFEnd; ++pFIter) {
+    pFEnd = FacetArray().end();
+    for (pFIter = FacetArray().begin(); pFIter != pFEnd; ++pFIter) {
         if (pFIter->IsValid()) {
             *pFTemp++ = *pFIter;
         }
     }
 
     // free memory
-    //_aclFacetArray = aclFArray;
-    _aclFacetArray.swap(aclFArray);
+    //FacetArray() = aclFArray;
+    FacetArray().swap(aclFArray);
 }
 
 void MeshKernel::CutFacets(const MeshFacetGrid& rclGrid,
@@ -810,17 +888,17 @@ std::vector<PointIndex> MeshKernel::GetFacetPoints(const std::vector<FacetIndex>
 
 std::vector<FacetIndex> MeshKernel::GetPointFacets(const std::vector<PointIndex>& points) const
 {
-    _aclPointArray.ResetFlag(MeshPoint::TMP0);
-    _aclFacetArray.ResetFlag(MeshFacet::TMP0);
+    PointArray().ResetFlag(MeshPoint::TMP0);
+    FacetArray().ResetFlag(MeshFacet::TMP0);
     for (PointIndex point : points) {
-        _aclPointArray[point].SetFlag(MeshPoint::TMP0);
+        PointArray()[point].SetFlag(MeshPoint::TMP0);
     }
 
     // mark facets if at least one corner point is marked
-    for (const auto& pF : _aclFacetArray) {
-        const MeshPoint& rclP0 = _aclPointArray[pF._aulPoints[0]];
-        const MeshPoint& rclP1 = _aclPointArray[pF._aulPoints[1]];
-        const MeshPoint& rclP2 = _aclPointArray[pF._aulPoints[2]];
+    for (const auto& pF : FacetArray()) {
+        const MeshPoint& rclP0 = PointArray()[pF._aulPoints[0]];
+        const MeshPoint& rclP1 = PointArray()[pF._aulPoints[1]];
+        const MeshPoint& rclP2 = PointArray()[pF._aulPoints[2]];
 
         if (rclP0.IsFlag(MeshPoint::TMP0) || rclP1.IsFlag(MeshPoint::TMP0)
             || rclP2.IsFlag(MeshPoint::TMP0)) {
@@ -836,9 +914,9 @@ std::vector<FacetIndex> MeshKernel::GetPointFacets(const std::vector<PointIndex>
 std::vector<FacetIndex> MeshKernel::HasFacets(const MeshPointIterator& rclIter) const
 {
     PointIndex ulPtInd = rclIter.Position();
-    std::vector<MeshFacet>::const_iterator pFIter = _aclFacetArray.begin();
-    std::vector<MeshFacet>::const_iterator pFBegin = _aclFacetArray.begin();
-    std::vector<MeshFacet>::const_iterator pFEnd = _aclFacetArray.end();
+    std::vector<MeshFacet>::const_iterator pFIter = FacetArray().begin();
+    std::vector<MeshFacet>::const_iterator pFBegin = FacetArray().begin();
+    std::vector<MeshFacet>::const_iterator pFEnd = FacetArray().end();
     std::vector<FacetIndex> aulBelongs;
 
     while (pFIter < pFEnd) {
@@ -859,7 +937,7 @@ MeshPointArray MeshKernel::GetPoints(const std::vector<PointIndex>& indices) con
     MeshPointArray ary;
     ary.reserve(indices.size());
     for (PointIndex it : indices) {
-        ary.push_back(this->_aclPointArray[it]);
+        ary.push_back(this->PointArray()[it]);
     }
     return ary;
 }
@@ -869,7 +947,7 @@ MeshFacetArray MeshKernel::GetFacets(const std::vector<FacetIndex>& indices) con
     MeshFacetArray ary;
     ary.reserve(indices.size());
     for (FacetIndex it : indices) {
-        ary.push_back(this->_aclFacetArray[it]);
+        ary.push_back(this->FacetArray()[it]);
     }
     return ary;
 }
@@ -898,11 +976,11 @@ void MeshKernel::Write(std::ostream& rclOut) const
     str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
 
     // write the data
-    for (const auto& it : _aclPointArray) {
+    for (const auto& it : PointArray()) {
         str << it.x << it.y << it.z;
     }
 
-    for (const auto& it : _aclFacetArray) {
+    for (const auto& it : FacetArray()) {
         str << static_cast<uint32_t>(it._aulPoints[0]) << static_cast<uint32_t>(it._aulPoints[1])
             << static_cast<uint32_t>(it._aulPoints[2]);
         str << static_cast<uint32_t>(it._aulNeighbours[0])
@@ -915,12 +993,30 @@ void MeshKernel::Write(std::ostream& rclOut) const
     str << _clBoundBox.MinZ << _clBoundBox.MaxZ;
 }
 
+void MeshKernel::WriteCompressed(std::ostream& rclOut) const
+{
+    if (!rclOut || rclOut.bad()) {
+        return;
+    }
+
+    Base::OutputStream str(rclOut);
+
+    // Write a header with a "magic number" and a version
+    str << static_cast<uint32_t>(0xA0B0C0D0);
+    str << static_cast<uint32_t>(MeshChunkedFormat::Version);
+
+    MeshChunkedFormat format;
+    format.Write(rclOut, PointArray(), FacetArray());
+}
+
 void MeshKernel::Read(std::istream& rclIn)
 {
     if (!rclIn || rclIn.bad()) {
         return;
     }
 
+    InvalidateAdjacency();
+
     // get header
     Base::InputStream str(rclIn);
 
@@ -943,7 +1039,24 @@ void MeshKernel::Read(std::istream& rclIn)
         str.setByteOrder(Base::Stream::BigEndian);
     }
 
-    if (new_format) {
+    bool chunked_format = (magic == 0xA0B0C0D0 && version == MeshChunkedFormat::Version)
+        || (swap_magic == 0xA0B0C0D0 && swap_version == MeshChunkedFormat::Version);
+
+    if (chunked_format) {
+        MeshPointArray pointArray;
+        MeshFacetArray facetArray;
+        try {
+            MeshChunkedFormat format;
+            format.Read(rclIn, pointArray, facetArray);
+        }
+        catch (const std::bad_alloc&) {
+            throw Base::BadFormatError("Reading from stream failed");
+        }
+
+        // the neighbourhood isn't stored
+        Adopt(pointArray, facetArray, true);
+    }
+    else if (new_format) {
         char szInfo[256];
         rclIn.read(szInfo, 256);
 
@@ -1019,8 +1132,10 @@ void MeshKernel::Read(std::istream& rclIn)
             str >> _clBoundBox.MinZ >> _clBoundBox.MaxZ;
 
             // If we reach this block no exception occurred and we can safely assign the mesh
-            _aclPointArray.swap(pointArray);
-            _aclFacetArray.swap(facetArray);
+            _aclPointArray = std::make_shared<MeshPointArray>(std::move(pointArray));
+            _aclFacetArray = std::make_shared<MeshFacetArray>(std::move(facetArray));
+            _detachPoints = false;
+            _detachFacets = false;
         }
         catch (std::exception&) {
             // Special handling of std::length_error
@@ -1093,8 +1208,10 @@ void MeshKernel::Read(std::istream& rclIn)
             }
         }
 
-        _aclPointArray.swap(pointArray);
-        _aclFacetArray.swap(facetArray);
+        _aclPointArray = std::make_shared<MeshPointArray>(std::move(pointArray));
+        _aclFacetArray = std::make_shared<MeshFacetArray>(std::move(facetArray));
+        _detachPoints = false;
+        _detachFacets = false;
     }
 }
 
@@ -1105,7 +1222,7 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    auto clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
+    auto clPIter = PointArray().begin(), clPEIter = PointArray().end();
 
     _clBoundBox.SetVoid();
     while (clPIter < clPEIter) {
@@ -1124,7 +1241,7 @@ void MeshKernel::Smooth(int iterations, float stepsize)
 void MeshKernel::RecalcBoundBox() const
 {
     _clBoundBox.SetVoid();
-    for (const auto& pI : _aclPointArray) {
+    for (const auto& pI : PointArray()) {
         _clBoundBox.Add(pI);
     }
 }
@@ -1155,11 +1272,11 @@ std::vector<Base::Vector3f> MeshKernel::GetFacetNormals(const std::vector<FacetI
     normals.reserve(facets.size());
 
     for (FacetIndex it : facets) {
-        const MeshFacet& face = _aclFacetArray[it];
+        const MeshFacet& face = FacetArray()[it];
 
-        const Base::Vector3f& p1 = _aclPointArray[face._aulPoints[0]];
-        const Base::Vector3f& p2 = _aclPointArray[face._aulPoints[1]];
-        const Base::Vector3f& p3 = _aclPointArray[face._aulPoints[2]];
+        const Base::Vector3f& p1 = PointArray()[face._aulPoints[0]];
+        const Base::Vector3f& p2 = PointArray()[face._aulPoints[1]];
+        const Base::Vector3f& p3 = PointArray()[face._aulPoints[2]];
 
         Base::Vector3f n = (p2 - p1) % (p3 - p1);
         n.Normalize();
@@ -1238,6 +1355,43 @@ bool MeshKernel::HasSelfIntersections() const
 }
 
 // Iterators
+const MeshPointFacetAdjacency& MeshKernel::GetPointFacetAdjacency() const
+{
+    std::lock_guard<std::mutex> lock(_adjacencyMutex);
+    if (!_pointFacets) {
+        _pointFacets = std::make_shared<MeshPointFacetAdjacency>(*this);
+    }
+    return *_pointFacets;
+}
+
+const MeshPointPointAdjacency& MeshKernel::GetPointPointAdjacency() const
+{
+    std::lock_guard<std::mutex> lock(_adjacencyMutex);
+    if (!_pointPoints) {
+        _pointPoints = std::make_shared<MeshPointPointAdjacency>(*this);
+    }
+    return *_pointPoints;
+}
+
+const MeshFacetFacetAdjacency& MeshKernel::GetFacetFacetAdjacency() const
+{
+    std::lock_guard<std::mutex> lock(_adjacencyMutex);
+    if (!_facetFacets) {
+        if (!_pointFacets) {
+            _pointFacets = std::make_shared<MeshPointFacetAdjacency>(*this);
+        }
+        _facetFacets = std::make_shared<MeshFacetFacetAdjacency>(*this, *_pointFacets);
+    }
+    return *_facetFacets;
+}
+
+void MeshKernel::InvalidateAdjacency()
+{
+    _pointFacets.reset();
+    _pointPoints.reset();
+    _facetFacets.reset();
+}
+
 MeshFacetIterator MeshKernel::FacetIterator() const
 {
     MeshFacetIterator it(*this);
@@ -1256,7 +1410,7 @@ void MeshKernel::GetEdges(std::vector<MeshGeomEdge>& edges) const
 {
     std::set<MeshBuilder::Edge> tmp;
 
-    for (const auto& it : _aclFacetArray) {
+    for (const auto& it : FacetArray()) {
         for (int i = 0; i < 3; i++) {
             tmp.insert(MeshBuilder::Edge(it._aulPoints[i],
                                          it._aulPoints[(i + 1) % 3],
@@ -1267,8 +1421,8 @@ void MeshKernel::GetEdges(std::vector<MeshGeomEdge>& edges) const
     edges.reserve(tmp.size());
     for (const auto& it2 : tmp) {
         MeshGeomEdge edge;
-        edge._aclPoints[0] = this->_aclPointArray[it2.pt1];
-        edge._aclPoints[1] = this->_aclPointArray[it2.pt2];
+        edge._aclPoints[0] = this->PointArray()[it2.pt1];
+        edge._aclPoints[1] = this->PointArray()[it2.pt2];
         edge._bBorder = it2.facetIdx == FACET_INDEX_MAX;
 
         edges.push_back(edge);
@@ -1279,7 +1433,7 @@ unsigned long MeshKernel::CountEdges() const
 {
     unsigned long openEdges = 0, closedEdges = 0;
 
-    for (const auto& it : _aclFacetArray) {
+    for (const auto& it : FacetArray()) {
         for (FacetIndex nbFacet : it._aulNeighbours) {
             if (nbFacet == FACET_INDEX_MAX) {
                 openEdges++;
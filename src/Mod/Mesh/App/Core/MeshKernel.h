@@ -23,8 +23,11 @@
 #ifndef MESH_KERNEL_H
 #define MESH_KERNEL_H
 
+#include <atomic>
 #include <cassert>
 #include <iosfwd>
+#include <memory>
+#include <mutex>
 
 #include <Base/BoundBox.h>
 #include <Base/Matrix.h>
@@ -49,6 +52,9 @@ class MeshFacet;
 class MeshFacetVisitor;
 class MeshPointVisitor;
 class MeshFacetGrid;
+class MeshPointFacetAdjacency;
+class MeshPointPointAdjacency;
+class MeshFacetFacetAdjacency;
 
 
 /**
@@ -79,6 +85,10 @@ public:
     //@{
     /// Binary streaming of data
     void Write(std::ostream& rclOut) const;
+    /** Binary streaming of data in the compressed format of version 2, see MeshChunkedFormat.
+     * The neighbourhood is not stored but rebuilt by Read().
+     */
+    void WriteCompressed(std::ostream& rclOut) const;
     void Read(std::istream& rclIn);
     //@}
 
@@ -87,21 +97,19 @@ public:
     /// Returns the number of facets
     unsigned long CountFacets() const
     {
-        return static_cast<unsigned long>(_aclFacetArray.size());
+        return static_cast<unsigned long>(FacetArray().size());
     }
     /// Returns the number of edge
     unsigned long CountEdges() const;
     // Returns the number of points
     unsigned long CountPoints() const
     {
-        return static_cast<unsigned long>(_aclPointArray.size());
-    }
-    /// Returns the number of required memory in bytes
-    unsigned int GetMemSize() const
-    {
-        return static_cast<unsigned int>(_aclPointArray.size() * sizeof(MeshPoint)
-                                         + _aclFacetArray.size() * sizeof(MeshFacet));
+        return static_cast<unsigned long>(PointArray().size());
     }
+    /** Returns the number of required memory in bytes. Arrays shared with other kernels are
+     * counted in full, they don't get detached.
+     */
+    unsigned int GetMemSize() const;
     /// Determines the bounding box
     const Base::BoundBox3f& GetBoundBox() const
     {
@@ -164,7 +172,7 @@ public:
     /** Returns the array of all data points. */
     const MeshPointArray& GetPoints() const
     {
-        return _aclPointArray;
+        return PointArray();
     }
     /** Returns an array of points to the given indices. The indices
      * must not be out of range.
@@ -174,13 +182,13 @@ public:
     /** Returns a modifier for the point array */
     MeshPointModifier ModifyPoints()
     {
-        return MeshPointModifier(_aclPointArray);
+        return MeshPointModifier(PointArray());
     }
 
     /** Returns the array of all facets */
     const MeshFacetArray& GetFacets() const
     {
-        return _aclFacetArray;
+        return FacetArray();
     }
     /** Returns an array of facets to the given indices. The indices
      * must not be out of range.
@@ -190,7 +198,7 @@ public:
     /** Returns a modifier for the facet array */
     MeshFacetModifier ModifyFacets()
     {
-        return MeshFacetModifier(_aclFacetArray);
+        return MeshFacetModifier(FacetArray());
     }
 
     /** Returns the array of all edges.
@@ -220,6 +228,19 @@ public:
     bool HasSelfIntersections() const;
     //@}
 
+    /** @name Adjacency */
+    //@{
+    /** Returns the facets of each point. The table is built on first access and kept until the
+     * point indices of the facets change, copies of the kernel share it. Several threads may
+     * request the tables at the same time, they are built only once.
+     */
+    const MeshPointFacetAdjacency& GetPointFacetAdjacency() const;
+    /** Returns the neighbour points of each point, see GetPointFacetAdjacency(). */
+    const MeshPointPointAdjacency& GetPointPointAdjacency() const;
+    /** Returns the facets sharing a point with each facet, see GetPointFacetAdjacency(). */
+    const MeshFacetFacetAdjacency& GetFacetFacetAdjacency() const;
+    //@}
+
     /** @name Facet visitors
      * The MeshKernel class provides different methods to visit "topologic connected" facets
      * to a given start facet. Two facets are regarded as "topologic connected" if they share
@@ -428,6 +449,11 @@ public:
     void Adopt(MeshPointArray& rPoints, MeshFacetArray& rFacets, bool checkNeighbourHood = false);
     /// Swaps the content of this kernel and \a mesh
     void Swap(MeshKernel& mesh);
+    /** Makes sure that the point and facet arrays aren't shared with another kernel. Code that
+     * keeps references to the arrays while it modifies the kernel must call it before it takes
+     * the references, MeshTopoAlgorithm and MeshValidation do it.
+     */
+    void Detach();
     /// Transform the data structure with the given transformation matrix.
     void operator*=(const Base::Matrix4D& rclMat);
     /** Transform the data structure with the given transformation matrix.
@@ -464,6 +490,10 @@ public:
     //@}
 
 protected:
+    /** Discards the cached adjacency tables. It must be called whenever the point indices of the
+     * facets are changed.
+     */
+    void InvalidateAdjacency();
     /** Rebuilds the neighbour indices for subset of all facets from index \a index on. */
     void RebuildNeighbours(FacetIndex);
     /** Checks if this point is associated to no other facet and deletes if so.
@@ -482,10 +512,63 @@ protected:
     inline Base::Vector3f GetGravityPoint(const MeshFacet& rclFacet) const;
 
 private:
-    MeshPointArray _aclPointArray;        /**< Holds the array of geometric points. */
-    MeshFacetArray _aclFacetArray;        /**< Holds the array of facets. */
+    /** @name Shared arrays
+     * A copy of a kernel shares the point and facet arrays with the kernel it was copied from
+     * until it accesses them for the first time. Then it copies an array that is still used by
+     * another kernel, so a copy that is never accessed, like an undo snapshot, costs no memory.
+     * The kernel that was copied keeps the arrays and copies them only before it changes them.
+     * @note Flags set through the const interface of a kernel are also seen by its copies that
+     * haven't accessed the arrays yet. A copy takes over the flags at its first access.
+     */
+    //@{
+    MeshPointArray& PointArray()
+    {
+        if (_detachPoints.load(std::memory_order_relaxed) || _aclPointArray.use_count() > 1) {
+            DetachPoints();
+        }
+        return *_aclPointArray;
+    }
+    const MeshPointArray& PointArray() const
+    {
+        if (_detachPoints.load(std::memory_order_acquire)) {
+            DetachPoints();
+        }
+        return *_aclPointArray;
+    }
+    MeshFacetArray& FacetArray()
+    {
+        if (_detachFacets.load(std::memory_order_relaxed) || _aclFacetArray.use_count() > 1) {
+            DetachFacets();
+        }
+        return *_aclFacetArray;
+    }
+    const MeshFacetArray& FacetArray() const
+    {
+        if (_detachFacets.load(std::memory_order_acquire)) {
+            DetachFacets();
+        }
+        return *_aclFacetArray;
+    }
+    /** Copies the array if another kernel still uses it. */
+    void DetachPoints() const;
+    /** Copies the array if another kernel still uses it. */
+    void DetachFacets() const;
+    //@}
+
+private:
+    /** Holds the array of geometric points, mutable because the flags are. */
+    mutable std::shared_ptr<MeshPointArray> _aclPointArray {std::make_shared<MeshPointArray>()};
+    /** Holds the array of facets, mutable because the flags are. */
+    mutable std::shared_ptr<MeshFacetArray> _aclFacetArray {std::make_shared<MeshFacetArray>()};
+    mutable std::atomic<bool> _detachPoints {false}; /**< Detach the points on first access. */
+    mutable std::atomic<bool> _detachFacets {false}; /**< Detach the facets on first access. */
+    mutable std::mutex _arrayMutex; /**< Guards detaching the arrays on first access. */
     mutable Base::BoundBox3f _clBoundBox; /**< The current calculated bounding box. */
     bool _bValid {true};                  /**< Current state of validality. */
+    mutable std::shared_ptr<const MeshPointFacetAdjacency> _pointFacets; /**< Built on demand. */
+    mutable std::shared_ptr<const MeshPointPointAdjacency> _pointPoints; /**< Built on demand. */
+    mutable std::shared_ptr<const MeshFacetFacetAdjacency> _facetFacets; /**< Built on demand. */
+    mutable std::mutex _adjacencyMutex; /**< Guards building the adjacency tables. */
 
     // friends
     friend class MeshPointIterator;
@@ -500,20 +583,20 @@ private:
 
 inline MeshPoint MeshKernel::GetPoint(PointIndex ulIndex) const
 {
-    assert(ulIndex < _aclPointArray.size());
-    return _aclPointArray[ulIndex];
+    assert(ulIndex < PointArray().size());
+    return PointArray()[ulIndex];
 }
 
 inline MeshGeomFacet MeshKernel::GetFacet(FacetIndex ulIndex) const
 {
-    assert(ulIndex < _aclFacetArray.size());
+    assert(ulIndex < FacetArray().size());
 
-    const MeshFacet* pclF = &_aclFacetArray[ulIndex];
+    const MeshFacet* pclF = &FacetArray()[ulIndex];
     MeshGeomFacet clFacet;
 
-    clFacet._aclPoints[0] = _aclPointArray[pclF->_aulPoints[0]];
-    clFacet._aclPoints[1] = _aclPointArray[pclF->_aulPoints[1]];
-    clFacet._aclPoints[2] = _aclPointArray[pclF->_aulPoints[2]];
+    clFacet._aclPoints[0] = PointArray()[pclF->_aulPoints[0]];
+    clFacet._aclPoints[1] = PointArray()[pclF->_aulPoints[1]];
+    clFacet._aclPoints[2] = PointArray()[pclF->_aulPoints[2]];
     clFacet._ulProp = pclF->_ulProp;
     clFacet._ucFlag = pclF->_ucFlag;
     clFacet.CalcNormal();
@@ -522,14 +605,14 @@ inline MeshGeomFacet MeshKernel::GetFacet(FacetIndex ulIndex) const
 
 inline MeshGeomFacet MeshKernel::GetFacet(const MeshFacet& rclFacet) const
 {
-    assert(rclFacet._aulPoints[0] < _aclPointArray.size());
-    assert(rclFacet._aulPoints[1] < _aclPointArray.size());
-    assert(rclFacet._aulPoints[2] < _aclPointArray.size());
+    assert(rclFacet._aulPoints[0] < PointArray().size());
+    assert(rclFacet._aulPoints[1] < PointArray().size());
+    assert(rclFacet._aulPoints[2] < PointArray().size());
 
     MeshGeomFacet clFacet;
-    clFacet._aclPoints[0] = _aclPointArray[rclFacet._aulPoints[0]];
-    clFacet._aclPoints[1] = _aclPointArray[rclFacet._aulPoints[1]];
-    clFacet._aclPoints[2] = _aclPointArray[rclFacet._aulPoints[2]];
+    clFacet._aclPoints[0] = PointArray()[rclFacet._aulPoints[0]];
+    clFacet._aclPoints[1] = PointArray()[rclFacet._aulPoints[1]];
+    clFacet._aclPoints[2] = PointArray()[rclFacet._aulPoints[2]];
     clFacet._ulProp = rclFacet._ulProp;
     clFacet._ucFlag = rclFacet._ucFlag;
     clFacet.CalcNormal();
@@ -541,33 +624,33 @@ inline void MeshKernel::GetFacetNeighbours(FacetIndex ulIndex,
                                            FacetIndex& rulNIdx1,
                                            FacetIndex& rulNIdx2) const
 {
-    assert(ulIndex < _aclFacetArray.size());
+    assert(ulIndex < FacetArray().size());
 
-    rulNIdx0 = _aclFacetArray[ulIndex]._aulNeighbours[0];
-    rulNIdx1 = _aclFacetArray[ulIndex]._aulNeighbours[1];
-    rulNIdx2 = _aclFacetArray[ulIndex]._aulNeighbours[2];
+    rulNIdx0 = FacetArray()[ulIndex]._aulNeighbours[0];
+    rulNIdx1 = FacetArray()[ulIndex]._aulNeighbours[1];
+    rulNIdx2 = FacetArray()[ulIndex]._aulNeighbours[2];
 }
 
 inline void MeshKernel::MovePoint(PointIndex ulPtIndex, const Base::Vector3f& rclTrans)
 {
-    _aclPointArray[ulPtIndex] += rclTrans;
+    PointArray()[ulPtIndex] += rclTrans;
 }
 
 inline void MeshKernel::SetPoint(PointIndex ulPtIndex, const Base::Vector3f& rPoint)
 {
-    _aclPointArray[ulPtIndex] = rPoint;
+    PointArray()[ulPtIndex] = rPoint;
 }
 
 inline void MeshKernel::SetPoint(PointIndex ulPtIndex, float x, float y, float z)
 {
-    _aclPointArray[ulPtIndex].Set(x, y, z);
+    PointArray()[ulPtIndex].Set(x, y, z);
 }
 
 inline void MeshKernel::AdjustNormal(MeshFacet& rclFacet, const Base::Vector3f& rclNormal)
 {
     Base::Vector3f clN =
-        (_aclPointArray[rclFacet._aulPoints[1]] - _aclPointArray[rclFacet._aulPoints[0]])
-        % (_aclPointArray[rclFacet._aulPoints[2]] - _aclPointArray[rclFacet._aulPoints[0]]);
+        (PointArray()[rclFacet._aulPoints[1]] - PointArray()[rclFacet._aulPoints[0]])
+        % (PointArray()[rclFacet._aulPoints[2]] - PointArray()[rclFacet._aulPoints[0]]);
     if ((clN * rclNormal) < 0.0F) {
         rclFacet.FlipNormal();
     }
@@ -576,17 +659,17 @@ inline void MeshKernel::AdjustNormal(MeshFacet& rclFacet, const Base::Vector3f&
 inline Base::Vector3f MeshKernel::GetNormal(const MeshFacet& rclFacet) const
 {
     Base::Vector3f clN =
-        (_aclPointArray[rclFacet._aulPoints[1]] - _aclPointArray[rclFacet._aulPoints[0]])
-        % (_aclPointArray[rclFacet._aulPoints[2]] - _aclPointArray[rclFacet._aulPoints[0]]);
+        (PointArray()[rclFacet._aulPoints[1]] - PointArray()[rclFacet._aulPoints[0]])
+        % (PointArray()[rclFacet._aulPoints[2]] - PointArray()[rclFacet._aulPoints[0]]);
     clN.Normalize();
     return clN;
 }
 
 inline Base::Vector3f MeshKernel::GetGravityPoint(const MeshFacet& rclFacet) const
 {
-    const Base::Vector3f& p0 = _aclPointArray[rclFacet._aulPoints[0]];
-    const Base::Vector3f& p1 = _aclPointArray[rclFacet._aulPoints[1]];
-    const Base::Vector3f& p2 = _aclPointArray[rclFacet._aulPoints[2]];
+    const Base::Vector3f& p0 = PointArray()[rclFacet._aulPoints[0]];
+    const Base::Vector3f& p1 = PointArray()[rclFacet._aulPoints[1]];
+    const Base::Vector3f& p2 = PointArray()[rclFacet._aulPoints[2]];
     return Base::Vector3f((p0.x + p1.x + p2.x) / 3.0F,
                           (p0.y + p1.y + p2.y) / 3.0F,
                           (p0.z + p1.z + p2.z) / 3.0F);
@@ -597,8 +680,8 @@ inline void MeshKernel::GetFacetPoints(FacetIndex ulFaIndex,
                                        PointIndex& rclP1,
                                        PointIndex& rclP2) const
 {
-    assert(ulFaIndex < _aclFacetArray.size());
-    const MeshFacet& rclFacet = _aclFacetArray[ulFaIndex];
+    assert(ulFaIndex < FacetArray().size());
+    const MeshFacet& rclFacet = FacetArray()[ulFaIndex];
     rclP0 = rclFacet._aulPoints[0];
     rclP1 = rclFacet._aulPoints[1];
     rclP2 = rclFacet._aulPoints[2];
@@ -609,8 +692,8 @@ inline void MeshKernel::SetFacetPoints(FacetIndex ulFaIndex,
                                        PointIndex rclP1,
                                        PointIndex rclP2)
 {
-    assert(ulFaIndex < _aclFacetArray.size());
-    MeshFacet& rclFacet = _aclFacetArray[ulFaIndex];
+    assert(ulFaIndex < FacetArray().size());
+    MeshFacet& rclFacet = FacetArray()[ulFaIndex];
     rclFacet._aulPoints[0] = rclP0;
     rclFacet._aulPoints[1] = rclP1;
     rclFacet._aulPoints[2] = rclP2;
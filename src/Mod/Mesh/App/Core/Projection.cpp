@@ -27,6 +27,7 @@
 #include <map>
 #endif
 
+#include "BVH.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
@@ -139,12 +140,6 @@ bool MeshProjection::projectLineOnMesh(const MeshFacetGrid& grid,
                                        const Base::Vector3f& vd,
                                        std::vector<Base::Vector3f>& polyline)
 {
-    Base::Vector3f dir(v2 - v1);
-    Base::Vector3f base(v1), normal(vd % dir);
-    normal.Normalize();
-    dir.Normalize();
-
-
     std::vector<FacetIndex> facets;
 
     // special case: start and endpoint inside same facet
@@ -163,6 +158,64 @@ bool MeshProjection::projectLineOnMesh(const MeshFacetGrid& grid,
         }
     }
 
+    return projectLineOnFacets(facets, v1, f1, v2, f2, vd, polyline);
+}
+
+bool MeshProjection::projectLineOnMesh(const MeshFacetBVH& bvh,
+                                       const Base::Vector3f& v1,
+                                       FacetIndex f1,
+                                       const Base::Vector3f& v2,
+                                       FacetIndex f2,
+                                       const Base::Vector3f& vd,
+                                       std::vector<Base::Vector3f>& polyline)
+{
+    std::vector<FacetIndex> facets;
+
+    // special case: start and endpoint inside same facet
+    if (f1 == f2) {
+        polyline.push_back(v1);
+        polyline.push_back(v2);
+        return true;
+    }
+
+    Base::Vector3f dir(v2 - v1);
+    Base::Vector3f normal(vd % dir);
+    normal.Normalize();
+    dir.Normalize();
+    float dist1 = v1 * dir;
+    float dist2 = v2 * dir;
+
+    // cut all facets between the two endpoints, a node must be visited if the bounding box of
+    // one of its facets passes bboxInsideRectangle()
+    bvh.Search(
+        [&](const Base::BoundBox3f& bbox) {
+            if (!bbox.IsCutPlane(v1, normal)) {
+                return false;
+            }
+            float center = bbox.GetCenter() * dir;
+            float extent = 0.5F
+                * (std::fabs(dir.x) * bbox.LengthX() + std::fabs(dir.y) * bbox.LengthY()
+                   + std::fabs(dir.z) * bbox.LengthZ() + bbox.CalcDiagonalLength());
+            return center + extent >= dist1 && center - extent <= dist2;
+        },
+        facets);
+
+    return projectLineOnFacets(facets, v1, f1, v2, f2, vd, polyline);
+}
+
+bool MeshProjection::projectLineOnFacets(std::vector<FacetIndex>& facets,
+                                         const Base::Vector3f& v1,
+                                         FacetIndex f1,
+                                         const Base::Vector3f& v2,
+                                         FacetIndex f2,
+                                         const Base::Vector3f& vd,
+                                         std::vector<Base::Vector3f>& polyline) const
+{
+    Base::Vector3f dir(v2 - v1);
+    Base::Vector3f base(v1), normal(vd % dir);
+    normal.Normalize();
+    dir.Normalize();
+
     std::sort(facets.begin(), facets.end());
     facets.erase(std::unique(facets.begin(), facets.end()), facets.end());
 
@@ -32,9 +32,9 @@
 namespace MeshCore
 {
 class MeshKernel;
-class MeshRefPointToPoints;
-class MeshRefPointToFacets;
-class MeshRefFacetToFacets;
+class MeshPointPointAdjacency;
+class MeshPointFacetAdjacency;
+class MeshFacetFacetAdjacency;
 
 /** Base class for smoothing algorithms. */
 class MeshExport AbstractSmoothing
@@ -107,9 +107,9 @@ public:
     }
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&, const MeshRefPointToFacets&, double);
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&,
+    void Umbrella(const MeshPointPointAdjacency&, const MeshPointFacetAdjacency&, double);
+    void Umbrella(const MeshPointPointAdjacency&,
+                  const MeshPointFacetAdjacency&,
                   double,
                   const std::vector<PointIndex>&);
 
@@ -149,8 +149,8 @@ public:
     void SmoothPoints(unsigned int, const std::vector<PointIndex>&) override;
 
 private:
-    void UpdatePoints(const MeshRefFacetToFacets&,
-                      const MeshRefPointToFacets&,
+    void UpdatePoints(const MeshFacetFacetAdjacency&,
+                      const MeshPointFacetAdjacency&,
                       const std::vector<PointIndex>&);
 
 private:
@@ -44,7 +44,11 @@ using namespace MeshCore;
 
 MeshTopoAlgorithm::MeshTopoAlgorithm(MeshKernel& rclM)
     : _rclMesh(rclM)
-{}
+{
+    // the facets are changed directly and references to the arrays must stay valid
+    _rclMesh.Detach();
+    _rclMesh.InvalidateAdjacency();
+}
 
 MeshTopoAlgorithm::~MeshTopoAlgorithm()
 {
@@ -52,17 +56,18 @@ MeshTopoAlgorithm::~MeshTopoAlgorithm()
         Cleanup();
     }
     EndCache();
+    _rclMesh.InvalidateAdjacency();
 }
 
 bool MeshTopoAlgorithm::InsertVertex(FacetIndex ulFacetPos, const Base::Vector3f& rclPoint)
 {
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
     MeshFacet clNewFacet1, clNewFacet2;
 
     // insert new point
-    PointIndex ulPtCnt = _rclMesh._aclPointArray.size();
+    PointIndex ulPtCnt = _rclMesh.PointArray().size();
     PointIndex ulPtInd = this->GetOrAddIndex(rclPoint);
-    FacetIndex ulSize = _rclMesh._aclFacetArray.size();
+    FacetIndex ulSize = _rclMesh.FacetArray().size();
 
     if (ulPtInd < ulPtCnt) {
         return false;  // the given point is already part of the mesh => creating new facets would
@@ -87,10 +92,10 @@ bool MeshTopoAlgorithm::InsertVertex(FacetIndex ulFacetPos, const Base::Vector3f
     clNewFacet2._aulNeighbours[2] = ulSize;
     // adjust the neighbour facet
     if (rclF._aulNeighbours[1] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclF._aulNeighbours[1]].ReplaceNeighbour(ulFacetPos, ulSize);
+        _rclMesh.FacetArray()[rclF._aulNeighbours[1]].ReplaceNeighbour(ulFacetPos, ulSize);
     }
     if (rclF._aulNeighbours[2] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclF._aulNeighbours[2]].ReplaceNeighbour(ulFacetPos, ulSize + 1);
+        _rclMesh.FacetArray()[rclF._aulNeighbours[2]].ReplaceNeighbour(ulFacetPos, ulSize + 1);
     }
     // original facet
     rclF._aulPoints[2] = ulPtInd;
@@ -98,23 +103,23 @@ bool MeshTopoAlgorithm::InsertVertex(FacetIndex ulFacetPos, const Base::Vector3f
     rclF._aulNeighbours[2] = ulSize + 1;
 
     // insert new facets
-    _rclMesh._aclFacetArray.push_back(clNewFacet1);
-    _rclMesh._aclFacetArray.push_back(clNewFacet2);
+    _rclMesh.FacetArray().push_back(clNewFacet1);
+    _rclMesh.FacetArray().push_back(clNewFacet2);
 
     return true;
 }
 
 bool MeshTopoAlgorithm::SnapVertex(FacetIndex ulFacetPos, const Base::Vector3f& rP)
 {
-    MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& rFace = _rclMesh.FacetArray()[ulFacetPos];
     if (!rFace.HasOpenEdge()) {
         return false;
     }
     Base::Vector3f cNo1 = _rclMesh.GetNormal(rFace);
     for (unsigned short i = 0; i < 3; i++) {
         if (rFace._aulNeighbours[i] == FACET_INDEX_MAX) {
-            const Base::Vector3f& rPt1 = _rclMesh._aclPointArray[rFace._aulPoints[i]];
-            const Base::Vector3f& rPt2 = _rclMesh._aclPointArray[rFace._aulPoints[(i + 1) % 3]];
+            const Base::Vector3f& rPt1 = _rclMesh.PointArray()[rFace._aulPoints[i]];
+            const Base::Vector3f& rPt2 = _rclMesh.PointArray()[rFace._aulPoints[(i + 1) % 3]];
             Base::Vector3f cNo2 = (rPt2 - rPt1) % cNo1;
             Base::Vector3f cNo3 = (rP - rPt1) % (rPt2 - rPt1);
             float fD2 = Base::DistanceP2(rPt1, rPt2);
@@ -131,7 +136,7 @@ bool MeshTopoAlgorithm::SnapVertex(FacetIndex ulFacetPos, const Base::Vector3f&
                 cTria._aulPoints[2] = rFace._aulPoints[i];
                 cTria._aulNeighbours[1] = ulFacetPos;
                 rFace._aulNeighbours[i] = _rclMesh.CountFacets();
-                _rclMesh._aclFacetArray.push_back(cTria);
+                _rclMesh.FacetArray().push_back(cTria);
                 return true;
             }
         }
@@ -145,7 +150,7 @@ void MeshTopoAlgorithm::OptimizeTopology(float fMaxAngle)
     // For each internal edge get the adjacent facets. When doing an edge swap we must update
     // this structure.
     std::map<std::pair<PointIndex, PointIndex>, std::vector<FacetIndex>> aEdge2Face;
-    for (auto pI = _rclMesh._aclFacetArray.begin(); pI != _rclMesh._aclFacetArray.end(); ++pI) {
+    for (auto pI = _rclMesh.FacetArray().begin(); pI != _rclMesh.FacetArray().end(); ++pI) {
         for (int i = 0; i < 3; i++) {
             // ignore open edges
             if (pI->_aulNeighbours[i] != FACET_INDEX_MAX) {
@@ -154,7 +159,7 @@ void MeshTopoAlgorithm::OptimizeTopology(float fMaxAngle)
                 PointIndex ulPt1 =
                     std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
                 aEdge2Face[std::pair<PointIndex, PointIndex>(ulPt0, ulPt1)].push_back(
-                    pI - _rclMesh._aclFacetArray.begin());
+                    pI - _rclMesh.FacetArray().begin());
             }
         }
     }
@@ -196,8 +201,8 @@ void MeshTopoAlgorithm::OptimizeTopology(float fMaxAngle)
             // swap the edge
             SwapEdge(pE->second[0], pE->second[1]);
 
-            MeshFacet& rF1 = _rclMesh._aclFacetArray[pE->second[0]];
-            MeshFacet& rF2 = _rclMesh._aclFacetArray[pE->second[1]];
+            MeshFacet& rF1 = _rclMesh.FacetArray()[pE->second[0]];
+            MeshFacet& rF2 = _rclMesh.FacetArray()[pE->second[1]];
             unsigned short side1 = rF1.Side(aEdge.first, aEdge.second);
             unsigned short side2 = rF2.Side(aEdge.first, aEdge.second);
 
@@ -356,7 +361,7 @@ void MeshTopoAlgorithm::DelaunayFlip(float fMaxAngle)
     // For each internal edge get the adjacent facets.
     std::set<std::pair<FacetIndex, FacetIndex>> aEdge2Face;
     FacetIndex index = 0;
-    for (auto pI = _rclMesh._aclFacetArray.begin(); pI != _rclMesh._aclFacetArray.end();
+    for (auto pI = _rclMesh.FacetArray().begin(); pI != _rclMesh.FacetArray().end();
          ++pI, index++) {
         for (FacetIndex nbIndex : pI->_aulNeighbours) {
             // ignore open edges
@@ -376,8 +381,8 @@ void MeshTopoAlgorithm::DelaunayFlip(float fMaxAngle)
         if (ShouldSwapEdge(edge.first, edge.second, fMaxAngle)) {
             float radius = _rclMesh.GetFacet(edge.first).CenterOfCircumCircle(center);
             radius *= radius;
-            const MeshFacet& face_1 = _rclMesh._aclFacetArray[edge.first];
-            const MeshFacet& face_2 = _rclMesh._aclFacetArray[edge.second];
+            const MeshFacet& face_1 = _rclMesh.FacetArray()[edge.first];
+            const MeshFacet& face_2 = _rclMesh.FacetArray()[edge.second];
             unsigned short side = face_2.Side(edge.first);
             MeshPoint vertex = _rclMesh.GetPoint(face_2._aulPoints[(side + 1) % 3]);
             if (Base::DistanceP2(center, vertex) < radius) {
@@ -408,17 +413,17 @@ void MeshTopoAlgorithm::DelaunayFlip(float fMaxAngle)
 int MeshTopoAlgorithm::DelaunayFlip()
 {
     int cnt_swap = 0;
-    _rclMesh._aclFacetArray.ResetFlag(MeshFacet::TMP0);
-    size_t cnt_facets = _rclMesh._aclFacetArray.size();
+    _rclMesh.FacetArray().ResetFlag(MeshFacet::TMP0);
+    size_t cnt_facets = _rclMesh.FacetArray().size();
     for (size_t i = 0; i < cnt_facets; i++) {
-        const MeshFacet& f_face = _rclMesh._aclFacetArray[i];
+        const MeshFacet& f_face = _rclMesh.FacetArray()[i];
         if (f_face.IsFlag(MeshFacet::TMP0)) {
             continue;
         }
         for (int j = 0; j < 3; j++) {
             FacetIndex n = f_face._aulNeighbours[j];
             if (n != FACET_INDEX_MAX) {
-                const MeshFacet& n_face = _rclMesh._aclFacetArray[n];
+                const MeshFacet& n_face = _rclMesh.FacetArray()[n];
                 if (n_face.IsFlag(MeshFacet::TMP0)) {
                     continue;
                 }
@@ -554,11 +559,11 @@ bool MeshTopoAlgorithm::InsertVertexAndSwapEdge(FacetIndex ulFacetPos,
     }
 
     // get the created elements
-    FacetIndex ulF1Ind = _rclMesh._aclFacetArray.size() - 2;
-    FacetIndex ulF2Ind = _rclMesh._aclFacetArray.size() - 1;
-    MeshFacet& rclF1 = _rclMesh._aclFacetArray[ulFacetPos];
-    MeshFacet& rclF2 = _rclMesh._aclFacetArray[ulF1Ind];
-    MeshFacet& rclF3 = _rclMesh._aclFacetArray[ulF2Ind];
+    FacetIndex ulF1Ind = _rclMesh.FacetArray().size() - 2;
+    FacetIndex ulF2Ind = _rclMesh.FacetArray().size() - 1;
+    MeshFacet& rclF1 = _rclMesh.FacetArray()[ulFacetPos];
+    MeshFacet& rclF2 = _rclMesh.FacetArray()[ulF1Ind];
+    MeshFacet& rclF3 = _rclMesh.FacetArray()[ulF2Ind];
 
     // first facet
     for (FacetIndex uNeighbour : rclF1._aulNeighbours) {
@@ -594,8 +599,8 @@ bool MeshTopoAlgorithm::InsertVertexAndSwapEdge(FacetIndex ulFacetPos,
 
 bool MeshTopoAlgorithm::IsSwapEdgeLegal(FacetIndex ulFacetPos, FacetIndex ulNeighbour) const
 {
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
-    MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
+    MeshFacet& rclN = _rclMesh.FacetArray()[ulNeighbour];
 
     unsigned short uFSide = rclF.Side(rclN);
     unsigned short uNSide = rclN.Side(rclF);
@@ -604,10 +609,10 @@ bool MeshTopoAlgorithm::IsSwapEdgeLegal(FacetIndex ulFacetPos, FacetIndex ulNeig
         return false;  // not neighbours
     }
 
-    Base::Vector3f cP1 = _rclMesh._aclPointArray[rclF._aulPoints[uFSide]];
-    Base::Vector3f cP2 = _rclMesh._aclPointArray[rclF._aulPoints[(uFSide + 1) % 3]];
-    Base::Vector3f cP3 = _rclMesh._aclPointArray[rclF._aulPoints[(uFSide + 2) % 3]];
-    Base::Vector3f cP4 = _rclMesh._aclPointArray[rclN._aulPoints[(uNSide + 2) % 3]];
+    Base::Vector3f cP1 = _rclMesh.PointArray()[rclF._aulPoints[uFSide]];
+    Base::Vector3f cP2 = _rclMesh.PointArray()[rclF._aulPoints[(uFSide + 1) % 3]];
+    Base::Vector3f cP3 = _rclMesh.PointArray()[rclF._aulPoints[(uFSide + 2) % 3]];
+    Base::Vector3f cP4 = _rclMesh.PointArray()[rclN._aulPoints[(uNSide + 2) % 3]];
 
     // do not allow one to create degenerated triangles
     MeshGeomFacet cT3(cP4, cP3, cP1);
@@ -645,16 +650,16 @@ bool MeshTopoAlgorithm::ShouldSwapEdge(FacetIndex ulFacetPos,
         return false;
     }
 
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
-    MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
+    MeshFacet& rclN = _rclMesh.FacetArray()[ulNeighbour];
 
     unsigned short uFSide = rclF.Side(rclN);
     unsigned short uNSide = rclN.Side(rclF);
 
-    Base::Vector3f cP1 = _rclMesh._aclPointArray[rclF._aulPoints[uFSide]];
-    Base::Vector3f cP2 = _rclMesh._aclPointArray[rclF._aulPoints[(uFSide + 1) % 3]];
-    Base::Vector3f cP3 = _rclMesh._aclPointArray[rclF._aulPoints[(uFSide + 2) % 3]];
-    Base::Vector3f cP4 = _rclMesh._aclPointArray[rclN._aulPoints[(uNSide + 2) % 3]];
+    Base::Vector3f cP1 = _rclMesh.PointArray()[rclF._aulPoints[uFSide]];
+    Base::Vector3f cP2 = _rclMesh.PointArray()[rclF._aulPoints[(uFSide + 1) % 3]];
+    Base::Vector3f cP3 = _rclMesh.PointArray()[rclF._aulPoints[(uFSide + 2) % 3]];
+    Base::Vector3f cP4 = _rclMesh.PointArray()[rclN._aulPoints[(uNSide + 2) % 3]];
 
     MeshGeomFacet cT1(cP1, cP2, cP3);
     float fMax1 = cT1.MaximumAngle();
@@ -680,8 +685,8 @@ bool MeshTopoAlgorithm::ShouldSwapEdge(FacetIndex ulFacetPos,
 
 void MeshTopoAlgorithm::SwapEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbour)
 {
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
-    MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
+    MeshFacet& rclN = _rclMesh.FacetArray()[ulNeighbour];
 
     unsigned short uFSide = rclF.Side(rclN);
     unsigned short uNSide = rclN.Side(rclF);
@@ -692,12 +697,12 @@ void MeshTopoAlgorithm::SwapEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbour)
 
     // adjust the neighbourhood
     if (rclF._aulNeighbours[(uFSide + 1) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclF._aulNeighbours[(uFSide + 1) % 3]].ReplaceNeighbour(
+        _rclMesh.FacetArray()[rclF._aulNeighbours[(uFSide + 1) % 3]].ReplaceNeighbour(
             ulFacetPos,
             ulNeighbour);
     }
     if (rclN._aulNeighbours[(uNSide + 1) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclN._aulNeighbours[(uNSide + 1) % 3]].ReplaceNeighbour(ulNeighbour,
+        _rclMesh.FacetArray()[rclN._aulNeighbours[(uNSide + 1) % 3]].ReplaceNeighbour(ulNeighbour,
                                                                                         ulFacetPos);
     }
 
@@ -714,8 +719,8 @@ bool MeshTopoAlgorithm::SplitEdge(FacetIndex ulFacetPos,
                                   FacetIndex ulNeighbour,
                                   const Base::Vector3f& rP)
 {
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
-    MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
+    MeshFacet& rclN = _rclMesh.FacetArray()[ulNeighbour];
 
     unsigned short uFSide = rclF.Side(rclN);
     unsigned short uNSide = rclN.Side(rclF);
@@ -724,9 +729,9 @@ bool MeshTopoAlgorithm::SplitEdge(FacetIndex ulFacetPos,
         return false;  // not neighbours
     }
 
-    PointIndex uPtCnt = _rclMesh._aclPointArray.size();
+    PointIndex uPtCnt = _rclMesh.PointArray().size();
     PointIndex uPtInd = this->GetOrAddIndex(rP);
-    FacetIndex ulSize = _rclMesh._aclFacetArray.size();
+    FacetIndex ulSize = _rclMesh.FacetArray().size();
 
     // the given point is already part of the mesh => creating new facets would
     // be an illegal operation
@@ -736,11 +741,11 @@ bool MeshTopoAlgorithm::SplitEdge(FacetIndex ulFacetPos,
 
     // adjust the neighbourhood
     if (rclF._aulNeighbours[(uFSide + 1) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclF._aulNeighbours[(uFSide + 1) % 3]].ReplaceNeighbour(ulFacetPos,
+        _rclMesh.FacetArray()[rclF._aulNeighbours[(uFSide + 1) % 3]].ReplaceNeighbour(ulFacetPos,
                                                                                         ulSize);
     }
     if (rclN._aulNeighbours[(uNSide + 2) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclN._aulNeighbours[(uNSide + 2) % 3]].ReplaceNeighbour(ulNeighbour,
+        _rclMesh.FacetArray()[rclN._aulNeighbours[(uNSide + 2) % 3]].ReplaceNeighbour(ulNeighbour,
                                                                                         ulSize + 1);
     }
 
@@ -766,8 +771,8 @@ bool MeshTopoAlgorithm::SplitEdge(FacetIndex ulFacetPos,
     rclN._aulNeighbours[(uNSide + 2) % 3] = ulSize + 1;
 
     // insert new facets
-    _rclMesh._aclFacetArray.push_back(cNew1);
-    _rclMesh._aclFacetArray.push_back(cNew2);
+    _rclMesh.FacetArray().push_back(cNew1);
+    _rclMesh.FacetArray().push_back(cNew2);
 
     return true;
 }
@@ -776,14 +781,14 @@ bool MeshTopoAlgorithm::SplitOpenEdge(FacetIndex ulFacetPos,
                                       unsigned short uSide,
                                       const Base::Vector3f& rP)
 {
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
     if (rclF._aulNeighbours[uSide] != FACET_INDEX_MAX) {
         return false;  // not open
     }
 
-    PointIndex uPtCnt = _rclMesh._aclPointArray.size();
+    PointIndex uPtCnt = _rclMesh.PointArray().size();
     PointIndex uPtInd = this->GetOrAddIndex(rP);
-    FacetIndex ulSize = _rclMesh._aclFacetArray.size();
+    FacetIndex ulSize = _rclMesh.FacetArray().size();
 
     if (uPtInd < uPtCnt) {
         return false;  // the given point is already part of the mesh => creating new facets would
@@ -792,7 +797,7 @@ bool MeshTopoAlgorithm::SplitOpenEdge(FacetIndex ulFacetPos,
 
     // adjust the neighbourhood
     if (rclF._aulNeighbours[(uSide + 1) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclF._aulNeighbours[(uSide + 1) % 3]].ReplaceNeighbour(ulFacetPos,
+        _rclMesh.FacetArray()[rclF._aulNeighbours[(uSide + 1) % 3]].ReplaceNeighbour(ulFacetPos,
                                                                                        ulSize);
     }
 
@@ -809,7 +814,7 @@ bool MeshTopoAlgorithm::SplitOpenEdge(FacetIndex ulFacetPos,
     rclF._aulNeighbours[(uSide + 1) % 3] = ulSize;
 
     // insert new facets
-    _rclMesh._aclFacetArray.push_back(cNew);
+    _rclMesh.FacetArray().push_back(cNew);
     return true;
 }
 
@@ -832,9 +837,9 @@ void MeshTopoAlgorithm::BeginCache()
 {
     delete _cache;
     _cache = new tCache();
-    PointIndex nbPoints = _rclMesh._aclPointArray.size();
+    PointIndex nbPoints = _rclMesh.PointArray().size();
     for (unsigned int pntCpt = 0; pntCpt < nbPoints; ++pntCpt) {
-        _cache->insert(std::make_pair(_rclMesh._aclPointArray[pntCpt], pntCpt));
+        _cache->insert(std::make_pair(_rclMesh.PointArray()[pntCpt], pntCpt));
     }
 }
 
@@ -850,13 +855,13 @@ void MeshTopoAlgorithm::EndCache()
 PointIndex MeshTopoAlgorithm::GetOrAddIndex(const MeshPoint& rclPoint)
 {
     if (!_cache) {
-        return _rclMesh._aclPointArray.GetOrAddIndex(rclPoint);
+        return _rclMesh.PointArray().GetOrAddIndex(rclPoint);
     }
 
-    unsigned long sz = _rclMesh._aclPointArray.size();
+    unsigned long sz = _rclMesh.PointArray().size();
     std::pair<tCache::iterator, bool> retval = _cache->insert(std::make_pair(rclPoint, sz));
     if (retval.second) {
-        _rclMesh._aclPointArray.push_back(rclPoint);
+        _rclMesh.PointArray().push_back(rclPoint);
     }
     return retval.first->second;
 }
@@ -872,7 +877,7 @@ std::vector<FacetIndex> MeshTopoAlgorithm::GetFacetsToPoint(FacetIndex uFacetPos
         FacetIndex uIndex = aReference.front();
         aReference.pop_front();
         aRefFacet.insert(uIndex);
-        MeshFacet& rFace = _rclMesh._aclFacetArray[uIndex];
+        MeshFacet& rFace = _rclMesh.FacetArray()[uIndex];
         for (int i = 0; i < 3; i++) {
             if (rFace._aulPoints[i] == uPointPos) {
                 if (rFace._aulNeighbours[i] != FACET_INDEX_MAX) {
@@ -912,13 +917,13 @@ bool MeshTopoAlgorithm::CollapseVertex(const VertexCollapse& vc)
         return false;
     }
 
-    if (!_rclMesh._aclPointArray[vc._point].IsValid()) {
+    if (!_rclMesh.PointArray()[vc._point].IsValid()) {
         return false;  // the point is marked invalid from a previous run
     }
 
-    MeshFacet& rFace1 = _rclMesh._aclFacetArray[vc._circumFacets[0]];
-    MeshFacet& rFace2 = _rclMesh._aclFacetArray[vc._circumFacets[1]];
-    MeshFacet& rFace3 = _rclMesh._aclFacetArray[vc._circumFacets[2]];
+    MeshFacet& rFace1 = _rclMesh.FacetArray()[vc._circumFacets[0]];
+    MeshFacet& rFace2 = _rclMesh.FacetArray()[vc._circumFacets[1]];
+    MeshFacet& rFace3 = _rclMesh.FacetArray()[vc._circumFacets[2]];
 
     // get the point that is not shared by rFace1
     PointIndex ptIndex = POINT_INDEX_MAX;
@@ -954,18 +959,18 @@ bool MeshTopoAlgorithm::CollapseVertex(const VertexCollapse& vc)
     rFace1.ReplaceNeighbour(vc._circumFacets[2], neighbour2);
 
     if (neighbour1 != FACET_INDEX_MAX) {
-        MeshFacet& rFace4 = _rclMesh._aclFacetArray[neighbour1];
+        MeshFacet& rFace4 = _rclMesh.FacetArray()[neighbour1];
         rFace4.ReplaceNeighbour(vc._circumFacets[1], vc._circumFacets[0]);
     }
     if (neighbour2 != FACET_INDEX_MAX) {
-        MeshFacet& rFace5 = _rclMesh._aclFacetArray[neighbour2];
+        MeshFacet& rFace5 = _rclMesh.FacetArray()[neighbour2];
         rFace5.ReplaceNeighbour(vc._circumFacets[2], vc._circumFacets[0]);
     }
 
     // the two facets and the point can be marked for removal
     rFace2.SetInvalid();
     rFace3.SetInvalid();
-    _rclMesh._aclPointArray[vc._point].SetInvalid();
+    _rclMesh.PointArray()[vc._point].SetInvalid();
 
     _needsCleanup = true;
 
@@ -974,8 +979,8 @@ bool MeshTopoAlgorithm::CollapseVertex(const VertexCollapse& vc)
 
 bool MeshTopoAlgorithm::CollapseEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbour)
 {
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
-    MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
+    MeshFacet& rclN = _rclMesh.FacetArray()[ulNeighbour];
 
     unsigned short uFSide = rclF.Side(rclN);
     unsigned short uNSide = rclN.Side(rclF);
@@ -995,28 +1000,28 @@ bool MeshTopoAlgorithm::CollapseEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbo
     // get all facets this point is referenced by
     std::vector<FacetIndex> aRefs = GetFacetsToPoint(ulFacetPos, ulPointPos);
     for (FacetIndex it : aRefs) {
-        MeshFacet& rFace = _rclMesh._aclFacetArray[it];
+        MeshFacet& rFace = _rclMesh.FacetArray()[it];
         rFace.Transpose(ulPointPos, ulPointNew);
     }
 
     // set the new neighbourhood
     if (rclF._aulNeighbours[(uFSide + 1) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclF._aulNeighbours[(uFSide + 1) % 3]].ReplaceNeighbour(
+        _rclMesh.FacetArray()[rclF._aulNeighbours[(uFSide + 1) % 3]].ReplaceNeighbour(
             ulFacetPos,
             rclF._aulNeighbours[(uFSide + 2) % 3]);
     }
     if (rclF._aulNeighbours[(uFSide + 2) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclF._aulNeighbours[(uFSide + 2) % 3]].ReplaceNeighbour(
+        _rclMesh.FacetArray()[rclF._aulNeighbours[(uFSide + 2) % 3]].ReplaceNeighbour(
             ulFacetPos,
             rclF._aulNeighbours[(uFSide + 1) % 3]);
     }
     if (rclN._aulNeighbours[(uNSide + 1) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclN._aulNeighbours[(uNSide + 1) % 3]].ReplaceNeighbour(
+        _rclMesh.FacetArray()[rclN._aulNeighbours[(uNSide + 1) % 3]].ReplaceNeighbour(
             ulNeighbour,
             rclN._aulNeighbours[(uNSide + 2) % 3]);
     }
     if (rclN._aulNeighbours[(uNSide + 2) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclN._aulNeighbours[(uNSide + 2) % 3]].ReplaceNeighbour(
+        _rclMesh.FacetArray()[rclN._aulNeighbours[(uNSide + 2) % 3]].ReplaceNeighbour(
             ulNeighbour,
             rclN._aulNeighbours[(uNSide + 1) % 3]);
     }
@@ -1030,7 +1035,7 @@ bool MeshTopoAlgorithm::CollapseEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbo
     rclN._aulNeighbours[1] = FACET_INDEX_MAX;
     rclN._aulNeighbours[2] = FACET_INDEX_MAX;
     rclN.SetInvalid();
-    _rclMesh._aclPointArray[ulPointPos].SetInvalid();
+    _rclMesh.PointArray()[ulPointPos].SetInvalid();
 
     _needsCleanup = true;
 
@@ -1055,7 +1060,7 @@ bool MeshTopoAlgorithm::IsCollapseEdgeLegal(const EdgeCollapse& ec) const
     // Check geometry
     std::vector<FacetIndex>::const_iterator it;
     for (it = ec._changeFacets.begin(); it != ec._changeFacets.end(); ++it) {
-        MeshFacet f = _rclMesh._aclFacetArray[*it];
+        MeshFacet f = _rclMesh.FacetArray()[*it];
         if (!f.IsValid()) {
             return false;
         }
@@ -1077,17 +1082,17 @@ bool MeshTopoAlgorithm::IsCollapseEdgeLegal(const EdgeCollapse& ec) const
     // If the data structure is valid and the algorithm works as expected
     // it should never happen to reject the edge-collapse here!
     for (it = ec._removeFacets.begin(); it != ec._removeFacets.end(); ++it) {
-        MeshFacet f = _rclMesh._aclFacetArray[*it];
+        MeshFacet f = _rclMesh.FacetArray()[*it];
         if (!f.IsValid()) {
             return false;
         }
     }
 
-    if (!_rclMesh._aclPointArray[ec._fromPoint].IsValid()) {
+    if (!_rclMesh.PointArray()[ec._fromPoint].IsValid()) {
         return false;
     }
 
-    if (!_rclMesh._aclPointArray[ec._toPoint].IsValid()) {
+    if (!_rclMesh.PointArray()[ec._toPoint].IsValid()) {
         return false;
     }
 
@@ -1098,7 +1103,7 @@ bool MeshTopoAlgorithm::CollapseEdge(const EdgeCollapse& ec)
 {
     std::vector<FacetIndex>::const_iterator it;
     for (it = ec._removeFacets.begin(); it != ec._removeFacets.end(); ++it) {
-        MeshFacet& f = _rclMesh._aclFacetArray[*it];
+        MeshFacet& f = _rclMesh.FacetArray()[*it];
         f.SetInvalid();
 
         // adjust the neighbourhood
@@ -1114,23 +1119,23 @@ bool MeshTopoAlgorithm::CollapseEdge(const EdgeCollapse& ec)
         }
 
         if (neighbours.size() == 2) {
-            MeshFacet& n1 = _rclMesh._aclFacetArray[neighbours[0]];
+            MeshFacet& n1 = _rclMesh.FacetArray()[neighbours[0]];
             n1.ReplaceNeighbour(*it, neighbours[1]);
-            MeshFacet& n2 = _rclMesh._aclFacetArray[neighbours[1]];
+            MeshFacet& n2 = _rclMesh.FacetArray()[neighbours[1]];
             n2.ReplaceNeighbour(*it, neighbours[0]);
         }
         else if (neighbours.size() == 1) {
-            MeshFacet& n1 = _rclMesh._aclFacetArray[neighbours[0]];
+            MeshFacet& n1 = _rclMesh.FacetArray()[neighbours[0]];
             n1.ReplaceNeighbour(*it, FACET_INDEX_MAX);
         }
     }
 
     for (it = ec._changeFacets.begin(); it != ec._changeFacets.end(); ++it) {
-        MeshFacet& f = _rclMesh._aclFacetArray[*it];
+        MeshFacet& f = _rclMesh.FacetArray()[*it];
         f.Transpose(ec._fromPoint, ec._toPoint);
     }
 
-    _rclMesh._aclPointArray[ec._fromPoint].SetInvalid();
+    _rclMesh.PointArray()[ec._fromPoint].SetInvalid();
 
     _needsCleanup = true;
     return true;
@@ -1138,7 +1143,7 @@ bool MeshTopoAlgorithm::CollapseEdge(const EdgeCollapse& ec)
 
 bool MeshTopoAlgorithm::CollapseFacet(FacetIndex ulFacetPos)
 {
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
     if (!rclF.IsValid()) {
         return false;  // the facet is marked invalid from a previous run
     }
@@ -1150,18 +1155,18 @@ bool MeshTopoAlgorithm::CollapseFacet(FacetIndex ulFacetPos)
 
     // move the vertex to the gravity center
     Base::Vector3f cCenter = _rclMesh.GetGravityPoint(rclF);
-    _rclMesh._aclPointArray[ulPointInd0] = cCenter;
+    _rclMesh.PointArray()[ulPointInd0] = cCenter;
 
     // set the new point indices for all facets that share one of the points to be deleted
     std::vector<FacetIndex> aRefs = GetFacetsToPoint(ulFacetPos, ulPointInd1);
     for (FacetIndex it : aRefs) {
-        MeshFacet& rFace = _rclMesh._aclFacetArray[it];
+        MeshFacet& rFace = _rclMesh.FacetArray()[it];
         rFace.Transpose(ulPointInd1, ulPointInd0);
     }
 
     aRefs = GetFacetsToPoint(ulFacetPos, ulPointInd2);
     for (FacetIndex it : aRefs) {
-        MeshFacet& rFace = _rclMesh._aclFacetArray[it];
+        MeshFacet& rFace = _rclMesh.FacetArray()[it];
         rFace.Transpose(ulPointInd2, ulPointInd0);
     }
 
@@ -1170,16 +1175,16 @@ bool MeshTopoAlgorithm::CollapseFacet(FacetIndex ulFacetPos)
         if (nbIndex == FACET_INDEX_MAX) {
             continue;
         }
-        MeshFacet& rclN = _rclMesh._aclFacetArray[nbIndex];
+        MeshFacet& rclN = _rclMesh.FacetArray()[nbIndex];
         unsigned short uNSide = rclN.Side(rclF);
 
         if (rclN._aulNeighbours[(uNSide + 1) % 3] != FACET_INDEX_MAX) {
-            _rclMesh._aclFacetArray[rclN._aulNeighbours[(uNSide + 1) % 3]].ReplaceNeighbour(
+            _rclMesh.FacetArray()[rclN._aulNeighbours[(uNSide + 1) % 3]].ReplaceNeighbour(
                 nbIndex,
                 rclN._aulNeighbours[(uNSide + 2) % 3]);
         }
         if (rclN._aulNeighbours[(uNSide + 2) % 3] != FACET_INDEX_MAX) {
-            _rclMesh._aclFacetArray[rclN._aulNeighbours[(uNSide + 2) % 3]].ReplaceNeighbour(
+            _rclMesh.FacetArray()[rclN._aulNeighbours[(uNSide + 2) % 3]].ReplaceNeighbour(
                 nbIndex,
                 rclN._aulNeighbours[(uNSide + 1) % 3]);
         }
@@ -1196,8 +1201,8 @@ bool MeshTopoAlgorithm::CollapseFacet(FacetIndex ulFacetPos)
     rclF._aulNeighbours[1] = FACET_INDEX_MAX;
     rclF._aulNeighbours[2] = FACET_INDEX_MAX;
     rclF.SetInvalid();
-    _rclMesh._aclPointArray[ulPointInd1].SetInvalid();
-    _rclMesh._aclPointArray[ulPointInd2].SetInvalid();
+    _rclMesh.PointArray()[ulPointInd1].SetInvalid();
+    _rclMesh.PointArray()[ulPointInd2].SetInvalid();
 
     _needsCleanup = true;
 
@@ -1209,10 +1214,10 @@ void MeshTopoAlgorithm::SplitFacet(FacetIndex ulFacetPos,
                                    const Base::Vector3f& rP2)
 {
     float fEps = MESH_MIN_EDGE_LEN;
-    MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
-    MeshPoint& rVertex0 = _rclMesh._aclPointArray[rFace._aulPoints[0]];
-    MeshPoint& rVertex1 = _rclMesh._aclPointArray[rFace._aulPoints[1]];
-    MeshPoint& rVertex2 = _rclMesh._aclPointArray[rFace._aulPoints[2]];
+    MeshFacet& rFace = _rclMesh.FacetArray()[ulFacetPos];
+    MeshPoint& rVertex0 = _rclMesh.PointArray()[rFace._aulPoints[0]];
+    MeshPoint& rVertex1 = _rclMesh.PointArray()[rFace._aulPoints[1]];
+    MeshPoint& rVertex2 = _rclMesh.PointArray()[rFace._aulPoints[2]];
 
     auto pointIndex = [=](const Base::Vector3f& rP) {
         unsigned short equalP = USHRT_MAX;
@@ -1253,11 +1258,11 @@ void MeshTopoAlgorithm::SplitFacetOnOneEdge(FacetIndex ulFacetPos, const Base::V
 {
     float fMinDist = FLOAT_MAX;
     unsigned short iEdgeNo = USHRT_MAX;
-    MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& rFace = _rclMesh.FacetArray()[ulFacetPos];
 
     for (unsigned short i = 0; i < 3; i++) {
-        Base::Vector3f cBase(_rclMesh._aclPointArray[rFace._aulPoints[i]]);
-        Base::Vector3f cEnd(_rclMesh._aclPointArray[rFace._aulPoints[(i + 1) % 3]]);
+        Base::Vector3f cBase(_rclMesh.PointArray()[rFace._aulPoints[i]]);
+        Base::Vector3f cEnd(_rclMesh.PointArray()[rFace._aulPoints[(i + 1) % 3]]);
         Base::Vector3f cDir = cEnd - cBase;
 
         float fDist = rP.DistanceToLine(cBase, cDir);
@@ -1284,11 +1289,11 @@ void MeshTopoAlgorithm::SplitFacetOnTwoEdges(FacetIndex ulFacetPos,
     // search for the matching edges
     unsigned short iEdgeNo1 = USHRT_MAX, iEdgeNo2 = USHRT_MAX;
     float fMinDist1 = FLOAT_MAX, fMinDist2 = FLOAT_MAX;
-    MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& rFace = _rclMesh.FacetArray()[ulFacetPos];
 
     for (unsigned short i = 0; i < 3; i++) {
-        Base::Vector3f cBase(_rclMesh._aclPointArray[rFace._aulPoints[i]]);
-        Base::Vector3f cEnd(_rclMesh._aclPointArray[rFace._aulPoints[(i + 1) % 3]]);
+        Base::Vector3f cBase(_rclMesh.PointArray()[rFace._aulPoints[i]]);
+        Base::Vector3f cEnd(_rclMesh.PointArray()[rFace._aulPoints[(i + 1) % 3]]);
         Base::Vector3f cDir = cEnd - cBase;
 
         float fDist = rP1.DistanceToLine(cBase, cDir);
@@ -1338,8 +1343,8 @@ void MeshTopoAlgorithm::SplitFacetOnTwoEdges(FacetIndex ulFacetPos,
     rFace._aulPoints[v1] = cntPts1;
     rFace._aulNeighbours[v0] = cntFts + 1;
 
-    float dist1 = Base::DistanceP2(_rclMesh._aclPointArray[p0], cP1);
-    float dist2 = Base::DistanceP2(_rclMesh._aclPointArray[p1], cP2);
+    float dist1 = Base::DistanceP2(_rclMesh.PointArray()[p0], cP1);
+    float dist2 = Base::DistanceP2(_rclMesh.PointArray()[p1], cP2);
 
     if (dist1 > dist2) {
         AddFacet(p0, p1, cntPts2, n0, cntFts + 1, n2);
@@ -1360,7 +1365,7 @@ void MeshTopoAlgorithm::SplitFacetOnTwoEdges(FacetIndex ulFacetPos,
     // split up the neighbour facets
     if (n1 != FACET_INDEX_MAX) {
         fixIndices.push_back(n1);
-        MeshFacet& rN = _rclMesh._aclFacetArray[n1];
+        MeshFacet& rN = _rclMesh.FacetArray()[n1];
         for (FacetIndex nbIndex : rN._aulNeighbours) {
             fixIndices.push_back(nbIndex);
         }
@@ -1369,7 +1374,7 @@ void MeshTopoAlgorithm::SplitFacetOnTwoEdges(FacetIndex ulFacetPos,
 
     if (n2 != FACET_INDEX_MAX) {
         fixIndices.push_back(n2);
-        MeshFacet& rN = _rclMesh._aclFacetArray[n2];
+        MeshFacet& rN = _rclMesh.FacetArray()[n2];
         for (FacetIndex nbIndex : rN._aulNeighbours) {
             fixIndices.push_back(nbIndex);
         }
@@ -1391,17 +1396,17 @@ void MeshTopoAlgorithm::SplitFacet(FacetIndex ulFacetPos,
                                    PointIndex P2,
                                    PointIndex Pn)
 {
-    MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& rFace = _rclMesh.FacetArray()[ulFacetPos];
     unsigned short side = rFace.Side(P1, P2);
     if (side != USHRT_MAX) {
         PointIndex V1 = rFace._aulPoints[(side + 1) % 3];
         PointIndex V2 = rFace._aulPoints[(side + 2) % 3];
-        FacetIndex size = _rclMesh._aclFacetArray.size();
+        FacetIndex size = _rclMesh.FacetArray().size();
 
         rFace._aulPoints[(side + 1) % 3] = Pn;
         FacetIndex N1 = rFace._aulNeighbours[(side + 1) % 3];
         if (N1 != FACET_INDEX_MAX) {
-            _rclMesh._aclFacetArray[N1].ReplaceNeighbour(ulFacetPos, size);
+            _rclMesh.FacetArray()[N1].ReplaceNeighbour(ulFacetPos, size);
         }
 
         rFace._aulNeighbours[(side + 1) % 3] = ulFacetPos;
@@ -1416,7 +1421,7 @@ void MeshTopoAlgorithm::AddFacet(PointIndex P1, PointIndex P2, PointIndex P3)
     facet._aulPoints[1] = P2;
     facet._aulPoints[2] = P3;
 
-    _rclMesh._aclFacetArray.push_back(facet);
+    _rclMesh.FacetArray().push_back(facet);
 }
 
 void MeshTopoAlgorithm::AddFacet(PointIndex P1,
@@ -1434,7 +1439,7 @@ void MeshTopoAlgorithm::AddFacet(PointIndex P1,
     facet._aulNeighbours[1] = N2;
     facet._aulNeighbours[2] = N3;
 
-    _rclMesh._aclFacetArray.push_back(facet);
+    _rclMesh.FacetArray().push_back(facet);
 }
 
 void MeshTopoAlgorithm::HarmonizeNeighbours(const std::vector<FacetIndex>& ulFacets)
@@ -1452,8 +1457,8 @@ void MeshTopoAlgorithm::HarmonizeNeighbours(FacetIndex facet1, FacetIndex facet2
         return;
     }
 
-    MeshFacet& rFace1 = _rclMesh._aclFacetArray[facet1];
-    MeshFacet& rFace2 = _rclMesh._aclFacetArray[facet2];
+    MeshFacet& rFace1 = _rclMesh.FacetArray()[facet1];
+    MeshFacet& rFace2 = _rclMesh.FacetArray()[facet2];
 
     unsigned short side = rFace1.Side(rFace2);
     if (side != USHRT_MAX) {
@@ -1470,19 +1475,19 @@ void MeshTopoAlgorithm::SplitNeighbourFacet(FacetIndex ulFacetPos,
                                             unsigned short uFSide,
                                             const Base::Vector3f& rPoint)
 {
-    MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& rclF = _rclMesh.FacetArray()[ulFacetPos];
 
     FacetIndex ulNeighbour = rclF._aulNeighbours[uFSide];
-    MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
+    MeshFacet& rclN = _rclMesh.FacetArray()[ulNeighbour];
 
     unsigned short uNSide = rclN.Side(rclF);
 
     PointIndex uPtInd = this->GetOrAddIndex(rPoint);
-    FacetIndex ulSize = _rclMesh._aclFacetArray.size();
+    FacetIndex ulSize = _rclMesh.FacetArray().size();
 
     // adjust the neighbourhood
     if (rclN._aulNeighbours[(uNSide + 1) % 3] != FACET_INDEX_MAX) {
-        _rclMesh._aclFacetArray[rclN._aulNeighbours[(uNSide + 1) % 3]].ReplaceNeighbour(ulNeighbour,
+        _rclMesh.FacetArray()[rclN._aulNeighbours[(uNSide + 1) % 3]].ReplaceNeighbour(ulNeighbour,
                                                                                         ulSize);
     }
 
@@ -1499,7 +1504,7 @@ void MeshTopoAlgorithm::SplitNeighbourFacet(FacetIndex ulFacetPos,
     rclN._aulNeighbours[(uNSide + 1) % 3] = ulSize;
 
     // insert new facet
-    _rclMesh._aclFacetArray.push_back(cNew);
+    _rclMesh.FacetArray().push_back(cNew);
 }
 
 #if 0
@@ -1508,19 +1513,19 @@ void MeshTopoAlgorithm::SplitNeighbourFacet(FacetIndex ulFacetPos,
 
   // facet [P1, Ei+1, P2]
   clFacet._aclPoints[0] = cP1;
-  clFacet._aclPoints[1] = _rclMesh._aclPointArray[rFace._aulPoints[(iEdgeNo1+1)%3]];
+  clFacet._aclPoints[1] = _rclMesh.PointArray()[rFace._aulPoints[(iEdgeNo1+1)%3]];
   clFacet._aclPoints[2] = cP2;
   clFacet.CalcNormal();
   _aclNewFacets.push_back(clFacet);
   // facet [P2, Ei+2, Ei]
   clFacet._aclPoints[0] = cP2;
-  clFacet._aclPoints[1] = _rclMesh._aclPointArray[rFace._aulPoints[(iEdgeNo1+2)%3]];
-  clFacet._aclPoints[2] = _rclMesh._aclPointArray[rFace._aulPoints[iEdgeNo1]];
+  clFacet._aclPoints[1] = _rclMesh.PointArray()[rFace._aulPoints[(iEdgeNo1+2)%3]];
+  clFacet._aclPoints[2] = _rclMesh.PointArray()[rFace._aulPoints[iEdgeNo1]];
   clFacet.CalcNormal();
   _aclNewFacets.push_back(clFacet);
   // facet [P2, Ei, P1]
   clFacet._aclPoints[0] = cP2;
-  clFacet._aclPoints[1] = _rclMesh._aclPointArray[rFace._aulPoints[iEdgeNo1]];
+  clFacet._aclPoints[1] = _rclMesh.PointArray()[rFace._aulPoints[iEdgeNo1]];
   clFacet._aclPoints[2] = cP1;
   clFacet.CalcNormal();
   _aclNewFacets.push_back(clFacet);
@@ -1528,23 +1533,23 @@ void MeshTopoAlgorithm::SplitNeighbourFacet(FacetIndex ulFacetPos,
 
 bool MeshTopoAlgorithm::RemoveDegeneratedFacet(FacetIndex index)
 {
-    if (index >= _rclMesh._aclFacetArray.size()) {
+    if (index >= _rclMesh.FacetArray().size()) {
         return false;
     }
-    MeshFacet& rFace = _rclMesh._aclFacetArray[index];
+    MeshFacet& rFace = _rclMesh.FacetArray()[index];
 
     // coincident corners (either topological or geometrical)
     for (int i = 0; i < 3; i++) {
-        const MeshPoint& rE0 = _rclMesh._aclPointArray[rFace._aulPoints[i]];
-        const MeshPoint& rE1 = _rclMesh._aclPointArray[rFace._aulPoints[(i + 1) % 3]];
+        const MeshPoint& rE0 = _rclMesh.PointArray()[rFace._aulPoints[i]];
+        const MeshPoint& rE1 = _rclMesh.PointArray()[rFace._aulPoints[(i + 1) % 3]];
         if (rE0 == rE1) {
             FacetIndex uN1 = rFace._aulNeighbours[(i + 1) % 3];
             FacetIndex uN2 = rFace._aulNeighbours[(i + 2) % 3];
             if (uN2 != FACET_INDEX_MAX) {
-                _rclMesh._aclFacetArray[uN2].ReplaceNeighbour(index, uN1);
+                _rclMesh.FacetArray()[uN2].ReplaceNeighbour(index, uN1);
             }
             if (uN1 != FACET_INDEX_MAX) {
-                _rclMesh._aclFacetArray[uN1].ReplaceNeighbour(index, uN2);
+                _rclMesh.FacetArray()[uN1].ReplaceNeighbour(index, uN2);
             }
 
             // isolate the face and remove it
@@ -1560,17 +1565,17 @@ bool MeshTopoAlgorithm::RemoveDegeneratedFacet(FacetIndex index)
     // P0 +----+------+P2
     //         P1
     for (int j = 0; j < 3; j++) {
-        Base::Vector3f cVec1 = _rclMesh._aclPointArray[rFace._aulPoints[(j + 1) % 3]]
-            - _rclMesh._aclPointArray[rFace._aulPoints[j]];
-        Base::Vector3f cVec2 = _rclMesh._aclPointArray[rFace._aulPoints[(j + 2) % 3]]
-            - _rclMesh._aclPointArray[rFace._aulPoints[j]];
+        Base::Vector3f cVec1 = _rclMesh.PointArray()[rFace._aulPoints[(j + 1) % 3]]
+            - _rclMesh.PointArray()[rFace._aulPoints[j]];
+        Base::Vector3f cVec2 = _rclMesh.PointArray()[rFace._aulPoints[(j + 2) % 3]]
+            - _rclMesh.PointArray()[rFace._aulPoints[j]];
 
         // adjust the neighbourhoods and point indices
         if (cVec1 * cVec2 < 0.0F) {
             FacetIndex uN1 = rFace._aulNeighbours[(j + 1) % 3];
             if (uN1 != FACET_INDEX_MAX) {
                 // get the neighbour and common edge side
-                MeshFacet& rNb = _rclMesh._aclFacetArray[uN1];
+                MeshFacet& rNb = _rclMesh.FacetArray()[uN1];
                 unsigned short side = rNb.Side(index);
 
                 // bend the point indices
@@ -1581,12 +1586,12 @@ bool MeshTopoAlgorithm::RemoveDegeneratedFacet(FacetIndex index)
                 FacetIndex uN2 = rFace._aulNeighbours[(j + 2) % 3];
                 rNb._aulNeighbours[side] = uN2;
                 if (uN2 != FACET_INDEX_MAX) {
-                    _rclMesh._aclFacetArray[uN2].ReplaceNeighbour(index, uN1);
+                    _rclMesh.FacetArray()[uN2].ReplaceNeighbour(index, uN1);
                 }
                 FacetIndex uN3 = rNb._aulNeighbours[(side + 1) % 3];
                 rFace._aulNeighbours[(j + 1) % 3] = uN3;
                 if (uN3 != FACET_INDEX_MAX) {
-                    _rclMesh._aclFacetArray[uN3].ReplaceNeighbour(uN1, index);
+                    _rclMesh.FacetArray()[uN3].ReplaceNeighbour(uN1, index);
                 }
                 rNb._aulNeighbours[(side + 1) % 3] = index;
                 rFace._aulNeighbours[(j + 2) % 3] = uN1;
@@ -1604,10 +1609,10 @@ bool MeshTopoAlgorithm::RemoveDegeneratedFacet(FacetIndex index)
 
 bool MeshTopoAlgorithm::RemoveCorruptedFacet(FacetIndex index)
 {
-    if (index >= _rclMesh._aclFacetArray.size()) {
+    if (index >= _rclMesh.FacetArray().size()) {
         return false;
     }
-    MeshFacet& rFace = _rclMesh._aclFacetArray[index];
+    MeshFacet& rFace = _rclMesh.FacetArray()[index];
 
     // coincident corners (topological)
     for (int i = 0; i < 3; i++) {
@@ -1615,10 +1620,10 @@ bool MeshTopoAlgorithm::RemoveCorruptedFacet(FacetIndex index)
             FacetIndex uN1 = rFace._aulNeighbours[(i + 1) % 3];
             FacetIndex uN2 = rFace._aulNeighbours[(i + 2) % 3];
             if (uN2 != FACET_INDEX_MAX) {
-                _rclMesh._aclFacetArray[uN2].ReplaceNeighbour(index, uN1);
+                _rclMesh.FacetArray()[uN2].ReplaceNeighbour(index, uN1);
             }
             if (uN1 != FACET_INDEX_MAX) {
-                _rclMesh._aclFacetArray[uN1].ReplaceNeighbour(index, uN2);
+                _rclMesh.FacetArray()[uN1].ReplaceNeighbour(index, uN2);
             }
 
             // isolate the face and remove it
@@ -1668,7 +1673,7 @@ void MeshTopoAlgorithm::FillupHoles(int level,
 
     MeshFacetArray newFacets;
     MeshPointArray newPoints;
-    unsigned long numberOfOldPoints = _rclMesh._aclPointArray.size();
+    unsigned long numberOfOldPoints = _rclMesh.PointArray().size();
     for (const auto& aBorder : aBorders) {
         MeshFacetArray cFacets;
         MeshPointArray cPoints;
@@ -1708,7 +1713,7 @@ void MeshTopoAlgorithm::FillupHoles(int level,
     }
 
     // insert new points and faces into the mesh structure
-    _rclMesh._aclPointArray.insert(_rclMesh._aclPointArray.end(),
+    _rclMesh.PointArray().insert(_rclMesh.PointArray().end(),
                                    newPoints.begin(),
                                    newPoints.end());
     for (const auto& newPoint : newPoints) {
@@ -1775,13 +1780,13 @@ void MeshTopoAlgorithm::HarmonizeNormals()
 {
     std::vector<FacetIndex> uIndices = MeshEvalOrientation(_rclMesh).GetIndices();
     for (FacetIndex index : uIndices) {
-        _rclMesh._aclFacetArray[index].FlipNormal();
+        _rclMesh.FacetArray()[index].FlipNormal();
     }
 }
 
 void MeshTopoAlgorithm::FlipNormals()
 {
-    for (auto i = _rclMesh._aclFacetArray.begin(); i < _rclMesh._aclFacetArray.end(); ++i) {
+    for (auto i = _rclMesh.FacetArray().begin(); i < _rclMesh.FacetArray().end(); ++i) {
         i->FlipNormal();
     }
 }
@@ -150,9 +150,9 @@ bool MeshTrimming::HasIntersection(const MeshGeomFacet& rclFacet) const
 
 bool MeshTrimming::PolygonContainsCompleteFacet(bool bInner, FacetIndex ulIndex) const
 {
-    const MeshFacet& rclFacet = myMesh._aclFacetArray[ulIndex];
+    const MeshFacet& rclFacet = myMesh.FacetArray()[ulIndex];
     for (PointIndex ptIndex : rclFacet._aulPoints) {
-        const MeshPoint& rclFacPt = myMesh._aclPointArray[ptIndex];
+        const MeshPoint& rclFacPt = myMesh.PointArray()[ptIndex];
         Base::Vector3f clPt = (*myProj)(rclFacPt);
         if (myPoly.Contains(Base::Vector2d(clPt.x, clPt.y)) != bInner) {
             return false;
@@ -384,13 +384,13 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
 
     // no intersection point found => triangle is only touched at a corner point
     if (raclPoints.empty()) {
-        MeshFacet& facet = myMesh._aclFacetArray[ulFacetPos];
+        MeshFacet& facet = myMesh.FacetArray()[ulFacetPos];
         int iCtPtsIn = 0;
         int iCtPtsOn = 0;
         Base::Vector3f clFacPnt;
         Base::Vector2d clProjPnt;
         for (PointIndex ptIndex : facet._aulPoints) {
-            clFacPnt = (*myProj)(myMesh._aclPointArray[ptIndex]);
+            clFacPnt = (*myProj)(myMesh.PointArray()[ptIndex]);
             clProjPnt = Base::Vector2d(clFacPnt.x, clFacPnt.y);
             if (myPoly.Intersect(clProjPnt, double(MESH_MIN_PT_DIST))) {
                 ++iCtPtsOn;
@@ -444,7 +444,7 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
     }
     // two intersection points found
     else if (raclPoints.size() == 2) {
-        MeshFacet& facet = myMesh._aclFacetArray[ulFacetPos];
+        MeshFacet& facet = myMesh.FacetArray()[ulFacetPos];
         AdjustFacet(facet, iSide);
         Base::Vector3f clP1(raclPoints[0]), clP2(raclPoints[1]);
 
@@ -459,7 +459,7 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
         Base::Vector3f clFacPnt;
         Base::Vector2d clProjPnt;
         for (PointIndex ptIndex : facet._aulPoints) {
-            clFacPnt = (*myProj)(myMesh._aclPointArray[ptIndex]);
+            clFacPnt = (*myProj)(myMesh.PointArray()[ptIndex]);
             clProjPnt = Base::Vector2d(clFacPnt.x, clFacPnt.y);
             if (myPoly.Contains(clProjPnt) == myInner) {
                 ++iCtPts;
@@ -469,18 +469,18 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
         if (iCtPts == 2) {
             // erstes Dreieck
             clFac._aclPoints[0] = clP1;
-            clFac._aclPoints[1] = myMesh._aclPointArray[facet._aulPoints[2]];
+            clFac._aclPoints[1] = myMesh.PointArray()[facet._aulPoints[2]];
             clFac._aclPoints[2] = clP2;
             aclNewFacets.push_back(clFac);
         }
         else if (iCtPts == 1) {
             // erstes Dreieck
-            clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[0]];
-            clFac._aclPoints[1] = myMesh._aclPointArray[facet._aulPoints[1]];
+            clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[0]];
+            clFac._aclPoints[1] = myMesh.PointArray()[facet._aulPoints[1]];
             clFac._aclPoints[2] = clP2;
             aclNewFacets.push_back(clFac);
             // zweites Dreieck
-            clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[1]];
+            clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[1]];
             clFac._aclPoints[1] = clP1;
             clFac._aclPoints[2] = clP2;
             aclNewFacets.push_back(clFac);
@@ -491,7 +491,7 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
     }
     // four intersection points found
     else if (raclPoints.size() == 4) {
-        MeshFacet& facet = myMesh._aclFacetArray[ulFacetPos];
+        MeshFacet& facet = myMesh.FacetArray()[ulFacetPos];
         AdjustFacet(facet, iSide);
 
         clFac = myMesh.GetFacet(ulFacetPos);
@@ -504,7 +504,7 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
         Base::Vector3f clFacPnt;
         Base::Vector2d clProjPnt;
         for (PointIndex ptIndex : facet._aulPoints) {
-            clFacPnt = (*myProj)(myMesh._aclPointArray[ptIndex]);
+            clFacPnt = (*myProj)(myMesh.PointArray()[ptIndex]);
             clProjPnt = Base::Vector2d(clFacPnt.x, clFacPnt.y);
             if (myPoly.Contains(clProjPnt) == myInner) {
                 ++iCtPts;
@@ -587,17 +587,17 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
         // now create the new facets
         if (iCtPts == 0) {
             // insert first facet
-            clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[0]];
-            clFac._aclPoints[1] = myMesh._aclPointArray[facet._aulPoints[1]];
+            clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[0]];
+            clFac._aclPoints[1] = myMesh.PointArray()[facet._aulPoints[1]];
             clFac._aclPoints[2] = clP1;
             aclNewFacets.push_back(clFac);
             // insert second facet
-            clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[0]];
+            clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[0]];
             clFac._aclPoints[1] = clP1;
             clFac._aclPoints[2] = clP2;
             aclNewFacets.push_back(clFac);
             // finally insert third facet
-            clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[2]];
+            clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[2]];
             clFac._aclPoints[1] = clP4;
             clFac._aclPoints[2] = clP3;
             aclNewFacets.push_back(clFac);
@@ -606,17 +606,17 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
             // insert first facet
             clFac._aclPoints[0] = clP1;
             clFac._aclPoints[1] = clP2;
-            clFac._aclPoints[2] = myMesh._aclPointArray[facet._aulPoints[1]];
+            clFac._aclPoints[2] = myMesh.PointArray()[facet._aulPoints[1]];
             aclNewFacets.push_back(clFac);
             // finally insert second facet
             clFac._aclPoints[0] = clP4;
             clFac._aclPoints[1] = clP3;
-            clFac._aclPoints[2] = myMesh._aclPointArray[facet._aulPoints[2]];
+            clFac._aclPoints[2] = myMesh.PointArray()[facet._aulPoints[2]];
             aclNewFacets.push_back(clFac);
         }
         else if (iCtPts == 2) {
             // insert first facet
-            clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[0]];
+            clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[0]];
             clFac._aclPoints[1] = clP2;
             clFac._aclPoints[2] = clP4;
             aclNewFacets.push_back(clFac);
@@ -665,16 +665,16 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
     Base::Vector3f clP1(raclPoints[0]);
     Base::Vector3f clP2(raclPoints[1]);
 
-    MeshFacet& facet = myMesh._aclFacetArray[ulFacetPos];
+    MeshFacet& facet = myMesh.FacetArray()[ulFacetPos];
     AdjustFacet(facet, iSide);
 
     MeshGeomFacet clFac;
 
-    float fDistEdgeP1 = clP1.DistanceToLineSegment(myMesh._aclPointArray[facet._aulPoints[1]],
-                                                   myMesh._aclPointArray[facet._aulPoints[2]])
+    float fDistEdgeP1 = clP1.DistanceToLineSegment(myMesh.PointArray()[facet._aulPoints[1]],
+                                                   myMesh.PointArray()[facet._aulPoints[2]])
                             .Length();
-    float fDistEdgeP2 = clP2.DistanceToLineSegment(myMesh._aclPointArray[facet._aulPoints[1]],
-                                                   myMesh._aclPointArray[facet._aulPoints[2]])
+    float fDistEdgeP2 = clP2.DistanceToLineSegment(myMesh.PointArray()[facet._aulPoints[1]],
+                                                   myMesh.PointArray()[facet._aulPoints[2]])
                             .Length();
 
     // swap P1 and P2
@@ -689,7 +689,7 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
     Base::Vector3f clFacPnt;
     Base::Vector2d clProjPnt;
     for (PointIndex ptIndex : facet._aulPoints) {
-        clFacPnt = (*myProj)(myMesh._aclPointArray[ptIndex]);
+        clFacPnt = (*myProj)(myMesh.PointArray()[ptIndex]);
         clProjPnt = Base::Vector2d(clFacPnt.x, clFacPnt.y);
         if (myPoly.Contains(clProjPnt) == myInner) {
             ++iCtPts;
@@ -711,28 +711,28 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
     else if (iCtPts == 2) {
         // first facet
         clFac._aclPoints[0] = clP1;
-        clFac._aclPoints[1] = myMesh._aclPointArray[facet._aulPoints[2]];
+        clFac._aclPoints[1] = myMesh.PointArray()[facet._aulPoints[2]];
         clFac._aclPoints[2] = clP3;
         aclNewFacets.push_back(clFac);
         // second facet
-        clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[2]];
+        clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[2]];
         clFac._aclPoints[1] = clP2;
         clFac._aclPoints[2] = clP3;
         aclNewFacets.push_back(clFac);
     }
     else if (iCtPts == 1) {
         // first facet
-        clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[0]];
-        clFac._aclPoints[1] = myMesh._aclPointArray[facet._aulPoints[1]];
+        clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[0]];
+        clFac._aclPoints[1] = myMesh.PointArray()[facet._aulPoints[1]];
         clFac._aclPoints[2] = clP3;
         aclNewFacets.push_back(clFac);
         // second facet
-        clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[1]];
+        clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[1]];
         clFac._aclPoints[1] = clP1;
         clFac._aclPoints[2] = clP3;
         aclNewFacets.push_back(clFac);
         // third facet
-        clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[0]];
+        clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[0]];
         clFac._aclPoints[1] = clP3;
         clFac._aclPoints[2] = clP2;
         aclNewFacets.push_back(clFac);
@@ -745,23 +745,23 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
             clP2 = tmp;
         }
         // first facet
-        clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[2]];
+        clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[2]];
         clFac._aclPoints[1] = clP3;
         clFac._aclPoints[2] = clP2;
         aclNewFacets.push_back(clFac);
         // second facet
-        clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[2]];
-        clFac._aclPoints[1] = myMesh._aclPointArray[facet._aulPoints[0]];
+        clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[2]];
+        clFac._aclPoints[1] = myMesh.PointArray()[facet._aulPoints[0]];
         clFac._aclPoints[2] = clP3;
         aclNewFacets.push_back(clFac);
         // third facet
-        clFac._aclPoints[0] = myMesh._aclPointArray[facet._aulPoints[0]];
-        clFac._aclPoints[1] = myMesh._aclPointArray[facet._aulPoints[1]];
+        clFac._aclPoints[0] = myMesh.PointArray()[facet._aulPoints[0]];
+        clFac._aclPoints[1] = myMesh.PointArray()[facet._aulPoints[1]];
         clFac._aclPoints[2] = clP3;
         aclNewFacets.push_back(clFac);
         // and finally fourth facet
         clFac._aclPoints[0] = clP3;
-        clFac._aclPoints[1] = myMesh._aclPointArray[facet._aulPoints[1]];
+        clFac._aclPoints[1] = myMesh.PointArray()[facet._aulPoints[1]];
         clFac._aclPoints[2] = clP1;
         aclNewFacets.push_back(clFac);
     }
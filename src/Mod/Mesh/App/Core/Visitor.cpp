@@ -38,24 +38,24 @@ unsigned long MeshKernel::VisitNeighbourFacets(MeshFacetVisitor& rclFVisitor,
                                                FacetIndex ulStartFacet) const
 {
     unsigned long ulVisited = 0, ulLevel = 0;
-    unsigned long ulCount = _aclFacetArray.size();
+    unsigned long ulCount = FacetArray().size();
     std::vector<FacetIndex> clCurrentLevel, clNextLevel;
     std::vector<FacetIndex>::iterator clCurrIter;
     MeshFacetArray::_TConstIterator clCurrFacet, clNBFacet;
 
-    if (ulStartFacet >= _aclFacetArray.size()) {
+    if (ulStartFacet >= FacetArray().size()) {
         return 0;
     }
 
     // pick up start point
     clCurrentLevel.push_back(ulStartFacet);
-    _aclFacetArray[ulStartFacet].SetFlag(MeshFacet::VISIT);
+    FacetArray()[ulStartFacet].SetFlag(MeshFacet::VISIT);
 
     // as long as free neighbours
     while (!clCurrentLevel.empty()) {
         // visit all neighbours of the current level
         for (clCurrIter = clCurrentLevel.begin(); clCurrIter < clCurrentLevel.end(); ++clCurrIter) {
-            clCurrFacet = _aclFacetArray.begin() + *clCurrIter;
+            clCurrFacet = FacetArray().begin() + *clCurrIter;
 
             // visit all neighbours of the current level if not yet done
             for (unsigned short i = 0; i < 3; i++) {
@@ -68,7 +68,7 @@ unsigned long MeshKernel::VisitNeighbourFacets(MeshFacetVisitor& rclFVisitor,
                     continue;  // error in data structure
                 }
 
-                clNBFacet = _aclFacetArray.begin() + j;
+                clNBFacet = FacetArray().begin() + j;
 
                 if (!rclFVisitor.AllowVisit(*clNBFacet, *clCurrFacet, j, ulLevel, i)) {
                     continue;
@@ -100,11 +100,11 @@ unsigned long MeshKernel::VisitNeighbourFacetsOverCorners(MeshFacetVisitor& rclF
 {
     unsigned long ulVisited = 0, ulLevel = 0;
     MeshRefPointToFacets clRPF(*this);
-    const MeshFacetArray& raclFAry = _aclFacetArray;
+    const MeshFacetArray& raclFAry = FacetArray();
     MeshFacetArray::_TConstIterator pFBegin = raclFAry.begin();
     std::vector<FacetIndex> aclCurrentLevel, aclNextLevel;
 
-    if (ulStartFacet >= _aclFacetArray.size()) {
+    if (ulStartFacet >= FacetArray().size()) {
         return 0;
     }
 
@@ -149,7 +149,7 @@ unsigned long MeshKernel::VisitNeighbourPoints(MeshPointVisitor& rclPVisitor,
     unsigned long ulVisited = 0, ulLevel = 0;
     std::vector<PointIndex> aclCurrentLevel, aclNextLevel;
     std::vector<PointIndex>::iterator clCurrIter;
-    MeshPointArray::_TConstIterator pPBegin = _aclPointArray.begin();
+    MeshPointArray::_TConstIterator pPBegin = PointArray().begin();
     MeshRefPointToPoints clNPs(*this);
 
     aclCurrentLevel.push_back(ulStartPoint);
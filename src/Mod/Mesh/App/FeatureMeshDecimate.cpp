@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#include <Base/Tools.h>
+
+#include "FeatureMeshDecimate.h"
+
+
+using namespace Mesh;
+
+
+PROPERTY_SOURCE(Mesh::Decimate, Mesh::Feature)
+
+Decimate::Decimate()
+{
+    ADD_PROPERTY(Source, (nullptr));
+    ADD_PROPERTY(TargetSize, (0));
+    ADD_PROPERTY(MaxError, (FLOAT_MAX));
+    ADD_PROPERTY(LockBoundary, (false));
+    ADD_PROPERTY(FeatureAngle, (0.0));
+}
+
+short Decimate::mustExecute() const
+{
+    if (Source.isTouched() || TargetSize.isTouched() || MaxError.isTouched()
+        || LockBoundary.isTouched() || FeatureAngle.isTouched()) {
+        return 1;
+    }
+    return 0;
+}
+
+App::DocumentObjectExecReturn* Decimate::execute()
+{
+    App::DocumentObject* link = Source.getValue();
+    if (!link) {
+        return new App::DocumentObjectExecReturn("No mesh linked");
+    }
+    App::Property* prop = link->getPropertyByName("Mesh");
+    if (prop && prop->is<Mesh::PropertyMeshKernel>()) {
+        Mesh::PropertyMeshKernel* kernel = static_cast<Mesh::PropertyMeshKernel*>(prop);
+        std::unique_ptr<MeshObject> mesh(new MeshObject);
+        *mesh = kernel->getValue();
+        mesh->decimate(TargetSize.getValue(),
+                       static_cast<float>(MaxError.getValue()),
+                       LockBoundary.getValue(),
+                       Base::toRadians(static_cast<float>(FeatureAngle.getValue())));
+        this->Mesh.setValuePtr(mesh.release());
+    }
+
+    return App::DocumentObject::StdReturn;
+}
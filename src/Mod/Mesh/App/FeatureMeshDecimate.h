@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_FEATURE_MESH_DECIMATE_H
+#define MESH_FEATURE_MESH_DECIMATE_H
+
+#include <App/PropertyLinks.h>
+#include <App/PropertyUnits.h>
+
+#include "MeshFeature.h"
+
+
+namespace Mesh
+{
+
+/**
+ * The Decimate class reduces the number of facets of the attached mesh by quadric edge collapses.
+ */
+class MeshExport Decimate: public Mesh::Feature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Mesh::Decimate);
+
+public:
+    /// Constructor
+    Decimate();
+
+    /** @name Properties */
+    //@{
+    App::PropertyLink Source;
+    App::PropertyInteger TargetSize;
+    App::PropertyFloat MaxError;
+    App::PropertyBool LockBoundary;
+    App::PropertyAngle FeatureAngle;
+    //@}
+
+    /** @name methods override Feature */
+    //@{
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    short mustExecute() const override;
+    //@}
+};
+
+}  // namespace Mesh
+
+
+#endif  // MESH_FEATURE_MESH_DECIMATE_H
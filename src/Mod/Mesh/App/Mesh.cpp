@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <boost/core/ignore_unused.hpp>
 #include <sstream>
 #endif
 
@@ -379,7 +380,12 @@ void MeshObject::Save(Base::Writer& /*writer*/) const
 
 void MeshObject::SaveDocFile(Base::Writer& writer) const
 {
-    _kernel.Write(writer.Stream());
+    if (writer.getMode("CompressedMesh")) {
+        _kernel.WriteCompressed(writer.Stream());
+    }
+    else {
+        _kernel.Write(writer.Stream());
+    }
 }
 
 void MeshObject::Restore(Base::XMLReader& /*reader*/)
@@ -521,26 +527,44 @@ void MeshObject::load(std::istream& in)
 {
     _kernel.Read(in);
     this->_segments.clear();
+    checkAfterLoad(_kernel).report();
+}
 
+MeshObject::LoadCheck MeshObject::checkAfterLoad(MeshCore::MeshKernel& kernel)
+{
+    LoadCheck check;
 #ifndef FC_DEBUG
     try {
-        MeshCore::MeshEvalNeighbourhood nb(_kernel);
+        MeshCore::MeshEvalNeighbourhood nb(kernel);
         if (!nb.Evaluate()) {
-            Base::Console().Warning("Errors in neighbourhood of mesh found...");
-            _kernel.RebuildNeighbours();
-            Base::Console().Warning("fixed\n");
+            kernel.RebuildNeighbours();
+            check.fixedNeighbourhood = true;
         }
 
-        MeshCore::MeshEvalTopology eval(_kernel);
-        if (!eval.Evaluate()) {
-            Base::Console().Warning("The mesh data structure has some defects\n");
-        }
+        MeshCore::MeshEvalTopology eval(kernel);
+        check.hasDefects = !eval.Evaluate();
     }
     catch (const Base::MemoryException&) {
         // ignore memory exceptions and continue
-        Base::Console().Log("Check for defects in mesh data structure failed\n");
+        check.checkFailed = true;
     }
+#else
+    boost::ignore_unused(kernel);
 #endif
+    return check;
+}
+
+void MeshObject::LoadCheck::report() const
+{
+    if (fixedNeighbourhood) {
+        Base::Console().Warning("Errors in neighbourhood of mesh found...fixed\n");
+    }
+    if (hasDefects) {
+        Base::Console().Warning("The mesh data structure has some defects\n");
+    }
+    if (checkFailed) {
+        Base::Console().Log("Check for defects in mesh data structure failed\n");
+    }
 }
 
 void MeshObject::writeInventor(std::ostream& str, float creaseangle) const
@@ -1084,8 +1108,21 @@ void MeshObject::decimate(float fTolerance, float fReduction)
 
 void MeshObject::decimate(int targetSize)
 {
-    MeshCore::MeshSimplify dm(this->_kernel);
-    dm.simplify(targetSize);
+    decimate(targetSize, FLOAT_MAX, false, 0.0F);
+}
+
+void MeshObject::decimate(int targetSize, float maxError, bool lockBoundary, float featureAngle)
+{
+    MeshCore::MeshQuadricDecimation::Parameters params;
+    params.targetSize = static_cast<std::size_t>(std::max(targetSize, 0));
+    params.maxError = maxError;
+    params.lockBoundary = lockBoundary;
+    params.featureAngle = featureAngle;
+
+    MeshCore::MeshQuadricDecimation dm(this->_kernel);
+    if (dm.Decimate(params) > 0) {
+        this->_segments.clear();
+    }
 }
 
 Base::Vector3d MeshObject::getPointNormal(PointIndex index) const
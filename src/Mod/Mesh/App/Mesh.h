@@ -209,6 +209,19 @@ public:
     // Save and load in internal format
     void save(std::ostream&) const;
     void load(std::istream&);
+    /// The result of checkAfterLoad()
+    struct LoadCheck
+    {
+        bool fixedNeighbourhood {false};
+        bool hasDefects {false};
+        bool checkFailed {false};
+        /// Reports the result to the console
+        void report() const;
+    };
+    /** Checks a mesh read in internal format like load() does and repairs its neighbourhood.
+     * Nothing is reported, so the check can be done by a worker thread.
+     */
+    static LoadCheck checkAfterLoad(MeshCore::MeshKernel& kernel);
     void writeInventor(std::ostream& str, float creaseangle = 0.0F) const;
     //@}
 
@@ -264,6 +277,12 @@ public:
     void smooth(int iterations, float d_max);
     void decimate(float fTolerance, float fReduction);
     void decimate(int targetSize);
+    /** Decimates the mesh by quadric edge collapses until it has \a targetSize facets or the
+     * error of the next collapse exceeds \a maxError. With \a lockBoundary the points of open
+     * edges are kept, a \a featureAngle (in radian) higher than zero keeps the points of edges
+     * whose facet normals enclose a higher angle.
+     */
+    void decimate(int targetSize, float maxError, bool lockBoundary, float featureAngle);
     Base::Vector3d getPointNormal(PointIndex) const;
     std::vector<Base::Vector3d> getPointNormals() const;
     void crossSections(const std::vector<TPlane>&,
@@ -22,6 +22,9 @@
 
 #include "PreCompiled.h"
 
+#include <Base/PyWrapParseTupleAndKeywords.h>
+#include <Base/Tools.h>
+
 #include "MeshFeature.h"
 // inclusion of the generated files (generated out of MeshFeaturePy.xml)
 // clang-format off
@@ -90,11 +93,11 @@ PyObject* MeshFeaturePy::smooth(PyObject* args)
     Py_Return;
 }
 
-PyObject* MeshFeaturePy::decimate(PyObject* args)
+PyObject* MeshFeaturePy::decimate(PyObject* args, PyObject* kwds)
 {
     float fTol {};
     float fRed {};
-    if (PyArg_ParseTuple(args, "ff", &fTol, &fRed)) {
+    if (!kwds && PyArg_ParseTuple(args, "ff", &fTol, &fRed)) {
         PY_TRY
         {
             Mesh::Feature* obj = getFeaturePtr();
@@ -109,12 +112,28 @@ PyObject* MeshFeaturePy::decimate(PyObject* args)
 
     PyErr_Clear();
     int targetSize {};
-    if (PyArg_ParseTuple(args, "i", &targetSize)) {
+    float maxError = FLOAT_MAX;
+    PyObject* lockBoundary = Py_False;
+    float featureAngle = 0.0F;
+    static const std::array<const char*, 5>
+        keywords_decimate {"TargetSize", "MaxError", "LockBoundary", "FeatureAngle", nullptr};
+    if (Base::Wrapped_ParseTupleAndKeywords(args,
+                                            kwds,
+                                            "i|fO!f",
+                                            keywords_decimate,
+                                            &targetSize,
+                                            &maxError,
+                                            &PyBool_Type,
+                                            &lockBoundary,
+                                            &featureAngle)) {
         PY_TRY
         {
             Mesh::Feature* obj = getFeaturePtr();
             MeshObject* kernel = obj->Mesh.startEditing();
-            kernel->decimate(targetSize);
+            kernel->decimate(targetSize,
+                             maxError,
+                             Base::asBoolean(lockBoundary),
+                             Base::toRadians(featureAngle));
             obj->Mesh.finishEditing();
         }
         PY_CATCH;
@@ -123,7 +142,9 @@ PyObject* MeshFeaturePy::decimate(PyObject* args)
     }
 
     PyErr_SetString(PyExc_ValueError,
-                    "decimate(tolerance=float, reduction=float) or decimate(targetSize=int)");
+                    "decimate(tolerance=float, reduction=float) or "
+                    "decimate(TargetSize=int, [MaxError=float, LockBoundary=bool, "
+                    "FeatureAngle=float])");
     return nullptr;
 }
 
@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 
+#include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Reader.h>
@@ -153,6 +154,11 @@ void PropertyNormalList::SaveDocFile(Base::Writer& writer) const
     }
 }
 
+bool PropertyNormalList::canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const
+{
+    return true;
+}
+
 void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
 {
     Base::InputStream str(reader);
@@ -346,6 +352,11 @@ void PropertyCurvatureList::SaveDocFile(Base::Writer& writer) const
     }
 }
 
+bool PropertyCurvatureList::canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const
+{
+    return true;
+}
+
 void PropertyCurvatureList::RestoreDocFile(Base::Reader& reader)
 {
     Base::InputStream str(reader);
@@ -637,6 +648,11 @@ void PropertyMaterial::SaveDocFile(Base::Writer& writer) const
     saveFloat(_material.transparency);
 }
 
+bool PropertyMaterial::canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const
+{
+    return true;
+}
+
 void PropertyMaterial::RestoreDocFile(Base::Reader& reader)
 {
     Base::InputStream str(reader);
@@ -778,26 +794,36 @@ void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 
 const MeshObject& PropertyMeshKernel::getValue() const
 {
+    restoreDeferred();
     return *_meshObject;
 }
 
 const MeshObject* PropertyMeshKernel::getValuePtr() const
 {
+    restoreDeferred();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 const Data::ComplexGeoData* PropertyMeshKernel::getComplexData() const
+{
+    restoreDeferred();
+    return peekComplexData();
+}
+
+const Data::ComplexGeoData* PropertyMeshKernel::peekComplexData() const
 {
     return static_cast<MeshObject*>(_meshObject);
 }
 
 Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
 {
+    restoreDeferred();
     return _meshObject->getBoundBox();
 }
 
 unsigned int PropertyMeshKernel::getMemSize() const
 {
+    restoreDeferred();
     unsigned int size = 0;
     size += _meshObject->getMemSize();
 
@@ -845,6 +871,7 @@ Base::Matrix4D PropertyMeshKernel::getTransform() const
 
 PyObject* PropertyMeshKernel::getPyObject()
 {
+    restoreDeferred();
     if (!meshPyObject) {
         meshPyObject = new MeshPy(
             &*_meshObject);  // Lgtm[cpp/resource-not-released-in-destructor] ** Not destroyed in
@@ -882,6 +909,7 @@ void PropertyMeshKernel::setPyObject(PyObject* value)
 
 void PropertyMeshKernel::Save(Base::Writer& writer) const
 {
+    restoreDeferred();
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Mesh>" << std::endl;
         MeshCore::MeshOutput saver(_meshObject->getKernel());
@@ -921,7 +949,19 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
 
 void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 {
-    _meshObject->save(writer.Stream());
+    restoreDeferred();
+    // RestoreDocFile() reads both formats
+    if (writer.getMode("CompressedMesh")) {
+        _meshObject->getKernel().WriteCompressed(writer.Stream());
+    }
+    else {
+        _meshObject->save(writer.Stream());
+    }
+}
+
+bool PropertyMeshKernel::canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const
+{
+    return true;
 }
 
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
@@ -931,8 +971,40 @@ void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+bool PropertyMeshKernel::canRestoreDocFileConcurrently() const
+{
+    return true;
+}
+
+std::function<void()> PropertyMeshKernel::RestoreDocFileConcurrently(Base::Reader& reader)
+{
+    // Read and check the mesh like MeshObject::load() does but only report
+    // the messages when the data is applied
+    auto kernel = std::make_shared<MeshCore::MeshKernel>();
+    kernel->Read(reader);
+    MeshObject::LoadCheck check = MeshObject::checkAfterLoad(*kernel);
+
+    return [this, kernel, check]() {
+        check.report();
+        aboutToSetValue();
+        _meshObject->swap(*kernel);
+        hasSetValue();
+    };
+}
+
+bool PropertyMeshKernel::canRestoreDocFileDeferred() const
+{
+    return true;
+}
+
+void PropertyMeshKernel::RestoreDocFileDeferred(Base::Reader& reader)
+{
+    _meshObject->load(reader);
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
+    restoreDeferred();
     // Note: Copy the content, do NOT reference the same mesh object
     PropertyMeshKernel* prop = new PropertyMeshKernel();
     *(prop->_meshObject) = *(this->_meshObject);
@@ -84,6 +84,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
 
     void SaveDocFile(Base::Writer& writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
     App::Property* Copy() const override;
@@ -157,6 +158,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
 
     void SaveDocFile(Base::Writer& writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
     /** @name Python interface */
@@ -213,6 +215,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
 
     void SaveDocFile(Base::Writer& writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
     const char* getEditorName() const override;
@@ -314,12 +317,20 @@ public:
     void Restore(Base::XMLReader& reader) override;
 
     void SaveDocFile(Base::Writer& writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canRestoreDocFileConcurrently() const override;
+    std::function<void()> RestoreDocFileConcurrently(Base::Reader& reader) override;
+    bool canRestoreDocFileDeferred() const override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
+protected:
+    const Data::ComplexGeoData* peekComplexData() const override;
+    void RestoreDocFileDeferred(Base::Reader& reader) override;
+
 private:
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
@@ -2056,11 +2056,11 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
     Py_Return;
 }
 
-PyObject* MeshPy::decimate(PyObject* args)
+PyObject* MeshPy::decimate(PyObject* args, PyObject* kwds)
 {
     float fTol {};
     float fRed {};
-    if (PyArg_ParseTuple(args, "ff", &fTol, &fRed)) {
+    if (!kwds && PyArg_ParseTuple(args, "ff", &fTol, &fRed)) {
         PY_TRY
         {
             getMeshObjectPtr()->decimate(fTol, fRed);
@@ -2072,10 +2072,26 @@ PyObject* MeshPy::decimate(PyObject* args)
 
     PyErr_Clear();
     int targetSize {};
-    if (PyArg_ParseTuple(args, "i", &targetSize)) {
+    float maxError = FLOAT_MAX;
+    PyObject* lockBoundary = Py_False;
+    float featureAngle = 0.0F;
+    static const std::array<const char*, 5>
+        keywords_decimate {"TargetSize", "MaxError", "LockBoundary", "FeatureAngle", nullptr};
+    if (Base::Wrapped_ParseTupleAndKeywords(args,
+                                            kwds,
+                                            "i|fO!f",
+                                            keywords_decimate,
+                                            &targetSize,
+                                            &maxError,
+                                            &PyBool_Type,
+                                            &lockBoundary,
+                                            &featureAngle)) {
         PY_TRY
         {
-            getMeshObjectPtr()->decimate(targetSize);
+            getMeshObjectPtr()->decimate(targetSize,
+                                         maxError,
+                                         Base::asBoolean(lockBoundary),
+                                         Base::toRadians(featureAngle));
         }
         PY_CATCH;
 
@@ -2083,7 +2099,9 @@ PyObject* MeshPy::decimate(PyObject* args)
     }
 
     PyErr_SetString(PyExc_ValueError,
-                    "decimate(tolerance=float, reduction=float) or decimate(targetSize=int)");
+                    "decimate(tolerance=float, reduction=float) or "
+                    "decimate(TargetSize=int, [MaxError=float, LockBoundary=bool, "
+                    "FeatureAngle=float])");
     return nullptr;
 }
 
@@ -21,17 +21,30 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+
+#ifndef FC_OS_WIN32
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES 1
+#endif
+#endif
+
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
 #include <climits>
+#include <cmath>
+#include <map>
+#include <unordered_map>
 #ifdef FC_OS_WIN32
 #include <windows.h>
 #endif
 #ifdef FC_OS_MACOSX
 #include <OpenGL/gl.h>
+#include <OpenGL/glext.h>
 #include <OpenGL/glu.h>
 #else
 #include <GL/gl.h>
+#include <GL/glext.h>
 #include <GL/glu.h>
 #endif
 #include <Inventor/SbLine.h>
@@ -47,11 +60,16 @@
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/details/SoFaceDetail.h>
 #include <Inventor/details/SoLineDetail.h>
+#include <Inventor/elements/SoGLLazyElement.h>
+#include <Inventor/errors/SoDebugError.h>
 #include <Inventor/misc/SoState.h>
 #endif
+#include <Inventor/C/glue/gl.h>
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/ThreadPool.h>
+#include <Gui/GLBuffer.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
@@ -599,6 +617,378 @@ inline SbVec3f sbvec3f(const Base::Vector3f& _v)
     return {_v.x, _v.y, _v.z};
 }
 
+// ----------------------------------------------------------------------------
+
+/**
+ * Holds the buffer objects of an SoFCMeshObjectShape for all OpenGL contexts it's rendered in.
+ * Each facet gets its own three vertices in the vertex buffer to have flat shading, so the
+ * index of a vertex is three times the facet index plus the corner.
+ */
+class SoFCMeshObjectShape::VBO
+{
+public:
+    using Color = std::array<uint8_t, 4>;
+
+    static bool canRenderGLArray(SoGLRenderAction* action);
+    void invalidate();
+    void render(SoGLRenderAction* action,
+                const Mesh::MeshObject* mesh,
+                Binding bind,
+                SbBool ccw,
+                unsigned int lodLimit);
+
+private:
+    void bindVertices(uint32_t context, const Mesh::MeshObject* mesh);
+    bool bindColors(SoState* state, uint32_t context, const Mesh::MeshObject* mesh, Binding bind);
+    bool bindLevelOfDetail(uint32_t context, const Mesh::MeshObject* mesh, unsigned int limit);
+    static std::vector<uint32_t> buildLevelOfDetail(const MeshCore::MeshKernel& kernel,
+                                                    unsigned int limit);
+
+private:
+    Gui::OpenGLMultiBuffer vertices {GL_ARRAY_BUFFER};
+    Gui::OpenGLMultiBuffer colors {GL_ARRAY_BUFFER};
+    Gui::OpenGLMultiBuffer lodIndices {GL_ELEMENT_ARRAY_BUFFER};
+    std::size_t numVertices {0};
+    SbBool ccw {true};
+
+    // Colors of the vertices and the range of the last change that must be
+    // written to the buffers of contexts having the previous revision
+    std::vector<Color> colorArray;
+    Binding colorBinding {OVERALL};
+    uint32_t diffuseId {0};
+    uint32_t transparencyId {0};
+    unsigned long colorRevision {0};
+    std::size_t changedBegin {0};
+    std::size_t changedEnd {0};
+    std::map<uint32_t, unsigned long> contextRevision;
+
+    // Index buffer of the approximation rendered during interaction
+    std::vector<uint32_t> lodArray;
+    unsigned int lodLimit {0};
+    bool lodValid {false};
+};
+
+bool SoFCMeshObjectShape::VBO::canRenderGLArray(SoGLRenderAction* action)
+{
+    static bool init = false;
+    static bool vboAvailable = false;
+    if (!init) {
+        vboAvailable = Gui::OpenGLBuffer::isVBOSupported(action->getCacheContext());
+        if (!vboAvailable) {
+            SoDebugError::postInfo("SoFCMeshObjectShape",
+                                   "GL_ARB_vertex_buffer_object extension not supported");
+        }
+        init = true;
+    }
+
+    return vboAvailable;
+}
+
+void SoFCMeshObjectShape::VBO::invalidate()
+{
+    vertices.destroy();
+    colors.destroy();
+    lodIndices.destroy();
+    numVertices = 0;
+
+    colorArray.clear();
+    colorBinding = OVERALL;
+    contextRevision.clear();
+
+    lodArray.clear();
+    lodValid = false;
+}
+
+void SoFCMeshObjectShape::VBO::bindVertices(uint32_t context, const Mesh::MeshObject* mesh)
+{
+    vertices.setCurrentContext(context);
+    if (vertices.isCreated(context)) {
+        vertices.bind();
+        return;
+    }
+
+    const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+
+    // interleaved normal and vertex of the three corners
+    std::vector<float> vertex_array(18 * rFacets.size());
+    Base::parallel_for(rFacets.size(), 10000, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshCore::MeshFacet& face = rFacets[i];
+            const MeshCore::MeshPoint& v0 = rPoints[face._aulPoints[0]];
+            const MeshCore::MeshPoint& v1 = rPoints[face._aulPoints[1]];
+            const MeshCore::MeshPoint& v2 = rPoints[face._aulPoints[2]];
+            Base::Vector3f n = (v1 - v0) % (v2 - v0);
+            n.Normalize();
+            if (!ccw) {
+                n = -n;
+            }
+
+            float* data = &vertex_array[18 * i];
+            for (const Base::Vector3f& v : {v0, v1, v2}) {
+                *data++ = n.x;
+                *data++ = n.y;
+                *data++ = n.z;
+                *data++ = v.x;
+                *data++ = v.y;
+                *data++ = v.z;
+            }
+        }
+    });
+
+    vertices.create();
+    vertices.bind();
+    vertices.allocate(vertex_array.data(), int(vertex_array.size() * sizeof(float)));
+    numVertices = 3 * rFacets.size();
+}
+
+bool SoFCMeshObjectShape::VBO::bindColors(SoState* state,
+                                          uint32_t context,
+                                          const Mesh::MeshObject* mesh,
+                                          Binding bind)
+{
+    SoGLLazyElement* gl = SoGLLazyElement::getInstance(state);
+    if (!gl || gl->getNumDiffuse() < 1) {
+        return false;
+    }
+
+    // Recompute the colors only if the material has changed
+    if (colorBinding != bind || diffuseId != gl->getDiffuseNodeId()
+        || transparencyId != gl->getTransparencyNodeId() || colorArray.size() != numVertices) {
+        colorBinding = bind;
+        diffuseId = gl->getDiffuseNodeId();
+        transparencyId = gl->getTransparencyNodeId();
+
+        const SbColor* diffuse = gl->getDiffusePointer();
+        const float* transparency = gl->getTransparencyPointer();
+        int numDiffuse = gl->getNumDiffuse();
+        int numTransparency = gl->getNumTransparencies();
+        auto getColor = [&](std::size_t index) {
+            const SbColor& c = diffuse[std::min<std::size_t>(index, numDiffuse - 1)];
+            float t = numTransparency > 0
+                ? transparency[std::min<std::size_t>(index, numTransparency - 1)]
+                : 0.0F;
+            return Color {static_cast<uint8_t>(c[0] * 255.0F + 0.5F),
+                          static_cast<uint8_t>(c[1] * 255.0F + 0.5F),
+                          static_cast<uint8_t>(c[2] * 255.0F + 0.5F),
+                          static_cast<uint8_t>((1.0F - t) * 255.0F + 0.5F)};
+        };
+
+        const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+        std::vector<Color> color_array(numVertices);
+        for (std::size_t i = 0; i < rFacets.size(); i++) {
+            for (int j = 0; j < 3; j++) {
+                std::size_t index = bind == PER_FACE_INDEXED ? i : rFacets[i]._aulPoints[j];
+                color_array[3 * i + j] = getColor(index);
+            }
+        }
+
+        // Determine the changed range, e.g. a highlighted selection usually only
+        // touches a small part of the mesh
+        std::size_t begin = 0;
+        std::size_t end = color_array.size();
+        if (colorArray.size() == color_array.size()) {
+            while (begin < end && colorArray[begin] == color_array[begin]) {
+                begin++;
+            }
+            while (end > begin && colorArray[end - 1] == color_array[end - 1]) {
+                end--;
+            }
+        }
+
+        colorArray.swap(color_array);
+        if (begin < end) {
+            changedBegin = begin;
+            changedEnd = end;
+            colorRevision++;
+        }
+    }
+
+    colors.setCurrentContext(context);
+    auto it = contextRevision.find(context);
+    if (!colors.isCreated(context) || it == contextRevision.end()) {
+        colors.create();
+        colors.bind();
+        colors.allocate(colorArray.data(), int(colorArray.size() * sizeof(Color)));
+    }
+    else {
+        colors.bind();
+        if (it->second + 1 == colorRevision) {
+            colors.write(int(changedBegin * sizeof(Color)),
+                         &colorArray[changedBegin],
+                         int((changedEnd - changedBegin) * sizeof(Color)));
+        }
+        else if (it->second != colorRevision) {
+            colors.allocate(colorArray.data(), int(colorArray.size() * sizeof(Color)));
+        }
+    }
+    contextRevision[context] = colorRevision;
+
+    return true;
+}
+
+bool SoFCMeshObjectShape::VBO::bindLevelOfDetail(uint32_t context,
+                                                 const Mesh::MeshObject* mesh,
+                                                 unsigned int limit)
+{
+    if (!lodValid || lodLimit != limit) {
+        lodIndices.destroy();
+        lodArray = buildLevelOfDetail(mesh->getKernel(), limit);
+        lodLimit = limit;
+        lodValid = true;
+    }
+
+    if (lodArray.empty()) {
+        return false;
+    }
+
+    lodIndices.setCurrentContext(context);
+    if (lodIndices.isCreated(context)) {
+        lodIndices.bind();
+    }
+    else {
+        lodIndices.create();
+        lodIndices.bind();
+        lodIndices.allocate(lodArray.data(), int(lodArray.size() * sizeof(uint32_t)));
+    }
+
+    return true;
+}
+
+/**
+ * Computes an approximation of the mesh with at most \a limit triangles by vertex clustering.
+ * All points inside a grid cell are replaced by the one closest to the cell center and triangles
+ * that collapse are dropped. The returned indices refer to the vertex buffer, i.e. a cluster is represented by
+ * a corner of an adjacent facet and the approximation gets its normals and colors.
+ */
+std::vector<uint32_t> SoFCMeshObjectShape::VBO::buildLevelOfDetail(const MeshCore::MeshKernel& kernel,
+                                                                   unsigned int limit)
+{
+    const MeshCore::MeshPointArray& rPoints = kernel.GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = kernel.GetFacets();
+    Base::BoundBox3f box = kernel.GetBoundBox();
+    float length = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    if (length <= 0.0F) {
+        return {};
+    }
+
+    // the first vertex that refers to a mesh point
+    std::vector<uint32_t> vertexOfPoint(rPoints.size(), UINT32_MAX);
+    for (std::size_t i = 0; i < rFacets.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            uint32_t& vertex = vertexOfPoint[rFacets[i]._aulPoints[j]];
+            if (vertex == UINT32_MAX) {
+                vertex = static_cast<uint32_t>(3 * i + j);
+            }
+        }
+    }
+
+    // a surface touches about res*res cells that give two triangles each
+    std::vector<uint32_t> cluster(rPoints.size());
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (double res = std::sqrt(double(limit) / 2.0); res >= 2.0; res *= 0.7) {
+        float size = length / float(res);
+        // each cell is represented by the point closest to its center
+        std::unordered_map<uint64_t, std::pair<float, uint32_t>> cells;
+        std::vector<uint64_t> keys(rPoints.size());
+        for (std::size_t i = 0; i < rPoints.size(); i++) {
+            if (vertexOfPoint[i] == UINT32_MAX) {
+                continue;
+            }
+            const MeshCore::MeshPoint& p = rPoints[i];
+            float fx = std::max(0.0F, (p.x - box.MinX) / size);
+            float fy = std::max(0.0F, (p.y - box.MinY) / size);
+            float fz = std::max(0.0F, (p.z - box.MinZ) / size);
+            auto cx = static_cast<uint64_t>(fx);
+            auto cy = static_cast<uint64_t>(fy);
+            auto cz = static_cast<uint64_t>(fz);
+            float dx = fx - float(cx) - 0.5F;
+            float dy = fy - float(cy) - 0.5F;
+            float dz = fz - float(cz) - 0.5F;
+            float dist = dx * dx + dy * dy + dz * dz;
+            keys[i] = (cx << 42) | (cy << 21) | cz;
+            auto it = cells.emplace(keys[i], std::make_pair(dist, vertexOfPoint[i])).first;
+            if (dist < it->second.first) {
+                it->second = std::make_pair(dist, vertexOfPoint[i]);
+            }
+        }
+        for (std::size_t i = 0; i < rPoints.size(); i++) {
+            if (vertexOfPoint[i] != UINT32_MAX) {
+                cluster[i] = cells[keys[i]].second;
+            }
+        }
+
+        triangles.clear();
+        for (const auto& face : rFacets) {
+            std::array<uint32_t, 3> tria {cluster[face._aulPoints[0]],
+                                          cluster[face._aulPoints[1]],
+                                          cluster[face._aulPoints[2]]};
+            if (tria[0] == tria[1] || tria[1] == tria[2] || tria[2] == tria[0]) {
+                continue;
+            }
+            // start with the smallest index to keep the orientation
+            std::rotate(tria.begin(), std::min_element(tria.begin(), tria.end()), tria.end());
+            triangles.push_back(tria);
+        }
+
+        std::sort(triangles.begin(), triangles.end());
+        triangles.erase(std::unique(triangles.begin(), triangles.end()), triangles.end());
+        if (triangles.size() <= limit) {
+            break;
+        }
+    }
+
+    std::vector<uint32_t> indices;
+    indices.reserve(3 * triangles.size());
+    for (const auto& tria : triangles) {
+        indices.insert(indices.end(), tria.begin(), tria.end());
+    }
+    return indices;
+}
+
+void SoFCMeshObjectShape::VBO::render(SoGLRenderAction* action,
+                                      const Mesh::MeshObject* mesh,
+                                      Binding bind,
+                                      SbBool ccw,
+                                      unsigned int lodLimit)
+{
+    if (this->ccw != ccw) {
+        invalidate();
+        this->ccw = ccw;
+    }
+
+    uint32_t context = action->getCacheContext();
+    bindVertices(context, mesh);
+    glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
+    vertices.release();
+
+    // the current color is changed by the color array
+    bool perVertex = bind != OVERALL && bindColors(action->getState(), context, mesh, bind);
+    if (perVertex) {
+        glPushAttrib(GL_CURRENT_BIT);
+        glEnableClientState(GL_COLOR_ARRAY);
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, nullptr);
+        colors.release();
+    }
+
+    if (lodLimit > 0 && bindLevelOfDetail(context, mesh, lodLimit)) {
+        glDrawElements(GL_TRIANGLES, GLsizei(lodArray.size()), GL_UNSIGNED_INT, nullptr);
+        lodIndices.release();
+    }
+    else {
+        glDrawArrays(GL_TRIANGLES, 0, GLsizei(numVertices));
+    }
+
+    if (perVertex) {
+        glDisableClientState(GL_COLOR_ARRAY);
+        glPopAttrib();
+    }
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+}
+
+// ----------------------------------------------------------------------------
+
 SO_NODE_SOURCE(SoFCMeshObjectShape)
 
 void SoFCMeshObjectShape::initClass()
@@ -608,6 +998,7 @@ void SoFCMeshObjectShape::initClass()
 
 SoFCMeshObjectShape::SoFCMeshObjectShape()
     : renderTriangleLimit(UINT_MAX)
+    , pimpl(std::make_unique<VBO>())
 {
     SO_NODE_CONSTRUCTOR(SoFCMeshObjectShape);
     setName(SoFCMeshObjectShape::getClassTypeId().getName());
@@ -655,28 +1046,40 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
             ccw = false;
         }
 
+#ifdef RENDER_GLARRAYS
+        // get the VBO status of the viewer
+        SbBool useVBO = true;
+        Gui::SoGLVBOActivatedElement::get(state, useVBO);
+        if (!VBO::canRenderGLArray(action)) {
+            useVBO = false;
+        }
+
+        if (updateGLArray) {
+            updateGLArray = false;
+            pimpl->invalidate();
+        }
+#else
+        SbBool useVBO = false;
+#endif
+
         if (!mode || mesh->countFacets() <= this->renderTriangleLimit) {
-            if (mbind != OVERALL) {
+            if (useVBO) {
+                renderFacesGLArray(action, mesh, mbind, ccw);
+            }
+            else if (mbind != OVERALL) {
                 drawFaces(mesh, &mb, mbind, needNormals, ccw);
             }
             else {
-#ifdef RENDER_GLARRAYS
-                if (updateGLArray) {
-                    updateGLArray = false;
-                    generateGLArrays(state);
-                }
-                renderFacesGLArray(action);
-#else
-                drawFaces(mesh, 0, mbind, needNormals, ccw);
-#endif
+                drawFaces(mesh, nullptr, mbind, needNormals, ccw);
             }
         }
         else {
-#if 0 && defined(RENDER_GLARRAYS)
-            renderCoordsGLArray(action);
-#else
-            drawPoints(mesh, needNormals, ccw);
-#endif
+            if (useVBO) {
+                renderLevelOfDetail(action, mesh, mbind, ccw);
+            }
+            else {
+                drawPoints(mesh, needNormals, ccw);
+            }
         }
     }
 }
@@ -880,72 +1283,20 @@ void SoFCMeshObjectShape::drawPoints(const Mesh::MeshObject* mesh,
     }
 }
 
-void SoFCMeshObjectShape::generateGLArrays(SoState* state)
+void SoFCMeshObjectShape::renderFacesGLArray(SoGLRenderAction* action,
+                                             const Mesh::MeshObject* mesh,
+                                             Binding bind,
+                                             SbBool ccw)
 {
-    const Mesh::MeshObject* mesh = SoFCMeshObjectElement::get(state);
-
-    this->index_array.resize(0);
-    this->vertex_array.resize(0);
-
-    std::vector<float> face_vertices;
-    std::vector<int32_t> face_indices;
-
-    const MeshCore::MeshKernel& kernel = mesh->getKernel();
-    const MeshCore::MeshPointArray& cP = kernel.GetPoints();
-    const MeshCore::MeshFacetArray& cF = kernel.GetFacets();
-
-    // Flat shading
-    face_vertices.reserve(3 * cF.size() * 6);  // duplicate each vertex
-    face_indices.resize(3 * cF.size());
-
-    int indexed = 0;
-    for (const auto& it : cF) {
-        Base::Vector3f n = kernel.GetFacet(it).GetNormal();
-        for (Mesh::PointIndex ptIndex : it._aulPoints) {
-            face_vertices.push_back(n.x);
-            face_vertices.push_back(n.y);
-            face_vertices.push_back(n.z);
-            const Base::Vector3f& v = cP[ptIndex];
-            face_vertices.push_back(v.x);
-            face_vertices.push_back(v.y);
-            face_vertices.push_back(v.z);
-
-            face_indices[indexed] = indexed;
-            indexed++;
-        }
-    }
-    this->index_array.swap(face_indices);
-    this->vertex_array.swap(face_vertices);
-}
-
-void SoFCMeshObjectShape::renderFacesGLArray(SoGLRenderAction* action)
-{
-    (void)action;
-    GLsizei cnt = static_cast<GLsizei>(index_array.size());
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-    glInterleavedArrays(GL_N3F_V3F, 0, vertex_array.data());
-    glDrawElements(GL_TRIANGLES, cnt, GL_UNSIGNED_INT, index_array.data());
-
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
+    pimpl->render(action, mesh, bind, ccw, 0);
 }
 
-void SoFCMeshObjectShape::renderCoordsGLArray(SoGLRenderAction* action)
+void SoFCMeshObjectShape::renderLevelOfDetail(SoGLRenderAction* action,
+                                              const Mesh::MeshObject* mesh,
+                                              Binding bind,
+                                              SbBool ccw)
 {
-    (void)action;
-    int cnt = index_array.size();
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-    glInterleavedArrays(GL_N3F_V3F, 0, vertex_array.data());
-    glDrawElements(GL_POINTS, cnt, GL_UNSIGNED_INT, index_array.data());
-
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
+    pimpl->render(action, mesh, bind, ccw, this->renderTriangleLimit);
 }
 
 void SoFCMeshObjectShape::doAction(SoAction* action)
@@ -23,6 +23,7 @@
 #ifndef MESHGUI_SOFCMESHOBJECT_H
 #define MESHGUI_SOFCMESHOBJECT_H
 
+#include <memory>
 #include <Inventor/elements/SoReplacedElement.h>
 #include <Inventor/fields/SoSFUInt32.h>
 #include <Inventor/fields/SoSFVec3f.h>
@@ -161,11 +162,19 @@ protected:
  * The SoFCMeshObjectShape is an Inventor shape node that is designed to render huge meshes.
  * If the mesh exceeds a certain number of triangles and the user does some intersections
  * (e.g. moving, rotating, zooming, spinning, etc.) with the mesh then the GLRender() method
- * renders only the gravity points of a subset of the triangles.
+ * renders only a coarser approximation of the mesh.
  * If there is no user interaction with the mesh then all triangles are rendered.
  * The limit of maximum allowed triangles can be specified in \a renderTriangleLimit, the
  * default value is set to 100.000.
  *
+ * If vertex buffer objects are supported the triangles are uploaded once per mesh change
+ * as interleaved normal and vertex data. Per-face or per-vertex colors are kept in a
+ * separate buffer of which only the changed range is updated, e.g. when highlighting a
+ * selection. The approximation used during interaction is an index buffer into the same
+ * vertex data computed by vertex clustering. Without buffer support the triangles are
+ * rendered directly and the approximation falls back to the gravity points of a subset
+ * of the triangles.
+ *
  * The GLRender() method checks the status of the SoFCInteractiveElement to decide to be in
  * interactive mode or not.
  * To take advantage of this facility the client programmer must set the status of the
@@ -226,17 +235,22 @@ private:
     void stopSelection(SoAction* action, const Mesh::MeshObject*);
     void renderSelectionGeometry(const Mesh::MeshObject*);
 
-    void generateGLArrays(SoState* state);
-    void renderFacesGLArray(SoGLRenderAction* action);
-    void renderCoordsGLArray(SoGLRenderAction* action);
+    void renderFacesGLArray(SoGLRenderAction* action,
+                            const Mesh::MeshObject*,
+                            Binding bind,
+                            SbBool ccw);
+    void renderLevelOfDetail(SoGLRenderAction* action,
+                             const Mesh::MeshObject*,
+                             Binding bind,
+                             SbBool ccw);
 
 private:
+    class VBO;
     GLuint* selectBuf {nullptr};
     GLfloat modelview[16] {};
     GLfloat projection[16] {};
-    // Vertex array handling
-    std::vector<int32_t> index_array;
-    std::vector<float> vertex_array;
+    // Vertex buffer handling
+    std::unique_ptr<VBO> pimpl;
     SbBool updateGLArray {false};
 };
 
@@ -50,6 +50,7 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -61,6 +62,7 @@
 using namespace MeshPart;
 using MeshCore::MeshAlgorithm;
 using MeshCore::MeshFacet;
+using MeshCore::MeshFacetBVH;
 using MeshCore::MeshFacetGrid;
 using MeshCore::MeshFacetIterator;
 using MeshCore::MeshKernel;
@@ -664,10 +666,9 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                                    float tolerance,
                                    std::vector<Base::Vector3f>& pointsOut) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    // the bounding volume hierarchy copes with unevenly distributed facets
+    // and like the grid it finds the facets on both sides of the points
+    MeshFacetBVH cBVH(_rcMesh);
 
     // get all boundary points and edges of the mesh
     std::vector<Base::Vector3f> boundaryPoints;
@@ -691,10 +692,12 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
 
     Base::SequencerLauncher seq("Project points on mesh", pointsIn.size());
 
-    for (auto it : pointsIn) {
-        Base::Vector3f result;
-        MeshCore::FacetIndex index;
-        if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
+    std::vector<MeshFacetBVH::RayHit> hits = cBVH.NearestFacetsOnLines(pointsIn, dir);
+    for (std::size_t i = 0; i < pointsIn.size(); i++) {
+        const Base::Vector3f& it = pointsIn[i];
+        Base::Vector3f result = hits[i].point;
+        MeshCore::FacetIndex index = hits[i].facet;
+        if (index != MeshCore::FACET_INDEX_MAX) {
             MeshCore::MeshGeomFacet geomFacet = _rcMesh.GetFacet(index);
             if (tolerance > 0 && geomFacet.IntersectPlaneWithLine(it, dir, result)) {
                 if (geomFacet.IsPointOfFace(result, tolerance)) {
@@ -744,10 +747,7 @@ void MeshProjection::projectParallelToMesh(const TopoDS_Shape& aShape,
                                            const Base::Vector3f& dir,
                                            std::vector<PolyLine>& rPolyLines) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    MeshFacetBVH cBVH(_rcMesh);
     TopExp_Explorer Ex;
 
     int iCnt = 0;
@@ -766,11 +766,9 @@ void MeshProjection::projectParallelToMesh(const TopoDS_Shape& aShape,
         std::vector<HitPoint> hitPoints;
         using HitPoints = std::pair<HitPoint, HitPoint>;
         std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
+        for (const auto& hit : cBVH.NearestFacetsOnLines(points, dir)) {
+            if (hit.facet != MeshCore::FACET_INDEX_MAX) {
+                hitPoints.emplace_back(hit.point, hit.facet);
 
                 if (hitPoints.size() > 1) {
                     HitPoint p1 = hitPoints[hitPoints.size() - 2];
@@ -784,7 +782,7 @@ void MeshProjection::projectParallelToMesh(const TopoDS_Shape& aShape,
         PolyLine polyline;
         for (auto it : hitPointPairs) {
             points.clear();
-            if (meshProjection.projectLineOnMesh(cGrid,
+            if (meshProjection.projectLineOnMesh(cBVH,
                                                  it.first.first,
                                                  it.first.second,
                                                  it.second.first,
@@ -804,10 +802,7 @@ void MeshProjection::projectParallelToMesh(const std::vector<PolyLine>& aEdges,
                                            const Base::Vector3f& dir,
                                            std::vector<PolyLine>& rPolyLines) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    MeshFacetBVH cBVH(_rcMesh);
 
     Base::SequencerLauncher seq("Project curve on mesh", aEdges.size());
 
@@ -818,11 +813,9 @@ void MeshProjection::projectParallelToMesh(const std::vector<PolyLine>& aEdges,
         std::vector<HitPoint> hitPoints;
         using HitPoints = std::pair<HitPoint, HitPoint>;
         std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
+        for (const auto& hit : cBVH.NearestFacetsOnLines(points, dir)) {
+            if (hit.facet != MeshCore::FACET_INDEX_MAX) {
+                hitPoints.emplace_back(hit.point, hit.facet);
 
                 if (hitPoints.size() > 1) {
                     HitPoint p1 = hitPoints[hitPoints.size() - 2];
@@ -836,7 +829,7 @@ void MeshProjection::projectParallelToMesh(const std::vector<PolyLine>& aEdges,
         PolyLine polyline;
         for (auto it : hitPointPairs) {
             points.clear();
-            if (meshProjection.projectLineOnMesh(cGrid,
+            if (meshProjection.projectLineOnMesh(cBVH,
                                                  it.first.first,
                                                  it.first.second,
                                                  it.second.first,
@@ -97,11 +97,13 @@ void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    restoreDeferred();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    restoreDeferred();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -117,6 +119,12 @@ const TopoShape& PropertyPartShape::getShape() const
 }
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
+{
+    restoreDeferred();
+    return peekComplexData();
+}
+
+const Data::ComplexGeoData* PropertyPartShape::peekComplexData() const
 {
     _Shape.initCache(-1);
     return &(this->_Shape);
@@ -124,6 +132,7 @@ const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
+    restoreDeferred();
     Base::BoundBox3d box;
     if (_Shape.getShape().IsNull())
         return box;
@@ -150,11 +159,13 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D &rclTrf)
 {
+    restoreDeferred();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    restoreDeferred();
     return _Shape.getTransform();
 }
 
@@ -167,6 +178,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 
 PyObject *PropertyPartShape::getPyObject()
 {
+    restoreDeferred();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop)
         prop->setConst();
@@ -203,6 +215,7 @@ void PropertyPartShape::setPyObject(PyObject *value)
 
 App::Property *PropertyPartShape::Copy() const
 {
+    restoreDeferred();
     PropertyPartShape *prop = new PropertyPartShape();
 
     // March, 2024 Toponaming project:  There was originally a feature to enable making an element
@@ -228,6 +241,7 @@ void PropertyPartShape::Paste(const App::Property &from)
 
 unsigned int PropertyPartShape::getMemSize () const
 {
+    restoreDeferred();
     return _Shape.getMemSize();
 }
 
@@ -247,6 +261,7 @@ void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier> &paths) cons
 
 void PropertyPartShape::beforeSave() const
 {
+    restoreDeferred();
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
@@ -259,6 +274,7 @@ void PropertyPartShape::beforeSave() const
 }
 void PropertyPartShape::Save (Base::Writer &writer) const
 {
+    restoreDeferred();
     //See SaveDocFile(), RestoreDocFile()
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
@@ -423,6 +439,13 @@ void PropertyPartShape::afterRestore()
 // to disable saving of triangulation
 //
 
+// If false the BRep files are written and read through a temporary file
+static bool isDirectAccess()
+{
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+}
+
 static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_CString File)
 {
   std::ofstream os;
@@ -561,6 +584,7 @@ void PropertyPartShape::loadFromStream(Base::Reader &reader)
 
 void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
 {
+    restoreDeferred();
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
     if (_Shape.getShape().IsNull())
@@ -572,9 +596,7 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
         shape.exportBinary(writer.Stream());
     }
     else {
-        bool direct = App::GetApplication().GetParameterGroupByPath
-            ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
-        if (!direct) {
+        if (!isDirectAccess()) {
             saveToFile(writer);
         }
         else {
@@ -585,6 +607,12 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     }
 }
 
+bool PropertyPartShape::canSaveDocFileConcurrently(const Base::Writer &writer) const
+{
+    // the BRep text format may go through a temporary file and reads parameters
+    return writer.getMode("BinaryBrep");
+}
+
 void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
 {
     Base::FileInfo brep(reader.getFileName());
@@ -594,9 +622,7 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
         setValue(shape);
     }
     else {
-        bool direct = App::GetApplication().GetParameterGroupByPath
-            ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
-        if (!direct) {
+        if (!isDirectAccess()) {
             loadFromFile(reader);
         }
         else {
@@ -607,6 +633,76 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
     }
 }
 
+bool PropertyPartShape::canRestoreDocFileConcurrently() const
+{
+    // the shape is read straight from the stream, a temporary file is only used
+    // by RestoreDocFile()
+    return isDirectAccess();
+}
+
+bool PropertyPartShape::canRestoreDocFileDeferred() const
+{
+    return isDirectAccess();
+}
+
+void PropertyPartShape::RestoreDocFileDeferred(Base::Reader &reader)
+{
+    // Only the geometry is read, the element map, tag and hasher restored with
+    // the document are kept
+    TopoDS_Shape shape;
+    Base::FileInfo brep(reader.getFileName());
+    if (brep.hasExtension("bin")) {
+        TopoShape binary;
+        binary.importBinary(reader);
+        shape = binary.getShape();
+    }
+    else {
+        try {
+            reader.exceptions(std::istream::failbit | std::istream::badbit);
+            BRep_Builder builder;
+            BRepTools::Read(shape, reader, builder);
+        }
+        catch (const std::exception&) {
+            if (!reader.eof())
+                Base::Console().Warning("Failed to load BRep file %s\n", reader.getFileName().c_str());
+        }
+    }
+    _Shape.setShape(shape, false);
+}
+
+std::function<void()> PropertyPartShape::RestoreDocFileConcurrently(Base::Reader &reader)
+{
+    // The shape is always parsed straight from the reader, i.e. from memory,
+    // and not through a temporary file
+    Base::FileInfo brep(reader.getFileName());
+    if (brep.hasExtension("bin")) {
+        TopoShape shape;
+        shape.importBinary(reader);
+        return [this, shape]() {
+            setValue(shape);
+        };
+    }
+
+    TopoDS_Shape shape;
+    try {
+        reader.exceptions(std::istream::failbit | std::istream::badbit);
+        BRep_Builder builder;
+        BRepTools::Read(shape, reader, builder);
+    }
+    catch (const std::exception&) {
+        // an empty file means an empty shape
+        std::string fileName = reader.eof() ? std::string() : reader.getFileName();
+        return [fileName]() {
+            if (!fileName.empty())
+                Base::Console().Warning("Failed to load BRep file %s\n", fileName.c_str());
+        };
+    }
+
+    return [this, shape]() {
+        setValue(shape);
+    };
+}
+
 // -------------------------------------------------------------------------
 
 ShapeHistory::ShapeHistory(BRepBuilderAPI_MakeShape& mkShape, TopAbs_ShapeEnum type,
@@ -89,7 +89,11 @@ public:
     virtual void beforeSave() const override;
 
     void SaveDocFile (Base::Writer &writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer &writer) const override;
     void RestoreDocFile(Base::Reader &reader) override;
+    bool canRestoreDocFileConcurrently() const override;
+    std::function<void()> RestoreDocFileConcurrently(Base::Reader &reader) override;
+    bool canRestoreDocFileDeferred() const override;
 
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
@@ -106,6 +110,10 @@ public:
 
     friend class Feature;
 
+protected:
+    const Data::ComplexGeoData* peekComplexData() const override;
+    void RestoreDocFileDeferred(Base::Reader &reader) override;
+
 private:
     void saveToFile(Base::Writer &writer) const;
     void loadFromFile(Base::Reader &reader);
@@ -168,6 +168,7 @@
 #include <Base/Exception.h>
 #include <Base/Placement.h>
 #include <Base/Tools.h>
+#include <Base/Profiler.h>
 #include <Base/Reader.h>
 #include <Base/Writer.h>
 
@@ -3330,6 +3331,8 @@ void TopoShape::getFaces(std::vector<Base::Vector3d> &aPoints,
     if (this->_Shape.IsNull())
         return;
 
+    FC_PROFILE_SCOPE("tessellation", "TopoShape::getFaces");
+
     // get the meshes of all faces and then merge them
     BRepMesh_IncrementalMesh aMesh(this->_Shape, accuracy,
                                    /*isRelative*/ Standard_False,
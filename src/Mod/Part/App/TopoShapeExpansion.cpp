@@ -98,6 +98,7 @@
 #include "BRepOffsetAPI_MakeOffsetFix.h"
 #include "Base/Tools.h"
 #include "Base/BoundBox.h"
+#include "Base/Profiler.h"
 
 #include <App/ElementMap.h>
 #include <App/ElementNamingUtils.h>
@@ -5568,6 +5569,8 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
         FC_THROWM(NullShapeException, "Null shape");
     }
 
+    FC_PROFILE_SCOPE("boolean", maker);
+
     if (strcmp(maker, Part::OpCodes::Compound) == 0) {
         return makeElementCompound(shapes, op, SingleShapeCompoundCreationPolicy::returnShape);
     }
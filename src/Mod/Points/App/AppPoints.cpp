@@ -25,6 +25,8 @@
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 
+#include "FilterFeature.h"
+#include "OctreeFeature.h"
 #include "Points.h"
 #include "PointsPy.h"
 #include "Properties.h"
@@ -60,6 +62,14 @@ PyMOD_INIT_FUNC(Points)
     Points::FeatureCustom           ::init();
     Points::StructuredCustom        ::init();
     Points::FeaturePython           ::init();
+    Points::OctreeFeature           ::init();
+    Points::Filter                  ::init();
+    Points::VoxelGrid               ::init();
+    Points::PoissonDisk             ::init();
+    Points::CropBox                 ::init();
+    Points::CropPlane               ::init();
+    Points::RadiusOutlierRemoval    ::init();
+    Points::Deduplicate             ::init();
     PyMOD_Return(pointsModule);
     // clang-format on
 }
@@ -22,7 +22,10 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <boost/math/special_functions/fpclassify.hpp>
 #endif
 
 #include <App/Application.h>
@@ -33,9 +36,16 @@
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
+#include <Base/PyWrapParseTupleAndKeywords.h>
 
+#include "OctreeFeature.h"
 #include "Points.h"
 #include "PointsAlgos.h"
+#include "PointsEstimation.h"
+#include "PointsFeature.h"
+#include "PointsFilter.h"
+#include "PointsKDTree.h"
+#include "PointsOctree.h"
 #include "PointsPy.h"
 #include "Properties.h"
 #include "Structured.h"
@@ -56,6 +66,28 @@ public:
                            &Module::show,
                            "show(points,[string]) -- Add the points to the active document or "
                            "create one if no document exists.  Returns document object.");
+        add_varargs_method(
+            "buildOctree",
+            &Module::buildOctree,
+            "buildOctree(source, target, [maxPointsPerNode=65536]) -- Reads the point cloud file "
+            "'source' chunk by chunk and writes it to the out-of-core octree file 'target'.\n"
+            "Returns the number of points.");
+        add_varargs_method("insertOctree",
+                           &Module::insertOctree,
+                           "insertOctree(string, [string]) -- Adds an object that references the "
+                           "octree file to the given or active document. Returns document object.");
+        add_keyword_method(
+            "estimateNormals",
+            &Module::estimateNormals,
+            "estimateNormals(Feature, [KSearch=10, SearchRadius=0.0, Curvature=False]) -- "
+            "Estimates the normals of a points feature and stores them in its 'Normal' property.\n"
+            "If Curvature is True the principal curvatures are stored in its 'Curvature' property.");
+        add_keyword_method(
+            "removeOutliers",
+            &Module::removeOutliers,
+            "removeOutliers(Feature, [KSearch=8, StdDevMul=1.0]) -- Removes the points of a points "
+            "feature whose mean distance to their neighbours is statistically too large.\n"
+            "Returns the number of removed points.");
         initialize("This module is the Points module.");  // register with Python
     }
 
@@ -73,6 +105,30 @@ private:
 
         return std::make_tuple(useColor, checkState, minDistance);
     }
+    std::unique_ptr<Reader> createReader(const Base::FileInfo& file) const
+    {
+        std::unique_ptr<Reader> reader;
+        if (file.hasExtension("asc")) {
+            reader = std::make_unique<AscReader>();
+        }
+        else if (file.hasExtension("e57")) {
+            auto setting = readE57Settings();
+            reader = std::make_unique<E57Reader>(std::get<0>(setting),
+                                                 std::get<1>(setting),
+                                                 std::get<2>(setting));
+        }
+        else if (file.hasExtension("ply")) {
+            reader = std::make_unique<PlyReader>();
+        }
+        else if (file.hasExtension("pcd")) {
+            reader = std::make_unique<PcdReader>();
+        }
+        else {
+            throw Py::RuntimeError("Unsupported file extension");
+        }
+
+        return reader;
+    }
     Py::Object open(const Py::Tuple& args)
     {
         char* Name {};
@@ -91,25 +147,7 @@ private:
                 throw Py::RuntimeError("No file extension");
             }
 
-            std::unique_ptr<Reader> reader;
-            if (file.hasExtension("asc")) {
-                reader = std::make_unique<AscReader>();
-            }
-            else if (file.hasExtension("e57")) {
-                auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(std::get<0>(setting),
-                                                     std::get<1>(setting),
-                                                     std::get<2>(setting));
-            }
-            else if (file.hasExtension("ply")) {
-                reader = std::make_unique<PlyReader>();
-            }
-            else if (file.hasExtension("pcd")) {
-                reader = std::make_unique<PcdReader>();
-            }
-            else {
-                throw Py::RuntimeError("Unsupported file extension");
-            }
+            std::unique_ptr<Reader> reader = createReader(file);
 
             reader->read(EncodedName);
 
@@ -213,25 +251,7 @@ private:
                 throw Py::RuntimeError("No file extension");
             }
 
-            std::unique_ptr<Reader> reader;
-            if (file.hasExtension("asc")) {
-                reader = std::make_unique<AscReader>();
-            }
-            else if (file.hasExtension("e57")) {
-                auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(std::get<0>(setting),
-                                                     std::get<1>(setting),
-                                                     std::get<2>(setting));
-            }
-            else if (file.hasExtension("ply")) {
-                reader = std::make_unique<PlyReader>();
-            }
-            else if (file.hasExtension("pcd")) {
-                reader = std::make_unique<PcdReader>();
-            }
-            else {
-                throw Py::RuntimeError("Unsupported file extension");
-            }
+            std::unique_ptr<Reader> reader = createReader(file);
 
             reader->read(EncodedName);
 
@@ -399,6 +419,229 @@ private:
         return Py::None();
     }
 
+    Py::Object buildOctree(const Py::Tuple& args)
+    {
+        char* Source {};
+        char* Target {};
+        unsigned long maxPoints = 65536;
+        if (!PyArg_ParseTuple(args.ptr(),
+                              "etet|k",
+                              "utf-8",
+                              &Source,
+                              "utf-8",
+                              &Target,
+                              &maxPoints)) {
+            throw Py::Exception();
+        }
+        std::string EncodedSource = std::string(Source);
+        PyMem_Free(Source);
+        std::string EncodedTarget = std::string(Target);
+        PyMem_Free(Target);
+
+        try {
+            Base::FileInfo file(EncodedSource);
+            if (file.extension().empty()) {
+                throw Py::RuntimeError("No file extension");
+            }
+
+            std::unique_ptr<Reader> reader = createReader(file);
+            OctreeBuilder builder(EncodedTarget, maxPoints);
+
+            // pass the points block by block to the octree so that the cloud is never
+            // completely in memory
+            PointChunk chunk;
+            reader->setChunkHandler([&builder, &chunk](const Reader& block) {
+                chunk.clear();
+                const PointKernel& kernel = block.getPoints();
+                chunk.points.reserve(kernel.size());
+                for (const auto& pnt : kernel) {
+                    chunk.points.push_back(Base::toVector<float>(pnt));
+                }
+                if (block.hasNormals()) {
+                    chunk.normals = block.getNormals();
+                }
+                if (block.hasColors()) {
+                    auto toByte = [](float value) {
+                        return static_cast<std::uint8_t>(
+                            std::clamp(value, 0.0F, 1.0F) * 255.0F + 0.5F);
+                    };
+                    const std::vector<App::Color>& colors = block.getColors();
+                    chunk.colors.reserve(colors.size());
+                    for (const auto& col : colors) {
+                        chunk.colors.push_back(
+                            {toByte(col.r), toByte(col.g), toByte(col.b), toByte(col.a)});
+                    }
+                }
+                if (block.hasIntensities()) {
+                    chunk.intensity = block.getIntensities();
+                }
+                builder.add(chunk);
+            });
+
+            reader->read(EncodedSource);
+            builder.finish();
+            return Py::Long(static_cast<unsigned long long>(builder.countPoints()));
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+    }
+
+    Py::Object insertOctree(const Py::Tuple& args)
+    {
+        char* Name {};
+        const char* DocName = nullptr;
+        if (!PyArg_ParseTuple(args.ptr(), "et|s", "utf-8", &Name, &DocName)) {
+            throw Py::Exception();
+        }
+        std::string EncodedName = std::string(Name);
+        PyMem_Free(Name);
+
+        try {
+            Base::FileInfo file(EncodedName);
+            App::Document* pcDoc = DocName ? App::GetApplication().getDocument(DocName)
+                                           : App::GetApplication().getActiveDocument();
+            if (!pcDoc) {
+                pcDoc = App::GetApplication().newDocument(DocName);
+            }
+
+            auto* pcFeature = pcDoc->addObject<Points::OctreeFeature>(file.fileNamePure().c_str());
+            pcFeature->File.setValue(EncodedName.c_str());
+            pcDoc->recomputeFeature(pcFeature);
+            return Py::asObject(pcFeature->getPyObject());
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+    }
+
+    static Points::Feature* getFeature(PyObject* obj)
+    {
+        auto object = static_cast<App::DocumentObjectPy*>(obj)->getDocumentObjectPtr();
+        auto feature = dynamic_cast<Points::Feature*>(object);
+        if (!feature) {
+            throw Py::TypeError("Points feature expected");
+        }
+        return feature;
+    }
+
+    template<typename PropertyT>
+    static PropertyT* getOrAddProperty(Points::Feature* feature, const char* name)
+    {
+        auto prop = dynamic_cast<PropertyT*>(feature->getPropertyByName(name));
+        if (!prop) {
+            prop = dynamic_cast<PropertyT*>(
+                feature->addDynamicProperty(PropertyT::getClassTypeId().getName(), name));
+        }
+        if (!prop) {
+            throw Py::RuntimeError(std::string("Cannot add property ") + name);
+        }
+        return prop;
+    }
+
+    Py::Object estimateNormals(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject* obj {};
+        int kSearch = 10;
+        double searchRadius = 0.0;
+        PyObject* curvature = Py_False;
+        static const std::array<const char*, 5> keywords {"Feature",
+                                                          "KSearch",
+                                                          "SearchRadius",
+                                                          "Curvature",
+                                                          nullptr};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(),
+                                                 kwds.ptr(),
+                                                 "O!|idO!",
+                                                 keywords,
+                                                 &(App::DocumentObjectPy::Type),
+                                                 &obj,
+                                                 &kSearch,
+                                                 &searchRadius,
+                                                 &PyBool_Type,
+                                                 &curvature)) {
+            throw Py::Exception();
+        }
+
+        try {
+            Points::Feature* feature = getFeature(obj);
+            KDTree tree(feature->Points.getValue());
+            NormalEstimation estimation(tree);
+            estimation.setKSearch(static_cast<std::size_t>(std::max(kSearch, 0)));
+            estimation.setSearchRadius(static_cast<float>(searchRadius));
+
+            std::vector<Base::Vector3f> normals;
+            if (Base::asBoolean(curvature)) {
+                std::vector<CurvatureInfo> curvatures;
+                estimation.perform(normals, curvatures);
+                getOrAddProperty<PropertyCurvatureList>(feature, "Curvature")
+                    ->setValues(curvatures);
+            }
+            else {
+                estimation.perform(normals);
+            }
+            getOrAddProperty<PropertyNormalList>(feature, "Normal")->setValues(normals);
+            return Py::None();
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+    }
+
+    Py::Object removeOutliers(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject* obj {};
+        int kSearch = 8;
+        double stdDevMul = 1.0;
+        static const std::array<const char*, 4> keywords {"Feature",
+                                                          "KSearch",
+                                                          "StdDevMul",
+                                                          nullptr};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(),
+                                                 kwds.ptr(),
+                                                 "O!|id",
+                                                 keywords,
+                                                 &(App::DocumentObjectPy::Type),
+                                                 &obj,
+                                                 &kSearch,
+                                                 &stdDevMul)) {
+            throw Py::Exception();
+        }
+
+        try {
+            Points::Feature* feature = getFeature(obj);
+
+            // the invalid points of a structured cloud have NaN coordinates and are skipped
+            std::vector<Base::Vector3f> points;
+            std::vector<unsigned long> indices;
+            const std::vector<Base::Vector3f>& basicPoints =
+                feature->Points.getValue().getBasicPoints();
+            for (std::size_t i = 0; i < basicPoints.size(); i++) {
+                const Base::Vector3f& pnt = basicPoints[i];
+                if (!(boost::math::isnan(pnt.x) || boost::math::isnan(pnt.y)
+                      || boost::math::isnan(pnt.z))) {
+                    points.push_back(pnt);
+                    indices.push_back(static_cast<unsigned long>(i));
+                }
+            }
+
+            KDTree tree(points);
+            StatisticalOutlierFilter filter(tree);
+            filter.setKSearch(static_cast<std::size_t>(std::max(kSearch, 0)));
+            filter.setStdDevMul(stdDevMul);
+
+            std::vector<unsigned long> outliers = filter.perform();
+            for (auto& index : outliers) {
+                index = indices[index];
+            }
+            feature->removeIndices(outliers);
+            return Py::Long(static_cast<unsigned long>(outliers.size()));
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+    }
+
     Py::Object show(const Py::Tuple& args)
     {
         PyObject* pcObj {};
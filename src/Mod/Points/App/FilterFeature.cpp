@@ -0,0 +1,377 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <climits>
+#include <numeric>
+#include <set>
+#include <string>
+#include <type_traits>
+#endif
+
+#include <Base/Converter.h>
+#include <Base/Exception.h>
+#include <Base/ThreadPool.h>
+
+#include "FilterFeature.h"
+#include "PointsFilter.h"
+#include "PointsKDTree.h"
+#include "Properties.h"
+
+
+namespace Points
+{
+const App::PropertyIntegerConstraint::Constraints intNeighbours = {0, INT_MAX, 1};
+}  // namespace Points
+
+using namespace Points;
+
+namespace
+{
+
+/// Returns the points in global coordinates
+std::vector<Base::Vector3f> getGlobalPoints(const PointKernel& kernel)
+{
+    const std::vector<Base::Vector3f>& points = kernel.getBasicPoints();
+    const Base::Matrix4D mat = kernel.getTransform();
+    std::vector<Base::Vector3f> global(points.size());
+    Base::parallel_for(points.size(), 10000, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            global[i] = mat * points[i];
+        }
+    });
+    return global;
+}
+
+/// Copies the values of \a indices if \a prop is a PropertyT with a value for each point
+template<typename PropertyT>
+bool copyValues(Feature* target,
+                const App::Property* prop,
+                std::size_t numPoints,
+                const std::vector<unsigned long>& indices)
+{
+    auto source = dynamic_cast<const PropertyT*>(prop);
+    if (!source || static_cast<std::size_t>(source->getSize()) != numPoints) {
+        return false;
+    }
+
+    auto copy = dynamic_cast<PropertyT*>(target->getPropertyByName(prop->getName()));
+    if (!copy) {
+        copy = dynamic_cast<PropertyT*>(
+            target->addDynamicProperty(PropertyT::getClassTypeId().getName(), prop->getName()));
+    }
+    if (!copy) {
+        return false;
+    }
+
+    const auto& values = source->getValues();
+    std::decay_t<decltype(values)> subset;
+    subset.reserve(indices.size());
+    for (unsigned long index : indices) {
+        subset.push_back(values[index]);
+    }
+    copy->setValues(subset);
+    return true;
+}
+
+}  // namespace
+
+PROPERTY_SOURCE(Points::Filter, Points::Feature)
+
+Filter::Filter()
+{
+    ADD_PROPERTY_TYPE(Source, (nullptr), "Filter", App::Prop_None, "The points to filter");
+}
+
+short Filter::mustExecute() const
+{
+    if (Source.isTouched()) {
+        return 1;
+    }
+    return Feature::mustExecute();
+}
+
+App::DocumentObjectExecReturn* Filter::execute()
+{
+    auto source = dynamic_cast<Feature*>(Source.getValue());
+    if (!source) {
+        return new App::DocumentObjectExecReturn("No points linked");
+    }
+
+    try {
+        copyPoints(*source, filter(source->Points.getValue()));
+    }
+    catch (const Base::Exception& e) {
+        return new App::DocumentObjectExecReturn(e.what());
+    }
+
+    return App::DocumentObject::StdReturn;
+}
+
+std::vector<unsigned long> Filter::filter(const PointKernel& kernel) const
+{
+    std::vector<unsigned long> indices(kernel.size());
+    std::iota(indices.begin(), indices.end(), 0UL);
+    return indices;
+}
+
+void Filter::copyPoints(const Feature& source, const std::vector<unsigned long>& indices)
+{
+    const PointKernel& kernel = source.Points.getValue();
+    const std::vector<Base::Vector3f>& points = kernel.getBasicPoints();
+
+    PointKernel subset;
+    subset.setTransform(kernel.getTransform());
+    std::vector<Base::Vector3f>& values = subset.getBasicPoints();
+    values.reserve(indices.size());
+    for (unsigned long index : indices) {
+        values.push_back(points[index]);
+    }
+
+    // carry along the per-point properties and clear those the source doesn't have any more
+    std::set<std::string> names;
+    std::vector<App::Property*> props;
+    source.getPropertyList(props);
+    for (auto prop : props) {
+        if (copyValues<PropertyNormalList>(this, prop, points.size(), indices)
+            || copyValues<PropertyGreyValueList>(this, prop, points.size(), indices)
+            || copyValues<PropertyCurvatureList>(this, prop, points.size(), indices)
+            || copyValues<App::PropertyColorList>(this, prop, points.size(), indices)) {
+            names.insert(prop->getName());
+        }
+    }
+
+    for (const auto& name : getDynamicPropertyNames()) {
+        App::Property* prop = getDynamicPropertyByName(name.c_str());
+        if (prop && names.count(name) == 0
+            && (prop->isDerivedFrom<PropertyNormalList>()
+                || prop->isDerivedFrom<PropertyGreyValueList>()
+                || prop->isDerivedFrom<PropertyCurvatureList>()
+                || prop->isDerivedFrom<App::PropertyColorList>())) {
+            static_cast<App::PropertyLists*>(prop)->setSize(0);
+        }
+    }
+
+    Points.setValue(subset);
+}
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(Points::VoxelGrid, Points::Filter)
+
+VoxelGrid::VoxelGrid()
+{
+    ADD_PROPERTY_TYPE(LeafSize, (1.0), "Filter", App::Prop_None, "The edge length of the cells");
+}
+
+short VoxelGrid::mustExecute() const
+{
+    if (LeafSize.isTouched()) {
+        return 1;
+    }
+    return Filter::mustExecute();
+}
+
+std::vector<unsigned long> VoxelGrid::filter(const PointKernel& kernel) const
+{
+    VoxelGridFilter voxel(kernel.getBasicPoints());
+    voxel.setLeafSize(static_cast<float>(LeafSize.getValue()));
+    return voxel.perform();
+}
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(Points::PoissonDisk, Points::Filter)
+
+PoissonDisk::PoissonDisk()
+{
+    ADD_PROPERTY_TYPE(Radius,
+                      (1.0),
+                      "Filter",
+                      App::Prop_None,
+                      "The minimum distance of the kept points");
+}
+
+short PoissonDisk::mustExecute() const
+{
+    if (Radius.isTouched()) {
+        return 1;
+    }
+    return Filter::mustExecute();
+}
+
+std::vector<unsigned long> PoissonDisk::filter(const PointKernel& kernel) const
+{
+    PoissonDiskFilter poisson(kernel.getBasicPoints());
+    poisson.setRadius(static_cast<float>(Radius.getValue()));
+    return poisson.perform();
+}
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(Points::CropBox, Points::Filter)
+
+CropBox::CropBox()
+{
+    ADD_PROPERTY_TYPE(Minimum,
+                      (Base::Vector3d()),
+                      "Filter",
+                      App::Prop_None,
+                      "The minimum corner of the box");
+    ADD_PROPERTY_TYPE(Maximum,
+                      (Base::Vector3d(1, 1, 1)),
+                      "Filter",
+                      App::Prop_None,
+                      "The maximum corner of the box");
+    ADD_PROPERTY_TYPE(Invert, (false), "Filter", App::Prop_None, "Keep the points outside the box");
+}
+
+short CropBox::mustExecute() const
+{
+    if (Minimum.isTouched() || Maximum.isTouched() || Invert.isTouched()) {
+        return 1;
+    }
+    return Filter::mustExecute();
+}
+
+std::vector<unsigned long> CropBox::filter(const PointKernel& kernel) const
+{
+    Base::BoundBox3f box;
+    box.Add(Base::convertTo<Base::Vector3f>(Minimum.getValue()));
+    box.Add(Base::convertTo<Base::Vector3f>(Maximum.getValue()));
+    std::vector<Base::Vector3f> points = getGlobalPoints(kernel);
+    CropFilter crop(points);
+    crop.setNegative(Invert.getValue());
+    return crop.perform(box);
+}
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(Points::CropPlane, Points::Filter)
+
+CropPlane::CropPlane()
+{
+    ADD_PROPERTY_TYPE(Origin, (Base::Vector3d()), "Filter", App::Prop_None, "A point on the plane");
+    ADD_PROPERTY_TYPE(Direction,
+                      (Base::Vector3d(0, 0, 1)),
+                      "Filter",
+                      App::Prop_None,
+                      "The normal of the plane pointing to the kept points");
+    ADD_PROPERTY_TYPE(Invert,
+                      (false),
+                      "Filter",
+                      App::Prop_None,
+                      "Keep the points on the other side of the plane");
+}
+
+short CropPlane::mustExecute() const
+{
+    if (Origin.isTouched() || Direction.isTouched() || Invert.isTouched()) {
+        return 1;
+    }
+    return Filter::mustExecute();
+}
+
+std::vector<unsigned long> CropPlane::filter(const PointKernel& kernel) const
+{
+    Base::Vector3f base = Base::convertTo<Base::Vector3f>(Origin.getValue());
+    Base::Vector3f normal = Base::convertTo<Base::Vector3f>(Direction.getValue());
+    std::vector<Base::Vector3f> points = getGlobalPoints(kernel);
+    CropFilter crop(points);
+    crop.setNegative(Invert.getValue());
+    return crop.perform(base, normal);
+}
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(Points::RadiusOutlierRemoval, Points::Filter)
+
+RadiusOutlierRemoval::RadiusOutlierRemoval()
+{
+    ADD_PROPERTY_TYPE(Radius, (1.0), "Filter", App::Prop_None, "The search radius");
+    ADD_PROPERTY_TYPE(MinNeighbours,
+                      (2),
+                      "Filter",
+                      App::Prop_None,
+                      "The minimum number of neighbours of a kept point");
+    MinNeighbours.setConstraints(&intNeighbours);
+}
+
+short RadiusOutlierRemoval::mustExecute() const
+{
+    if (Radius.isTouched() || MinNeighbours.isTouched()) {
+        return 1;
+    }
+    return Filter::mustExecute();
+}
+
+std::vector<unsigned long> RadiusOutlierRemoval::filter(const PointKernel& kernel) const
+{
+    KDTree tree(kernel);
+    RadiusOutlierFilter outlier(tree);
+    outlier.setRadius(static_cast<float>(Radius.getValue()));
+    outlier.setMinNeighbours(static_cast<std::size_t>(MinNeighbours.getValue()));
+    std::vector<unsigned long> outliers = outlier.perform();
+
+    std::vector<unsigned long> indices;
+    indices.reserve(kernel.size() - outliers.size());
+    auto it = outliers.begin();
+    for (unsigned long index = 0; index < kernel.size(); index++) {
+        if (it != outliers.end() && *it == index) {
+            ++it;
+        }
+        else {
+            indices.push_back(index);
+        }
+    }
+    return indices;
+}
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(Points::Deduplicate, Points::Filter)
+
+Deduplicate::Deduplicate()
+{
+    ADD_PROPERTY_TYPE(Tolerance,
+                      (0.0),
+                      "Filter",
+                      App::Prop_None,
+                      "Points closer than the tolerance are duplicates");
+}
+
+short Deduplicate::mustExecute() const
+{
+    if (Tolerance.isTouched()) {
+        return 1;
+    }
+    return Filter::mustExecute();
+}
+
+std::vector<unsigned long> Deduplicate::filter(const PointKernel& kernel) const
+{
+    DuplicateFilter duplicates(kernel.getBasicPoints());
+    duplicates.setTolerance(static_cast<float>(Tolerance.getValue()));
+    return duplicates.perform();
+}
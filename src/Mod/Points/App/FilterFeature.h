@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_FILTERFEATURE_H
+#define POINTS_FILTERFEATURE_H
+
+#include <vector>
+
+#include <App/PropertyLinks.h>
+#include <App/PropertyStandard.h>
+#include <App/PropertyUnits.h>
+
+#include "PointsFeature.h"
+
+
+namespace Points
+{
+
+/*! The Filter class is the base class of features that create a subset of the points of the
+  linked Points feature. The per-point properties of the source, i.e. normals, colors, intensities
+  and curvatures, are carried along. The base class itself copies all points.
+ */
+class PointsExport Filter: public Feature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::Filter);
+
+public:
+    /// Constructor
+    Filter();
+
+    /** @name Properties */
+    //@{
+    App::PropertyLink Source;
+    //@}
+
+    /** @name methods override Feature */
+    //@{
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    short mustExecute() const override;
+    //@}
+
+protected:
+    /// Returns the sorted indices of the points of \a kernel to keep
+    virtual std::vector<unsigned long> filter(const PointKernel& kernel) const;
+
+private:
+    void copyPoints(const Feature& source, const std::vector<unsigned long>& indices);
+};
+
+/*! The VoxelGrid class keeps one point of each occupied cell of a regular grid.
+ */
+class PointsExport VoxelGrid: public Filter
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::VoxelGrid);
+
+public:
+    /// Constructor
+    VoxelGrid();
+
+    App::PropertyLength LeafSize;
+
+    short mustExecute() const override;
+
+protected:
+    std::vector<unsigned long> filter(const PointKernel& kernel) const override;
+};
+
+/*! The PoissonDisk class keeps a subset of points where no two points are closer than the radius.
+ */
+class PointsExport PoissonDisk: public Filter
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::PoissonDisk);
+
+public:
+    /// Constructor
+    PoissonDisk();
+
+    App::PropertyLength Radius;
+
+    short mustExecute() const override;
+
+protected:
+    std::vector<unsigned long> filter(const PointKernel& kernel) const override;
+};
+
+/*! The CropBox class keeps the points inside or outside a box given in global coordinates.
+ */
+class PointsExport CropBox: public Filter
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::CropBox);
+
+public:
+    /// Constructor
+    CropBox();
+
+    App::PropertyVector Minimum;
+    App::PropertyVector Maximum;
+    App::PropertyBool Invert;
+
+    short mustExecute() const override;
+
+protected:
+    std::vector<unsigned long> filter(const PointKernel& kernel) const override;
+};
+
+/*! The CropPlane class keeps the points on the side of a plane its direction points to. The plane
+  is given in global coordinates.
+ */
+class PointsExport CropPlane: public Filter
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::CropPlane);
+
+public:
+    /// Constructor
+    CropPlane();
+
+    App::PropertyVector Origin;
+    App::PropertyVector Direction;
+    App::PropertyBool Invert;
+
+    short mustExecute() const override;
+
+protected:
+    std::vector<unsigned long> filter(const PointKernel& kernel) const override;
+};
+
+/*! The RadiusOutlierRemoval class removes points with too few neighbours within the radius.
+ */
+class PointsExport RadiusOutlierRemoval: public Filter
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::RadiusOutlierRemoval);
+
+public:
+    /// Constructor
+    RadiusOutlierRemoval();
+
+    App::PropertyLength Radius;
+    App::PropertyIntegerConstraint MinNeighbours;
+
+    short mustExecute() const override;
+
+protected:
+    std::vector<unsigned long> filter(const PointKernel& kernel) const override;
+};
+
+/*! The Deduplicate class removes points that are closer than the tolerance to a kept point.
+ */
+class PointsExport Deduplicate: public Filter
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::Deduplicate);
+
+public:
+    /// Constructor
+    Deduplicate();
+
+    App::PropertyLength Tolerance;
+
+    short mustExecute() const override;
+
+protected:
+    std::vector<unsigned long> filter(const PointKernel& kernel) const override;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_FILTERFEATURE_H
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#include <boost/lexical_cast/try_lexical_convert.hpp>
+
+#include <Base/Exception.h>
+#include <Base/Sequencer.h>
+#include <Base/ThreadPool.h>
+
+#include "LineParser.h"
+
+
+using namespace Points;
+
+void LineTokenizer::split(std::string_view line, std::vector<std::string_view>& tokens)
+{
+    auto isSeparator = [](char ch) {
+        return ch == ' ' || ch == '\t' || ch == '\r';
+    };
+
+    tokens.clear();
+    while (!line.empty() && Base::LineScanner::isSpace(line.front())) {
+        line.remove_prefix(1);
+    }
+    while (!line.empty() && Base::LineScanner::isSpace(line.back())) {
+        line.remove_suffix(1);
+    }
+
+    // the trimmed line neither starts nor ends with a separator
+    std::size_t start = 0;
+    for (std::size_t pos = 0; pos < line.size(); pos++) {
+        if (isSeparator(line[pos])) {
+            if (pos > start) {
+                tokens.push_back(line.substr(start, pos - start));
+            }
+            start = pos + 1;
+        }
+    }
+    tokens.push_back(line.substr(start));
+}
+
+bool LineTokenizer::parseReal(std::string_view token, double& value)
+{
+    if (Base::LineScanner::parseNumber(token, value)) {
+        return true;
+    }
+    // special values like "nan" or "inf" and values out of range
+    return boost::conversion::try_lexical_convert(token.data(), token.size(), value);
+}
+
+// ----------------------------------------------------------------------------
+
+AsciiTableReader::AsciiTableReader(std::istream& input, Base::SequencerLauncher* seq)
+    : reader(input)
+    , seq(seq)
+{}
+
+bool AsciiTableReader::fetchLine()
+{
+    const std::vector<std::string_view>* lines = &reader.lines();
+    while (lineIndex >= lines->size() || (*lines)[lineIndex].empty()) {
+        if (lineIndex < lines->size()) {
+            ++lineIndex;
+        }
+        else if (reader.next()) {
+            lines = &reader.lines();
+            lineIndex = 0;
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AsciiTableReader::skipLines(std::size_t count)
+{
+    for (std::size_t i = 0; i < count && fetchLine(); i++) {
+        ++lineIndex;
+    }
+}
+
+Eigen::Index AsciiTableReader::read(Eigen::MatrixXd& data)
+{
+    const std::size_t minParallelLines = 10000;
+    const Eigen::Index numFields = data.cols();
+
+    // collect the lines of the current block and parse them concurrently
+    Eigen::Index row = 0;
+    std::vector<std::string_view> rows;
+    while (row < data.rows() && fetchLine()) {
+        const std::vector<std::string_view>& lines = reader.lines();
+        rows.clear();
+        for (; lineIndex < lines.size() && row + Eigen::Index(rows.size()) < data.rows();
+             lineIndex++) {
+            if (!lines[lineIndex].empty()) {
+                rows.push_back(lines[lineIndex]);
+            }
+        }
+
+        Base::parallel_for(rows.size(), minParallelLines, [&](std::size_t begin, std::size_t end) {
+            std::vector<std::string_view> tokens;
+            for (std::size_t i = begin; i < end; i++) {
+                LineTokenizer::split(rows[i], tokens);
+                Eigen::Index size = Eigen::Index(tokens.size());
+                for (Eigen::Index col = 0; col < size && col < numFields; col++) {
+                    double value {};
+                    if (!LineTokenizer::parseReal(tokens[col], value)) {
+                        throw Base::BadFormatError("Invalid number in data section");
+                    }
+                    data(row + Eigen::Index(i), col) = value;
+                }
+            }
+        });
+
+        row += Eigen::Index(rows.size());
+        numRows += rows.size();
+        if (seq) {
+            seq->setProgress(numRows);
+        }
+    }
+
+    return row;
+}
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_LINEPARSER_H
+#define POINTS_LINEPARSER_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <Base/LineParser.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+namespace Base
+{
+class SequencerLauncher;
+}
+
+namespace Points
+{
+
+/** Splits lines into tokens and parses numbers like the boost functions they replace
+ * in the readers. Lines with a fixed layout are better scanned with Base::LineScanner.
+ */
+class PointsExport LineTokenizer
+{
+public:
+    /** Splits \a line like boost::trim() followed by boost::split() at "\t\r " with
+     * token_compress_on. So a line of whitespace gives a single empty token.
+     */
+    static void split(std::string_view line, std::vector<std::string_view>& tokens);
+
+    /// Parses a token like boost::lexical_cast<double>() does
+    static bool parseReal(std::string_view token, double& value);
+};
+
+/** Reads rows of whitespace separated numbers into a matrix, as stored in the data section
+ * of ASCII PLY or PCD files. The lines of a block are parsed in parallel.
+ */
+class PointsExport AsciiTableReader
+{
+public:
+    /// If \a seq is set the number of read rows is reported to it
+    explicit AsciiTableReader(std::istream& input, Base::SequencerLauncher* seq = nullptr);
+
+    /// Skips the next \a count lines that aren't empty
+    void skipLines(std::size_t count);
+    /** Reads the next lines that aren't empty into the rows of \a data. The tokens of a line
+     * are parsed with LineTokenizer::parseReal() into the columns, surplus tokens are ignored
+     * and the columns of missing ones are left unchanged. A Base::BadFormatError is thrown for
+     * an invalid number.
+     * Returns the number of read rows, which is less than the rows of \a data only if the
+     * stream ends before.
+     */
+    Eigen::Index read(Eigen::MatrixXd& data);
+    /// Returns the number of rows read so far
+    std::size_t countRows() const
+    {
+        return numRows;
+    }
+
+private:
+    bool fetchLine();
+
+private:
+    Base::LineBlockReader reader;
+    Base::SequencerLauncher* seq;
+    std::size_t lineIndex {0};
+    std::size_t numRows {0};
+};
+
+}  // namespace Points
+
+#endif  // POINTS_LINEPARSER_H
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+
+#include "OctreeFeature.h"
+
+
+using namespace Points;
+
+PROPERTY_SOURCE(Points::OctreeFeature, App::GeoFeature)
+
+OctreeFeature::OctreeFeature()
+{
+    ADD_PROPERTY_TYPE(File, (""), "Octree", App::Prop_None, "The file of the point octree");
+}
+
+std::shared_ptr<const OctreeFile> OctreeFeature::getOctree() const
+{
+    if (octree && octree->isOpen()) {
+        return octree;
+    }
+    return {};
+}
+
+short OctreeFeature::mustExecute() const
+{
+    if (File.isTouched()) {
+        return 1;
+    }
+    return App::GeoFeature::mustExecute();
+}
+
+App::DocumentObjectExecReturn* OctreeFeature::execute()
+{
+    if (!getOctree()) {
+        return new App::DocumentObjectExecReturn("Cannot read octree file");
+    }
+    return App::DocumentObject::StdReturn;
+}
+
+void OctreeFeature::onChanged(const App::Property* prop)
+{
+    if (prop == &File) {
+        // A new object is created so that a view still rendering the old octree keeps it
+        octree.reset();
+        if (File.getValue()[0] != '\0') {
+            try {
+                auto file = std::make_shared<OctreeFile>();
+                file->open(File.getValue());
+                octree = file;
+            }
+            catch (const Base::Exception& e) {
+                Base::Console().Error("%s: %s\n", getFullName().c_str(), e.what());
+            }
+        }
+    }
+
+    App::GeoFeature::onChanged(prop);
+}
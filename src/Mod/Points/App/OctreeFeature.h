@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_OCTREEFEATURE_H
+#define POINTS_OCTREEFEATURE_H
+
+#include <memory>
+
+#include <App/GeoFeature.h>
+#include <App/PropertyFile.h>
+
+#include "PointsOctree.h"
+
+
+namespace Points
+{
+
+/*! The OctreeFeature class references a point cloud that is stored out-of-core in an octree
+  file. Unlike Feature it doesn't hold the points in memory, so it can be used for clouds of
+  any size. The points are given in the local coordinate system of the feature, i.e. the
+  Placement must be applied to them.
+ */
+class PointsExport OctreeFeature: public App::GeoFeature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::OctreeFeature);
+
+public:
+    /// Constructor
+    OctreeFeature();
+
+    App::PropertyFile File; /**< The octree file. */
+
+    /// Returns the opened octree, or null if the file cannot be read.
+    std::shared_ptr<const OctreeFile> getOctree() const;
+
+    /** @name methods override Feature */
+    //@{
+    short mustExecute() const override;
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    /// returns the type name of the ViewProvider
+    const char* getViewProviderName() const override
+    {
+        return "PointsGui::ViewProviderOctree";
+    }
+    //@}
+
+protected:
+    void onChanged(const App::Property* prop) override;
+
+private:
+    std::shared_ptr<OctreeFile> octree;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_OCTREEFEATURE_H
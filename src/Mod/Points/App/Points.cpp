@@ -198,6 +198,11 @@ void PointKernel::SaveDocFile(Base::Writer& writer) const
     }
 }
 
+bool PointKernel::canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const
+{
+    return true;
+}
+
 void PointKernel::Restore(Base::XMLReader& reader)
 {
     clear();
@@ -215,20 +220,42 @@ void PointKernel::Restore(Base::XMLReader& reader)
     }
 }
 
-void PointKernel::RestoreDocFile(Base::Reader& reader)
+namespace
+{
+void readPoints(Base::Reader& reader, std::vector<PointKernel::value_type>& points)
 {
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
-    _Points.resize(uCt);
+    points.resize(uCt);
     for (unsigned long i = 0; i < uCt; i++) {
         float x {};
         float y {};
         float z {};
         str >> x >> y >> z;
-        _Points[i].Set(x, y, z);
+        points[i].Set(x, y, z);
     }
 }
+}  // namespace
+
+void PointKernel::RestoreDocFile(Base::Reader& reader)
+{
+    readPoints(reader, _Points);
+}
+
+bool PointKernel::canRestoreDocFileConcurrently() const
+{
+    return true;
+}
+
+std::function<void()> PointKernel::RestoreDocFileConcurrently(Base::Reader& reader)
+{
+    auto points = std::make_shared<std::vector<value_type>>();
+    readPoints(reader, *points);
+    return [this, points]() {
+        _Points.swap(*points);
+    };
+}
 
 void PointKernel::save(const char* file) const
 {
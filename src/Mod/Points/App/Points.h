@@ -114,8 +114,11 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer& writer) const override;
     void SaveDocFile(Base::Writer& writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canRestoreDocFileConcurrently() const override;
+    std::function<void()> RestoreDocFileConcurrently(Base::Reader& reader) override;
     void save(const char* file) const;
     void save(std::ostream&) const;
     void load(const char* file);
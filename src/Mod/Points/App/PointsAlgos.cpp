@@ -31,22 +31,88 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>  // needed for compilation on some systems
-#include <boost/regex.hpp>
 #endif
 
 #include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/LineParser.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/ThreadPool.h>
 
+#include "LineParser.h"
 #include "PointsAlgos.h"
 #include <E57Format.h>
 
 
 using namespace Points;
 
+namespace
+{
+
+/** Parses a line of three numbers like the regular expression ^\s*N\s+N\s+N\s*$ with
+ * N = [-+]?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)?
+ */
+bool parsePoint(std::string_view line, Base::Vector3d& pt)
+{
+    Base::LineScanner scanner(line);
+    return Base::LineScanner::parseDecimal(scanner.token(), pt.x)
+        && Base::LineScanner::parseDecimal(scanner.token(), pt.y)
+        && Base::LineScanner::parseDecimal(scanner.token(), pt.z) && scanner.atEnd();
+}
+
+/** Reads the points of an ASCII file, lines that aren't points are skipped.
+ * The lines of a block are parsed concurrently and transformed with \a mat. Then \a func is
+ * called with the points of the block and the read fraction of the file.
+ */
+void readAsciiPoints(const Base::FileInfo& fi,
+                     const Base::Matrix4D& mat,
+                     const std::function<void(const std::vector<Base::Vector3f>&, double)>& func)
+{
+    const std::size_t minParallelLines = 10000;
+    Base::ifstream file(fi, std::ios::in | std::ios::binary);
+    file.seekg(0, std::ios::end);
+    std::size_t fileSize = std::max<std::size_t>(static_cast<std::size_t>(file.tellg()), 1);
+    file.seekg(0, std::ios::beg);
+    Base::SequencerLauncher seq("Loading points...", fileSize);
+
+    std::vector<Base::Vector3f> points;
+    std::vector<char> valid;
+    Base::LineBlockReader reader(file);
+    while (reader.next()) {
+        const std::vector<std::string_view>& lines = reader.lines();
+        points.resize(lines.size());
+        valid.assign(lines.size(), 0);
+        Base::parallel_for(lines.size(), minParallelLines, [&](std::size_t begin, std::size_t end) {
+            Base::Vector3d pt;
+            for (std::size_t i = begin; i < end; i++) {
+                if (parsePoint(lines[i], pt)) {
+                    pt = mat * pt;
+                    points[i].Set(static_cast<float>(pt.x),
+                                  static_cast<float>(pt.y),
+                                  static_cast<float>(pt.z));
+                    valid[i] = 1;
+                }
+            }
+        });
+
+        // keep the order of the points
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < lines.size(); i++) {
+            if (valid[i]) {
+                points[count++] = points[i];
+            }
+        }
+        points.resize(count);
+
+        func(points, double(reader.bytesRead()) / double(fileSize));
+        seq.setProgress(reader.bytesRead());
+    }
+}
+
+}  // namespace
 void PointsAlgos::Load(PointKernel& points, const char* FileName)
 {
     Base::FileInfo File(FileName);
@@ -66,60 +132,26 @@ void PointsAlgos::Load(PointKernel& points, const char* FileName)
 
 void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
 {
-    boost::regex rx("^\\s*([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                    "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                    "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    // boost::regex rx("(\\b[0-9]+\\.([0-9]+\\b)?|\\.[0-9]+\\b)");
-    // boost::regex
-    // rx("^\\s*(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s*$");
-    boost::cmatch what;
-
-    Base::Vector3d pt;
-    int LineCnt = 0;
-    std::string line;
     Base::FileInfo fi(FileName);
+    Base::Matrix4D mat(points.getTransform());
+    mat.inverse();
 
-    Base::ifstream tmp_str(fi, std::ios::in);
-
-    // estimating size
-    while (std::getline(tmp_str, line)) {
-        LineCnt++;
-    }
-
-    // resize the PointKernel
-    points.resize(LineCnt);
-
-    Base::SequencerLauncher seq("Loading points...", LineCnt);
-
-    // again to the beginning
-    Base::ifstream file(fi, std::ios::in);
-    LineCnt = 0;
-
+    std::vector<PointKernel::value_type> kernel;
     try {
-        // read file
-        while (std::getline(file, line)) {
-            if (boost::regex_match(line.c_str(), what, rx)) {
-                pt.x = std::atof(what[1].first);
-                pt.y = std::atof(what[4].first);
-                pt.z = std::atof(what[7].first);
-
-                points.setPoint(LineCnt, pt);
-                seq.next();
-                LineCnt++;
+        readAsciiPoints(fi, mat, [&kernel](const std::vector<Base::Vector3f>& block, double read) {
+            // estimate the number of points from the first block
+            if (kernel.empty() && read > 0.0) {
+                kernel.reserve(static_cast<std::size_t>(double(block.size()) / read) + 1);
             }
-        }
+            kernel.insert(kernel.end(), block.begin(), block.end());
+        });
     }
     catch (...) {
         points.clear();
         throw Base::BadFormatError("Reading in points failed.");
     }
 
-    // now remove the last points from the kernel
-    // Note: first we allocate memory corresponding to the number of lines (points and comments)
-    //       and read in the file twice. But then the size of the kernel is too high
-    if (LineCnt < (int)points.size()) {
-        points.erase(LineCnt, points.size());
-    }
+    points.swap(kernel);
 }
 
 // ----------------------------------------------------------------------------
@@ -190,15 +222,72 @@ int Reader::getHeight() const
     return height;
 }
 
+void Reader::setChunkHandler(const std::function<void(const Reader&)>& handler,
+                             std::size_t chunkSize)
+{
+    this->chunkHandler = handler;
+    this->chunkSize = handler ? std::max<std::size_t>(chunkSize, 1) : 0;
+}
+
+std::size_t Reader::getChunkSize() const
+{
+    return chunkSize;
+}
+
+void Reader::flushChunk()
+{
+    if (chunkHandler) {
+        if (points.size() > 0) {
+            chunkHandler(*this);
+        }
+        points.clear();
+        clear();
+    }
+}
+
 // ----------------------------------------------------------------------------
 
 AscReader::AscReader() = default;
 
 void AscReader::read(const std::string& filename)
 {
-    points.load(filename.c_str());
     this->height = 1;
-    this->width = points.size();
+    std::size_t chunkSize = getChunkSize();
+    if (chunkSize == 0) {
+        points.load(filename.c_str());
+        this->width = points.size();
+        return;
+    }
+
+    // the points are passed to the chunk handler while the file is read
+    Base::FileInfo fi(filename);
+    if (!fi.isReadable()) {
+        throw Base::FileException("File to load not existing or not readable", filename);
+    }
+
+    Base::Matrix4D mat(points.getTransform());
+    mat.inverse();
+
+    std::size_t numPoints = 0;
+    std::vector<PointKernel::value_type> chunk;
+    auto flush = [&]() {
+        numPoints += chunk.size();
+        points.swap(chunk);
+        flushChunk();
+        chunk.clear();
+    };
+
+    readAsciiPoints(fi, mat, [&](const std::vector<Base::Vector3f>& block, double) {
+        for (const auto& pt : block) {
+            chunk.push_back(pt);
+            if (chunk.size() == chunkSize) {
+                flush();
+            }
+        }
+    });
+    flush();
+
+    this->width = static_cast<int>(numPoints);
 }
 
 // ----------------------------------------------------------------------------
@@ -562,17 +651,6 @@ void PlyReader::read(const std::string& filename)
     this->width = numPoints;
     this->height = 1;
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
-    }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
-    }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
-    }
-
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
@@ -665,55 +743,82 @@ void PlyReader::read(const std::string& filename)
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (red != max_size && green != max_size && blue != max_size);
 
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
+    // the lines of the data section are read and parsed block by block
+    std::unique_ptr<Base::SequencerLauncher> seq;
+    std::unique_ptr<AsciiTableReader> table;
+    if (format == "ascii") {
+        seq = std::make_unique<Base::SequencerLauncher>("Reading points...", numPoints);
+        table = std::make_unique<AsciiTableReader>(inp, seq.get());
+        table->skipLines(offset);
     }
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+    // with a chunk handler the points are read and passed block by block
+    Eigen::Index chunk = getChunkSize() > 0 ? Eigen::Index(getChunkSize()) : numPoints;
+    for (Eigen::Index start = 0; start < numPoints; start += chunk) {
+        Eigen::Index rows = std::min(chunk, numPoints - start);
+        Eigen::MatrixXd data(rows, fields.size());
+        if (format == "ascii") {
+            table->read(data);
+        }
+        else if (format == "binary_little_endian") {
+            readBinary(false, inp, start == 0 ? offset : 0, types, sizes, data);
+        }
+        else if (format == "binary_big_endian") {
+            readBinary(true, inp, start == 0 ? offset : 0, types, sizes, data);
         }
-    }
 
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(static_cast<float>(data(i, greyvalue)));
+        if (hasData) {
+            points.reserve(rows);
+            for (Eigen::Index i = 0; i < rows; i++) {
+                points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+            }
         }
-    }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        float a = 1.0;
-        if (types[red] == "uchar") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(static_cast<float>(r) / 255.0F,
-                                    static_cast<float>(g) / 255.0F,
-                                    static_cast<float>(b) / 255.0F,
-                                    static_cast<float>(a) / 255.0F);
+        if (hasData && hasNormal) {
+            normals.reserve(rows);
+            for (Eigen::Index i = 0; i < rows; i++) {
+                normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
             }
         }
-        else if (types[red] == "float") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
+
+        if (hasData && hasIntensity) {
+            intensity.reserve(rows);
+            for (Eigen::Index i = 0; i < rows; i++) {
+                intensity.push_back(static_cast<float>(data(i, greyvalue)));
+            }
+        }
+
+        if (hasData && hasColor) {
+            colors.reserve(rows);
+            float a = 1.0;
+            if (types[red] == "uchar") {
+                for (Eigen::Index i = 0; i < rows; i++) {
+                    float r = static_cast<float>(data(i, red));
+                    float g = static_cast<float>(data(i, green));
+                    float b = static_cast<float>(data(i, blue));
+                    if (alpha != max_size) {
+                        a = static_cast<float>(data(i, alpha));
+                    }
+                    colors.emplace_back(static_cast<float>(r) / 255.0F,
+                                        static_cast<float>(g) / 255.0F,
+                                        static_cast<float>(b) / 255.0F,
+                                        static_cast<float>(a) / 255.0F);
+                }
+            }
+            else if (types[red] == "float") {
+                for (Eigen::Index i = 0; i < rows; i++) {
+                    float r = static_cast<float>(data(i, red));
+                    float g = static_cast<float>(data(i, green));
+                    float b = static_cast<float>(data(i, blue));
+                    if (alpha != max_size) {
+                        a = static_cast<float>(data(i, alpha));
+                    }
+                    colors.emplace_back(r, g, b, a);
                 }
-                colors.emplace_back(r, g, b, a);
             }
         }
+
+        flushChunk();
     }
 }
 
@@ -887,39 +992,6 @@ std::size_t PlyReader::readHeader(std::istream& in,
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
-{
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        if (offset > 0) {
-            offset--;
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
-}
-
 void PlyReader::readBinary(bool swapByteOrder,
                            std::istream& inp,
                            std::size_t offset,
@@ -1036,14 +1108,10 @@ void PcdReader::read(const std::string& filename)
     std::vector<int> sizes;
     Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, data);
-    }
-    else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
-    }
-    else if (format == "binary_compressed") {
+    // the compressed data is stored field by field and thus must be read at once
+    Eigen::MatrixXd compressedData;
+    if (format == "binary_compressed") {
+        compressedData.resize(numPoints, fields.size());
         unsigned int c {};
         unsigned int u {};
         Base::InputStream str(inp);
@@ -1056,7 +1124,7 @@ void PcdReader::read(const std::string& filename)
             DataStreambuf ibuf(uncompressed);
             std::istream istr(nullptr);
             istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
+            readBinary(true, istr, types, sizes, compressedData);
         }
         else {
             throw Base::BadFormatError("Failed to decompress binary data");
@@ -1140,49 +1208,75 @@ void PcdReader::read(const std::string& filename)
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (rgba != max_size);
 
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
+    // the lines of the data section are read and parsed block by block
+    std::unique_ptr<Base::SequencerLauncher> seq;
+    std::unique_ptr<AsciiTableReader> table;
+    if (format == "ascii") {
+        seq = std::make_unique<Base::SequencerLauncher>("Reading points...", numPoints);
+        table = std::make_unique<AsciiTableReader>(inp, seq.get());
     }
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+    // with a chunk handler the points are read and passed block by block
+    Eigen::Index chunk = getChunkSize() > 0 ? Eigen::Index(getChunkSize()) : numPoints;
+    for (Eigen::Index start = 0; start < numPoints; start += chunk) {
+        Eigen::Index rows = std::min(chunk, numPoints - start);
+        Eigen::MatrixXd data(rows, fields.size());
+        if (format == "ascii") {
+            table->read(data);
+        }
+        else if (format == "binary") {
+            readBinary(false, inp, types, sizes, data);
+        }
+        else if (format == "binary_compressed") {
+            data = compressedData.middleRows(start, rows);
         }
-    }
 
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(data(i, greyvalue));
+        if (hasData) {
+            points.reserve(rows);
+            for (Eigen::Index i = 0; i < rows; i++) {
+                points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+            }
         }
-    }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                uint32_t packed = static_cast<uint32_t>(data(i, rgba));
-                App::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
+        if (hasData && hasNormal) {
+            normals.reserve(rows);
+            for (Eigen::Index i = 0; i < rows; i++) {
+                normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
             }
         }
-        else if (types[rgba] == "F") {
-            static_assert(sizeof(float) == sizeof(uint32_t),
-                          "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float f = static_cast<float>(data(i, rgba));
-                uint32_t packed {};
-                std::memcpy(&packed, &f, sizeof(packed));
-                App::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
+
+        if (hasData && hasIntensity) {
+            intensity.reserve(rows);
+            for (Eigen::Index i = 0; i < rows; i++) {
+                intensity.push_back(data(i, greyvalue));
+            }
+        }
+
+        if (hasData && hasColor) {
+            colors.reserve(rows);
+            if (types[rgba] == "U") {
+                for (Eigen::Index i = 0; i < rows; i++) {
+                    uint32_t packed = static_cast<uint32_t>(data(i, rgba));
+                    App::Color col;
+                    col.setPackedARGB(packed);
+                    colors.emplace_back(col);
+                }
+            }
+            else if (types[rgba] == "F") {
+                static_assert(sizeof(float) == sizeof(uint32_t),
+                              "float and uint32_t have different sizes");
+                for (Eigen::Index i = 0; i < rows; i++) {
+                    float f = static_cast<float>(data(i, rgba));
+                    uint32_t packed {};
+                    std::memcpy(&packed, &f, sizeof(packed));
+                    App::Color col;
+                    col.setPackedARGB(packed);
+                    colors.emplace_back(col);
+                }
             }
         }
+
+        flushChunk();
     }
 }
 
@@ -1257,34 +1351,6 @@ std::size_t PcdReader::readHeader(std::istream& in,
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
-{
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
-}
-
 void PcdReader::readBinary(bool transpose,
                            std::istream& inp,
                            const std::vector<std::string>& types,
@@ -1433,6 +1499,29 @@ public:
         return normals;
     }
 
+    /// Sets a function that is called as soon as at least \a size points are read
+    void setChunkHandler(const std::function<void()>& handler, std::size_t size)
+    {
+        chunkHandler = handler;
+        chunkSize = size;
+    }
+
+    /// Moves the read points and their properties to the given arrays
+    void takeData(PointKernel& pts,
+                  std::vector<Base::Vector3f>& nor,
+                  std::vector<App::Color>& col,
+                  std::vector<float>& inty)
+    {
+        pts = std::move(points);
+        nor = std::move(normals);
+        col = std::move(colors);
+        inty = std::move(intensity);
+        points.clear();
+        normals.clear();
+        colors.clear();
+        intensity.clear();
+    }
+
 private:
     void readData3D(const e57::VectorNode& data3D)
     {
@@ -1676,6 +1765,10 @@ private:
                     }
                 }
             }
+
+            if (chunkHandler && points.size() >= chunkSize) {
+                chunkHandler();
+            }
         }
     }
 
@@ -1769,6 +1862,8 @@ private:
     bool checkState;
     double minDistance;
     const size_t buf_size = 1024;
+    std::function<void()> chunkHandler;
+    std::size_t chunkSize {0};
     std::vector<App::Color> colors;
     std::vector<float> intensity;
     PointKernel points;
@@ -1786,12 +1881,18 @@ void E57Reader::read(const std::string& filename)
 {
     try {
         E57ReaderImp reader(filename, useColor, checkState, minDistance);
+        std::size_t numPoints = 0;
+        auto transfer = [&]() {
+            reader.takeData(points, normals, colors, intensity);
+            numPoints += points.size();
+            flushChunk();
+        };
+        if (getChunkSize() > 0) {
+            reader.setChunkHandler(transfer, getChunkSize());
+        }
         reader.read();
-        points = reader.getPoints();
-        normals = reader.getNormals();
-        colors = reader.getColors();
-        intensity = reader.getItensity();
-        width = points.size();
+        transfer();
+        width = numPoints;
         height = 1;
     }
     catch (const Base::BadFormatError&) {
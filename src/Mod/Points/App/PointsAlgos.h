@@ -23,6 +23,8 @@
 #ifndef _PointsAlgos_h_
 #define _PointsAlgos_h_
 
+#include <functional>
+
 #include <Eigen/Core>
 
 #include "Points.h"
@@ -64,12 +66,24 @@ public:
     bool isStructured() const;
     int getWidth() const;
     int getHeight() const;
+    /** Sets a function that is called for every block of about \a chunkSize points.
+     * After the handler has returned the points and their properties are removed from
+     * the reader, so that files of any size can be processed with bounded memory.
+     */
+    void setChunkHandler(const std::function<void(const Reader&)>& handler,
+                         std::size_t chunkSize = 65536);
 
     Reader(const Reader&) = delete;
     Reader(Reader&&) = delete;
     Reader& operator=(const Reader&) = delete;
     Reader& operator=(Reader&&) = delete;
 
+protected:
+    /// Returns the number of points per block, or 0 if no chunk handler is set
+    std::size_t getChunkSize() const;
+    /// Passes the read points to the chunk handler and clears them afterwards
+    void flushChunk();
+
 protected:
     // NOLINTBEGIN
     PointKernel points;
@@ -79,6 +93,10 @@ protected:
     int width {0};
     int height {1};
     // NOLINTEND
+
+private:
+    std::function<void(const Reader&)> chunkHandler;
+    std::size_t chunkSize {0};
 };
 
 class PointsExport AscReader: public Reader
@@ -101,7 +119,6 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
     void readBinary(bool swapByteOrder,
                     std::istream&,
                     std::size_t offset,
@@ -122,7 +139,6 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
     void readBinary(bool transpose,
                     std::istream&,
                     const std::vector<std::string>& types,
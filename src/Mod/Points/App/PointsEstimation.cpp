@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#endif
+
+#include <Eigen/Eigenvalues>
+
+#include <Base/ThreadPool.h>
+
+#include "PointsEstimation.h"
+#include "PointsKDTree.h"
+
+
+using namespace Points;
+
+namespace
+{
+
+Base::Vector3f toVector(const Eigen::Vector3d& v)
+{
+    return Base::Vector3f(static_cast<float>(v.x()),
+                          static_cast<float>(v.y()),
+                          static_cast<float>(v.z()));
+}
+
+/** Fits the height function w = a*u^2 + b*u*v + c*v^2 + d*u + e*v + f over the tangent plane of
+ * \a pnt to its neighbours and computes the principal curvatures at \a pnt from it.
+ */
+void fitCurvature(const KDTree& tree,
+                  const std::vector<unsigned long>& neighbours,
+                  const Eigen::Vector3d& pnt,
+                  const Eigen::Vector3d& normal,
+                  const Eigen::Vector3d& tangent,
+                  CurvatureInfo& info)
+{
+    using Matrix6d = Eigen::Matrix<double, 6, 6>;
+    using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+    const Eigen::Vector3d binormal = normal.cross(tangent);
+
+    // scale the neighbourhood to unit size for a well-conditioned system
+    double scale = 0.0;
+    for (unsigned long index : neighbours) {
+        const Base::Vector3f& pt = tree.getPoint(index);
+        scale += (Eigen::Vector3d(pt.x, pt.y, pt.z) - pnt).squaredNorm();
+    }
+    scale = std::sqrt(scale / double(neighbours.size()));
+    if (scale <= 0.0) {
+        return;
+    }
+
+    Matrix6d ata = Matrix6d::Zero();
+    Vector6d atb = Vector6d::Zero();
+    for (unsigned long index : neighbours) {
+        const Base::Vector3f& pt = tree.getPoint(index);
+        Eigen::Vector3d d = (Eigen::Vector3d(pt.x, pt.y, pt.z) - pnt) / scale;
+        double u = d.dot(tangent);
+        double v = d.dot(binormal);
+        double w = d.dot(normal);
+        Vector6d row;
+        row << u * u, u * v, v * v, u, v, 1.0;
+        ata += row * row.transpose();
+        atb += row * w;
+    }
+
+    Eigen::LDLT<Matrix6d> ldlt(ata);
+    if (ldlt.info() != Eigen::Success) {
+        return;
+    }
+    Vector6d coeff = ldlt.solve(atb);
+    if (!coeff.allFinite()) {
+        return;
+    }
+
+    // first and second fundamental form of the Monge patch at the origin
+    double fx = coeff(3);
+    double fy = coeff(4);
+    double fxx = 2.0 * coeff(0);
+    double fxy = coeff(1);
+    double fyy = 2.0 * coeff(2);
+    double E = 1.0 + fx * fx;
+    double F = fx * fy;
+    double G = 1.0 + fy * fy;
+    double W = std::sqrt(1.0 + fx * fx + fy * fy);
+    double L = fxx / W;
+    double M = fxy / W;
+    double N = fyy / W;
+    double det = E * G - F * F;
+
+    double mean = (E * N - 2.0 * F * M + G * L) / (2.0 * det);
+    double gauss = (L * N - M * M) / det;
+    double disc = std::sqrt(std::max(mean * mean - gauss, 0.0));
+    double curv1 = mean + disc;
+    double curv2 = mean - disc;
+
+    // the principal directions are the eigenvectors of the shape operator
+    Eigen::Matrix2d shape;
+    shape << G * L - F * M, G * M - F * N, E * M - F * L, E * N - F * M;
+    shape /= det;
+    auto direction = [&](double curv) {
+        Eigen::Vector2d dir(shape(0, 1), curv - shape(0, 0));
+        if (dir.squaredNorm() < 1e-20) {
+            dir = Eigen::Vector2d(curv - shape(1, 1), shape(1, 0));
+        }
+        if (dir.squaredNorm() < 1e-20) {
+            return Eigen::Vector3d();
+        }
+        // keep the directions in the plane of the estimated normal
+        Eigen::Vector3d vec = dir(0) * tangent + dir(1) * binormal;
+        return Eigen::Vector3d(vec.normalized());
+    };
+
+    Eigen::Vector3d dir1 = direction(curv1);
+    Eigen::Vector3d dir2;
+    if (dir1.isZero()) {
+        // umbilic point: any pair of orthogonal tangents will do
+        dir1 = tangent;
+        dir2 = binormal;
+    }
+    else {
+        dir2 = normal.cross(dir1);
+    }
+
+    info.fMaxCurvature = static_cast<float>(curv1 / scale);
+    info.fMinCurvature = static_cast<float>(curv2 / scale);
+    info.cMaxCurvDir = toVector(dir1);
+    info.cMinCurvDir = toVector(dir2);
+}
+
+}  // namespace
+
+NormalEstimation::NormalEstimation(const KDTree& tree)
+    : tree(tree)
+{}
+
+void NormalEstimation::setKSearch(std::size_t k)
+{
+    kSearch = k;
+}
+
+void NormalEstimation::setSearchRadius(float radius)
+{
+    searchRadius = radius;
+}
+
+void NormalEstimation::setViewPoint(const Base::Vector3f& pnt)
+{
+    viewPoint = pnt;
+}
+
+void NormalEstimation::perform(std::vector<Base::Vector3f>& normals) const
+{
+    compute(normals, nullptr);
+}
+
+void NormalEstimation::perform(std::vector<Base::Vector3f>& normals,
+                               std::vector<CurvatureInfo>& curvatures) const
+{
+    compute(normals, &curvatures);
+}
+
+void NormalEstimation::compute(std::vector<Base::Vector3f>& normals,
+                               std::vector<CurvatureInfo>* curvatures) const
+{
+    const std::size_t minParallelPoints = 1000;
+    const std::size_t numPoints = tree.size();
+    normals.assign(numPoints, Base::Vector3f());
+    if (curvatures) {
+        curvatures->assign(numPoints, CurvatureInfo());
+    }
+
+    Base::parallel_for(numPoints, minParallelPoints, [&](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> neighbours;
+        std::vector<float> distances;
+        for (std::size_t i = begin; i < end; i++) {
+            const Base::Vector3f& pt = tree.getPoint(static_cast<unsigned long>(i));
+            if (searchRadius > 0.0F) {
+                tree.findInRadius(pt, searchRadius, neighbours, distances);
+            }
+            else {
+                tree.findNearest(pt, kSearch, neighbours, distances);
+            }
+            if (neighbours.size() < 3) {
+                continue;
+            }
+
+            Eigen::Vector3d center = Eigen::Vector3d::Zero();
+            for (unsigned long index : neighbours) {
+                const Base::Vector3f& nb = tree.getPoint(index);
+                center += Eigen::Vector3d(nb.x, nb.y, nb.z);
+            }
+            center /= double(neighbours.size());
+
+            Eigen::Matrix3d cov = Eigen::Matrix3d::Zero();
+            for (unsigned long index : neighbours) {
+                const Base::Vector3f& nb = tree.getPoint(index);
+                Eigen::Vector3d d = Eigen::Vector3d(nb.x, nb.y, nb.z) - center;
+                cov += d * d.transpose();
+            }
+
+            // the eigenvalues are sorted in increasing order
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eig(cov);
+            Eigen::Vector3d normal = eig.eigenvectors().col(0);
+            Eigen::Vector3d pnt(pt.x, pt.y, pt.z);
+            Eigen::Vector3d view(viewPoint.x, viewPoint.y, viewPoint.z);
+            if (normal.dot(view - pnt) < 0.0) {
+                normal = -normal;
+            }
+            normals[i] = toVector(normal);
+
+            if (curvatures && neighbours.size() >= 6) {
+                Eigen::Vector3d tangent = eig.eigenvectors().col(2);
+                fitCurvature(tree, neighbours, pnt, normal, tangent, (*curvatures)[i]);
+            }
+        }
+    });
+}
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_POINTSESTIMATION_H
+#define POINTS_POINTSESTIMATION_H
+
+#include <cstddef>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include "Properties.h"
+
+
+namespace Points
+{
+class KDTree;
+
+/**
+ * The NormalEstimation class estimates the normals of a point cloud from the principal
+ * components of the neighbourhood of each point: the normal is the direction of least variance.
+ * Normals are oriented towards a view point.
+ *
+ * The curvature is estimated by fitting a quadric height function over the tangent plane to the
+ * neighbourhood. A point with less than three neighbours gets a null normal, a point with less
+ * than six neighbours a zero curvature.
+ * @code
+ * Points::KDTree tree(kernel);
+ * Points::NormalEstimation estimate(tree);
+ * estimate.setKSearch(20);
+ * std::vector<Base::Vector3f> normals;
+ * estimate.perform(normals);
+ * @endcode
+ */
+class PointsExport NormalEstimation
+{
+public:
+    explicit NormalEstimation(const KDTree& tree);
+
+    /// Uses the \a k nearest neighbours of a point, the default is 10
+    void setKSearch(std::size_t k);
+    /// Uses the neighbours within \a radius instead of the nearest ones if it's greater than 0
+    void setSearchRadius(float radius);
+    /// Sets the point the normals are oriented to, the default is the origin
+    void setViewPoint(const Base::Vector3f& pnt);
+
+    /// Estimates the normals of all points of the tree
+    void perform(std::vector<Base::Vector3f>& normals) const;
+    /// Estimates the normals and curvatures of all points of the tree
+    void perform(std::vector<Base::Vector3f>& normals,
+                 std::vector<CurvatureInfo>& curvatures) const;
+
+private:
+    void compute(std::vector<Base::Vector3f>& normals,
+                 std::vector<CurvatureInfo>* curvatures) const;
+
+private:
+    const KDTree& tree;
+    std::size_t kSearch {10};
+    float searchRadius {0.0F};
+    Base::Vector3f viewPoint;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_POINTSESTIMATION_H
@@ -23,10 +23,14 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <vector>
 #endif
 
+#include <App/PropertyStandard.h>
+
 #include "PointsFeature.h"
+#include "Properties.h"
 
 
 using namespace Points;
@@ -64,6 +68,57 @@ void Feature::RestoreDocFile(Base::Reader& reader)
     Points.RestoreDocFile(reader);
 }
 
+void Feature::removeIndices(const std::vector<unsigned long>& indices)
+{
+    const int numPoints = static_cast<int>(Points.getValue().size());
+    std::vector<unsigned long> sorted(indices);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    sorted.erase(
+        std::lower_bound(sorted.begin(), sorted.end(), static_cast<unsigned long>(numPoints)),
+        sorted.end());
+
+    // only properties with a value for each point are changed
+    std::vector<App::Property*> props;
+    getPropertyList(props);
+    for (auto prop : props) {
+        if (auto normals = dynamic_cast<PropertyNormalList*>(prop)) {
+            if (normals->getSize() == numPoints) {
+                normals->removeIndices(sorted);
+            }
+        }
+        else if (auto grey = dynamic_cast<PropertyGreyValueList*>(prop)) {
+            if (grey->getSize() == numPoints) {
+                grey->removeIndices(sorted);
+            }
+        }
+        else if (auto curvature = dynamic_cast<PropertyCurvatureList*>(prop)) {
+            if (curvature->getSize() == numPoints) {
+                curvature->removeIndices(sorted);
+            }
+        }
+        else if (auto colors = dynamic_cast<App::PropertyColorList*>(prop)) {
+            if (colors->getSize() == numPoints) {
+                std::vector<App::Color> values;
+                values.reserve(colors->getSize() - sorted.size());
+                auto pos = sorted.begin();
+                const std::vector<App::Color>& list = colors->getValues();
+                for (std::size_t index = 0; index < list.size(); ++index) {
+                    if (pos != sorted.end() && *pos == index) {
+                        ++pos;
+                    }
+                    else {
+                        values.push_back(list[index]);
+                    }
+                }
+                colors->setValues(values);
+            }
+        }
+    }
+
+    Points.removeIndices(sorted);
+}
+
 void Feature::onChanged(const App::Property* prop)
 {
     // if the placement has changed apply the change to the point data as well
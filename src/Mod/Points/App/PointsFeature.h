@@ -76,6 +76,9 @@ public:
         return &Points;
     }
 
+    /// Removes the points with the given indices and their values of the per-point properties
+    virtual void removeIndices(const std::vector<unsigned long>& indices);
+
 protected:
     void onChanged(const App::Property* prop) override;
     //@}
@@ -0,0 +1,511 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/ThreadPool.h>
+
+#include "PointsFilter.h"
+#include "PointsKDTree.h"
+
+
+using namespace Points;
+
+namespace
+{
+
+const std::size_t minParallelPoints = 1000;
+
+bool isValid(const Base::Vector3f& pnt)
+{
+    return std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z);
+}
+
+/// Returns the indices of the flagged points
+std::vector<unsigned long> collect(const std::vector<char>& flags)
+{
+    std::vector<unsigned long> indices;
+    for (std::size_t i = 0; i < flags.size(); i++) {
+        if (flags[i]) {
+            indices.push_back(static_cast<unsigned long>(i));
+        }
+    }
+    return indices;
+}
+
+/**
+ * Maps points to the cells of a regular grid. A cell is encoded in a 64 bit key with 21 bits
+ * per axis. The cell coordinates start at 1 so that the neighbours of every cell can be encoded.
+ */
+class GridCells
+{
+public:
+    using Cell = std::array<std::uint32_t, 3>;
+    static constexpr std::uint64_t InvalidKey = std::numeric_limits<std::uint64_t>::max();
+
+    GridCells(const std::vector<Base::Vector3f>& points, float size)
+        : size(size)
+    {
+        for (const auto& pnt : points) {
+            if (isValid(pnt)) {
+                box.Add(pnt);
+            }
+        }
+
+        const double maxCells = double(1 << 21) - 3.0;
+        if (box.IsValid()
+            && (double(box.LengthX()) / size >= maxCells || double(box.LengthY()) / size >= maxCells
+                || double(box.LengthZ()) / size >= maxCells)) {
+            throw Base::ValueError("The cell size is too small for the extent of the points");
+        }
+    }
+
+    std::uint64_t getKey(const Base::Vector3f& pnt) const
+    {
+        if (!isValid(pnt)) {
+            return InvalidKey;
+        }
+        return toKey({static_cast<std::uint32_t>((pnt.x - box.MinX) / size) + 1,
+                      static_cast<std::uint32_t>((pnt.y - box.MinY) / size) + 1,
+                      static_cast<std::uint32_t>((pnt.z - box.MinZ) / size) + 1});
+    }
+
+    static std::uint64_t toKey(const Cell& cell)
+    {
+        return (std::uint64_t(cell[0]) << 42) | (std::uint64_t(cell[1]) << 21)
+            | std::uint64_t(cell[2]);
+    }
+
+    static Cell toCell(std::uint64_t key)
+    {
+        const std::uint64_t mask = (1 << 21) - 1;
+        return {std::uint32_t(key >> 42),
+                std::uint32_t((key >> 21) & mask),
+                std::uint32_t(key & mask)};
+    }
+
+private:
+    Base::BoundBox3f box;
+    float size;
+};
+
+struct CellEntry
+{
+    std::uint64_t key;
+    std::uint64_t rank;
+    unsigned long index;
+
+    bool operator<(const CellEntry& other) const
+    {
+        if (key != other.key) {
+            return key < other.key;
+        }
+        return rank < other.rank;
+    }
+};
+
+/**
+ * Returns the valid points sorted by their cells and by \a rank within a cell, together with the
+ * start positions of the cells. The last start position is the end of the entries.
+ */
+template<typename Rank>
+std::pair<std::vector<CellEntry>, std::vector<std::size_t>>
+sortCells(const std::vector<Base::Vector3f>& points, const GridCells& grid, Rank rank)
+{
+    std::vector<CellEntry> entries(points.size());
+    Base::parallel_for(points.size(), minParallelPoints, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            auto index = static_cast<unsigned long>(i);
+            entries[i] = {grid.getKey(points[i]), rank(index), index};
+        }
+    });
+
+    std::sort(entries.begin(), entries.end());
+    auto last = std::partition_point(entries.begin(), entries.end(), [](const CellEntry& entry) {
+        return entry.key != GridCells::InvalidKey;
+    });
+    entries.erase(last, entries.end());
+
+    std::vector<std::size_t> starts;
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        if (i == 0 || entries[i].key != entries[i - 1].key) {
+            starts.push_back(i);
+        }
+    }
+    starts.push_back(entries.size());
+    return {std::move(entries), std::move(starts)};
+}
+
+/**
+ * Selects points so that no two of them are closer than \a radius. The points of a cell are
+ * visited in the order of \a rank. With the cell size equal to the radius only points of
+ * adjacent cells can conflict, so all cells whose coordinates have the same parities are
+ * processed concurrently.
+ */
+template<typename Rank>
+std::vector<unsigned long>
+selectMinDistance(const std::vector<Base::Vector3f>& points, float radius, Rank rank)
+{
+    GridCells grid(points, radius);
+    auto [entries, starts] = sortCells(points, grid, rank);
+    const std::size_t numCells = starts.size() - 1;
+
+    std::unordered_map<std::uint64_t, std::size_t> cellIndex;
+    cellIndex.reserve(numCells);
+    std::array<std::vector<std::size_t>, 8> phases;
+    for (std::size_t i = 0; i < numCells; i++) {
+        std::uint64_t key = entries[starts[i]].key;
+        GridCells::Cell cell = GridCells::toCell(key);
+        cellIndex[key] = i;
+        phases[(cell[0] & 1) | ((cell[1] & 1) << 1) | ((cell[2] & 1) << 2)].push_back(i);
+    }
+
+    // the kept points of each cell, only written while the cell is processed
+    std::vector<std::vector<unsigned long>> kept(numCells);
+    const float sqrRadius = radius * radius;
+    for (const auto& phase : phases) {
+        Base::parallel_for(phase.size(), 64, [&](std::size_t begin, std::size_t end) {
+            std::vector<std::size_t> neighbours;
+            for (std::size_t i = begin; i < end; i++) {
+                std::size_t index = phase[i];
+                GridCells::Cell cell = GridCells::toCell(entries[starts[index]].key);
+                neighbours.clear();
+                for (std::uint32_t x = cell[0] - 1; x <= cell[0] + 1; x++) {
+                    for (std::uint32_t y = cell[1] - 1; y <= cell[1] + 1; y++) {
+                        for (std::uint32_t z = cell[2] - 1; z <= cell[2] + 1; z++) {
+                            auto it = cellIndex.find(GridCells::toKey({x, y, z}));
+                            if (it != cellIndex.end()) {
+                                neighbours.push_back(it->second);
+                            }
+                        }
+                    }
+                }
+
+                for (std::size_t pos = starts[index]; pos < starts[index + 1]; pos++) {
+                    const Base::Vector3f& pnt = points[entries[pos].index];
+                    auto isFree = [&](std::size_t nb) {
+                        return std::none_of(kept[nb].begin(), kept[nb].end(), [&](unsigned long k) {
+                            return Base::DistanceP2(pnt, points[k]) < sqrRadius;
+                        });
+                    };
+                    if (std::all_of(neighbours.begin(), neighbours.end(), isFree)) {
+                        kept[index].push_back(entries[pos].index);
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<unsigned long> indices;
+    for (const auto& it : kept) {
+        indices.insert(indices.end(), it.begin(), it.end());
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+}  // namespace
+
+StatisticalOutlierFilter::StatisticalOutlierFilter(const KDTree& tree)
+    : tree(tree)
+{}
+
+void StatisticalOutlierFilter::setKSearch(std::size_t k)
+{
+    kSearch = k;
+}
+
+void StatisticalOutlierFilter::setStdDevMul(double mul)
+{
+    stdDevMul = mul;
+}
+
+std::vector<unsigned long> StatisticalOutlierFilter::perform() const
+{
+    const std::size_t minParallelPoints = 1000;
+    const std::size_t numPoints = tree.size();
+    std::vector<unsigned long> outliers;
+    if (numPoints < 2 || kSearch == 0) {
+        return outliers;
+    }
+
+    // the nearest neighbour of a point is the point itself
+    std::vector<double> meanDistances(numPoints);
+    Base::parallel_for(numPoints, minParallelPoints, [&](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> neighbours;
+        std::vector<float> distances;
+        for (std::size_t i = begin; i < end; i++) {
+            tree.findNearest(tree.getPoint(static_cast<unsigned long>(i)),
+                             kSearch + 1,
+                             neighbours,
+                             distances);
+            double sum = 0.0;
+            for (std::size_t j = 1; j < distances.size(); j++) {
+                sum += std::sqrt(double(distances[j]));
+            }
+            meanDistances[i] = sum / double(distances.size() - 1);
+        }
+    });
+
+    double sum = 0.0;
+    double sqrSum = 0.0;
+    for (double dist : meanDistances) {
+        sum += dist;
+        sqrSum += dist * dist;
+    }
+    double mean = sum / double(numPoints);
+    double variance = (sqrSum - sum * mean) / double(numPoints - 1);
+    double threshold = mean + stdDevMul * std::sqrt(std::max(variance, 0.0));
+
+    for (std::size_t i = 0; i < numPoints; i++) {
+        if (meanDistances[i] > threshold) {
+            outliers.push_back(static_cast<unsigned long>(i));
+        }
+    }
+
+    return outliers;
+}
+
+// ----------------------------------------------------------------------------
+
+RadiusOutlierFilter::RadiusOutlierFilter(const KDTree& tree)
+    : tree(tree)
+{}
+
+void RadiusOutlierFilter::setRadius(float radius)
+{
+    this->radius = radius;
+}
+
+void RadiusOutlierFilter::setMinNeighbours(std::size_t num)
+{
+    minNeighbours = num;
+}
+
+std::vector<unsigned long> RadiusOutlierFilter::perform() const
+{
+    const std::size_t numPoints = tree.size();
+    std::vector<char> outliers(numPoints, 0);
+    Base::parallel_for(numPoints, minParallelPoints, [&](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> neighbours;
+        std::vector<float> distances;
+        for (std::size_t i = begin; i < end; i++) {
+            tree.findInRadius(tree.getPoint(static_cast<unsigned long>(i)),
+                              radius,
+                              neighbours,
+                              distances);
+            // the point itself is not a neighbour
+            std::size_t count = neighbours.empty() ? 0 : neighbours.size() - 1;
+            outliers[i] = count < minNeighbours ? 1 : 0;
+        }
+    });
+
+    return collect(outliers);
+}
+
+// ----------------------------------------------------------------------------
+
+VoxelGridFilter::VoxelGridFilter(const std::vector<Base::Vector3f>& points)
+    : points(points)
+{}
+
+void VoxelGridFilter::setLeafSize(float size)
+{
+    leafSize = size;
+}
+
+std::vector<unsigned long> VoxelGridFilter::perform() const
+{
+    if (leafSize <= 0.0F) {
+        throw Base::ValueError("The leaf size must be positive");
+    }
+
+    GridCells grid(points, leafSize);
+    auto [entries, starts] = sortCells(points, grid, [](unsigned long) {
+        return std::uint64_t(0);
+    });
+
+    const std::size_t numCells = starts.size() - 1;
+    std::vector<unsigned long> indices(numCells);
+    Base::parallel_for(numCells, 64, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            Base::Vector3d center;
+            for (std::size_t pos = starts[i]; pos < starts[i + 1]; pos++) {
+                const Base::Vector3f& pnt = points[entries[pos].index];
+                center += Base::Vector3d(pnt.x, pnt.y, pnt.z);
+            }
+            center /= double(starts[i + 1] - starts[i]);
+
+            double minDist = std::numeric_limits<double>::max();
+            for (std::size_t pos = starts[i]; pos < starts[i + 1]; pos++) {
+                const Base::Vector3f& pnt = points[entries[pos].index];
+                double dist = Base::DistanceP2(center, Base::Vector3d(pnt.x, pnt.y, pnt.z));
+                if (dist < minDist) {
+                    minDist = dist;
+                    indices[i] = entries[pos].index;
+                }
+            }
+        }
+    });
+
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+// ----------------------------------------------------------------------------
+
+PoissonDiskFilter::PoissonDiskFilter(const std::vector<Base::Vector3f>& points)
+    : points(points)
+{}
+
+void PoissonDiskFilter::setRadius(float radius)
+{
+    this->radius = radius;
+}
+
+std::vector<unsigned long> PoissonDiskFilter::perform() const
+{
+    if (radius <= 0.0F) {
+        throw Base::ValueError("The radius must be positive");
+    }
+
+    // scramble the indices so that scan lines don't bias the selection
+    return selectMinDistance(points, radius, [](unsigned long index) {
+        std::uint64_t value = std::uint64_t(index) + 0x9e3779b97f4a7c15ULL;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    });
+}
+
+// ----------------------------------------------------------------------------
+
+DuplicateFilter::DuplicateFilter(const std::vector<Base::Vector3f>& points)
+    : points(points)
+{}
+
+void DuplicateFilter::setTolerance(float tol)
+{
+    tolerance = tol;
+}
+
+std::vector<unsigned long> DuplicateFilter::perform() const
+{
+    if (tolerance > 0.0F) {
+        return selectMinDistance(points, tolerance, [](unsigned long index) {
+            return std::uint64_t(index);
+        });
+    }
+
+    std::vector<unsigned long> order;
+    order.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (isValid(points[i])) {
+            order.push_back(static_cast<unsigned long>(i));
+        }
+    }
+
+    // Vector3f::operator== has a tolerance which doesn't give a strict weak ordering
+    auto isEqual = [this](unsigned long a, unsigned long b) {
+        const Base::Vector3f& p = points[a];
+        const Base::Vector3f& q = points[b];
+        return p.x == q.x && p.y == q.y && p.z == q.z;
+    };
+    auto less = [this](unsigned long a, unsigned long b) {
+        const Base::Vector3f& p = points[a];
+        const Base::Vector3f& q = points[b];
+        if (p.x != q.x) {
+            return p.x < q.x;
+        }
+        if (p.y != q.y) {
+            return p.y < q.y;
+        }
+        if (p.z != q.z) {
+            return p.z < q.z;
+        }
+        return a < b;
+    };
+    std::sort(order.begin(), order.end(), less);
+
+    // the first point of equal points has the lowest index
+    std::vector<unsigned long> indices;
+    for (std::size_t i = 0; i < order.size(); i++) {
+        if (i == 0 || !isEqual(order[i - 1], order[i])) {
+            indices.push_back(order[i]);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+// ----------------------------------------------------------------------------
+
+CropFilter::CropFilter(const std::vector<Base::Vector3f>& points)
+    : points(points)
+{}
+
+void CropFilter::setNegative(bool on)
+{
+    negative = on;
+}
+
+template<typename Pred>
+std::vector<unsigned long> CropFilter::select(Pred&& pred) const
+{
+    std::vector<char> inside(points.size(), 0);
+    Base::parallel_for(points.size(), minParallelPoints, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            // invalid points are neither inside nor outside
+            if (isValid(points[i])) {
+                inside[i] = pred(points[i]) != negative ? 1 : 0;
+            }
+        }
+    });
+
+    return collect(inside);
+}
+
+std::vector<unsigned long> CropFilter::perform(const Base::BoundBox3f& box) const
+{
+    return select([&box](const Base::Vector3f& pnt) {
+        return box.IsInBox(pnt);
+    });
+}
+
+std::vector<unsigned long> CropFilter::perform(const Base::Vector3f& base,
+                                               const Base::Vector3f& normal) const
+{
+    return select([&base, &normal](const Base::Vector3f& pnt) {
+        return (pnt - base) * normal >= 0.0F;
+    });
+}
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_POINTSFILTER_H
+#define POINTS_POINTSFILTER_H
+
+#include <cstddef>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+class KDTree;
+
+/**
+ * The StatisticalOutlierFilter class finds points that are far away from their neighbours.
+ * For every point the mean distance to its k nearest neighbours is computed. A point is an
+ * outlier if its mean distance exceeds the mean of all mean distances by more than a multiple of
+ * their standard deviation.
+ */
+class PointsExport StatisticalOutlierFilter
+{
+public:
+    explicit StatisticalOutlierFilter(const KDTree& tree);
+
+    /// Sets the number of neighbours of a point, the default is 8
+    void setKSearch(std::size_t k);
+    /// Sets the multiple of the standard deviation, the default is 1
+    void setStdDevMul(double mul);
+
+    /// Returns the sorted indices of the outliers
+    std::vector<unsigned long> perform() const;
+
+private:
+    const KDTree& tree;
+    std::size_t kSearch {8};
+    double stdDevMul {1.0};
+};
+
+/**
+ * The RadiusOutlierFilter class finds points that have too few neighbours within a given
+ * radius.
+ */
+class PointsExport RadiusOutlierFilter
+{
+public:
+    explicit RadiusOutlierFilter(const KDTree& tree);
+
+    /// Sets the search radius, the default is 1
+    void setRadius(float radius);
+    /// Sets the minimum number of neighbours of a point that is kept, the default is 2
+    void setMinNeighbours(std::size_t num);
+
+    /// Returns the sorted indices of the outliers
+    std::vector<unsigned long> perform() const;
+
+private:
+    const KDTree& tree;
+    float radius {1.0F};
+    std::size_t minNeighbours {2};
+};
+
+/**
+ * The VoxelGridFilter class downsamples points with a regular grid. Of every occupied cell the
+ * point next to the centroid of its points is kept, so that the attributes of the points can be
+ * carried along.
+ */
+class PointsExport VoxelGridFilter
+{
+public:
+    explicit VoxelGridFilter(const std::vector<Base::Vector3f>& points);
+
+    /// Sets the edge length of the cells, the default is 1
+    void setLeafSize(float size);
+
+    /// Returns the sorted indices of the kept points
+    std::vector<unsigned long> perform() const;
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    float leafSize {1.0F};
+};
+
+/**
+ * The PoissonDiskFilter class selects a subset of the points where no two points are closer
+ * than a given radius, while every removed point has a kept point within the radius. The points
+ * are visited in a random but reproducible order.
+ */
+class PointsExport PoissonDiskFilter
+{
+public:
+    explicit PoissonDiskFilter(const std::vector<Base::Vector3f>& points);
+
+    /// Sets the minimum distance of the kept points, the default is 1
+    void setRadius(float radius);
+
+    /// Returns the sorted indices of the kept points
+    std::vector<unsigned long> perform() const;
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    float radius {1.0F};
+};
+
+/**
+ * The DuplicateFilter class removes duplicated points. With a tolerance of 0 only points with
+ * equal coordinates are duplicates and of them the point with the lowest index is kept.
+ * Otherwise a point is removed if a kept point lies closer than the tolerance.
+ */
+class PointsExport DuplicateFilter
+{
+public:
+    explicit DuplicateFilter(const std::vector<Base::Vector3f>& points);
+
+    /// Sets the tolerance, the default is 0
+    void setTolerance(float tol);
+
+    /// Returns the sorted indices of the kept points
+    std::vector<unsigned long> perform() const;
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    float tolerance {0.0F};
+};
+
+/**
+ * The CropFilter class selects the points inside a box or on one side of a plane.
+ */
+class PointsExport CropFilter
+{
+public:
+    explicit CropFilter(const std::vector<Base::Vector3f>& points);
+
+    /// Selects the points outside the region instead of those inside
+    void setNegative(bool on);
+
+    /// Returns the sorted indices of the points inside \a box
+    std::vector<unsigned long> perform(const Base::BoundBox3f& box) const;
+    /// Returns the sorted indices of the points on the side of the plane \a normal points to
+    std::vector<unsigned long> perform(const Base::Vector3f& base,
+                                       const Base::Vector3f& normal) const;
+
+private:
+    template<typename Pred>
+    std::vector<unsigned long> select(Pred&& pred) const;
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    bool negative {false};
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_POINTSFILTER_H
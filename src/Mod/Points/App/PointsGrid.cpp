@@ -22,6 +22,14 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <algorithm>
+#include <climits>
+#include <memory>
+#endif
+
+#include <Base/ThreadPool.h>
+
 #include "PointsGrid.h"
 
 
@@ -122,7 +130,8 @@ void PointsGrid::Attach(const PointKernel& rclM)
 
 void PointsGrid::Clear()
 {
-    _aulGrid.clear();
+    _aulCellOffsets.clear();
+    _aulCellElements.clear();
     _pclPoints = nullptr;
 }
 
@@ -202,14 +211,8 @@ void PointsGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
-        }
-    }
+    _aulCellOffsets.assign(std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ + 1, 0);
+    _aulCellElements.clear();
 }
 
 unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
@@ -232,9 +235,8 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                PointsGridCell cell = GetCell(i, j, k);
+                raulElements.insert(raulElements.end(), cell.begin(), cell.end());
             }
         }
     }
@@ -270,9 +272,8 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    PointsGridCell cell = GetCell(i, j, k);
+                    raulElements.insert(raulElements.end(), cell.begin(), cell.end());
                 }
             }
         }
@@ -303,7 +304,8 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                PointsGridCell cell = GetCell(i, j, k);
+                raulElements.insert(cell.begin(), cell.end());
             }
         }
     }
@@ -552,7 +554,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            PointsGridCell cell = GetCell(nX, i, j);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nX++;
@@ -564,7 +567,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            PointsGridCell cell = GetCell(nX, i, j);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nX++;
@@ -576,7 +580,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            PointsGridCell cell = GetCell(i, nY, j);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nY++;
@@ -588,7 +593,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            PointsGridCell cell = GetCell(i, nY, j);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nY--;
@@ -600,7 +606,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            PointsGridCell cell = GetCell(i, j, nZ);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nZ++;
@@ -612,7 +619,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            PointsGridCell cell = GetCell(i, j, nZ);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nZ--;
@@ -682,22 +690,23 @@ unsigned long PointsGrid::GetElements(unsigned long ulX,
                                       unsigned long ulZ,
                                       std::set<unsigned long>& raclInd) const
 {
-    const std::set<unsigned long>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    if (!rclSet.empty()) {
-        raclInd.insert(rclSet.begin(), rclSet.end());
-        return rclSet.size();
+    PointsGridCell cell = GetCell(ulX, ulY, ulZ);
+    if (!cell.empty()) {
+        raclInd.insert(cell.begin(), cell.end());
+        return cell.size();
     }
 
     return 0;
 }
 
-void PointsGrid::AddPoint(const Base::Vector3d& rclPt, unsigned long ulPtIndex, float /*fEpsilon*/)
+unsigned long PointsGrid::CellOf(const Base::Vector3d& rclPt) const
 {
     unsigned long ulX {}, ulY {}, ulZ {};
-    Pos(Base::Vector3d(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
+    Pos(rclPt, ulX, ulY, ulZ);
     if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
+        return (ulZ * _ulCtGridsY + ulY) * _ulCtGridsX + ulX;
     }
+    return ULONG_MAX;
 }
 
 void PointsGrid::Validate(const PointKernel& rclPoints)
@@ -751,11 +760,35 @@ void PointsGrid::RebuildGrid()
 
     InitGrid();
 
-    // Fill data structure
+    // Determine the grid element of each point, in parallel for large point clouds
+    const std::size_t numPoints = _ulCtElements;
+    std::vector<unsigned long> cells(numPoints);
+    auto computeCells = [this, &cells](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            cells[i] = CellOf(_pclPoints->getPoint(int(i)));
+        }
+    };
 
-    unsigned long i = 0;
-    for (const auto& pnt : *_pclPoints) {
-        AddPoint(pnt, i++);
+    const std::size_t minParallelPoints = 100000;
+    Base::parallel_for(numPoints, minParallelPoints, computeCells);
+
+    // Count the points of each grid element and scatter them, this keeps them sorted
+    const std::size_t numCells = _aulCellOffsets.size() - 1;
+    for (unsigned long cell : cells) {
+        if (cell != ULONG_MAX) {
+            _aulCellOffsets[cell + 1]++;
+        }
+    }
+    for (std::size_t i = 0; i < numCells; i++) {
+        _aulCellOffsets[i + 1] += _aulCellOffsets[i];
+    }
+
+    _aulCellElements.resize(_aulCellOffsets[numCells]);
+    std::vector<std::size_t> cursors(_aulCellOffsets.begin(), _aulCellOffsets.end() - 1);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        if (cells[i] != ULONG_MAX) {
+            _aulCellElements[cursors[cells[i]]++] = static_cast<unsigned long>(i);
+        }
     }
 }
 
@@ -819,9 +852,8 @@ bool PointsGridIterator::InitOnRay(const Base::Vector3d& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        PointsGridCell cell = _rclGrid.GetCell(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
         _bValidRay = true;
     }
     else {  // StartPoint outside
@@ -837,9 +869,8 @@ bool PointsGridIterator::InitOnRay(const Base::Vector3d& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            PointsGridCell cell = _rclGrid.GetCell(_ulX, _ulY, _ulZ);
+            raulElements.insert(raulElements.end(), cell.begin(), cell.end());
             _bValidRay = true;
         }
     }
@@ -903,9 +934,8 @@ bool PointsGridIterator::NextOnRay(std::vector<unsigned long>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        PointsGridCell cell = _rclGrid.GetCell(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     else {
         _bValidRay = false;  // ray exited
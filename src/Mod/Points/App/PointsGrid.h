@@ -24,6 +24,7 @@
 #define POINTS_GRID_H
 
 #include <set>
+#include <vector>
 
 #include <Base/BoundBox.h>
 #include <Base/Vector3D.h>
@@ -40,6 +41,40 @@ namespace Points
 {
 class PointsGrid;
 
+/**
+ * Read-only view on the point indices of one grid element, sorted in ascending order.
+ */
+class PointsGridCell
+{
+public:
+    using const_iterator = const unsigned long*;
+
+    PointsGridCell(const unsigned long* first, const unsigned long* last)
+        : _first(first)
+        , _last(last)
+    {}
+    const_iterator begin() const
+    {
+        return _first;
+    }
+    const_iterator end() const
+    {
+        return _last;
+    }
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(_last - _first);
+    }
+    bool empty() const
+    {
+        return _first == _last;
+    }
+
+private:
+    const unsigned long* _first;
+    const unsigned long* _last;
+};
+
 /**
  * The PointsGrid allows one to divide a global point cloud into smaller regions of elements
  * depending on the resolution of the grid. All grid elements in the grid structure have the same
@@ -47,6 +82,9 @@ class PointsGrid;
  *
  * Grids can be used within algorithms to avoid to iterate through all elements, so grids can speed
  * up algorithms dramatically.
+ *
+ * The point indices of all grid elements are stored in one array, ordered by grid element, and an
+ * offset array points to the first index of each grid element.
  * @author Werner Mayer
  */
 class PointsExport PointsGrid
@@ -130,7 +168,14 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return _aulGrid[ulX][ulY][ulZ].size();
+        return GetCell(ulX, ulY, ulZ).size();
+    }
+    /** Returns the sorted indices of the elements in a given grid. */
+    PointsGridCell GetCell(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+    {
+        std::size_t cell = (ulZ * _ulCtGridsY + ulY) * _ulCtGridsX + ulX;
+        const unsigned long* data = _aulCellElements.data();
+        return {data + _aulCellOffsets[cell], data + _aulCellOffsets[cell + 1]};
     }
     /** Finds all points that lie in the same grid as the point \a rclPoint. */
     unsigned long FindElements(const Base::Vector3d& rclPoint,
@@ -180,8 +225,9 @@ protected:
                  std::set<unsigned long>& raclInd) const;
 
 private:
-    std::vector<std::vector<std::vector<std::set<unsigned long>>>>
-        _aulGrid;                  /**< Grid data structure. */
+    std::vector<std::size_t> _aulCellOffsets;    /**< Start of each grid element. */
+    std::vector<unsigned long> _aulCellElements; /**< Point indices of all grid elements. */
+
     const PointKernel* _pclPoints; /**< The point kernel. */
     unsigned long _ulCtElements;   /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;     /**< Number of grid elements in z. */
@@ -200,9 +246,9 @@ private:
 
 public:
 protected:
-    /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the point kernel. */
-    void AddPoint(const Base::Vector3d& rclPt, unsigned long ulPtIndex, float fEpsilon = 0.0f);
+    /** Returns the index of the grid element the point \a rclPt lies in, or ULONG_MAX if it lies
+     * outside the grid. */
+    unsigned long CellOf(const Base::Vector3d& rclPt) const;
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3d& rclPoint,
              unsigned long& rulX,
@@ -227,9 +273,8 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<unsigned long>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        PointsGridCell cell = _rclGrid.GetCell(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     /** @name Iteration */
     //@{
@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#endif
+
+#include <Base/BoundBox.h>
+#include <Base/ThreadPool.h>
+
+#include "Points.h"
+#include "PointsKDTree.h"
+
+
+using namespace Points;
+
+namespace
+{
+const std::size_t minParallelQueries = 1000;
+
+inline float sqrDistance(const Base::Vector3f& p, const Base::Vector3f& q)
+{
+    return Base::DistanceP2(p, q);
+}
+}  // namespace
+
+KDTree::KDTree(const std::vector<Base::Vector3f>& points)
+{
+    build(points);
+}
+
+KDTree::KDTree(const PointKernel& kernel)
+{
+    build(kernel.getBasicPoints());
+}
+
+void KDTree::build(const std::vector<Base::Vector3f>& pts)
+{
+    const std::size_t minParallelPoints = 100000;
+    const std::size_t numPoints = pts.size();
+    order.resize(numPoints);
+    std::iota(order.begin(), order.end(), 0UL);
+    axes.resize(numPoints);
+
+    if (numPoints < minParallelPoints) {
+        split(0, numPoints, pts, nullptr);
+    }
+    else {
+        Base::ThreadPool pool;
+        split(0, numPoints, pts, &pool);
+        pool.wait();
+    }
+
+    // store the points in tree order so that a leaf is contiguous in memory
+    points.resize(numPoints);
+    positions.resize(numPoints);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        points[i] = pts[order[i]];
+        positions[order[i]] = static_cast<unsigned long>(i);
+    }
+}
+
+void KDTree::split(std::size_t begin,
+                   std::size_t end,
+                   const std::vector<Base::Vector3f>& pts,
+                   Base::ThreadPool* pool)
+{
+    const std::size_t minParallelPoints = 50000;
+    while (end - begin > leafSize) {
+        Base::BoundBox3f box;
+        for (std::size_t i = begin; i < end; i++) {
+            box.Add(pts[order[i]]);
+        }
+
+        std::uint8_t axis = 0;
+        float length = box.LengthX();
+        if (box.LengthY() > length) {
+            axis = 1;
+            length = box.LengthY();
+        }
+        if (box.LengthZ() > length) {
+            axis = 2;
+        }
+
+        std::size_t mid = begin + (end - begin) / 2;
+        std::nth_element(order.begin() + std::ptrdiff_t(begin),
+                         order.begin() + std::ptrdiff_t(mid),
+                         order.begin() + std::ptrdiff_t(end),
+                         [&pts, axis](unsigned long lhs, unsigned long rhs) {
+                             return pts[lhs][axis] < pts[rhs][axis];
+                         });
+        axes[mid] = axis;
+
+        // the lower half is split by another thread if it's large enough
+        if (pool && mid - begin >= minParallelPoints) {
+            pool->submit([this, begin, mid, &pts, pool]() {
+                split(begin, mid, pts, pool);
+            });
+        }
+        else {
+            split(begin, mid, pts, pool);
+        }
+        begin = mid + 1;
+    }
+}
+
+void KDTree::searchNearest(std::size_t begin,
+                           std::size_t end,
+                           const Base::Vector3f& pt,
+                           std::size_t k,
+                           std::vector<Entry>& heap) const
+{
+    auto add = [&](std::size_t pos) {
+        float dist = sqrDistance(pt, points[pos]);
+        if (heap.size() < k) {
+            heap.emplace_back(dist, order[pos]);
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (dist < heap.front().first) {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = Entry(dist, order[pos]);
+            std::push_heap(heap.begin(), heap.end());
+        }
+    };
+
+    if (end - begin <= leafSize) {
+        for (std::size_t i = begin; i < end; i++) {
+            add(i);
+        }
+        return;
+    }
+
+    std::size_t mid = begin + (end - begin) / 2;
+    std::uint8_t axis = axes[mid];
+    float diff = pt[axis] - points[mid][axis];
+    add(mid);
+
+    // search the half containing the point first, the other one only if it may be closer
+    if (diff < 0) {
+        searchNearest(begin, mid, pt, k, heap);
+        if (heap.size() < k || diff * diff < heap.front().first) {
+            searchNearest(mid + 1, end, pt, k, heap);
+        }
+    }
+    else {
+        searchNearest(mid + 1, end, pt, k, heap);
+        if (heap.size() < k || diff * diff < heap.front().first) {
+            searchNearest(begin, mid, pt, k, heap);
+        }
+    }
+}
+
+void KDTree::searchRadius(std::size_t begin,
+                          std::size_t end,
+                          const Base::Vector3f& pt,
+                          float sqrRadius,
+                          std::vector<Entry>& result) const
+{
+    auto add = [&](std::size_t pos) {
+        float dist = sqrDistance(pt, points[pos]);
+        if (dist <= sqrRadius) {
+            result.emplace_back(dist, order[pos]);
+        }
+    };
+
+    if (end - begin <= leafSize) {
+        for (std::size_t i = begin; i < end; i++) {
+            add(i);
+        }
+        return;
+    }
+
+    std::size_t mid = begin + (end - begin) / 2;
+    std::uint8_t axis = axes[mid];
+    float diff = pt[axis] - points[mid][axis];
+    add(mid);
+
+    if (diff < 0 || diff * diff <= sqrRadius) {
+        searchRadius(begin, mid, pt, sqrRadius, result);
+    }
+    if (diff >= 0 || diff * diff <= sqrRadius) {
+        searchRadius(mid + 1, end, pt, sqrRadius, result);
+    }
+}
+
+void KDTree::findNearest(const Base::Vector3f& pt,
+                         std::size_t k,
+                         std::vector<unsigned long>& indices,
+                         std::vector<float>& sqrDistances) const
+{
+    std::vector<Entry> heap;
+    heap.reserve(k);
+    if (k > 0) {
+        searchNearest(0, size(), pt, k, heap);
+    }
+    std::sort_heap(heap.begin(), heap.end());
+
+    indices.resize(heap.size());
+    sqrDistances.resize(heap.size());
+    for (std::size_t i = 0; i < heap.size(); i++) {
+        sqrDistances[i] = heap[i].first;
+        indices[i] = heap[i].second;
+    }
+}
+
+void KDTree::findInRadius(const Base::Vector3f& pt,
+                          float radius,
+                          std::vector<unsigned long>& indices,
+                          std::vector<float>& sqrDistances) const
+{
+    std::vector<Entry> result;
+    if (radius >= 0) {
+        searchRadius(0, size(), pt, radius * radius, result);
+    }
+    std::sort(result.begin(), result.end());
+
+    indices.resize(result.size());
+    sqrDistances.resize(result.size());
+    for (std::size_t i = 0; i < result.size(); i++) {
+        sqrDistances[i] = result[i].first;
+        indices[i] = result[i].second;
+    }
+}
+
+Neighbours KDTree::findNearest(const std::vector<Base::Vector3f>& pts, std::size_t k) const
+{
+    // every query point gets the same number of neighbours
+    k = std::min(k, size());
+    Neighbours result;
+    result.offsets.resize(pts.size() + 1);
+    for (std::size_t i = 0; i <= pts.size(); i++) {
+        result.offsets[i] = i * k;
+    }
+    result.indices.resize(pts.size() * k);
+    result.sqrDistances.resize(pts.size() * k);
+    if (k == 0) {
+        return result;
+    }
+
+    Base::parallel_for(pts.size(), minParallelQueries, [&](std::size_t begin, std::size_t end) {
+        std::vector<Entry> heap;
+        heap.reserve(k);
+        for (std::size_t i = begin; i < end; i++) {
+            heap.clear();
+            searchNearest(0, size(), pts[i], k, heap);
+            std::sort_heap(heap.begin(), heap.end());
+            for (std::size_t j = 0; j < k; j++) {
+                result.sqrDistances[i * k + j] = heap[j].first;
+                result.indices[i * k + j] = heap[j].second;
+            }
+        }
+    });
+
+    return result;
+}
+
+Neighbours KDTree::findInRadius(const std::vector<Base::Vector3f>& pts, float radius) const
+{
+    // each range of query points collects its neighbours, then they are joined in order
+    struct Range
+    {
+        std::vector<std::size_t> counts;
+        std::vector<Entry> entries;
+    };
+    std::mutex mutex;
+    std::map<std::size_t, Range> ranges;
+
+    float sqrRadius = radius * radius;
+    Base::parallel_for(pts.size(), minParallelQueries, [&](std::size_t begin, std::size_t end) {
+        Range range;
+        range.counts.reserve(end - begin);
+        for (std::size_t i = begin; i < end; i++) {
+            std::size_t first = range.entries.size();
+            if (radius >= 0 && !empty()) {
+                searchRadius(0, size(), pts[i], sqrRadius, range.entries);
+            }
+            std::sort(range.entries.begin() + std::ptrdiff_t(first), range.entries.end());
+            range.counts.push_back(range.entries.size() - first);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        ranges.emplace(begin, std::move(range));
+    });
+
+    Neighbours result;
+    result.offsets.reserve(pts.size() + 1);
+    result.offsets.push_back(0);
+    for (const auto& it : ranges) {
+        for (std::size_t count : it.second.counts) {
+            result.offsets.push_back(result.offsets.back() + count);
+        }
+        for (const auto& entry : it.second.entries) {
+            result.sqrDistances.push_back(entry.first);
+            result.indices.push_back(entry.second);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_POINTSKDTREE_H
+#define POINTS_POINTSKDTREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Base
+{
+class ThreadPool;
+}
+
+namespace Points
+{
+class PointKernel;
+
+/**
+ * The result of a batched search. The neighbours of the i-th query point are stored in the
+ * range [offsets[i], offsets[i + 1]) of \a indices and \a sqrDistances, sorted by distance.
+ */
+struct PointsExport Neighbours
+{
+    std::vector<std::size_t> offsets;
+    std::vector<unsigned long> indices;
+    std::vector<float> sqrDistances;
+
+    /// Returns the number of query points
+    std::size_t size() const
+    {
+        return offsets.empty() ? 0 : offsets.size() - 1;
+    }
+    /// Returns the number of neighbours of the i-th query point
+    std::size_t count(std::size_t i) const
+    {
+        return offsets[i + 1] - offsets[i];
+    }
+};
+
+/**
+ * A k-d tree to search for the nearest neighbours of points. The tree is balanced and stored
+ * implicitly in an array, each inner node splits the points at the median of the axis with the
+ * largest extent. Large trees are built in parallel.
+ *
+ * The search methods are const and may be called concurrently, the batched searches distribute
+ * the query points over all cores themselves.
+ * @code
+ * Points::KDTree tree(kernel);
+ * Points::Neighbours nn = tree.findNearest(kernel.getBasicPoints(), 10);
+ * @endcode
+ */
+class PointsExport KDTree
+{
+public:
+    explicit KDTree(const std::vector<Base::Vector3f>& points);
+    /// Builds the tree over the untransformed points of \a kernel
+    explicit KDTree(const PointKernel& kernel);
+
+    std::size_t size() const
+    {
+        return points.size();
+    }
+    bool empty() const
+    {
+        return points.empty();
+    }
+    /// Returns the point with the given index as passed to the constructor
+    const Base::Vector3f& getPoint(unsigned long index) const
+    {
+        return points[positions[index]];
+    }
+
+    /** Finds the \a k nearest points of \a pt, sorted by distance. If \a pt is a point of the
+     * tree it is part of the result.
+     */
+    void findNearest(const Base::Vector3f& pt,
+                     std::size_t k,
+                     std::vector<unsigned long>& indices,
+                     std::vector<float>& sqrDistances) const;
+    /// Finds the points within \a radius of \a pt, sorted by distance
+    void findInRadius(const Base::Vector3f& pt,
+                      float radius,
+                      std::vector<unsigned long>& indices,
+                      std::vector<float>& sqrDistances) const;
+
+    /** @name Batched search */
+    //@{
+    Neighbours findNearest(const std::vector<Base::Vector3f>& pts, std::size_t k) const;
+    Neighbours findInRadius(const std::vector<Base::Vector3f>& pts, float radius) const;
+    //@}
+
+private:
+    using Entry = std::pair<float, unsigned long>;
+
+    void build(const std::vector<Base::Vector3f>& pts);
+    void split(std::size_t begin,
+               std::size_t end,
+               const std::vector<Base::Vector3f>& pts,
+               Base::ThreadPool* pool);
+    void searchNearest(std::size_t begin,
+                       std::size_t end,
+                       const Base::Vector3f& pt,
+                       std::size_t k,
+                       std::vector<Entry>& heap) const;
+    void searchRadius(std::size_t begin,
+                      std::size_t end,
+                      const Base::Vector3f& pt,
+                      float sqrRadius,
+                      std::vector<Entry>& result) const;
+
+private:
+    static constexpr std::size_t leafSize = 8;
+
+    std::vector<Base::Vector3f> points;    // in tree order
+    std::vector<unsigned long> order;      // original index of a point in tree order
+    std::vector<unsigned long> positions;  // position in tree order of an original index
+    std::vector<std::uint8_t> axes;        // split axis of the inner node at a position
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_POINTSKDTREE_H
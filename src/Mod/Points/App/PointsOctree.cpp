@@ -0,0 +1,837 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <queue>
+#include <unordered_set>
+#include <utility>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+
+#include "PointsOctree.h"
+
+
+using namespace Points;
+
+// The octree file is written in the native byte order. A file of the other byte order is
+// rejected because its magic number doesn't match.
+//
+// Header:     magic, version, attributes, number of nodes (uint32),
+//             number of points, offset of node table (uint64), bounding box (6 x float)
+// Payload:    for each node the points, normals, colors and intensities as plain arrays
+// Node table: for each node the bounding box (6 x float), offset (uint64), number of points,
+//             depth (uint32) and the eight child indices (int32)
+
+static_assert(sizeof(Base::Vector3f) == 3 * sizeof(float), "Unexpected size of Base::Vector3f");
+static_assert(sizeof(PointChunk::Rgba) == 4, "Unexpected size of PointChunk::Rgba");
+
+namespace
+{
+constexpr std::size_t headerSize = 4 * sizeof(std::uint32_t) + 2 * sizeof(std::uint64_t)
+    + 6 * sizeof(float);
+constexpr std::uint32_t maxDepth = 21;
+constexpr std::uint32_t cellsPerAxis = 128;
+constexpr std::size_t blockSize = 65536;
+
+template<typename T>
+void writeValue(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+void readValue(std::istream& inp, T& value)
+{
+    inp.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+template<typename T>
+void writeArray(std::ostream& out, const std::vector<T>& values)
+{
+    out.write(reinterpret_cast<const char*>(values.data()),
+              static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+template<typename T>
+void readArray(std::istream& inp, std::vector<T>& values, std::size_t count)
+{
+    values.resize(count);
+    inp.read(reinterpret_cast<char*>(values.data()),
+             static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+// the size of a node in the node table: box, offset, count, depth and children
+constexpr std::uint64_t nodeRecordSize = 6 * sizeof(float) + sizeof(std::uint64_t)
+    + 2 * sizeof(std::uint32_t) + 8 * sizeof(std::int32_t);
+
+// the size of a point with its attributes in the payload of a node
+std::uint64_t pointRecordSize(std::uint32_t attributes)
+{
+    std::uint64_t size = sizeof(Base::Vector3f);
+    if (attributes & OctreeFile::HasNormals) {
+        size += sizeof(Base::Vector3f);
+    }
+    if (attributes & OctreeFile::HasColors) {
+        size += sizeof(PointChunk::Rgba);
+    }
+    if (attributes & OctreeFile::HasIntensity) {
+        size += sizeof(float);
+    }
+    return size;
+}
+
+void writeBox(std::ostream& out, const Base::BoundBox3f& box)
+{
+    writeValue(out, box.MinX);
+    writeValue(out, box.MinY);
+    writeValue(out, box.MinZ);
+    writeValue(out, box.MaxX);
+    writeValue(out, box.MaxY);
+    writeValue(out, box.MaxZ);
+}
+
+void readBox(std::istream& inp, Base::BoundBox3f& box)
+{
+    readValue(inp, box.MinX);
+    readValue(inp, box.MinY);
+    readValue(inp, box.MinZ);
+    readValue(inp, box.MaxX);
+    readValue(inp, box.MaxY);
+    readValue(inp, box.MaxZ);
+}
+
+Base::BoundBox3f octant(const Base::BoundBox3f& box, int index)
+{
+    Base::Vector3f center = box.GetCenter();
+    Base::BoundBox3f child = box;
+    (index & 1 ? child.MinX : child.MaxX) = center.x;
+    (index & 2 ? child.MinY : child.MaxY) = center.y;
+    (index & 4 ? child.MinZ : child.MaxZ) = center.z;
+    return child;
+}
+
+/**
+ * A temporary file of point blocks. Only the attributes of the octree are stored.
+ */
+class RecordFile
+{
+public:
+    RecordFile(std::string name, std::uint32_t attributes)
+        : name(std::move(name))
+        , attributes(attributes)
+    {
+        remove();
+    }
+    ~RecordFile()
+    {
+        remove();
+    }
+
+    RecordFile(const RecordFile&) = delete;
+    RecordFile(RecordFile&&) = delete;
+    RecordFile& operator=(const RecordFile&) = delete;
+    RecordFile& operator=(RecordFile&&) = delete;
+
+    std::uint64_t size() const
+    {
+        return count;
+    }
+
+    /// Writes a block of points
+    void writeBlock(const PointChunk& chunk)
+    {
+        if (!out.is_open()) {
+            out.open(Base::FileInfo(name), std::ios::out | std::ios::binary | std::ios::app);
+            if (!out) {
+                throw Base::FileException("Cannot create temporary file", name.c_str());
+            }
+        }
+
+        std::size_t num = chunk.size();
+        writeValue(out, num);
+        writeArray(out, chunk.points);
+        if (attributes & OctreeFile::HasNormals) {
+            writeArray(out, chunk.normals);
+        }
+        if (attributes & OctreeFile::HasColors) {
+            writeArray(out, chunk.colors);
+        }
+        if (attributes & OctreeFile::HasIntensity) {
+            writeArray(out, chunk.intensity);
+        }
+        if (!out) {
+            throw Base::FileException("Failed to write temporary file", name.c_str());
+        }
+
+        count += chunk.size();
+    }
+
+    /// Reads back the points block by block. The file is removed afterwards.
+    void read(const std::function<void(const PointChunk&)>& func)
+    {
+        out.close();
+
+        Base::ifstream inp(Base::FileInfo(name), std::ios::in | std::ios::binary);
+        PointChunk chunk;
+        while (!inp.eof()) {
+            std::size_t num = 0;
+            readValue(inp, num);
+            if (!inp) {
+                break;
+            }
+
+            readArray(inp, chunk.points, num);
+            if (attributes & OctreeFile::HasNormals) {
+                readArray(inp, chunk.normals, num);
+            }
+            if (attributes & OctreeFile::HasColors) {
+                readArray(inp, chunk.colors, num);
+            }
+            if (attributes & OctreeFile::HasIntensity) {
+                readArray(inp, chunk.intensity, num);
+            }
+            if (!inp) {
+                throw Base::FileException("Failed to read temporary file", name.c_str());
+            }
+
+            func(chunk);
+        }
+
+        inp.close();
+        remove();
+    }
+
+    /// Buffers single points and writes them as blocks
+    void append(const PointChunk& chunk, std::size_t index)
+    {
+        buffer.points.push_back(chunk.points[index]);
+        if (attributes & OctreeFile::HasNormals) {
+            buffer.normals.push_back(chunk.normals[index]);
+        }
+        if (attributes & OctreeFile::HasColors) {
+            buffer.colors.push_back(chunk.colors[index]);
+        }
+        if (attributes & OctreeFile::HasIntensity) {
+            buffer.intensity.push_back(chunk.intensity[index]);
+        }
+        if (buffer.size() >= blockSize) {
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        if (!buffer.empty()) {
+            writeBlock(buffer);
+            buffer.clear();
+        }
+        out.close();
+    }
+
+private:
+    void remove()
+    {
+        out.close();
+        Base::FileInfo fi(name);
+        if (fi.exists()) {
+            fi.deleteFile();
+        }
+    }
+
+private:
+    std::string name;
+    std::uint32_t attributes;
+    std::uint64_t count {0};
+    Base::ofstream out;
+    PointChunk buffer;
+};
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+void PointChunk::clear()
+{
+    points.clear();
+    normals.clear();
+    colors.clear();
+    intensity.clear();
+}
+
+void PointChunk::reserve(std::size_t num)
+{
+    points.reserve(num);
+    normals.reserve(num);
+    colors.reserve(num);
+    intensity.reserve(num);
+}
+
+std::size_t PointChunk::getMemSize() const
+{
+    return points.size() * sizeof(Base::Vector3f) + normals.size() * sizeof(Base::Vector3f)
+        + colors.size() * sizeof(Rgba) + intensity.size() * sizeof(float);
+}
+
+bool OctreeNode::isLeaf() const
+{
+    return std::all_of(children.begin(), children.end(), [](std::int32_t child) {
+        return child < 0;
+    });
+}
+
+// ----------------------------------------------------------------------------
+
+class OctreeBuilder::Private
+{
+public:
+    struct Task
+    {
+        std::size_t node;
+        std::unique_ptr<RecordFile> records;
+    };
+
+    std::string fileName;
+    std::size_t maxPoints;
+    std::uint32_t attributes {0};
+    bool initialized {false};
+    std::uint64_t numPoints {0};
+    std::size_t tempIndex {0};
+    Base::BoundBox3f boundBox;
+    std::unique_ptr<RecordFile> input;
+    std::vector<OctreeNode> nodes;
+    Base::ofstream out;
+
+    std::unique_ptr<RecordFile> createTempFile()
+    {
+        std::string name = fileName + ".part" + std::to_string(tempIndex++);
+        return std::make_unique<RecordFile>(name, attributes);
+    }
+
+    void writePayload(OctreeNode& node, const PointChunk& chunk)
+    {
+        node.offset = static_cast<std::uint64_t>(out.tellp());
+        node.count = static_cast<std::uint32_t>(chunk.size());
+        writeArray(out, chunk.points);
+        if (attributes & OctreeFile::HasNormals) {
+            writeArray(out, chunk.normals);
+        }
+        if (attributes & OctreeFile::HasColors) {
+            writeArray(out, chunk.colors);
+        }
+        if (attributes & OctreeFile::HasIntensity) {
+            writeArray(out, chunk.intensity);
+        }
+        if (!out) {
+            throw Base::FileException("Failed to write octree file", fileName.c_str());
+        }
+    }
+
+    static void append(PointChunk& dst, const PointChunk& src, std::size_t index)
+    {
+        dst.points.push_back(src.points[index]);
+        if (!src.normals.empty()) {
+            dst.normals.push_back(src.normals[index]);
+        }
+        if (!src.colors.empty()) {
+            dst.colors.push_back(src.colors[index]);
+        }
+        if (!src.intensity.empty()) {
+            dst.intensity.push_back(src.intensity[index]);
+        }
+    }
+
+    /**
+     * Distributes the points of a node. The first point in each cell of a regular grid
+     * is kept in the node until it's full, all others are passed to the child octants.
+     */
+    void split(Task& task, std::deque<Task>& pending)
+    {
+        OctreeNode node = nodes[task.node];
+        PointChunk own;
+
+        if (task.records->size() <= maxPoints || node.depth >= maxDepth) {
+            own.reserve(static_cast<std::size_t>(task.records->size()));
+            task.records->read([&own](const PointChunk& chunk) {
+                for (std::size_t i = 0; i < chunk.size(); i++) {
+                    append(own, chunk, i);
+                }
+            });
+            writePayload(node, own);
+            nodes[task.node] = node;
+            return;
+        }
+
+        std::array<std::unique_ptr<RecordFile>, 8> childRecords;
+        std::unordered_set<std::uint64_t> occupied;
+        own.reserve(maxPoints);
+
+        const Base::Vector3f center = node.box.GetCenter();
+        const Base::Vector3f minimum = node.box.GetMinimum();
+        const float scale = static_cast<float>(cellsPerAxis) / node.box.LengthX();
+        auto cellOf = [&](float value, float start) {
+            auto cell = static_cast<std::int64_t>((value - start) * scale);
+            return static_cast<std::uint64_t>(
+                std::clamp<std::int64_t>(cell, 0, cellsPerAxis - 1));
+        };
+
+        task.records->read([&](const PointChunk& chunk) {
+            for (std::size_t i = 0; i < chunk.size(); i++) {
+                const Base::Vector3f& pnt = chunk.points[i];
+                if (own.size() < maxPoints) {
+                    std::uint64_t cell = (cellOf(pnt.x, minimum.x) * cellsPerAxis
+                                          + cellOf(pnt.y, minimum.y))
+                            * cellsPerAxis
+                        + cellOf(pnt.z, minimum.z);
+                    if (occupied.insert(cell).second) {
+                        append(own, chunk, i);
+                        continue;
+                    }
+                }
+
+                int index = (pnt.x >= center.x ? 1 : 0) | (pnt.y >= center.y ? 2 : 0)
+                    | (pnt.z >= center.z ? 4 : 0);
+                if (!childRecords[index]) {
+                    childRecords[index] = createTempFile();
+                }
+                childRecords[index]->append(chunk, i);
+            }
+        });
+
+        writePayload(node, own);
+        for (int i = 0; i < 8; i++) {
+            if (childRecords[i]) {
+                childRecords[i]->flush();
+
+                OctreeNode child;
+                child.box = octant(node.box, i);
+                child.depth = node.depth + 1;
+                node.children[i] = static_cast<std::int32_t>(nodes.size());
+                nodes.push_back(child);
+                pending.push_back({nodes.size() - 1, std::move(childRecords[i])});
+            }
+        }
+        nodes[task.node] = node;
+    }
+};
+
+OctreeBuilder::OctreeBuilder(const std::string& filename, std::size_t maxPointsPerNode)
+    : d(new Private)
+{
+    d->fileName = filename;
+    d->maxPoints = std::max<std::size_t>(maxPointsPerNode, 1);
+}
+
+OctreeBuilder::~OctreeBuilder() = default;
+
+void OctreeBuilder::add(const PointChunk& chunk)
+{
+    if (chunk.empty()) {
+        return;
+    }
+
+    if (!d->initialized) {
+        if (!chunk.normals.empty()) {
+            d->attributes |= OctreeFile::HasNormals;
+        }
+        if (!chunk.colors.empty()) {
+            d->attributes |= OctreeFile::HasColors;
+        }
+        if (!chunk.intensity.empty()) {
+            d->attributes |= OctreeFile::HasIntensity;
+        }
+        d->input = d->createTempFile();
+        d->initialized = true;
+    }
+
+    // fill up missing attributes with defaults
+    const PointChunk* block = &chunk;
+    PointChunk filled;
+    std::size_t num = chunk.size();
+    bool missingNormals = (d->attributes & OctreeFile::HasNormals) && chunk.normals.size() != num;
+    bool missingColors = (d->attributes & OctreeFile::HasColors) && chunk.colors.size() != num;
+    bool missingIntensity =
+        (d->attributes & OctreeFile::HasIntensity) && chunk.intensity.size() != num;
+    if (missingNormals || missingColors || missingIntensity) {
+        filled = chunk;
+        filled.normals.resize(num);
+        filled.colors.resize(num, PointChunk::Rgba {255, 255, 255, 255});
+        filled.intensity.resize(num);
+        block = &filled;
+    }
+
+    for (const auto& pnt : block->points) {
+        d->boundBox.Add(pnt);
+    }
+
+    d->input->writeBlock(*block);
+    d->numPoints += num;
+}
+
+void OctreeBuilder::finish()
+{
+    if (!d->input) {
+        d->input = d->createTempFile();
+    }
+    d->input->flush();
+
+    d->out.open(Base::FileInfo(d->fileName), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!d->out) {
+        throw Base::FileException("Cannot create octree file", d->fileName.c_str());
+    }
+
+    // The header is written again when the node table is known
+    std::vector<char> header(headerSize);
+    d->out.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+    // The octree uses cubic cells
+    OctreeNode root;
+    if (d->boundBox.IsValid()) {
+        Base::Vector3f center = d->boundBox.GetCenter();
+        float size = std::max({d->boundBox.LengthX(),
+                               d->boundBox.LengthY(),
+                               d->boundBox.LengthZ(),
+                               std::numeric_limits<float>::epsilon()});
+        float half = 0.5F * size * 1.001F;
+        root.box = Base::BoundBox3f(center.x - half,
+                                    center.y - half,
+                                    center.z - half,
+                                    center.x + half,
+                                    center.y + half,
+                                    center.z + half);
+    }
+
+    d->nodes.clear();
+    d->nodes.push_back(root);
+
+    // Processing the nodes breadth-first stores the coarse levels at the beginning of the file
+    std::deque<Private::Task> pending;
+    pending.push_back({0, std::move(d->input)});
+    while (!pending.empty()) {
+        Private::Task task = std::move(pending.front());
+        pending.pop_front();
+        d->split(task, pending);
+    }
+
+    auto tableOffset = static_cast<std::uint64_t>(d->out.tellp());
+    for (const auto& node : d->nodes) {
+        writeBox(d->out, node.box);
+        writeValue(d->out, node.offset);
+        writeValue(d->out, node.count);
+        writeValue(d->out, node.depth);
+        for (std::int32_t child : node.children) {
+            writeValue(d->out, child);
+        }
+    }
+
+    d->out.seekp(0);
+    writeValue(d->out, OctreeFile::Magic);
+    writeValue(d->out, OctreeFile::Version);
+    writeValue(d->out, d->attributes);
+    writeValue(d->out, static_cast<std::uint32_t>(d->nodes.size()));
+    writeValue(d->out, d->numPoints);
+    writeValue(d->out, tableOffset);
+    writeBox(d->out, d->boundBox.IsValid() ? d->boundBox : root.box);
+
+    d->out.close();
+    if (d->out.fail()) {
+        throw Base::FileException("Failed to write octree file", d->fileName.c_str());
+    }
+}
+
+std::uint64_t OctreeBuilder::countPoints() const
+{
+    return d->numPoints;
+}
+
+// ----------------------------------------------------------------------------
+
+OctreeFile::OctreeFile() = default;
+
+OctreeFile::~OctreeFile() = default;
+
+void OctreeFile::open(const std::string& filename)
+{
+    close();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    file.open(Base::FileInfo(filename), std::ios::in | std::ios::binary);
+    if (!file) {
+        throw Base::FileException("Cannot open octree file", filename.c_str());
+    }
+
+    std::uint32_t magic {};
+    std::uint32_t version {};
+    std::uint32_t numNodes {};
+    std::uint64_t tableOffset {};
+    readValue(file, magic);
+    readValue(file, version);
+    readValue(file, attributes);
+    readValue(file, numNodes);
+    readValue(file, numPoints);
+    readValue(file, tableOffset);
+    readBox(file, boundBox);
+    if (!file || magic != Magic) {
+        file.close();
+        throw Base::BadFormatError("Not an octree file");
+    }
+    if (version != Version) {
+        file.close();
+        throw Base::BadFormatError("Unsupported version of octree file");
+    }
+
+    // check the sizes against the file before allocating anything for them
+    file.seekg(0, std::ios::end);
+    auto fileSize = static_cast<std::uint64_t>(file.tellg());
+    if (tableOffset > fileSize || numNodes > (fileSize - tableOffset) / nodeRecordSize) {
+        file.close();
+        throw Base::BadFormatError("Truncated octree file");
+    }
+
+    file.seekg(static_cast<std::streamoff>(tableOffset));
+    nodes.resize(numNodes);
+    const std::uint64_t pointSize = pointRecordSize(attributes);
+    bool valid = true;
+    for (auto& node : nodes) {
+        readBox(file, node.box);
+        readValue(file, node.offset);
+        readValue(file, node.count);
+        readValue(file, node.depth);
+        for (std::int32_t& child : node.children) {
+            readValue(file, child);
+            if (child >= static_cast<std::int32_t>(numNodes)) {
+                child = -1;
+            }
+        }
+        if (node.offset > fileSize || node.count > (fileSize - node.offset) / pointSize) {
+            valid = false;
+        }
+    }
+
+    if (!file || !valid) {
+        file.close();
+        nodes.clear();
+        throw Base::BadFormatError("Truncated octree file");
+    }
+
+    fileName = filename;
+}
+
+void OctreeFile::close()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    file.close();
+    fileName.clear();
+    attributes = 0;
+    numPoints = 0;
+    boundBox = Base::BoundBox3f();
+    nodes.clear();
+    lru.clear();
+    cache.clear();
+    cacheSize = 0;
+}
+
+bool OctreeFile::isOpen() const
+{
+    return !nodes.empty();
+}
+
+const std::string& OctreeFile::getFileName() const
+{
+    return fileName;
+}
+
+std::uint64_t OctreeFile::countPoints() const
+{
+    return numPoints;
+}
+
+const Base::BoundBox3f& OctreeFile::getBoundBox() const
+{
+    return boundBox;
+}
+
+bool OctreeFile::hasNormals() const
+{
+    return (attributes & HasNormals) != 0;
+}
+
+bool OctreeFile::hasColors() const
+{
+    return (attributes & HasColors) != 0;
+}
+
+bool OctreeFile::hasIntensity() const
+{
+    return (attributes & HasIntensity) != 0;
+}
+
+const std::vector<OctreeNode>& OctreeFile::getNodes() const
+{
+    return nodes;
+}
+
+std::shared_ptr<PointChunk> OctreeFile::readNode(const OctreeNode& node) const
+{
+    // the mutex must be locked
+    auto chunk = std::make_shared<PointChunk>();
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(node.offset));
+    readArray(file, chunk->points, node.count);
+    if (hasNormals()) {
+        readArray(file, chunk->normals, node.count);
+    }
+    if (hasColors()) {
+        readArray(file, chunk->colors, node.count);
+    }
+    if (hasIntensity()) {
+        readArray(file, chunk->intensity, node.count);
+    }
+    if (!file) {
+        throw Base::FileException("Failed to read octree node", fileName.c_str());
+    }
+
+    return chunk;
+}
+
+void OctreeFile::insertCache(std::size_t index, const std::shared_ptr<PointChunk>& chunk) const
+{
+    // the mutex must be locked
+    lru.emplace_front(index, chunk);
+    cache[index] = lru.begin();
+    cacheSize += chunk->getMemSize();
+
+    // always keep the most recently used node
+    while (cacheSize > cacheLimit && lru.size() > 1) {
+        const CacheEntry& last = lru.back();
+        cacheSize -= last.second->getMemSize();
+        cache.erase(last.first);
+        lru.pop_back();
+    }
+}
+
+std::shared_ptr<const PointChunk> OctreeFile::loadNode(std::size_t index) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(index);
+    if (it != cache.end()) {
+        lru.splice(lru.begin(), lru, it->second);
+        return it->second->second;
+    }
+
+    if (index >= nodes.size()) {
+        throw Base::IndexError("Node index out of range");
+    }
+
+    std::shared_ptr<PointChunk> chunk = readNode(nodes[index]);
+    insertCache(index, chunk);
+    return chunk;
+}
+
+std::shared_ptr<const PointChunk> OctreeFile::findNode(std::size_t index) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(index);
+    if (it != cache.end()) {
+        lru.splice(lru.begin(), lru, it->second);
+        return it->second->second;
+    }
+
+    return {};
+}
+
+void OctreeFile::setCacheLimit(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    cacheLimit = bytes;
+    while (cacheSize > cacheLimit && !lru.empty()) {
+        const CacheEntry& last = lru.back();
+        cacheSize -= last.second->getMemSize();
+        cache.erase(last.first);
+        lru.pop_back();
+    }
+}
+
+std::size_t OctreeFile::getCacheLimit() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return cacheLimit;
+}
+
+void OctreeFile::forEachChunk(const std::function<void(const PointChunk&)>& func) const
+{
+    // Bypass the cache so that iterating the whole cloud doesn't evict the working set
+    for (const auto& node : nodes) {
+        std::shared_ptr<PointChunk> chunk;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            chunk = readNode(node);
+        }
+        func(*chunk);
+    }
+}
+
+std::vector<std::size_t>
+OctreeFile::selectNodes(std::uint64_t pointBudget,
+                        const std::function<float(const OctreeNode&)>& priority) const
+{
+    std::vector<std::size_t> selection;
+    if (nodes.empty()) {
+        return selection;
+    }
+
+    using Candidate = std::pair<float, std::size_t>;
+    std::priority_queue<Candidate> candidates;
+    float weight = priority(nodes.front());
+    if (weight > 0.0F) {
+        candidates.emplace(weight, 0);
+    }
+
+    std::uint64_t numPoints = 0;
+    while (!candidates.empty()) {
+        std::size_t index = candidates.top().second;
+        candidates.pop();
+
+        const OctreeNode& node = nodes[index];
+        if (numPoints + node.count > pointBudget) {
+            break;
+        }
+
+        numPoints += node.count;
+        selection.push_back(index);
+        for (std::int32_t child : node.children) {
+            if (child >= 0) {
+                weight = priority(nodes[child]);
+                if (weight > 0.0F) {
+                    candidates.emplace(weight, static_cast<std::size_t>(child));
+                }
+            }
+        }
+    }
+
+    return selection;
+}
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_POINTSOCTREE_H
+#define POINTS_POINTSOCTREE_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Stream.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+/**
+ * A block of points with optional per-point attributes. The attributes are either empty or
+ * have as many elements as there are points. Colors are stored as RGBA bytes so that they
+ * can directly be passed to OpenGL.
+ */
+struct PointsExport PointChunk
+{
+    using Rgba = std::array<std::uint8_t, 4>;
+
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> normals;
+    std::vector<Rgba> colors;
+    std::vector<float> intensity;
+
+    std::size_t size() const
+    {
+        return points.size();
+    }
+    bool empty() const
+    {
+        return points.empty();
+    }
+    void clear();
+    void reserve(std::size_t num);
+    /// Returns the memory in bytes occupied by the arrays
+    std::size_t getMemSize() const;
+};
+
+/**
+ * A node of an out-of-core octree. Each point of the cloud is stored in exactly one node.
+ * An inner node keeps a spatially uniform subsample of the points inside its box, the
+ * remaining points are passed to its children. So the nodes of a subtree that is cut off at
+ * any depth are a coarser representation of the whole subtree.
+ */
+struct PointsExport OctreeNode
+{
+    Base::BoundBox3f box;
+    std::uint64_t offset {0};
+    std::uint32_t count {0};
+    std::uint32_t depth {0};
+    std::array<std::int32_t, 8> children {-1, -1, -1, -1, -1, -1, -1, -1};
+
+    bool isLeaf() const;
+};
+
+/**
+ * The OctreeBuilder class creates an octree file from a point cloud of any size.
+ * The points are passed chunk by chunk with add() and spilled to temporary files, so that
+ * never more than one node is kept in memory. finish() then splits the points recursively
+ * until no node has more than the given number of points.
+ *
+ * The attributes of the first added chunk define the attributes of the octree. Attributes
+ * missing in later chunks are filled with default values.
+ * @code
+ * Points::OctreeBuilder builder("cloud.fcoct");
+ * while (...) {
+ *     builder.add(chunk);
+ * }
+ * builder.finish();
+ * @endcode
+ */
+class PointsExport OctreeBuilder
+{
+public:
+    explicit OctreeBuilder(const std::string& filename, std::size_t maxPointsPerNode = 65536);
+    ~OctreeBuilder();
+
+    /// Appends a block of points
+    void add(const PointChunk& chunk);
+    /// Builds the octree and writes it to the file
+    void finish();
+    /// Returns the number of added points
+    std::uint64_t countPoints() const;
+
+    OctreeBuilder(const OctreeBuilder&) = delete;
+    OctreeBuilder(OctreeBuilder&&) = delete;
+    OctreeBuilder& operator=(const OctreeBuilder&) = delete;
+    OctreeBuilder& operator=(OctreeBuilder&&) = delete;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+/**
+ * The OctreeFile class gives access to an octree file written by OctreeBuilder.
+ * Only the node table is kept in memory, the points of a node are paged in on demand by
+ * loadNode(). Recently used nodes are kept in a cache whose size can be limited. Nodes can
+ * be loaded from several threads at once, but the header and the node table aren't locked, so
+ * open() and close() must not be called while other threads use the file.
+ */
+class PointsExport OctreeFile
+{
+public:
+    /// The magic number at the beginning of an octree file
+    static constexpr std::uint32_t Magic = 0x544f4346;  // "FCOT"
+    static constexpr std::uint32_t Version = 1;
+
+    enum Attribute : std::uint32_t
+    {
+        HasNormals = 1,
+        HasColors = 2,
+        HasIntensity = 4
+    };
+
+    OctreeFile();
+    ~OctreeFile();
+
+    /// Opens the file and reads the node table. A Base::FileException is thrown if the file
+    /// cannot be opened, a Base::BadFormatError if it's not an octree file.
+    void open(const std::string& filename);
+    void close();
+    bool isOpen() const;
+    const std::string& getFileName() const;
+
+    /** @name Header */
+    //@{
+    std::uint64_t countPoints() const;
+    const Base::BoundBox3f& getBoundBox() const;
+    bool hasNormals() const;
+    bool hasColors() const;
+    bool hasIntensity() const;
+    //@}
+
+    /** @name Nodes */
+    //@{
+    const std::vector<OctreeNode>& getNodes() const;
+    /// Returns the points of the node with index \a index. Reads it from disk if it's not cached.
+    std::shared_ptr<const PointChunk> loadNode(std::size_t index) const;
+    /// Returns the points of the node if it's in the cache, or null otherwise.
+    std::shared_ptr<const PointChunk> findNode(std::size_t index) const;
+    /// Sets the maximum memory in bytes of the node cache
+    void setCacheLimit(std::size_t bytes);
+    std::size_t getCacheLimit() const;
+    //@}
+
+    /** Calls \a func for the points of every node. Each point of the cloud is passed exactly
+     * once while at most one node has to be in memory.
+     */
+    void forEachChunk(const std::function<void(const PointChunk&)>& func) const;
+
+    /** Selects the nodes to show a level of detail with at most \a pointBudget points.
+     * \a priority returns a weight for a node, e.g. its projected size on the screen; nodes
+     * with a weight <= 0 are skipped with their subtrees. Starting with the root, always the
+     * node with the highest weight is added and replaced by its children until the budget is
+     * used up. Since an inner node stores a subsample of its subtree every returned set of
+     * nodes is a complete, but coarser, representation of the visible part.
+     */
+    std::vector<std::size_t>
+    selectNodes(std::uint64_t pointBudget,
+                const std::function<float(const OctreeNode&)>& priority) const;
+
+    OctreeFile(const OctreeFile&) = delete;
+    OctreeFile(OctreeFile&&) = delete;
+    OctreeFile& operator=(const OctreeFile&) = delete;
+    OctreeFile& operator=(OctreeFile&&) = delete;
+
+private:
+    std::shared_ptr<PointChunk> readNode(const OctreeNode& node) const;
+    void insertCache(std::size_t index, const std::shared_ptr<PointChunk>& chunk) const;
+
+private:
+    using CacheEntry = std::pair<std::size_t, std::shared_ptr<const PointChunk>>;
+
+    std::string fileName;
+    mutable Base::ifstream file;
+    std::uint32_t attributes {0};
+    std::uint64_t numPoints {0};
+    Base::BoundBox3f boundBox;
+    std::vector<OctreeNode> nodes;
+
+    mutable std::mutex mutex;
+    mutable std::list<CacheEntry> lru;
+    mutable std::unordered_map<std::size_t, std::list<CacheEntry>::iterator> cache;
+    mutable std::size_t cacheSize {0};
+    std::size_t cacheLimit {512 * 1024 * 1024};
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_POINTSOCTREE_H
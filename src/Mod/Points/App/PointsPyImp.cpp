@@ -22,15 +22,21 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
 #include <boost/math/special_functions/fpclassify.hpp>
 #endif
 
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/VectorPy.h>
 
 #include "Points.h"
+#include "PointsEstimation.h"
+#include "PointsFilter.h"
+#include "PointsKDTree.h"
 // inclusion of the generated files (generated out of PointsPy.xml)
 #include "PointsPy.h"
 #include "PointsPy.cpp"
@@ -38,6 +44,47 @@
 
 using namespace Points;
 
+namespace
+{
+
+/// Converts a vector or a sequence of vectors into points in the local coordinate system
+bool getQueryPoints(PyObject* obj, const PointKernel* kernel, std::vector<Base::Vector3f>& pts)
+{
+    Base::Matrix4D inv = kernel->getTransform();
+    inv.inverseGauss();
+
+    if (PyObject_TypeCheck(obj, &Base::VectorPy::Type)) {
+        Base::Vector3d pnt = inv * Py::Vector(obj, false).toVector();
+        pts.push_back(Base::convertTo<Base::Vector3f>(pnt));
+        return true;
+    }
+
+    Py::Sequence list(obj);
+    pts.reserve(list.size());
+    for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+        Base::Vector3d pnt = inv * Py::Vector(*it).toVector();
+        pts.push_back(Base::convertTo<Base::Vector3f>(pnt));
+    }
+    return false;
+}
+
+Py::Object toIndexList(const Neighbours& nn, bool single)
+{
+    Py::List lists;
+    for (std::size_t i = 0; i < nn.size(); i++) {
+        Py::List indices;
+        for (std::size_t j = nn.offsets[i]; j < nn.offsets[i + 1]; j++) {
+            indices.append(Py::Long(static_cast<long>(nn.indices[j])));
+        }
+        if (single) {
+            return indices;
+        }
+        lists.append(indices);
+    }
+    return lists;
+}
+
+}  // namespace
 // returns a string which represents the object e.g. when printed in python
 std::string PointsPy::representation() const
 {
@@ -242,6 +289,164 @@ PyObject* PointsPy::fromValid(PyObject* args)
     }
 }
 
+PyObject* PointsPy::findNearest(PyObject* args)
+{
+    PyObject* obj {};
+    int k {};
+    if (!PyArg_ParseTuple(args, "Oi", &obj, &k)) {
+        return nullptr;
+    }
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "K must not be negative");
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const PointKernel* points = getPointKernelPtr();
+        std::vector<Base::Vector3f> pts;
+        bool single = getQueryPoints(obj, points, pts);
+
+        KDTree tree(*points);
+        Neighbours nn = tree.findNearest(pts, static_cast<std::size_t>(k));
+        return Py::new_reference_to(toIndexList(nn, single));
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::findInRadius(PyObject* args)
+{
+    PyObject* obj {};
+    double radius {};
+    if (!PyArg_ParseTuple(args, "Od", &obj, &radius)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const PointKernel* points = getPointKernelPtr();
+        std::vector<Base::Vector3f> pts;
+        bool single = getQueryPoints(obj, points, pts);
+
+        KDTree tree(*points);
+        Neighbours nn = tree.findInRadius(pts, static_cast<float>(radius));
+        return Py::new_reference_to(toIndexList(nn, single));
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::estimateNormals(PyObject* args, PyObject* kwds)
+{
+    int kSearch = 10;
+    double searchRadius = 0.0;
+    static const std::array<const char*, 3> keywords {"KSearch", "SearchRadius", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             kwds,
+                                             "|id",
+                                             keywords,
+                                             &kSearch,
+                                             &searchRadius)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const PointKernel* points = getPointKernelPtr();
+        KDTree tree(*points);
+        NormalEstimation estimation(tree);
+        estimation.setKSearch(static_cast<std::size_t>(std::max(kSearch, 0)));
+        estimation.setSearchRadius(static_cast<float>(searchRadius));
+
+        std::vector<Base::Vector3f> normals;
+        estimation.perform(normals);
+
+        // the normals are computed in the local coordinate system
+        Base::Matrix4D mat = points->getTransform();
+        mat.setCol(3, Base::Vector3d());
+        Py::List list;
+        for (const auto& it : normals) {
+            Base::Vector3d normal = mat * Base::convertTo<Base::Vector3d>(it);
+            list.append(Py::Vector(normal));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::estimateCurvatures(PyObject* args, PyObject* kwds)
+{
+    int kSearch = 10;
+    double searchRadius = 0.0;
+    static const std::array<const char*, 3> keywords {"KSearch", "SearchRadius", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             kwds,
+                                             "|id",
+                                             keywords,
+                                             &kSearch,
+                                             &searchRadius)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const PointKernel* points = getPointKernelPtr();
+        KDTree tree(*points);
+        NormalEstimation estimation(tree);
+        estimation.setKSearch(static_cast<std::size_t>(std::max(kSearch, 0)));
+        estimation.setSearchRadius(static_cast<float>(searchRadius));
+
+        std::vector<Base::Vector3f> normals;
+        std::vector<CurvatureInfo> curvatures;
+        estimation.perform(normals, curvatures);
+
+        Base::Matrix4D mat = points->getTransform();
+        mat.setCol(3, Base::Vector3d());
+        Py::List list;
+        for (const auto& it : curvatures) {
+            Base::Vector3d maxDir = mat * Base::convertTo<Base::Vector3d>(it.cMaxCurvDir);
+            Base::Vector3d minDir = mat * Base::convertTo<Base::Vector3d>(it.cMinCurvDir);
+            Py::Tuple tuple(4);
+            tuple.setItem(0, Py::Float(it.fMaxCurvature));
+            tuple.setItem(1, Py::Float(it.fMinCurvature));
+            tuple.setItem(2, Py::Vector(maxDir));
+            tuple.setItem(3, Py::Vector(minDir));
+            list.append(tuple);
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::findOutliers(PyObject* args, PyObject* kwds)
+{
+    int kSearch = 8;
+    double stdDevMul = 1.0;
+    static const std::array<const char*, 3> keywords {"KSearch", "StdDevMul", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             kwds,
+                                             "|id",
+                                             keywords,
+                                             &kSearch,
+                                             &stdDevMul)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        KDTree tree(*getPointKernelPtr());
+        StatisticalOutlierFilter filter(tree);
+        filter.setKSearch(static_cast<std::size_t>(std::max(kSearch, 0)));
+        filter.setStdDevMul(stdDevMul);
+
+        Py::List list;
+        for (unsigned long index : filter.perform()) {
+            list.append(Py::Long(static_cast<long>(index)));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
 Py::Long PointsPy::getCountPoints() const
 {
     return Py::Long((long)getPointKernelPtr()->size());
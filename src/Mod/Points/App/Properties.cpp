@@ -29,6 +29,7 @@
 #endif
 
 #include <Base/Converter.h>
+#include <Base/GeometryPyCXX.h>
 #include <Base/Matrix.h>
 #include <Base/Persistence.h>
 #include <Base/Stream.h>
@@ -155,6 +156,11 @@ void PropertyGreyValueList::SaveDocFile(Base::Writer& writer) const
     }
 }
 
+bool PropertyGreyValueList::canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const
+{
+    return true;
+}
+
 void PropertyGreyValueList::RestoreDocFile(Base::Reader& reader)
 {
     Base::InputStream str(reader);
@@ -327,6 +333,11 @@ void PropertyNormalList::SaveDocFile(Base::Writer& writer) const
     }
 }
 
+bool PropertyNormalList::canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const
+{
+    return true;
+}
+
 void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
 {
     Base::InputStream str(reader);
@@ -565,7 +576,16 @@ void PropertyCurvatureList::removeIndices(const std::vector<unsigned long>& uInd
 
 PyObject* PropertyCurvatureList::getPyObject()
 {
-    throw Py::NotImplementedError("Not yet implemented");
+    Py::List list;
+    for (const auto& it : _lValueList) {
+        Py::Tuple tuple(4);
+        tuple.setItem(0, Py::Float(it.fMaxCurvature));
+        tuple.setItem(1, Py::Float(it.fMinCurvature));
+        tuple.setItem(2, Py::Vector(it.cMaxCurvDir));
+        tuple.setItem(3, Py::Vector(it.cMinCurvDir));
+        list.append(tuple);
+    }
+    return Py::new_reference_to(list);
 }
 
 void PropertyCurvatureList::setPyObject(PyObject*)
@@ -606,6 +626,11 @@ void PropertyCurvatureList::SaveDocFile(Base::Writer& writer) const
     }
 }
 
+bool PropertyCurvatureList::canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const
+{
+    return true;
+}
+
 void PropertyCurvatureList::RestoreDocFile(Base::Reader& reader)
 {
     Base::InputStream str(reader);
@@ -84,6 +84,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
 
     void SaveDocFile(Base::Writer& writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
     App::Property* Copy() const override;
@@ -136,6 +137,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
 
     void SaveDocFile(Base::Writer& writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
     App::Property* Copy() const override;
@@ -214,6 +216,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
 
     void SaveDocFile(Base::Writer& writer) const override;
+    bool canSaveDocFileConcurrently(const Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
     //@}
 
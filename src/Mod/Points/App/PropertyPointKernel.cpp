@@ -52,10 +52,17 @@ void PropertyPointKernel::setValue(const PointKernel& m)
 
 const PointKernel& PropertyPointKernel::getValue() const
 {
+    restoreDeferred();
     return *_cPoints;
 }
 
 const Data::ComplexGeoData* PropertyPointKernel::getComplexData() const
+{
+    restoreDeferred();
+    return peekComplexData();
+}
+
+const Data::ComplexGeoData* PropertyPointKernel::peekComplexData() const
 {
     return _cPoints;
 }
@@ -72,11 +79,13 @@ Base::Matrix4D PropertyPointKernel::getTransform() const
 
 Base::BoundBox3d PropertyPointKernel::getBoundingBox() const
 {
+    restoreDeferred();
     return _cPoints->getBoundBox();
 }
 
 PyObject* PropertyPointKernel::getPyObject()
 {
+    restoreDeferred();
     PointsPy* points = new PointsPy(&*_cPoints);
     points->setConst();  // set immutable
     return points;
@@ -97,6 +106,7 @@ void PropertyPointKernel::setPyObject(PyObject* value)
 
 void PropertyPointKernel::Save(Base::Writer& writer) const
 {
+    restoreDeferred();
     _cPoints->Save(writer);
 }
 
@@ -133,8 +143,34 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+bool PropertyPointKernel::canRestoreDocFileConcurrently() const
+{
+    return true;
+}
+
+std::function<void()> PropertyPointKernel::RestoreDocFileConcurrently(Base::Reader& reader)
+{
+    auto apply = _cPoints->RestoreDocFileConcurrently(reader);
+    return [this, apply]() {
+        aboutToSetValue();
+        apply();
+        hasSetValue();
+    };
+}
+
+bool PropertyPointKernel::canRestoreDocFileDeferred() const
+{
+    return true;
+}
+
+void PropertyPointKernel::RestoreDocFileDeferred(Base::Reader& reader)
+{
+    _cPoints->RestoreDocFile(reader);
+}
+
 App::Property* PropertyPointKernel::Copy() const
 {
+    restoreDeferred();
     PropertyPointKernel* prop = new PropertyPointKernel();
     (*prop->_cPoints) = (*this->_cPoints);
     return prop;
@@ -150,6 +186,7 @@ void PropertyPointKernel::Paste(const App::Property& from)
 
 unsigned int PropertyPointKernel::getMemSize() const
 {
+    restoreDeferred();
     return sizeof(Base::Vector3f) * this->_cPoints->size();
 }
 
@@ -166,6 +203,7 @@ void PropertyPointKernel::finishEditing()
 
 void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndices)
 {
+    restoreDeferred();
     // We need a sorted array
     std::vector<unsigned long> uSortedInds = uIndices;
     std::sort(uSortedInds.begin(), uSortedInds.end());
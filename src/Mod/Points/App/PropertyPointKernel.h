@@ -76,6 +76,9 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canRestoreDocFileConcurrently() const override;
+    std::function<void()> RestoreDocFileConcurrently(Base::Reader& reader) override;
+    bool canRestoreDocFileDeferred() const override;
     //@}
 
     /** @name Modification */
@@ -87,6 +90,10 @@ public:
     void removeIndices(const std::vector<unsigned long>&);
     //@}
 
+protected:
+    const Data::ComplexGeoData* peekComplexData() const override;
+    void RestoreDocFileDeferred(Base::Reader& reader) override;
+
 private:
     Base::Reference<PointKernel> _cPoints;
 };
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <limits>
 #include <vector>
 #endif
 
@@ -80,6 +81,19 @@ App::DocumentObjectExecReturn* Structured::execute()
     return App::DocumentObject::StdReturn;
 }
 
+void Structured::removeIndices(const std::vector<unsigned long>& indices)
+{
+    PointKernel kernel(Points.getValue());
+    std::vector<PointKernel::value_type>& points = kernel.getBasicPoints();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    for (unsigned long index : indices) {
+        if (index < points.size()) {
+            points[index].Set(nan, nan, nan);
+        }
+    }
+    Points.setValue(kernel);
+}
+
 // ---------------------------------------------------------
 
 namespace App
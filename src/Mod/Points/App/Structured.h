@@ -55,6 +55,9 @@ public:
         return "PointsGui::ViewProviderStructured";
     }
     //@}
+
+    /// Marks the points with the given indices invalid to keep the Width*Height points
+    void removeIndices(const std::vector<unsigned long>& indices) override;
 };
 
 using StructuredCustom = App::FeatureCustomT<Structured>;
@@ -29,7 +29,9 @@
 #include <Gui/Language/Translator.h>
 #include <Mod/Points/App/PropertyPointKernel.h>
 
+#include "SoFCOctreePointSet.h"
 #include "ViewProvider.h"
+#include "ViewProviderOctree.h"
 #include "Workbench.h"
 
 
@@ -88,10 +90,12 @@ PyMOD_INIT_FUNC(PointsGui)
     CreatePointsCommands();
 
     // clang-format off
+    PointsGui::SoFCOctreePointSet       ::initClass();
     PointsGui::ViewProviderPoints       ::init();
     PointsGui::ViewProviderScattered    ::init();
     PointsGui::ViewProviderStructured   ::init();
     PointsGui::ViewProviderPython       ::init();
+    PointsGui::ViewProviderOctree       ::init();
     PointsGui::Workbench                ::init();
     // clang-format on
     Gui::ViewProviderBuilder::add(Points::PropertyPointKernel::getClassTypeId(),
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#ifdef FC_OS_WIN32
+#include <windows.h>
+#endif
+#ifdef FC_OS_MACOSX
+#include <OpenGL/gl.h>
+#else
+#include <GL/gl.h>
+#endif
+#include <Inventor/SoPrimitiveVertex.h>
+#include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoGetPrimitiveCountAction.h>
+#include <Inventor/bundles/SoMaterialBundle.h>
+#include <Inventor/details/SoPointDetail.h>
+#include <Inventor/elements/SoLazyElement.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
+#include <Inventor/misc/SoState.h>
+#include <Inventor/sensors/SoOneShotSensor.h>
+#endif
+
+#include <Gui/SoFCInteractiveElement.h>
+#include <Mod/Points/App/PointsOctree.h>
+
+#include "SoFCOctreePointSet.h"
+
+
+using namespace PointsGui;
+
+SO_NODE_SOURCE(SoFCOctreePointSet)
+
+void SoFCOctreePointSet::initClass()
+{
+    SO_NODE_INIT_CLASS(SoFCOctreePointSet, SoShape, "Shape");
+}
+
+SoFCOctreePointSet::SoFCOctreePointSet()
+{
+    SO_NODE_CONSTRUCTOR(SoFCOctreePointSet);
+    SO_NODE_ADD_FIELD(pointBudget, (3000000));
+    SO_NODE_ADD_FIELD(colorPerVertex, (false));
+    SO_NODE_ADD_FIELD(shaded, (false));
+
+    loadSensor = new SoOneShotSensor(loadSensorCB, this);
+}
+
+SoFCOctreePointSet::~SoFCOctreePointSet()
+{
+    delete loadSensor;
+}
+
+void SoFCOctreePointSet::loadSensorCB(void* data, SoSensor* /*sensor*/)
+{
+    // redraw to show the nodes that couldn't be loaded in the last frame
+    static_cast<SoFCOctreePointSet*>(data)->touch();
+}
+
+void SoFCOctreePointSet::setOctree(const std::shared_ptr<const Points::OctreeFile>& octree)
+{
+    this->octree = octree;
+    this->selection.clear();
+    touch();
+}
+
+/**
+ * Selects the nodes of the octree to render. The weight of a node is its projected size in
+ * pixels. While the user navigates only a quarter of the point budget is used.
+ */
+std::vector<std::size_t> SoFCOctreePointSet::selectNodes(SoState* state) const
+{
+    const SbMatrix& model = SoModelMatrixElement::get(state);
+    const SbViewVolume& vv = SoViewVolumeElement::get(state);
+    const SbViewportRegion& vp = SoViewportRegionElement::get(state);
+    auto height = static_cast<float>(vp.getViewportSizePixels()[1]);
+
+    std::uint64_t budget = std::max(pointBudget.getValue(), 0);
+    if (Gui::SoFCInteractiveElement::get(state)) {
+        budget /= 4;
+    }
+
+    return octree->selectNodes(budget, [&](const Points::OctreeNode& node) {
+        SbBox3f box(node.box.MinX,
+                    node.box.MinY,
+                    node.box.MinZ,
+                    node.box.MaxX,
+                    node.box.MaxY,
+                    node.box.MaxZ);
+        box.transform(model);
+        if (!vv.intersect(box)) {
+            return 0.0F;
+        }
+
+        float scale = vv.getWorldToScreenScale(box.getCenter(), 1.0F);
+        float size = (box.getMax() - box.getMin()).length();
+        if (scale <= 0.0F) {
+            return std::numeric_limits<float>::max();
+        }
+        return size / scale * height;
+    });
+}
+
+void SoFCOctreePointSet::GLRender(SoGLRenderAction* action)
+{
+    if (!octree || !shouldGLRender(action)) {
+        return;
+    }
+
+    SoState* state = action->getState();
+    selection = selectNodes(state);
+
+    // Load the missing nodes for a limited time to keep the viewer responsive. The selection
+    // starts with the coarse nodes, so a rough representation is shown immediately.
+    using Clock = std::chrono::steady_clock;
+    const auto deadline = Clock::now() + std::chrono::milliseconds(40);
+    std::vector<std::shared_ptr<const Points::PointChunk>> chunks;
+    chunks.reserve(selection.size());
+    bool missing = false;
+    for (std::size_t index : selection) {
+        std::shared_ptr<const Points::PointChunk> chunk = octree->findNode(index);
+        if (!chunk && Clock::now() < deadline) {
+            chunk = octree->loadNode(index);
+        }
+        if (chunk) {
+            chunks.push_back(chunk);
+        }
+        else {
+            missing = true;
+        }
+    }
+
+    if (missing) {
+        loadSensor->schedule();
+    }
+
+    bool useNormals = shaded.getValue() && octree->hasNormals();
+    bool useColors = colorPerVertex.getValue() && octree->hasColors();
+
+    SoMaterialBundle mb(action);
+    if (!useNormals) {
+        SoLazyElement::setLightModel(state, SoLazyElement::BASE_COLOR);
+    }
+    mb.sendFirst();  // make sure we have the correct material
+
+    // the color array changes the current color behind Coin's back
+    glPushAttrib(GL_CURRENT_BIT);
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    if (useNormals) {
+        glEnableClientState(GL_NORMAL_ARRAY);
+    }
+    if (useColors) {
+        glEnableClientState(GL_COLOR_ARRAY);
+    }
+
+    for (const auto& chunk : chunks) {
+        if (chunk->empty()) {
+            continue;
+        }
+        glVertexPointer(3, GL_FLOAT, 0, chunk->points.data());
+        if (useNormals) {
+            glNormalPointer(GL_FLOAT, 0, chunk->normals.data());
+        }
+        if (useColors) {
+            glColorPointer(3, GL_UNSIGNED_BYTE, sizeof(Points::PointChunk::Rgba),
+                           chunk->colors.data());
+        }
+        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(chunk->size()));
+    }
+
+    glPopClientAttrib();
+    glPopAttrib();
+}
+
+void SoFCOctreePointSet::computeBBox(SoAction* /*action*/, SbBox3f& box, SbVec3f& center)
+{
+    if (octree && octree->countPoints() > 0) {
+        const Base::BoundBox3f& cBox = octree->getBoundBox();
+        box.setBounds(SbVec3f(cBox.MinX, cBox.MinY, cBox.MinZ),
+                      SbVec3f(cBox.MaxX, cBox.MaxY, cBox.MaxZ));
+        Base::Vector3f mid = cBox.GetCenter();
+        center.setValue(mid.x, mid.y, mid.z);
+    }
+    else {
+        box.setBounds(SbVec3f(0, 0, 0), SbVec3f(0, 0, 0));
+        center.setValue(0.0F, 0.0F, 0.0F);
+    }
+}
+
+/**
+ * Adds the number of the points rendered in the last frame.
+ */
+void SoFCOctreePointSet::getPrimitiveCount(SoGetPrimitiveCountAction* action)
+{
+    if (!octree || !this->shouldPrimitiveCount(action)) {
+        return;
+    }
+
+    int numPoints = 0;
+    for (std::size_t index : selection) {
+        numPoints += static_cast<int>(octree->getNodes()[index].count);
+    }
+    action->addNumPoints(numPoints);
+}
+
+/**
+ * Creates the points rendered in the last frame, or the coarsest level if the node
+ * hasn't been rendered yet.
+ */
+void SoFCOctreePointSet::generatePrimitives(SoAction* /*action*/)
+{
+    if (!octree || octree->getNodes().empty()) {
+        return;
+    }
+
+    std::vector<std::size_t> nodes = selection;
+    if (nodes.empty()) {
+        nodes.push_back(0);
+    }
+
+    SoPrimitiveVertex vertex;
+    SoPointDetail pointDetail;
+    vertex.setDetail(&pointDetail);
+
+    int index = 0;
+    for (std::size_t node : nodes) {
+        std::shared_ptr<const Points::PointChunk> chunk = octree->loadNode(node);
+        for (std::size_t i = 0; i < chunk->size(); i++) {
+            const Base::Vector3f& pnt = chunk->points[i];
+            pointDetail.setCoordinateIndex(index++);
+            vertex.setPoint(SbVec3f(pnt.x, pnt.y, pnt.z));
+            if (!chunk->normals.empty()) {
+                const Base::Vector3f& nor = chunk->normals[i];
+                vertex.setNormal(SbVec3f(nor.x, nor.y, nor.z));
+            }
+            shapeVertex(&vertex);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTSGUI_SOFCOCTREEPOINTSET_H
+#define POINTSGUI_SOFCOCTREEPOINTSET_H
+
+#include <memory>
+#include <vector>
+
+#include <Inventor/fields/SoSFBool.h>
+#include <Inventor/fields/SoSFInt32.h>
+#include <Inventor/nodes/SoShape.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+class SoOneShotSensor;
+class SoSensor;
+
+namespace Points
+{
+class OctreeFile;
+}
+
+namespace PointsGui
+{
+
+/**
+ * The SoFCOctreePointSet class renders a point cloud stored in an out-of-core octree.
+ * For every frame the nodes with the largest projected size inside the view volume are
+ * selected until the point budget is used up, so the level of detail adapts to the camera.
+ * Nodes that are not in memory yet are loaded for a limited time per frame and the node is
+ * redrawn until all selected nodes are available.
+ */
+class PointsGuiExport SoFCOctreePointSet: public SoShape
+{
+    using inherited = SoShape;
+
+    SO_NODE_HEADER(SoFCOctreePointSet);
+
+public:
+    static void initClass();
+    SoFCOctreePointSet();
+
+    SoSFInt32 pointBudget;    /**< Maximum number of rendered points */
+    SoSFBool colorPerVertex;  /**< Use the colors of the points if available */
+    SoSFBool shaded;          /**< Use the normals of the points for lighting if available */
+
+    void setOctree(const std::shared_ptr<const Points::OctreeFile>& octree);
+
+protected:
+    ~SoFCOctreePointSet() override;
+    void GLRender(SoGLRenderAction* action) override;
+    void computeBBox(SoAction* action, SbBox3f& box, SbVec3f& center) override;
+    void getPrimitiveCount(SoGetPrimitiveCountAction* action) override;
+    void generatePrimitives(SoAction* action) override;
+
+private:
+    std::vector<std::size_t> selectNodes(SoState* state) const;
+    static void loadSensorCB(void* data, SoSensor* sensor);
+
+private:
+    std::shared_ptr<const Points::OctreeFile> octree;
+    std::vector<std::size_t> selection;
+    SoOneShotSensor* loadSensor;
+};
+
+}  // namespace PointsGui
+
+
+#endif  // POINTSGUI_SOFCOCTREEPOINTSET_H
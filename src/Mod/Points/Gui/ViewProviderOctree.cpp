@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <climits>
+#include <cstring>
+
+#include <Inventor/nodes/SoDrawStyle.h>
+#include <Inventor/nodes/SoGroup.h>
+#endif
+
+#include <Mod/Points/App/OctreeFeature.h>
+
+#include "SoFCOctreePointSet.h"
+#include "ViewProviderOctree.h"
+
+
+using namespace PointsGui;
+
+
+PROPERTY_SOURCE(PointsGui::ViewProviderOctree, Gui::ViewProviderGeometryObject)
+
+
+App::PropertyFloatConstraint::Constraints ViewProviderOctree::floatRange = {1.0, 64.0, 1.0};
+App::PropertyIntegerConstraint::Constraints ViewProviderOctree::budgetRange = {10000,
+                                                                               INT_MAX,
+                                                                               100000};
+
+ViewProviderOctree::ViewProviderOctree()
+{
+    static const char* osgroup = "Object Style";
+
+    ADD_PROPERTY_TYPE(PointSize, (2.0F), osgroup, App::Prop_None, "Set point size");
+    PointSize.setConstraints(&floatRange);
+    ADD_PROPERTY_TYPE(PointBudget,
+                      (3000000),
+                      osgroup,
+                      App::Prop_None,
+                      "Maximum number of points to render");
+    PointBudget.setConstraints(&budgetRange);
+
+    pcPointStyle = new SoDrawStyle();
+    pcPointStyle->ref();
+    pcPointStyle->style = SoDrawStyle::POINTS;
+    pcPointStyle->pointSize = PointSize.getValue();
+
+    pcPoints = new SoFCOctreePointSet();
+    pcPoints->ref();
+    pcPoints->pointBudget = PointBudget.getValue();
+}
+
+ViewProviderOctree::~ViewProviderOctree()
+{
+    pcPointStyle->unref();
+    pcPoints->unref();
+}
+
+void ViewProviderOctree::onChanged(const App::Property* prop)
+{
+    if (prop == &PointSize) {
+        pcPointStyle->pointSize = PointSize.getValue();
+    }
+    else if (prop == &PointBudget) {
+        pcPoints->pointBudget = PointBudget.getValue();
+    }
+    else {
+        ViewProviderGeometryObject::onChanged(prop);
+    }
+}
+
+void ViewProviderOctree::attach(App::DocumentObject* pcObj)
+{
+    // call parent's attach to define display modes
+    ViewProviderGeometryObject::attach(pcObj);
+
+    SoGroup* pcPointRoot = new SoGroup();
+    pcPointRoot->addChild(pcPointStyle);
+    pcPointRoot->addChild(pcShapeMaterial);
+    pcPointRoot->addChild(pcPoints);
+    addDisplayMaskMode(pcPointRoot, "Point");
+}
+
+void ViewProviderOctree::updateData(const App::Property* prop)
+{
+    ViewProviderGeometryObject::updateData(prop);
+    auto feature = dynamic_cast<Points::OctreeFeature*>(pcObject);
+    if (feature && prop == &feature->File) {
+        pcPoints->setOctree(feature->getOctree());
+    }
+}
+
+void ViewProviderOctree::setDisplayMode(const char* ModeName)
+{
+    // all modes share the same node that only uses the available attributes
+    pcPoints->colorPerVertex = (strcmp("Color", ModeName) == 0);
+    pcPoints->shaded = (strcmp("Shaded", ModeName) == 0);
+    setDisplayMaskMode("Point");
+
+    ViewProviderGeometryObject::setDisplayMode(ModeName);
+}
+
+std::vector<std::string> ViewProviderOctree::getDisplayModes() const
+{
+    std::vector<std::string> StrList;
+    StrList.emplace_back("Points");
+    StrList.emplace_back("Color");
+    StrList.emplace_back("Shaded");
+    return StrList;
+}
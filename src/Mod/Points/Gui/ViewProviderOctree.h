@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association <office@freecad.org>    *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTSGUI_VIEWPROVIDEROCTREE_H
+#define POINTSGUI_VIEWPROVIDEROCTREE_H
+
+
+
+
+
+
+#include <Gui/ViewProviderGeometryObject.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+class SoDrawStyle;
+
+namespace PointsGui
+{
+class SoFCOctreePointSet;
+
+/**
+ * The ViewProviderOctree class shows a point cloud of a Points::OctreeFeature.
+ * Only a level of detail that depends on the camera and the point budget is rendered.
+ */
+class PointsGuiExport ViewProviderOctree: public Gui::ViewProviderGeometryObject
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(PointsGui::ViewProviderOctree);
+
+public:
+    ViewProviderOctree();
+    ~ViewProviderOctree() override;
+
+    App::PropertyFloatConstraint PointSize;
+    App::PropertyIntegerConstraint PointBudget;
+
+    void attach(App::DocumentObject*) override;
+    /// Update the point representation
+    void updateData(const App::Property*) override;
+    /// set the viewing mode
+    void setDisplayMode(const char* ModeName) override;
+    /// returns a list of all possible modes
+    std::vector<std::string> getDisplayModes() const override;
+
+protected:
+    void onChanged(const App::Property* prop) override;
+
+private:
+    SoDrawStyle* pcPointStyle;
+    SoFCOctreePointSet* pcPoints;
+
+    static App::PropertyFloatConstraint::Constraints floatRange;
+    static App::PropertyIntegerConstraint::Constraints budgetRange;
+};
+
+}  // namespace PointsGui
+
+
+#endif  // POINTSGUI_VIEWPROVIDEROCTREE_H
@@ -73,6 +73,10 @@ void PropertySheet::clear()
     cellToPropertyNameMap.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
+    graphIndex.clear();
+    graphCells.clear();
+    graphDependants.clear();
+    graphPrecedents.clear();
     aliasProp.clear();
     revAliasProp.clear();
 
@@ -289,6 +293,10 @@ PropertySheet::PropertySheet(const PropertySheet& other)
     , cellToPropertyNameMap(other.cellToPropertyNameMap)
     , documentObjectToCellMap(other.documentObjectToCellMap)
     , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
+    , graphIndex(other.graphIndex)
+    , graphCells(other.graphCells)
+    , graphDependants(other.graphDependants)
+    , graphPrecedents(other.graphPrecedents)
     , aliasProp(other.aliasProp)
     , revAliasProp(other.revAliasProp)
     , updateCount(other.updateCount)
@@ -1386,6 +1394,13 @@ void PropertySheet::addDependencies(CellAddress key)
                 propertyNameToCellMap[propName].insert(key);
                 cellToPropertyNameMap[key].insert(propName);
 
+                if (docObj == owner) {
+                    CellAddress address = stringToAddress(name.c_str(), true);
+                    if (address.isValid()) {
+                        addGraphEdge(address, key);
+                    }
+                }
+
                 // Also an alias?
                 if (!name.empty() && docObj->isDerivedFrom<Sheet>()) {
                     auto other = static_cast<Sheet*>(docObj);
@@ -1398,6 +1413,10 @@ void PropertySheet::addDependencies(CellAddress key)
                         // Insert into maps
                         propertyNameToCellMap[propName].insert(key);
                         cellToPropertyNameMap[key].insert(propName);
+
+                        if (docObj == owner) {
+                            addGraphEdge(j->second, key);
+                        }
                     }
                 }
             }
@@ -1462,6 +1481,59 @@ void PropertySheet::removeDependencies(CellAddress key)
         cellToDocumentObjectMap.erase(i2);
         ++updateCount;
     }
+
+    removeGraphEdges(key);
+}
+
+/**
+ * Record that cell \a to depends on cell \a from of the same sheet.
+ */
+
+void PropertySheet::addGraphEdge(CellAddress from, CellAddress to)
+{
+    auto indexOf = [this](CellAddress address) {
+        auto res = graphIndex.emplace(address, static_cast<int>(graphCells.size()));
+        if (res.second) {
+            graphCells.push_back(address);
+            graphDependants.emplace_back();
+            graphPrecedents.emplace_back();
+        }
+        return res.first->second;
+    };
+
+    int fromIndex = indexOf(from);
+    int toIndex = indexOf(to);
+
+    // A cell may refer to the same cell more than once, e.g. by address and by alias
+    auto& precedents = graphPrecedents[toIndex];
+    if (std::find(precedents.begin(), precedents.end(), fromIndex) != precedents.end()) {
+        return;
+    }
+    precedents.push_back(fromIndex);
+    graphDependants[fromIndex].push_back(toIndex);
+}
+
+/**
+ * Remove the dependencies of cell \a key on the other cells of the same sheet.
+ */
+
+void PropertySheet::removeGraphEdges(CellAddress key)
+{
+    auto it = graphIndex.find(key);
+    if (it == graphIndex.end()) {
+        return;
+    }
+
+    int index = it->second;
+    for (int precedent : graphPrecedents[index]) {
+        auto& dependants = graphDependants[precedent];
+        auto jt = std::find(dependants.begin(), dependants.end(), index);
+        if (jt != dependants.end()) {
+            *jt = dependants.back();
+            dependants.pop_back();
+        }
+    }
+    graphPrecedents[index].clear();
 }
 
 /**
@@ -1645,6 +1717,86 @@ const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
     }
 }
 
+/**
+ * Add all cells depending on \a cells to it and sort them for recomputation.
+ *
+ * @param cells  Cells to recompute, on return extended by their dependants.
+ * @param levels Recompute order, the cells of a level only depend on
+ *               cells of previous levels and can be computed in any order.
+ * @return false if the cells have a cyclic dependency.
+ */
+
+bool PropertySheet::getRecomputeLevels(std::set<CellAddress>& cells,
+                                       std::vector<std::vector<CellAddress>>& levels) const
+{
+    levels.clear();
+
+    // Cells without any dependency inside the sheet can be computed first
+    std::vector<CellAddress> first;
+    std::vector<int> nodes;
+    std::vector<char> visited(graphCells.size(), 0);
+    for (const auto& address : cells) {
+        auto it = graphIndex.find(address);
+        if (it == graphIndex.end()) {
+            first.push_back(address);
+        }
+        else if (!visited[it->second]) {
+            visited[it->second] = 1;
+            nodes.push_back(it->second);
+        }
+    }
+
+    // Add all dependants
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        for (int dependant : graphDependants[nodes[i]]) {
+            if (!visited[dependant]) {
+                visited[dependant] = 1;
+                nodes.push_back(dependant);
+                cells.insert(graphCells[dependant]);
+            }
+        }
+    }
+
+    // Count the dependencies within the set, all dependants of a node are part of it
+    std::vector<int> waiting(graphCells.size(), 0);
+    for (int node : nodes) {
+        for (int dependant : graphDependants[node]) {
+            ++waiting[dependant];
+        }
+    }
+
+    std::vector<int> current;
+    for (int node : nodes) {
+        if (waiting[node] == 0) {
+            current.push_back(node);
+        }
+    }
+
+    std::size_t done = 0;
+    std::vector<int> next;
+    while (!current.empty() || !first.empty()) {
+        std::vector<CellAddress> level;
+        level.swap(first);
+        level.reserve(level.size() + current.size());
+        next.clear();
+        for (int node : current) {
+            level.push_back(graphCells[node]);
+            for (int dependant : graphDependants[node]) {
+                if (--waiting[dependant] == 0) {
+                    next.push_back(dependant);
+                }
+            }
+        }
+        done += current.size();
+        current.swap(next);
+
+        std::sort(level.begin(), level.end());
+        levels.push_back(std::move(level));
+    }
+
+    return done == nodes.size();
+}
+
 void PropertySheet::recomputeDependencies(CellAddress key)
 {
     AtomicPropertyChange signaller(*this);
@@ -200,6 +200,9 @@ public:
 
     const std::set<std::string>& getDeps(App::CellAddress pos) const;
 
+    bool getRecomputeLevels(std::set<App::CellAddress>& cells,
+                            std::vector<std::vector<App::CellAddress>>& levels) const;
+
     void recomputeDependencies(App::CellAddress key);
 
     PyObject* getPyObject() override;
@@ -303,6 +306,10 @@ private:
 
     void removeDependencies(App::CellAddress key);
 
+    void addGraphEdge(App::CellAddress from, App::CellAddress to);
+
+    void removeGraphEdges(App::CellAddress key);
+
     void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
     void recomputeDependants(const App::DocumentObject* obj, const char* propName);
 
@@ -322,6 +329,21 @@ private:
     /*! DocumentObject this cell depends on */
     std::map<App::CellAddress, std::set<std::string>> cellToDocumentObjectMap;
 
+    /*! Dependencies between the cells of this sheet, kept in sync with
+      propertyNameToCellMap. Cells taking part get a dense index into the
+      vectors below.
+      */
+    std::map<App::CellAddress, int> graphIndex;
+
+    /*! Cell address of a graph index */
+    std::vector<App::CellAddress> graphCells;
+
+    /*! Cells of this sheet depending on a cell, by graph index */
+    std::vector<std::vector<int>> graphDependants;
+
+    /*! Cells of this sheet a cell depends on, by graph index */
+    std::vector<std::vector<int>> graphPrecedents;
+
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
 
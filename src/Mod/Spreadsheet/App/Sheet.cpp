@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <boost/tokenizer.hpp>
 #include <deque>
 #include <memory>
@@ -32,12 +33,15 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DynamicProperty.h>
+#include <App/ExpressionCompiler.h>
 #include <App/ExpressionParser.h>
 #include <App/FeaturePythonPyImp.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
+#include <Base/ThreadPool.h>
 
 #include "Sheet.h"
 #include "SheetObserver.h"
@@ -752,10 +756,11 @@ struct CurrentAddressLock
  * depending on \a key.
  *
  * @param key The address of the cell we want to recompute.
+ * @param value The value of the cell's expression if it was evaluated already.
  *
  */
 
-void Sheet::updateProperty(CellAddress key)
+void Sheet::updateProperty(CellAddress key, ExpressionPtr value)
 {
     Cell* cell = getCell(key);
 
@@ -763,7 +768,10 @@ void Sheet::updateProperty(CellAddress key)
         std::unique_ptr<Expression> output;
         const Expression* input = cell->getExpression();
 
-        if (input) {
+        if (input && value) {
+            output = std::move(value);
+        }
+        else if (input) {
             CurrentAddressLock lock(currentRow, currentCol, key);
             output.reset(input->eval());
         }
@@ -891,9 +899,10 @@ void Sheet::recomputeCells(Range range)
 /**
  * @brief Recompute cell at address \a p.
  * @param p Address of cell.
+ * @param value Value of the cell's expression if it was evaluated already.
  */
 
-void Sheet::recomputeCell(CellAddress p)
+void Sheet::recomputeCell(CellAddress p, ExpressionPtr value)
 {
     Cell* cell = cells.getValue(p);
 
@@ -902,9 +911,10 @@ void Sheet::recomputeCell(CellAddress p)
             std::string content;
             cell->getStringContent(content);
             cell->setContent(content.c_str());
+            value.reset();
         }
 
-        updateProperty(p);
+        updateProperty(p, std::move(value));
 
         if (!cell || !cell->hasException()) {
             cells.clearDirty(p);
@@ -1021,6 +1031,62 @@ void Sheet::updateBindings()
     }
 }
 
+/**
+ * @brief Recompute the cells of a level, i.e. cells that don't depend on each other.
+ *
+ * Expressions that can be evaluated natively are evaluated concurrently if there are
+ * enough of them. The results are assigned to the cell properties in order afterwards.
+ * @param level Addresses of the cells.
+ */
+
+void Sheet::recomputeLevel(const std::vector<CellAddress>& level)
+{
+    // Below that the threads cost more than they save
+    const std::size_t minParallelCells = 64;
+
+    std::vector<ExpressionPtr> values(level.size());
+    std::vector<std::pair<std::size_t, const Expression*>> jobs;
+    if (level.size() >= minParallelCells) {
+        for (std::size_t i = 0; i < level.size(); ++i) {
+            Cell* cell = cells.getValue(level[i]);
+            const Expression* expr = cell ? cell->getExpression() : nullptr;
+            if (expr && !cell->hasException() && expr->getCompiled()->isNative()) {
+                jobs.emplace_back(i, expr);
+            }
+        }
+    }
+
+    if (jobs.size() >= minParallelCells) {
+        ParameterGrp::handle hGrp =
+            GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+        auto threads = static_cast<unsigned int>(std::max(0L, hGrp->GetInt("RecomputeThreads", 0)));
+
+        // An expression falling back to Python needs the GIL in the worker thread
+        std::unique_ptr<Base::PyGILStateRelease> unlockGIL;
+        if (Py_IsInitialized() && PyGILState_Check()) {
+            unlockGIL = std::make_unique<Base::PyGILStateRelease>();
+        }
+
+        Base::ThreadPool pool(threads);
+        auto evaluate = [&jobs, &values](std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; ++j) {
+                try {
+                    values[jobs[j].first].reset(jobs[j].second->eval());
+                }
+                catch (...) {
+                    // evaluated again by recomputeCell() to report the error
+                }
+            }
+        };
+        Base::parallel_for(pool, jobs.size(), evaluate, 16);
+    }
+
+    for (std::size_t i = 0; i < level.size(); ++i) {
+        FC_TRACE(level[i].toString());
+        recomputeCell(level[i], std::move(values[i]));
+    }
+}
+
 /**
  * Update the document properties.
  *
@@ -1039,56 +1105,24 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
-    DependencyList graph;
-    std::map<CellAddress, Vertex> VertexList;
-    std::map<Vertex, CellAddress> VertexIndexList;
-    std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
-    while (!workQueue.empty()) {
-        CellAddress currPos = workQueue.front();
-        workQueue.pop_front();
-
-        // Insert into map of CellPos -> Index, if it doesn't exist already
-        auto res = VertexList.emplace(currPos, Vertex());
-        if (res.second) {
-            res.first->second = add_vertex(graph);
-            VertexIndexList[res.first->second] = currPos;
-        }
-
-        // Process cells that depend on the current cell
-        for (auto& dep : providesTo(currPos)) {
-            auto resDep = VertexList.emplace(dep, Vertex());
-            if (resDep.second) {
-                resDep.first->second = add_vertex(graph);
-                VertexIndexList[resDep.first->second] = dep;
-                if (dirtyCells.insert(dep).second) {
-                    workQueue.push_back(dep);
-                }
-            }
-            // Add edge to graph to signal dependency
-            add_edge(res.first->second, resDep.first->second, graph);
-        }
-    }
-    // Compute cells
-    std::list<Vertex> make_order;
-    // Sort graph topologically to find evaluation order
-    try {
-        boost::topological_sort(graph, std::front_inserter(make_order));
+    // Add the dependants of the dirty cells and sort them into levels using the
+    // dependency graph kept by the cells property
+    std::vector<std::vector<CellAddress>> levels;
+    if (cells.getRecomputeLevels(dirtyCells, levels)) {
         // Recompute cells
         FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
-            FC_TRACE(addr.toString());
-            recomputeCell(addr);
+        for (const auto& level : levels) {
+            recomputeLevel(level);
         }
     }
-    catch (std::exception&) {
-        for (auto& v : VertexList) {
-            Cell* cell = cells.getValue(v.first);
+    else {
+        for (const auto& address : dirtyCells) {
+            Cell* cell = cells.getValue(address);
             // Mark as erroneous
             if (cell) {
-                cellErrors.insert(v.first);
+                cellErrors.insert(address);
                 cell->setException("Pending computation due to cyclic dependency", true);
-                cellUpdated(v.first);
+                cellUpdated(address);
             }
         }
 
@@ -243,13 +243,15 @@ protected:
 
     void onDocumentRestored() override;
 
-    void recomputeCell(App::CellAddress p);
+    void recomputeCell(App::CellAddress p, App::ExpressionPtr value = nullptr);
+
+    void recomputeLevel(const std::vector<App::CellAddress>& level);
 
     App::Property* getProperty(App::CellAddress key) const;
 
     App::Property* getProperty(const char* addr) const;
 
-    void updateProperty(App::CellAddress key);
+    void updateProperty(App::CellAddress key, App::ExpressionPtr value = nullptr);
 
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
 
@@ -53,6 +53,11 @@ void ZipInputStream::close() {
 //    ZipLocalEntry *ZipInputStream::createZipCDirEntry( const string
 //    &name ) {}
 
+bool ZipInputStream::readRawEntry( std::string &data ) {
+  clear() ; // clear eof and other flags.
+  return izf->readRawEntry( data ) ;
+}
+
 ConstEntryPointer ZipInputStream::getNextEntry() {
   clear() ; // clear eof and other flags.
   return izf->getNextEntry() ;
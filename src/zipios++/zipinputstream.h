@@ -49,6 +49,10 @@ public:
   */
   ConstEntryPointer getNextEntry() ;
 
+  /** Reads the data of the current entry without inflating it.
+      @see ZipInputStreambuf::readRawEntry() */
+  bool readRawEntry( std::string &data ) ;
+
   /** Destructor. */
   virtual ~ZipInputStream() ;
 
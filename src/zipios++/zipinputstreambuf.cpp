@@ -79,6 +79,22 @@ ConstEntryPointer ZipInputStreambuf::getNextEntry() {
 }
 
 
+bool ZipInputStreambuf::readRawEntry( std::string &data ) {
+  if ( ! _open_entry )
+    return false ;
+
+  data.resize( _curr_entry.getCompressedSize() ) ;
+  _inbuf->pubseekoff( _data_start, ios::beg, ios::in ) ;
+  int count = _inbuf->sgetn( &( data[ 0 ] ), data.size() ) ;
+  if ( count != static_cast< int >( data.size() ) )
+    throw IOException( "Unexpected end of zip entry" ) ;
+
+  // The stream is positioned at the next entry already
+  _open_entry = false ;
+  return true ;
+}
+
+
 ZipInputStreambuf::~ZipInputStreambuf() {
 }
 
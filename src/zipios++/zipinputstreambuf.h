@@ -39,6 +39,13 @@ public:
   */
   ConstEntryPointer getNextEntry() ;
 
+  /** Reads the data of the current entry as it is stored in the zip
+      archive, i.e. still compressed for a DEFLATED entry, and closes
+      the entry.
+      @param data receives the stored data.
+      @return false if there is no open entry. */
+  bool readRawEntry( std::string &data ) ;
+
   /** Destructor. */
   virtual ~ZipInputStreambuf() ;
 protected:
@@ -54,6 +54,11 @@ public:
   */
   void putNextEntry(const std::string& entryName);
 
+  /** Writes a complete entry whose data has been deflated already.
+      @see ZipOutputStreambuf::putRawEntry() */
+  void putRawEntry( const std::string &entryName, const char *data, 
+                    uint32 compressed_size, uint32 size, uint32 crc ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const std::string& comment ) ;
 
@@ -49,6 +49,16 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes a complete entry whose data has been deflated already, e.g. by
+      another thread. The current entry is closed first. 
+      @param entry the entry to write.
+      @param data raw deflate data (no zlib header) of the entry.
+      @param compressed_size the number of bytes in data.
+      @param size the size of the uncompressed data.
+      @param crc the CRC32 of the uncompressed data. */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data, 
+                    uint32 compressed_size, uint32 size, uint32 crc ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -69,6 +79,9 @@ protected:
   void setEntryClosedState() ;
   void updateEntryHeaderInfo() ;
 
+  /** Returns the current local time in MS-DOS format. */
+  static int currentDosTime() ;
+
   // Should/could be moved to zipheadio.h ?!
   static void writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
 				     EndOfCentralDirectory eocd,
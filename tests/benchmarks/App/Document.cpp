@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/FeatureTest.h>
+#include <Base/FileInfo.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+App::Document* newDocument()
+{
+    auto name = App::GetApplication().getUniqueDocumentName("Benchmark");
+    return App::GetApplication().newDocument(name.c_str(), "Benchmark");
+}
+
+void closeDocument(App::Document* doc)
+{
+    App::GetApplication().closeDocument(doc->getName());
+}
+
+// Each object depends on the previous one
+std::vector<App::FeatureTest*> createChain(App::Document* doc, int count)
+{
+    std::vector<App::FeatureTest*> objs;
+    objs.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        auto obj = doc->addObject<App::FeatureTest>();
+        if (!objs.empty()) {
+            obj->Source1.setValue(objs.back());
+        }
+        objs.push_back(obj);
+    }
+    return objs;
+}
+
+// All objects depend on the first one
+std::vector<App::FeatureTest*> createFan(App::Document* doc, int count)
+{
+    std::vector<App::FeatureTest*> objs;
+    objs.reserve(count);
+    objs.push_back(doc->addObject<App::FeatureTest>());
+    for (int i = 1; i < count; ++i) {
+        auto obj = doc->addObject<App::FeatureTest>();
+        obj->Source1.setValue(objs.front());
+        objs.push_back(obj);
+    }
+    return objs;
+}
+}  // namespace
+
+static void BM_DocumentCreateChain(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto doc = newDocument();
+        createChain(doc, static_cast<int>(state.range(0)));
+        doc->recompute();
+        state.PauseTiming();
+        closeDocument(doc);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DocumentCreateChain)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_DocumentRecomputeChain(benchmark::State& state)
+{
+    auto doc = newDocument();
+    auto objs = createChain(doc, static_cast<int>(state.range(0)));
+    doc->recompute();
+    for (auto _ : state) {
+        objs.front()->touch();
+        doc->recompute();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    closeDocument(doc);
+}
+BENCHMARK(BM_DocumentRecomputeChain)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_DocumentRecomputeFan(benchmark::State& state)
+{
+    auto doc = newDocument();
+    auto objs = createFan(doc, static_cast<int>(state.range(0)));
+    doc->recompute();
+    for (auto _ : state) {
+        objs.front()->touch();
+        doc->recompute();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    closeDocument(doc);
+}
+BENCHMARK(BM_DocumentRecomputeFan)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_DocumentSaveRestore(benchmark::State& state)
+{
+    auto doc = newDocument();
+    createChain(doc, static_cast<int>(state.range(0)));
+    doc->recompute();
+    Base::FileInfo file(Base::FileInfo::getTempFileName("Benchmark", nullptr) + ".FCStd");
+    std::string fileName = file.filePath();
+
+    for (auto _ : state) {
+        doc->saveToFile(fileName.c_str());
+        auto copy = newDocument();
+        copy->restore(fileName.c_str());
+        state.PauseTiming();
+        closeDocument(copy);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    closeDocument(doc);
+    file.deleteFile();
+}
+BENCHMARK(BM_DocumentSaveRestore)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/Expression.h>
+#include <App/FeatureTest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+const char* const expressions[] = {
+    // evaluated natively
+    "Integer * 2 + Float / 3",
+    "sin(30 deg) * Distance + 1 mm",
+    "Integer > 5 ? Distance * 2 : Distance / 2",
+    // needs Python
+    "str(Integer) + String",
+};
+
+class ExpressionFixture: public benchmark::Fixture
+{
+public:
+    void SetUp(const benchmark::State& /*state*/) override
+    {
+        auto name = App::GetApplication().getUniqueDocumentName("Benchmark");
+        doc = App::GetApplication().newDocument(name.c_str(), "Benchmark");
+        obj = doc->addObject<App::FeatureTest>("Obj");
+        obj->Integer.setValue(7);
+        obj->Float.setValue(0.25);
+        obj->Distance.setValue(12.5);
+        obj->String.setValue("abc");
+    }
+
+    void TearDown(const benchmark::State& /*state*/) override
+    {
+        App::GetApplication().closeDocument(doc->getName());
+    }
+
+protected:
+    App::Document* doc {};
+    App::FeatureTest* obj {};
+};
+}  // namespace
+
+BENCHMARK_DEFINE_F(ExpressionFixture, Parse)(benchmark::State& state)
+{
+    const char* text = expressions[state.range(0)];
+    for (auto _ : state) {
+        App::ExpressionPtr expr(App::Expression::parse(obj, text));
+        benchmark::DoNotOptimize(expr.get());
+    }
+}
+BENCHMARK_REGISTER_F(ExpressionFixture, Parse)->DenseRange(0, 3);
+
+BENCHMARK_DEFINE_F(ExpressionFixture, Evaluate)(benchmark::State& state)
+{
+    App::ExpressionPtr expr(App::Expression::parse(obj, expressions[state.range(0)]));
+    for (auto _ : state) {
+        auto value = expr->getValueAsAny();
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK_REGISTER_F(ExpressionFixture, Evaluate)->DenseRange(0, 3);
+
+BENCHMARK_DEFINE_F(ExpressionFixture, Eval)(benchmark::State& state)
+{
+    App::ExpressionPtr expr(App::Expression::parse(obj, expressions[state.range(0)]));
+    for (auto _ : state) {
+        App::ExpressionPtr result(expr->eval());
+        benchmark::DoNotOptimize(result.get());
+    }
+}
+BENCHMARK_REGISTER_F(ExpressionFixture, Eval)->DenseRange(0, 3);
+
+// NOLINTEND(readability-magic-numbers)
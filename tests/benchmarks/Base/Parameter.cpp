@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <App/Application.h>
+#include <Base/Parameter.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+const char* const groupPath = "User parameter:BaseApp/Benchmarks/Parameter";
+
+ParameterGrp::handle prepareGroup()
+{
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(groupPath);
+    for (int i = 0; i < 32; ++i) {
+        std::string name = "Value" + std::to_string(i);
+        hGrp->SetInt(name.c_str(), i);
+        hGrp->SetFloat(name.c_str(), i * 0.5);
+        hGrp->SetBool(name.c_str(), i % 2 == 0);
+        hGrp->SetASCII(name.c_str(), name.c_str());
+    }
+    return hGrp;
+}
+}  // namespace
+
+static void BM_ParameterGroupByPath(benchmark::State& state)
+{
+    prepareGroup();
+    for (auto _ : state) {
+        auto hGrp = App::GetApplication().GetParameterGroupByPath(groupPath);
+        benchmark::DoNotOptimize(hGrp);
+    }
+}
+BENCHMARK(BM_ParameterGroupByPath);
+
+static void BM_ParameterRead(benchmark::State& state)
+{
+    auto hGrp = prepareGroup();
+    std::vector<std::string> names;
+    for (int i = 0; i < 32; ++i) {
+        names.push_back("Value" + std::to_string(i));
+    }
+    for (auto _ : state) {
+        long sum = 0;
+        for (const auto& name : names) {
+            sum += hGrp->GetInt(name.c_str(), 0);
+            sum += static_cast<long>(hGrp->GetFloat(name.c_str(), 0.0));
+            sum += hGrp->GetBool(name.c_str(), false) ? 1 : 0;
+            sum += static_cast<long>(hGrp->GetASCII(name.c_str(), "").size());
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * 4 * static_cast<long>(names.size()));
+}
+BENCHMARK(BM_ParameterRead);
+
+static void BM_ParameterReadMissing(benchmark::State& state)
+{
+    auto hGrp = prepareGroup();
+    for (auto _ : state) {
+        long value = hGrp->GetInt("Missing", 42);
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_ParameterReadMissing);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+// A regular, slightly wavy surface of 2 * n * n triangles
+MeshCore::MeshKernel createSurface(int n)
+{
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    facets.reserve(2 * n * n);
+    auto point = [](int i, int j) {
+        return Base::Vector3f(float(i), float(j), float(std::sin(i * 0.1) * std::cos(j * 0.1)));
+    };
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            facets.emplace_back(point(i, j), point(i + 1, j), point(i + 1, j + 1));
+            facets.emplace_back(point(i, j), point(i + 1, j + 1), point(i, j + 1));
+        }
+    }
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+    return kernel;
+}
+
+std::vector<Base::Vector3f> createQueryPoints(int n, std::size_t count)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(0.0F, float(n));
+    std::vector<Base::Vector3f> points(count);
+    for (auto& pnt : points) {
+        pnt.Set(dist(gen), dist(gen), 0.5F);
+    }
+    return points;
+}
+}  // namespace
+
+static void BM_MeshKernelBuild(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto kernel = createSurface(static_cast<int>(state.range(0)));
+        benchmark::DoNotOptimize(kernel.CountFacets());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_MeshKernelBuild)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+
+static void BM_MeshFacetGridBuild(benchmark::State& state)
+{
+    auto kernel = createSurface(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        MeshCore::MeshFacetGrid grid(kernel);
+        benchmark::DoNotOptimize(grid.GetCtElements(0, 0, 0));
+    }
+    state.SetItemsProcessed(state.iterations() * kernel.CountFacets());
+}
+BENCHMARK(BM_MeshFacetGridBuild)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+
+static void BM_MeshFacetGridInside(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    auto kernel = createSurface(n);
+    MeshCore::MeshFacetGrid grid(kernel);
+    auto points = createQueryPoints(n, 1000);
+    std::vector<MeshCore::ElementIndex> elements;
+    for (auto _ : state) {
+        for (const auto& pnt : points) {
+            Base::BoundBox3f box(pnt.x - 2.0F, pnt.y - 2.0F, -2.0F, pnt.x + 2.0F, pnt.y + 2.0F, 2.0F);
+            elements.clear();
+            grid.Inside(box, elements);
+            benchmark::DoNotOptimize(elements.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(points.size()));
+}
+BENCHMARK(BM_MeshFacetGridInside)->Arg(100)->Arg(500);
+
+static void BM_MeshFacetGridNearest(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    auto kernel = createSurface(n);
+    MeshCore::MeshFacetGrid grid(kernel);
+    auto points = createQueryPoints(n, 1000);
+    for (auto _ : state) {
+        for (const auto& pnt : points) {
+            auto index = grid.SearchNearestFromPoint(pnt);
+            benchmark::DoNotOptimize(index);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(points.size()));
+}
+BENCHMARK(BM_MeshFacetGridNearest)->Arg(100)->Arg(500);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <gp_Ax2.hxx>
+
+#include <Mod/Part/App/TopoShape.h>
+#include <Mod/Part/App/TopoShapeOpCode.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+Part::TopoShape makeBox(double x, double y, double z, long tag)
+{
+    BRepPrimAPI_MakeBox maker(gp_Pnt(x, y, z), 10.0, 10.0, 10.0);
+    return {maker.Shape(), tag};
+}
+
+Part::TopoShape makeCylinder(double x, double y, long tag)
+{
+    BRepPrimAPI_MakeCylinder maker(gp_Ax2(gp_Pnt(x, y, -1.0), gp_Dir(0, 0, 1)), 2.0, 12.0);
+    return {maker.Shape(), tag};
+}
+
+// A row of n overlapping boxes
+std::vector<Part::TopoShape> makeBoxRow(int n)
+{
+    std::vector<Part::TopoShape> shapes;
+    for (int i = 0; i < n; ++i) {
+        shapes.push_back(makeBox(i * 7.0, 0.0, 0.0, i + 1));
+    }
+    return shapes;
+}
+}  // namespace
+
+static void BM_TopoShapeFuse(benchmark::State& state)
+{
+    auto shapes = makeBoxRow(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        Part::TopoShape result(0L);
+        result.makeElementBoolean(Part::OpCodes::Fuse, shapes);
+        benchmark::DoNotOptimize(result.getShape());
+    }
+}
+BENCHMARK(BM_TopoShapeFuse)->Arg(2)->Arg(10)->Unit(benchmark::kMillisecond);
+
+static void BM_TopoShapeCutHoles(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    BRepPrimAPI_MakeBox plate(gp_Pnt(0.0, 0.0, 0.0), n * 5.0, 10.0, 10.0);
+    std::vector<Part::TopoShape> shapes {Part::TopoShape(plate.Shape(), 1L)};
+    for (int i = 0; i < n; ++i) {
+        shapes.push_back(makeCylinder(2.5 + i * 5.0, 5.0, i + 2));
+    }
+    for (auto _ : state) {
+        Part::TopoShape result(0L);
+        result.makeElementBoolean(Part::OpCodes::Cut, shapes);
+        benchmark::DoNotOptimize(result.getShape());
+    }
+}
+BENCHMARK(BM_TopoShapeCutHoles)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond);
+
+static void BM_TopoShapeCommon(benchmark::State& state)
+{
+    std::vector<Part::TopoShape> shapes {makeBox(0.0, 0.0, 0.0, 1), makeBox(5.0, 5.0, 5.0, 2)};
+    for (auto _ : state) {
+        Part::TopoShape result(0L);
+        result.makeElementBoolean(Part::OpCodes::Common, shapes);
+        benchmark::DoNotOptimize(result.getShape());
+    }
+}
+BENCHMARK(BM_TopoShapeCommon)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <random>
+#include <vector>
+
+#include <Mod/Sketcher/App/planegcs/GCS.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+/* A fully constrained zig-zag polyline of n segments. The first point is fixed,
+ * every segment is alternately horizontal or vertical and has a fixed length.
+ * The unknowns start from a reproducibly perturbed position.
+ */
+class ZigZagSketch
+{
+public:
+    explicit ZigZagSketch(int n)
+        : values(2 * (n + 1))
+        , initial(2 * (n + 1))
+        , lengths(n, 10.0)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> noise(-2.0, 2.0);
+        double x = 0.0;
+        double y = 0.0;
+        for (int i = 0; i <= n; ++i) {
+            initial[2 * i] = x + (i > 0 ? noise(gen) : 0.0);
+            initial[2 * i + 1] = y + (i > 0 ? noise(gen) : 0.0);
+            if (i % 2 == 0) {
+                x += 10.0;
+            }
+            else {
+                y += 10.0;
+            }
+        }
+        for (int i = 0; i <= n; ++i) {
+            points.emplace_back(&values[2 * i], &values[2 * i + 1]);
+            if (i > 0) {
+                unknowns.push_back(&values[2 * i]);
+                unknowns.push_back(&values[2 * i + 1]);
+            }
+        }
+        for (int i = 0; i < n; ++i) {
+            GCS::Line line;
+            line.p1 = points[i];
+            line.p2 = points[i + 1];
+            lines.push_back(line);
+        }
+        reset();
+        for (int i = 0; i < n; ++i) {
+            if (i % 2 == 0) {
+                system.addConstraintHorizontal(lines[i], i + 1);
+            }
+            else {
+                system.addConstraintVertical(lines[i], i + 1);
+            }
+            system.addConstraintP2PDistance(points[i], points[i + 1], &lengths[i], i + 1);
+        }
+    }
+
+    void reset()
+    {
+        values = initial;
+    }
+
+    int solve()
+    {
+        system.declareUnknowns(unknowns);
+        system.initSolution();
+        int ret = system.solve(true, GCS::DogLeg);
+        system.applySolution();
+        return ret;
+    }
+
+private:
+    std::vector<double> values;
+    std::vector<double> initial;
+    std::vector<double> lengths;
+    std::vector<GCS::Point> points;
+    std::deque<GCS::Line> lines;
+    GCS::VEC_pD unknowns;
+    GCS::System system;
+};
+}  // namespace
+
+static void BM_GCSSolveZigZag(benchmark::State& state)
+{
+    ZigZagSketch sketch(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        sketch.reset();
+        state.ResumeTiming();
+        int ret = sketch.solve();
+        benchmark::DoNotOptimize(ret);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GCSSolveZigZag)->Arg(10)->Arg(50)->Arg(200)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include "src/App/InitApplication.h"
+
+// Runs the benchmarks with a headless application. Pass --benchmark_format=json or
+// --benchmark_out=<file> --benchmark_out_format=json to get machine readable results.
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    tests::initApplication();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
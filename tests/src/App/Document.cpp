@@ -5,7 +5,9 @@
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
 #include "App/StringHasher.h"
+#include "Base/Profiler.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
 
@@ -94,4 +96,126 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+class ParallelRecomputeTest: public DocumentTest
+{
+protected:
+    void SetUp() override
+    {
+        DocumentTest::SetUp();
+        _hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document");
+        _hGrp->SetBool("ParallelRecompute", true);
+        _hGrp->SetInt("RecomputeThreads", 4);
+    }
+
+    void TearDown() override
+    {
+        _hGrp->RemoveBool("ParallelRecompute");
+        _hGrp->RemoveInt("RecomputeThreads");
+        DocumentTest::TearDown();
+    }
+
+    // Creates a root object with 'count' concurrent children and one object depending on all
+    std::vector<App::FeatureTest*> createFan(int count)
+    {
+        std::vector<App::FeatureTest*> objs;
+        auto root = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+        objs.push_back(root);
+        std::vector<App::DocumentObject*> children;
+        for (int i = 0; i < count; ++i) {
+            auto child = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+            child->Source1.setValue(root);
+            child->setStatus(App::ObjectStatus::ConcurrentRecompute, true);
+            objs.push_back(child);
+            children.push_back(child);
+        }
+        auto tip = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+        tip->SourceN.setValues(children);
+        objs.push_back(tip);
+        return objs;
+    }
+
+private:
+    ParameterGrp::handle _hGrp;
+};
+
+TEST_F(ParallelRecomputeTest, recomputeAllObjectsOnce)
+{
+    // Arrange
+    auto objs = createFan(16);
+
+    // Act
+    int count = doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(count, static_cast<int>(objs.size()));
+    for (auto obj : objs) {
+        EXPECT_EQ(obj->ExecCount.getValue(), 1);
+        EXPECT_FALSE(obj->isTouched());
+    }
+}
+
+TEST_F(ParallelRecomputeTest, recomputedSignalsFollowDependencies)
+{
+    // Arrange
+    auto objs = createFan(16);
+    std::vector<const App::DocumentObject*> signaled;
+    auto conn = doc()->signalRecomputedObject.connect([&signaled](const App::DocumentObject& obj) {
+        signaled.push_back(&obj);
+    });
+
+    // Act
+    doc()->recompute();
+    conn.disconnect();
+
+    // Assert
+    ASSERT_EQ(signaled.size(), objs.size());
+    EXPECT_EQ(signaled.front(), objs.front());
+    EXPECT_EQ(signaled.back(), objs.back());
+}
+
+TEST_F(ParallelRecomputeTest, failedObjectSkipsDependents)
+{
+    // Arrange
+    auto objs = createFan(4);
+    objs[2]->ExceptionType.setValue(2);
+    bool hasError = false;
+
+    // Act
+    doc()->recompute({}, false, &hasError);
+
+    // Assert
+    EXPECT_TRUE(hasError);
+    EXPECT_TRUE(objs[2]->isError());
+    EXPECT_NE(doc()->getErrorDescription(objs[2]), nullptr);
+    EXPECT_EQ(objs[1]->ExecCount.getValue(), 1);
+    EXPECT_EQ(objs.back()->ExecCount.getValue(), 0);
+}
+
+TEST_F(ParallelRecomputeTest, profileRecordsEveryObject)
+{
+    // Arrange
+    auto objs = createFan(8);
+    doc()->getProfiler().setEnabled(true);
+
+    // Act
+    doc()->recompute();
+    doc()->getProfiler().setEnabled(false);
+
+    // Assert
+    auto events = doc()->getProfiler().getEvents();
+    int recomputed = 0;
+    for (const auto& event : events) {
+        if (event.category == "recompute") {
+            ++recomputed;
+            EXPECT_EQ(event.type, "App::FeatureTest");
+            EXPECT_NE(doc()->getObject(event.name.c_str()), nullptr);
+        }
+    }
+    EXPECT_EQ(recomputed, static_cast<int>(objs.size()));
+    ASSERT_FALSE(events.empty());
+    EXPECT_EQ(events.back().category, "document");
+    EXPECT_EQ(events.back().depth, 0);
+}
+
 // NOLINTEND(readability-magic-numbers)
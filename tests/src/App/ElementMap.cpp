@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <string>
+
 #include <App/Application.h>
 #include <App/ElementMap.h>
 #include <src/App/InitApplication.h>
@@ -553,4 +556,58 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
             return e.indexedName.toString() == "Pong2";
         }));
 }
+
+TEST_F(ElementMapTest, lookupBothDirections)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    const int count = 500;
+    for (int i = 1; i <= count; ++i) {
+        Data::IndexedName edge("Edge", i);
+        elementMap.setElementName(edge, Data::MappedName("Edge" + std::to_string(i) + ";:M"), 1L);
+        elementMap.setElementName(edge, Data::MappedName("Edge" + std::to_string(i) + ";:N"), 1L);
+    }
+
+    // Act
+    elementMap.erase(Data::IndexedName("Edge", 3));
+    elementMap.erase(Data::MappedName("Edge4;:M"));
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), 2 * count - 3);
+    EXPECT_FALSE(elementMap.find(Data::IndexedName("Edge", 3)));
+    EXPECT_FALSE(elementMap.find(Data::MappedName("Edge3;:N")));
+    EXPECT_FALSE(elementMap.find(Data::MappedName("Edge4;:M")));
+    EXPECT_EQ(elementMap.find(Data::MappedName("Edge4;:N")), Data::IndexedName("Edge", 4));
+    for (int i = 5; i <= count; ++i) {
+        Data::IndexedName edge("Edge", i);
+        for (auto& name : elementMap.findAll(edge)) {
+            EXPECT_EQ(elementMap.find(name.first), edge);
+        }
+        EXPECT_EQ(elementMap.findAll(edge).size(), 2);
+    }
+    auto all = elementMap.getAll();
+    EXPECT_EQ(all.size(), elementMap.size());
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end(), [](const auto& a, const auto& b) {
+        return a.name < b.name;
+    }));
+}
+
+TEST_F(ElementMapTest, memoryUsage)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+
+    // Act
+    auto usage = cube.elementMapPtr->getMemoryUsage();
+
+    // Assert
+    EXPECT_EQ(usage.names, 6);
+    EXPECT_GE(usage.tableSlots, 6);
+    EXPECT_EQ(usage.tableBytes, usage.tableSlots * sizeof(Data::MappedNameTable::Entry));
+    EXPECT_EQ(usage.nameBytes, 6 * std::string("Face1").size());
+    EXPECT_GE(usage.indexedBytes, 6 * sizeof(Data::MappedNameRef));
+    EXPECT_EQ(usage.childElements, 0);
+    EXPECT_EQ(usage.totalBytes(),
+              usage.tableBytes + usage.indexedBytes + usage.nameBytes + usage.childBytes);
+}
 // NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Base/Interpreter.h"
+#include "Base/Quantity.h"
+
+#include "App/Application.h"
+#include "App/Document.h"
+#include "App/DocumentObject.h"
+#include "App/ExpressionCompiler.h"
+#include "App/ExpressionParser.h"
+#include "App/PropertyStandard.h"
+#include "App/PropertyUnits.h"
+
+#include "src/App/InitApplication.h"
+
+// clang-format off
+
+class ExpressionCompilerTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _obj = _doc->addObject("App::FeatureTest", "Obj");
+        static_cast<App::PropertyInteger*>(
+            _obj->addDynamicProperty("App::PropertyInteger", "Count"))->setValue(7);
+        static_cast<App::PropertyFloat*>(
+            _obj->addDynamicProperty("App::PropertyFloat", "Ratio"))->setValue(0.25);
+        static_cast<App::PropertyLength*>(
+            _obj->addDynamicProperty("App::PropertyLength", "Size"))->setValue(12.5);
+        static_cast<App::PropertyBool*>(
+            _obj->addDynamicProperty("App::PropertyBool", "Flag"))->setValue(true);
+        static_cast<App::PropertyString*>(
+            _obj->addDynamicProperty("App::PropertyString", "Text"))->setValue("abc");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::DocumentObject* obj() { return _obj; }
+
+    App::ExpressionPtr parse(const char* text)
+    {
+        return App::ExpressionPtr(App::Expression::parse(_obj, text));
+    }
+
+    // Evaluates through Python, the reference for the native evaluation
+    static App::any pythonValue(const App::Expression& expr)
+    {
+        Base::PyGILStateLocker lock;
+        return App::pyObjectToAny(expr.getPyValue());
+    }
+
+    // Checks that the native evaluation gives exactly the same value as Python
+    void expectSame(const char* text)
+    {
+        SCOPED_TRACE(text);
+        auto expr = parse(text);
+        auto compiled = expr->getCompiled();
+        ASSERT_TRUE(compiled->isNative());
+        App::CompiledExpression::Value value;
+        ASSERT_TRUE(compiled->evaluate(value));
+        auto native = value.toAny();
+        auto python = pythonValue(*expr);
+        ASSERT_EQ(native.type(), python.type());
+        EXPECT_TRUE(App::isAnyEqual(native, python));
+        EXPECT_TRUE(App::isAnyEqual(expr->getValueAsAny(), python));
+    }
+
+    // Checks that the expression is left to Python
+    void expectFallback(const char* text)
+    {
+        SCOPED_TRACE(text);
+        auto expr = parse(text);
+        App::CompiledExpression::Value value;
+        EXPECT_FALSE(expr->getCompiled()->evaluate(value));
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    App::DocumentObject* _obj {};
+};
+
+TEST_F(ExpressionCompilerTest, numbers)
+{
+    expectSame("1 + 2");
+    expectSame("7 / 2");
+    expectSame("7 % 3");
+    expectSame("-7 % 3");
+    expectSame("7 % -3");
+    expectSame("-7.5 % 2");
+    expectSame("2 ^ 10");
+    expectSame("2 ^ -1");
+    expectSame("2.5 * 4");
+    expectSame("-(3 - 5)");
+    expectSame("1.5e3 - 0.5");
+}
+
+TEST_F(ExpressionCompilerTest, quantities)
+{
+    expectSame("1 mm + 2 mm");
+    expectSame("3 mm * 4 mm");
+    expectSame("10 mm / 4");
+    expectSame("2 * 3 mm");
+    expectSame("(2 mm) ^ 3");
+    expectSame("7 mm % 3");
+    expectSame("-(4 mm)");
+    expectSame("1 m + 5 cm");
+}
+
+TEST_F(ExpressionCompilerTest, comparisons)
+{
+    expectSame("1 < 2");
+    expectSame("2 <= 1.5");
+    expectSame("1 mm == 1 mm");
+    expectSame("2 mm >= 1 mm");
+    expectSame("2 mm > 2 mm");
+    expectSame("1 == True");
+    expectSame("1 < 2 ? 3 mm : 4");
+    expectSame("0 ? 1 : 2.5");
+}
+
+TEST_F(ExpressionCompilerTest, functions)
+{
+    expectSame("sin(30 deg)");
+    expectSame("cos(0.5)");
+    expectSame("atan2(1 mm; 2 mm)");
+    expectSame("sqrt(16 mm^2)");
+    expectSame("pow(2 mm; 2)");
+    expectSame("mod(7 mm; 2)");
+    expectSame("hypot(3; 4)");
+    expectSame("cath(5 mm; 3 mm)");
+    expectSame("round(2.5)");
+    expectSame("trunc(-2.5 mm)");
+    expectSame("abs(-3)");
+    expectSame("log10(1000)");
+    expectSame("href(1 + 2)");
+}
+
+TEST_F(ExpressionCompilerTest, properties)
+{
+    expectSame("Count * 2");
+    expectSame("Count / 2");
+    expectSame("Ratio + 1");
+    expectSame("Size * 2");
+    expectSame("Size + 1 mm");
+    expectSame("Flag ? Size : 0 mm");
+    expectSame("Obj.Count + Obj.Ratio");
+    expectSame("Placement.Base.x + 1");
+    expectSame("sum(1; 2; Count)");
+
+    // property changes are seen by an existing compiled expression
+    auto expr = parse("Count + 1");
+    App::CompiledExpression::Value value;
+    ASSERT_TRUE(expr->getCompiled()->evaluate(value));
+    EXPECT_EQ(value.intValue, 8);
+    static_cast<App::PropertyInteger*>(obj()->getPropertyByName("Count"))->setValue(41);
+    ASSERT_TRUE(expr->getCompiled()->evaluate(value));
+    EXPECT_EQ(value.intValue, 42);
+}
+
+TEST_F(ExpressionCompilerTest, fallback)
+{
+    // errors are reported by Python
+    expectFallback("1 / 0");
+    expectFallback("1.5 % 0");
+    expectFallback("1 mm + 1 s");
+    expectFallback("sin(1 mm)");
+    expectFallback("pow(2 mm; 0.5)");
+
+    // values that are not numbers
+    expectFallback("Text");
+    expectFallback("Placement.Base");
+    EXPECT_FALSE(parse("<<abc>>")->getCompiled()->isNative());
+    EXPECT_FALSE(parse("vector(1; 2; 3)")->getCompiled()->isNative());
+
+    // the Python path still evaluates them
+    auto expr = parse("Text");
+    EXPECT_EQ(App::any_cast<std::string>(expr->getValueAsAny()), "abc");
+    EXPECT_THROW(parse("1 / 0")->getValueAsAny(), Base::Exception);
+}
+
+TEST_F(ExpressionCompilerTest, eval)
+{
+    auto expr = parse("Count > 5");
+    App::ExpressionPtr result(expr->eval());
+    ASSERT_TRUE(result->isDerivedFrom<App::ConstantExpression>());
+    EXPECT_TRUE(static_cast<App::ConstantExpression*>(result.get())->isNumber());
+    EXPECT_EQ(result->toString(), "True");
+
+    expr = parse("Size * 2");
+    result.reset(expr->eval());
+    ASSERT_TRUE(result->isDerivedFrom<App::NumberExpression>());
+    EXPECT_EQ(static_cast<App::NumberExpression*>(result.get())->getQuantity(),
+              Base::Quantity(25.0, Base::Unit::Length));
+}
+
+TEST_F(ExpressionCompilerTest, cache)
+{
+    auto expr = parse("Count + 1");
+    auto compiled = expr->getCompiled();
+
+    // reading the dependencies keeps the native form
+    expr->getIdentifiers();
+    expr->getDeps();
+    EXPECT_EQ(compiled, expr->getCompiled());
+
+    // a visitor that may modify the expression discards it, the old one can still be evaluated
+    expr->adjustLinks({});
+    EXPECT_NE(compiled, expr->getCompiled());
+    App::CompiledExpression::Value value;
+    ASSERT_TRUE(compiled->evaluate(value));
+    EXPECT_EQ(value.intValue, 8);
+}
+
+TEST_F(ExpressionCompilerTest, concurrentEvaluation)
+{
+    auto expr = parse("Count * 2 + Ratio");
+    std::atomic<int> mismatches {0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&]() {
+            for (int run = 0; run < 1000; run++) {
+                App::CompiledExpression::Value value;
+                if (!expr->getCompiled()->evaluate(value) || value.floatValue != 14.25) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    // the dependencies are read while the expression is evaluated
+    threads.emplace_back([&]() {
+        for (int run = 0; run < 1000; run++) {
+            if (expr->getIdentifiers().size() != 2) {
+                mismatches++;
+            }
+        }
+    });
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+// clang-format on
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include "App/MappedNameTable.h"
+
+#include <string>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+TEST(MappedNameTable, insertAndFind)
+{
+    // Arrange
+    Data::MappedNameTable table;
+
+    // Act
+    auto first = table.insert(Data::MappedName("Face1"), Data::IndexedName("Face", 1));
+    auto second = table.insert(Data::MappedName("Face1"), Data::IndexedName("Face", 2));
+
+    // Assert
+    EXPECT_TRUE(first.second);
+    EXPECT_FALSE(second.second);
+    EXPECT_EQ(table.size(), 1);
+    ASSERT_NE(table.find(Data::MappedName("Face1")), nullptr);
+    EXPECT_EQ(table.find(Data::MappedName("Face1"))->index, Data::IndexedName("Face", 1));
+    EXPECT_EQ(table.find(Data::MappedName("Face2")), nullptr);
+}
+
+TEST(MappedNameTable, findIgnoresPostfixSplit)
+{
+    // Arrange
+    Data::MappedNameTable table;
+    table.insert(Data::MappedName("Edge1;:H2"), Data::IndexedName("Edge", 1));
+
+    // Act
+    auto entry = table.find(Data::MappedName(Data::MappedName("Edge1"), ";:H2"));
+
+    // Assert
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->index, Data::IndexedName("Edge", 1));
+}
+
+TEST(MappedNameTable, eraseKeepsOtherEntries)
+{
+    // Arrange
+    Data::MappedNameTable table;
+    const int count = 1000;
+    for (int i = 1; i <= count; ++i) {
+        table.insert(Data::MappedName("Vertex" + std::to_string(i)), Data::IndexedName("Vertex", i));
+    }
+
+    // Act
+    for (int i = 1; i <= count; i += 2) {
+        EXPECT_TRUE(table.erase(Data::MappedName("Vertex" + std::to_string(i))));
+    }
+
+    // Assert
+    EXPECT_FALSE(table.erase(Data::MappedName("Vertex1")));
+    EXPECT_EQ(table.size(), count / 2);
+    for (int i = 1; i <= count; ++i) {
+        auto entry = table.find(Data::MappedName("Vertex" + std::to_string(i)));
+        if (i % 2 != 0) {
+            EXPECT_EQ(entry, nullptr);
+        }
+        else {
+            ASSERT_NE(entry, nullptr);
+            EXPECT_EQ(entry->index, Data::IndexedName("Vertex", i));
+        }
+    }
+    std::size_t visited = 0;
+    table.forEach([&visited](const Data::MappedNameTable::Entry&) {
+        ++visited;
+    });
+    EXPECT_EQ(visited, table.size());
+}
+
+TEST(MappedNameTable, reserve)
+{
+    // Arrange
+    Data::MappedNameTable table;
+
+    // Act
+    table.reserve(100);
+    auto capacity = table.capacity();
+    for (int i = 1; i <= 100; ++i) {
+        table.insert(Data::MappedName("Face" + std::to_string(i)), Data::IndexedName("Face", i));
+    }
+
+    // Assert
+    EXPECT_GE(capacity, 100);
+    EXPECT_EQ(table.capacity(), capacity);
+    EXPECT_EQ(table.memoryUsage(), capacity * sizeof(Data::MappedNameTable::Entry));
+}
+
+// NOLINTEND(readability-magic-numbers)
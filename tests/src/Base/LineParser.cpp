@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Base/LineParser.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+TEST(LineParser, TestBlockReader)
+{
+    std::string text = "first\n\nthird line\r\nlast";
+    std::istringstream str(text);
+    Base::LineBlockReader reader(str, 4);
+
+    std::vector<std::string> lines;
+    while (reader.next()) {
+        for (auto line : reader.lines()) {
+            lines.emplace_back(line);
+        }
+    }
+
+    std::vector<std::string> expected {"first", "", "third line\r", "last"};
+    EXPECT_EQ(lines, expected);
+    EXPECT_EQ(reader.bytesRead(), text.size());
+}
+
+TEST(LineParser, TestScanner)
+{
+    Base::LineScanner scanner("  vertex 1.5\t-2 +3e1\r");
+    EXPECT_FALSE(scanner.keyword("VERTEX"));
+    EXPECT_TRUE(scanner.skipSpace());
+    EXPECT_TRUE(scanner.keyword("VERTEX", true));
+
+    float x {}, y {}, z {};
+    EXPECT_TRUE(Base::LineScanner::parseNumber(scanner.token(), x));
+    EXPECT_TRUE(Base::LineScanner::parseNumber(scanner.token(), y));
+    EXPECT_TRUE(Base::LineScanner::parseNumber(scanner.token(), z));
+    EXPECT_FLOAT_EQ(x, 1.5F);
+    EXPECT_FLOAT_EQ(y, -2.0F);
+    EXPECT_FLOAT_EQ(z, 30.0F);
+    EXPECT_TRUE(scanner.atEnd());
+    EXPECT_TRUE(scanner.token().empty());
+}
+
+TEST(LineParser, TestNumbers)
+{
+    double value {};
+    EXPECT_TRUE(Base::LineScanner::parseDecimal("-.5e1", value));
+    EXPECT_DOUBLE_EQ(value, -5.0);
+    EXPECT_TRUE(Base::LineScanner::parseDecimal("+12", value));
+    EXPECT_DOUBLE_EQ(value, 12.0);
+    EXPECT_FALSE(Base::LineScanner::parseDecimal("1.", value));
+    EXPECT_FALSE(Base::LineScanner::parseDecimal("nan", value));
+
+    EXPECT_TRUE(Base::LineScanner::parseNumber("1.", value));
+    EXPECT_DOUBLE_EQ(value, 1.0);
+    EXPECT_FALSE(Base::LineScanner::parseNumber("1e400", value));
+    EXPECT_FALSE(Base::LineScanner::parseNumber("0x10", value));
+
+    int index {};
+    EXPECT_TRUE(Base::LineScanner::parseNumber("+7", index));
+    EXPECT_EQ(index, 7);
+    EXPECT_FALSE(Base::LineScanner::parseNumber("7/2", index));
+
+    unsigned int count {};
+    EXPECT_TRUE(Base::LineScanner::parseNumber("3", count));
+    EXPECT_EQ(count, 3U);
+    EXPECT_FALSE(Base::LineScanner::parseNumber("-3", count));
+}
+
+// NOLINTEND(readability-magic-numbers)
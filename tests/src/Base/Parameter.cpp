@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
 #include <QLockFile>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
@@ -443,6 +447,97 @@ TEST_F(ParameterTest, TestObserverNoRef)
     EXPECT_EQ(obs.getCountNotifications(), 1);
 }
 
+TEST_F(ParameterTest, TestCachedValues)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+
+    // a missing parameter is cached, too
+    EXPECT_EQ(grp->GetInt("Int", 1), 1);
+    grp->SetInt("Int", 2);
+    EXPECT_EQ(grp->GetInt("Int", 1), 2);
+    grp->SetInt("Int", 3);
+    EXPECT_EQ(grp->GetInt("Int", 1), 3);
+    grp->RemoveInt("Int");
+    EXPECT_EQ(grp->GetInt("Int", 1), 1);
+
+    // the same name with a different type is a different parameter
+    grp->SetBool("Param", true);
+    EXPECT_EQ(grp->GetBool("Param", false), true);
+    EXPECT_EQ(grp->GetUnsigned("Param", 4), 4);
+    grp->SetUnsigned("Param", 5);
+    EXPECT_EQ(grp->GetUnsigned("Param", 4), 5);
+    EXPECT_EQ(grp->GetBool("Param", false), true);
+
+    grp->SetASCII("Text", "Value");
+    EXPECT_EQ(grp->GetASCII("Text", "Preset"), "Value");
+    grp->SetAttribute(ParameterGrp::ParamType::FCText, "Text", "Other");
+    EXPECT_EQ(grp->GetASCII("Text", "Preset"), "Other");
+
+    grp->SetFloat("Float", 1.5);
+    EXPECT_DOUBLE_EQ(grp->GetFloat("Float", 0.0), 1.5);
+    grp->Clear();
+    EXPECT_DOUBLE_EQ(grp->GetFloat("Float", 0.0), 0.0);
+    EXPECT_EQ(grp->GetASCII("Text", "Preset"), "Preset");
+    EXPECT_EQ(grp->GetBool("Param", false), false);
+}
+
+TEST_F(ParameterTest, TestCachedValuesImport)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup/Sub1");
+    grp->SetInt("Int", 1);
+
+    std::string fn = getFileName();
+    cfg->exportTo(fn.c_str());
+
+    grp->SetInt("Int", 2);
+    EXPECT_EQ(grp->GetInt("Int", 0), 2);
+
+    cfg->importFrom(fn.c_str());
+    EXPECT_EQ(grp->GetInt("Int", 0), 1);
+    EXPECT_EQ(cfg->GetGroup("TopLevelGroup/Sub1")->GetInt("Int", 0), 1);
+}
+
+TEST_F(ParameterTest, TestCachedValuesBenchmark)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("BaseApp/Preferences/Document");
+    const int numParams = 200;
+    std::vector<std::string> names;
+    for (int i = 0; i < numParams; i++) {
+        names.push_back("Param" + std::to_string(i));
+        grp->SetBool(names.back().c_str(), (i % 2) == 0);
+    }
+
+    // Reads every parameter the given number of times and returns the reads per second
+    auto readAll = [&cfg, &names](int passes) {
+        int count = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; pass++) {
+            for (const auto& name : names) {
+                auto hGrp = cfg->GetGroup("BaseApp/Preferences/Document");
+                if (hGrp->GetBool(name.c_str(), false)) {
+                    count++;
+                }
+            }
+        }
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        EXPECT_EQ(count, passes * numParams / 2);
+        long long reads = static_cast<long long>(passes) * numParams;
+        return reads * 1000000LL / std::max<long long>(duration.count(), 1);
+    };
+
+    // Setting a parameter doesn't cache it, so the first pass looks up the DOM
+    long long uncached = readAll(1);
+    long long cached = readAll(500);
+
+    // Only reported, the absolute numbers depend too much on the machine
+    RecordProperty("UncachedReadsPerSecond", std::to_string(uncached));
+    RecordProperty("CachedReadsPerSecond", std::to_string(cached));
+}
+
 TEST_F(ParameterTest, TestLockFile)
 {
     std::string fn = getFileName();
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Base/Profiler.h>
+#include <sstream>
+#include <thread>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+TEST(Profiler, TestNothingRecordedWithoutActivation)
+{
+    Base::Profiler profiler;
+    profiler.setEnabled(true);
+    {
+        FC_PROFILE_SCOPE("test", "inactive");
+    }
+    EXPECT_TRUE(profiler.getEvents().empty());
+}
+
+TEST(Profiler, TestNothingRecordedWhenDisabled)
+{
+    Base::Profiler profiler;
+    Base::Profiler::Activate active(&profiler);
+    {
+        FC_PROFILE_SCOPE("test", "disabled");
+    }
+    EXPECT_TRUE(profiler.getEvents().empty());
+}
+
+TEST(Profiler, TestNestedScopes)
+{
+    Base::Profiler profiler;
+    profiler.setEnabled(true);
+    Base::Profiler::Activate active(&profiler);
+    {
+        Base::Profiler::Scope outer("recompute", "Box", "Part::Box");
+        FC_PROFILE_SCOPE("boolean", "Fuse");
+    }
+
+    auto events = profiler.getEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].name, "Fuse");
+    EXPECT_EQ(events[0].depth, 1);
+    EXPECT_EQ(events[1].category, "recompute");
+    EXPECT_EQ(events[1].type, "Part::Box");
+    EXPECT_EQ(events[1].depth, 0);
+    EXPECT_EQ(events[0].thread, events[1].thread);
+    EXPECT_LE(events[1].start, events[0].start);
+    EXPECT_GE(events[1].duration, events[0].duration);
+}
+
+TEST(Profiler, TestThreads)
+{
+    Base::Profiler profiler;
+    profiler.setEnabled(true);
+    Base::Profiler::Activate active(&profiler);
+    {
+        FC_PROFILE_SCOPE("test", "main");
+    }
+    std::thread worker([&profiler]() {
+        Base::Profiler::Activate workerActive(&profiler);
+        FC_PROFILE_SCOPE("test", "worker");
+    });
+    worker.join();
+
+    auto events = profiler.getEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0].thread, events[1].thread);
+    EXPECT_EQ(events[1].depth, 0);
+}
+
+TEST(Profiler, TestExport)
+{
+    Base::Profiler profiler;
+    profiler.setEnabled(true);
+    {
+        Base::Profiler::Activate active(&profiler);
+        Base::Profiler::Scope scope("recompute", "Say \"hi\", twice", "App::FeatureTest");
+    }
+
+    std::ostringstream trace;
+    profiler.exportChromeTrace(trace);
+    EXPECT_NE(trace.str().find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.str().find("\"name\":\"Say \\\"hi\\\", twice\""), std::string::npos);
+    EXPECT_NE(trace.str().find("\"args\":{\"type\":\"App::FeatureTest\"}"), std::string::npos);
+
+    std::ostringstream csv;
+    profiler.exportCsv(csv);
+    std::string line;
+    std::istringstream lines(csv.str());
+    std::getline(lines, line);
+    EXPECT_EQ(line, "category,name,type,thread,depth,start_us,duration_us");
+    std::getline(lines, line);
+    EXPECT_EQ(line.rfind("recompute,\"Say \"\"hi\"\", twice\",App::FeatureTest,", 0), 0);
+
+    profiler.clear();
+    EXPECT_TRUE(profiler.getEvents().empty());
+}
+
+// NOLINTEND(readability-magic-numbers)
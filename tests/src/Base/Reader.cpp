@@ -7,7 +7,9 @@
 #endif
 
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Reader.h"
+#include "Base/Writer.h"
 #include <array>
 #include <filesystem>
 #include <fstream>
@@ -387,3 +389,98 @@ TEST_F(ReaderTest, invalidDefaults)
         { xml.Reader()->getAttributeAsInteger("missing", "Not a Float"); },
         std::invalid_argument);
 }
+
+namespace
+{
+// Reads its additional file and records the order the data is applied in
+class DocFile: public Base::Persistence
+{
+public:
+    DocFile(std::string content, bool concurrent, std::vector<std::string>& applied)
+        : content(std::move(content))
+        , concurrent(concurrent)
+        , applied(applied)
+    {}
+    unsigned int getMemSize() const override
+    {
+        return 0;
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << content;
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        std::ostringstream str;
+        str << reader.rdbuf();
+        restored = str.str();
+        applied.push_back(restored);
+    }
+    bool canRestoreDocFileConcurrently() const override
+    {
+        return concurrent;
+    }
+    std::function<void()> RestoreDocFileConcurrently(Base::Reader& reader) override
+    {
+        std::ostringstream str;
+        str << reader.rdbuf();
+        std::string data = str.str();
+        return [this, data]() {
+            restored = data;
+            applied.push_back(restored);
+        };
+    }
+
+    std::string restored;
+
+private:
+    std::string content;
+    bool concurrent;
+    std::vector<std::string>& applied;
+};
+}  // namespace
+
+// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(ReaderTest, readFilesConcurrently)
+{
+    // Arrange
+    std::vector<std::string> applied;
+    std::vector<std::unique_ptr<DocFile>> files;
+    files.push_back(std::make_unique<DocFile>(std::string(100000, 'a'), true, applied));
+    files.push_back(std::make_unique<DocFile>("second", false, applied));
+    files.push_back(std::make_unique<DocFile>("third", true, applied));
+    files.push_back(std::make_unique<DocFile>("fourth", true, applied));
+    std::ostringstream archive;
+    {
+        Base::ZipWriter writer(archive);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << R"(<?xml version="1.0" encoding="UTF-8"?><document/>)";
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            writer.addFile(("file" + std::to_string(i)).c_str(), files[i].get());
+        }
+        writer.writeFiles();
+    }
+    std::istringstream str(archive.str());
+    zipios::ZipInputStream zipstream(str);
+    Base::XMLReader reader("Document.xml", zipstream);
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        reader.addFile(("file" + std::to_string(i)).c_str(), files[i].get());
+    }
+
+    // Act
+    reader.setConcurrentFiles(2, 16);
+    reader.readFiles(zipstream);
+
+    // Assert
+    std::vector<std::string> expected {std::string(100000, 'a'), "second", "third", "fourth"};
+    EXPECT_EQ(applied, expected);
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        EXPECT_EQ(files[i]->restored, expected[i]);
+        EXPECT_FALSE(reader.hasReadFailed("file" + std::to_string(i)));
+    }
+}
+// NOLINTEND(readability-magic-numbers)
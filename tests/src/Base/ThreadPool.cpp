@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Base/ThreadPool.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+TEST(ThreadPool, TestDefaultSize)
+{
+    Base::ThreadPool pool;
+    EXPECT_EQ(pool.size(), Base::ThreadPool::defaultThreadCount());
+}
+
+TEST(ThreadPool, TestRunAllTasks)
+{
+    Base::ThreadPool pool(4);
+    std::atomic<int> count {0};
+    for (int i = 0; i < 1000; ++i) {
+        pool.submit([&count]() {
+            ++count;
+        });
+    }
+    pool.wait();
+    EXPECT_EQ(count, 1000);
+}
+
+TEST(ThreadPool, TestNestedSubmit)
+{
+    Base::ThreadPool pool(3);
+    std::atomic<int> count {0};
+    std::atomic<bool> inWorker {true};
+    for (int i = 0; i < 100; ++i) {
+        pool.submit([&]() {
+            if (pool.currentWorker() < 0) {
+                inWorker = false;
+            }
+            pool.submit([&count]() {
+                ++count;
+            });
+        });
+    }
+    pool.wait();
+    EXPECT_TRUE(inWorker);
+    EXPECT_EQ(count, 100);
+    EXPECT_EQ(pool.currentWorker(), -1);
+}
+
+TEST(ThreadPool, TestException)
+{
+    Base::ThreadPool pool(2);
+    pool.submit([]() {
+        throw std::runtime_error("failure");
+    });
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+    // the exception is reported only once
+    EXPECT_NO_THROW(pool.wait());
+}
+
+TEST(ThreadPool, TestParallelFor)
+{
+    // every index is visited exactly once
+    std::vector<std::atomic<int>> visits(10000);
+    Base::parallel_for(visits.size(), 100, [&visits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            ++visits[i];
+        }
+    });
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](const std::atomic<int>& value) {
+        return value == 1;
+    }));
+
+    // below the limit the whole range is passed at once
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    Base::parallel_for(50, 100, [&ranges](std::size_t begin, std::size_t end) {
+        ranges.emplace_back(begin, end);
+    });
+    ASSERT_EQ(ranges.size(), 1);
+    EXPECT_EQ(ranges.front(), std::make_pair(std::size_t(0), std::size_t(50)));
+
+    // the ranges of a given pool have the minimum size
+    Base::ThreadPool pool(2);
+    std::mutex mutex;
+    ranges.clear();
+    Base::parallel_for(
+        pool,
+        100,
+        [&](std::size_t begin, std::size_t end) {
+            std::lock_guard<std::mutex> lock(mutex);
+            ranges.emplace_back(begin, end);
+        },
+        30);
+    std::sort(ranges.begin(), ranges.end());
+    std::vector<std::pair<std::size_t, std::size_t>> expected {{0, 30},
+                                                               {30, 60},
+                                                               {60, 90},
+                                                               {90, 100}};
+    EXPECT_EQ(ranges, expected);
+}
+
+// NOLINTEND(readability-magic-numbers)
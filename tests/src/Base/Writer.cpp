@@ -2,7 +2,16 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +138,193 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+namespace
+{
+// Writes its content into an additional file and optionally requests a further file
+class DocFile: public Base::Persistence
+{
+public:
+    DocFile(std::string content, bool concurrent, const DocFile* child = nullptr)
+        : content(std::move(content))
+        , concurrent(concurrent)
+        , child(child)
+    {}
+    unsigned int getMemSize() const override
+    {
+        return 0;
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << content;
+        if (child) {
+            writer.addFile("child.txt", child);
+        }
+    }
+    bool canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const override
+    {
+        return concurrent;
+    }
+
+private:
+    std::string content;
+    bool concurrent;
+    const DocFile* child;
+};
+
+// A file that is big in memory and counts how many are serialized at the same time
+class BigDocFile: public Base::Persistence
+{
+public:
+    BigDocFile(std::atomic<int>& active, std::atomic<int>& maxActive)
+        : active(active)
+        , maxActive(maxActive)
+    {}
+    unsigned int getMemSize() const override
+    {
+        return 1000;
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        int count = ++active;
+        int max = maxActive;
+        while (count > max && !maxActive.compare_exchange_weak(max, count)) {}
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        writer.Stream() << "big";
+        --active;
+    }
+    bool canSaveDocFileConcurrently(const Base::Writer& /*writer*/) const override
+    {
+        return true;
+    }
+
+private:
+    std::atomic<int>& active;
+    std::atomic<int>& maxActive;
+};
+
+// Returns the names and contents of the files after the first entry
+std::vector<std::pair<std::string, std::string>> readArchive(const std::string& archive)
+{
+    std::vector<std::pair<std::string, std::string>> files;
+    std::istringstream str(archive);
+    zipios::ZipInputStream zipstream(str);
+    zipios::ConstEntryPointer entry;
+    try {
+        entry = zipstream.getNextEntry();
+    }
+    catch (const std::exception&) {
+        return files;
+    }
+    while (entry->isValid()) {
+        std::ostringstream content;
+        content << zipstream.rdbuf();
+        files.emplace_back(entry->getName(), content.str());
+        try {
+            entry = zipstream.getNextEntry();
+        }
+        catch (const std::exception&) {
+            break;
+        }
+    }
+    return files;
+}
+}  // namespace
+
+// NOLINTBEGIN(readability-magic-numbers)
+TEST(ZipWriterTest, concurrentFilesKeepOrderAndContent)
+{
+    // Arrange
+    DocFile child("child content", true);
+    DocFile first(std::string(100000, 'a'), true);
+    DocFile second("second content", false, &child);
+    DocFile third("third content", true);
+    std::ostringstream archive;
+
+    // Act
+    {
+        Base::ZipWriter writer(archive);
+        writer.setConcurrentFiles(2, 16);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        writer.addFile("first.txt", &first);
+        writer.addFile("second.txt", &second);
+        writer.addFile("third.txt", &third);
+        writer.writeFiles();
+    }
+
+    // Assert
+    auto files = readArchive(archive.str());
+    ASSERT_EQ(files.size(), 4);
+    EXPECT_EQ(files[0].first, "first.txt");
+    EXPECT_EQ(files[0].second, std::string(100000, 'a'));
+    EXPECT_EQ(files[1].first, "second.txt");
+    EXPECT_EQ(files[1].second, "second content");
+    EXPECT_EQ(files[2].first, "third.txt");
+    EXPECT_EQ(files[2].second, "third content");
+    EXPECT_EQ(files[3].first, "child.txt");
+    EXPECT_EQ(files[3].second, "child content");
+}
+
+TEST(ZipWriterTest, concurrentFilesUseUniqueNames)
+{
+    // Arrange
+    DocFile child("child", true);
+    DocFile first("first", true, &child);
+    DocFile second("second", true, &child);
+    std::ostringstream archive;
+
+    // Act
+    {
+        Base::ZipWriter writer(archive);
+        writer.setConcurrentFiles(2, 1024);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        writer.addFile("child.txt", &first);
+        writer.addFile("child.txt", &second);
+        writer.writeFiles();
+    }
+
+    // Assert
+    auto files = readArchive(archive.str());
+    std::map<std::string, std::string> names(files.begin(), files.end());
+    EXPECT_EQ(files.size(), 4);
+    EXPECT_EQ(names.size(), 4);
+}
+TEST(ZipWriterTest, concurrentFilesCountFilesBeingWritten)
+{
+    // Arrange
+    std::atomic<int> active {0};
+    std::atomic<int> maxActive {0};
+    std::vector<std::unique_ptr<BigDocFile>> docs;
+    for (int i = 0; i < 6; i++) {
+        docs.push_back(std::make_unique<BigDocFile>(active, maxActive));
+    }
+    std::ostringstream archive;
+
+    // Act
+    {
+        Base::ZipWriter writer(archive);
+        writer.setConcurrentFiles(4, 100);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        for (const auto& doc : docs) {
+            writer.addFile("big.txt", doc.get());
+        }
+        writer.writeFiles();
+    }
+
+    // Assert: the size of a file being written exceeds the buffer so the files are
+    // written one after another
+    EXPECT_EQ(maxActive.load(), 1);
+    EXPECT_EQ(readArchive(archive.str()).size(), 6);
+}
+// NOLINTEND(readability-magic-numbers)
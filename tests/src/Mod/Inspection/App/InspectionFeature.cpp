@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <BRepBuilderAPI_Transform.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <gp_Quaternion.hxx>
+#include <gp_Trsf.hxx>
+
+#include <Mod/Inspection/App/InspectionFeature.h>
+
+// NOLINTBEGIN
+
+namespace
+{
+struct Query
+{
+    Base::Vector3f point;
+    float distance;
+    float tolerance;
+};
+
+Base::Vector3f toVector(const gp_Pnt& pnt)
+{
+    return Base::Vector3f(float(pnt.X()), float(pnt.Y()), float(pnt.Z()));
+}
+
+// rotates the direction (dx, dy, dz) onto the +z axis so that the test rays hit the shape there
+gp_Trsf rotateToZ(double dx, double dy, double dz)
+{
+    gp_Trsf trsf;
+    trsf.SetRotation(gp_Quaternion(gp_Vec(dx, dy, dz), gp_Vec(0, 0, 1)));
+    return trsf;
+}
+
+void checkQueries(const Inspection::InspectNominalShape& nominal, const std::vector<Query>& queries)
+{
+    for (const auto& query : queries) {
+        float dist = nominal.getDistance(query.point);
+        if (std::fabs(query.distance) == FLT_MAX) {
+            EXPECT_EQ(dist, query.distance) << "at " << query.point.x << ", " << query.point.y
+                                            << ", " << query.point.z;
+        }
+        else {
+            EXPECT_NEAR(dist, query.distance, query.tolerance)
+                << "at " << query.point.x << ", " << query.point.y << ", " << query.point.z;
+        }
+    }
+}
+
+// runs the queries from several threads that share the query states of the nominal
+void checkConcurrentQueries(const Inspection::InspectNominalShape& nominal,
+                            const std::vector<Query>& queries)
+{
+    std::vector<float> expected;
+    for (const auto& query : queries) {
+        expected.push_back(nominal.getDistance(query.point));
+    }
+
+    std::atomic<int> mismatches {0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; i++) {
+        threads.emplace_back([&, i]() {
+            for (int run = 0; run < 50; run++) {
+                for (std::size_t j = 0; j < queries.size(); j++) {
+                    std::size_t index = (j + i) % queries.size();
+                    if (nominal.getDistance(queries[index].point) != expected[index]) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+}  // namespace
+
+class InspectNominalShapeTest: public ::testing::Test
+{
+protected:
+    static constexpr float searchRadius = 2.0F;
+    static constexpr float tolerance = 1e-4F;
+    // the chord error of the tessellation near edges of curved faces
+    static constexpr float deflection = 0.1F * searchRadius;
+};
+
+TEST_F(InspectNominalShapeTest, box)
+{
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    Inspection::InspectNominalShape nominal(box, searchRadius);
+
+    std::vector<Query> queries {
+        // inside and outside of a face, the ray goes through the diagonal of the top face
+        {Base::Vector3f(5, 5, 9), -1.0F, tolerance},
+        {Base::Vector3f(5, 5, 11), 1.0F, tolerance},
+        {Base::Vector3f(2, 3, 0.5F), -0.5F, tolerance},
+        {Base::Vector3f(3, -1.5F, 4), 1.5F, tolerance},
+        // near an edge
+        {Base::Vector3f(9.5F, 5, 9.5F), -0.5F, tolerance},
+        {Base::Vector3f(11, 5, 11), std::sqrt(2.0F), tolerance},
+        {Base::Vector3f(11, 11, 11), std::sqrt(3.0F), tolerance},
+        // beyond the search radius
+        {Base::Vector3f(5, 5, 5), -FLT_MAX, 0},
+        {Base::Vector3f(5, 5, 13), FLT_MAX, 0},
+        {Base::Vector3f(11.5F, 11.5F, 11.5F), FLT_MAX, 0},
+        {Base::Vector3f(5, 5, 20), FLT_MAX, 0},
+    };
+
+    checkQueries(nominal, queries);
+    checkConcurrentQueries(nominal, queries);
+}
+
+TEST_F(InspectNominalShapeTest, boxRayThroughSharedEdge)
+{
+    // the edge shared by the faces x = 10 and y = 10 is on top
+    gp_Trsf trsf = rotateToZ(1, 1, 0);
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    box = BRepBuilderAPI_Transform(box, trsf).Shape();
+    Inspection::InspectNominalShape nominal(box, searchRadius);
+
+    std::vector<Query> queries {
+        {toVector(gp_Pnt(9, 9, 5).Transformed(trsf)), -1.0F, tolerance},
+        {toVector(gp_Pnt(9.5, 9.5, 3).Transformed(trsf)), -0.5F, tolerance},
+        {toVector(gp_Pnt(11, 11, 5).Transformed(trsf)), std::sqrt(2.0F), tolerance},
+        {toVector(gp_Pnt(5, 5, 5).Transformed(trsf)), -FLT_MAX, 0},
+    };
+
+    checkQueries(nominal, queries);
+    checkConcurrentQueries(nominal, queries);
+}
+
+TEST_F(InspectNominalShapeTest, boxRayThroughSharedVertex)
+{
+    // the vertex shared by the faces x = 10, y = 10 and z = 10 is on top
+    gp_Trsf trsf = rotateToZ(1, 1, 1);
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    box = BRepBuilderAPI_Transform(box, trsf).Shape();
+    Inspection::InspectNominalShape nominal(box, searchRadius);
+
+    std::vector<Query> queries {
+        {toVector(gp_Pnt(9, 9, 9).Transformed(trsf)), -1.0F, tolerance},
+        {toVector(gp_Pnt(9.5, 9.5, 9.5).Transformed(trsf)), -0.5F, tolerance},
+        {toVector(gp_Pnt(11, 11, 11).Transformed(trsf)), std::sqrt(3.0F), tolerance},
+        {toVector(gp_Pnt(5, 5, 5).Transformed(trsf)), -FLT_MAX, 0},
+    };
+
+    checkQueries(nominal, queries);
+    checkConcurrentQueries(nominal, queries);
+}
+
+TEST_F(InspectNominalShapeTest, cylinder)
+{
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+    Inspection::InspectNominalShape nominal(cylinder, searchRadius);
+
+    std::vector<Query> queries {
+        // the distance to the lateral face is computed on the exact surface
+        {Base::Vector3f(4, 0, 5), -1.0F, tolerance},
+        {Base::Vector3f(6.5F, 0, 5), 1.5F, tolerance},
+        {Base::Vector3f(0, -3.5F, 2), -1.5F, tolerance},
+        {Base::Vector3f(3, 4.5F, 7), std::sqrt(29.25F) - 5.0F, tolerance},
+        // inside and outside of the caps, the ray goes along the axis
+        {Base::Vector3f(0, 0, 9), -1.0F, tolerance},
+        {Base::Vector3f(0, 0, 10.5F), 0.5F, tolerance},
+        {Base::Vector3f(1, 1, 0.5F), -0.5F, tolerance},
+        // near an edge the distance to the tessellation is used
+        {Base::Vector3f(4.5F, 0, 9.5F), -0.5F, deflection},
+        {Base::Vector3f(6, 0, 11), std::sqrt(2.0F), deflection},
+        // beyond the search radius
+        {Base::Vector3f(0, 0, 5), -FLT_MAX, 0},
+        {Base::Vector3f(6.5F, 6.5F, 5), FLT_MAX, 0},
+        {Base::Vector3f(0, 0, 20), FLT_MAX, 0},
+    };
+
+    checkQueries(nominal, queries);
+    checkConcurrentQueries(nominal, queries);
+}
+
+TEST_F(InspectNominalShapeTest, nominalIsNotModified)
+{
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+    Inspection::InspectNominalShape nominal(cylinder, searchRadius);
+    EXPECT_NEAR(nominal.getDistance(Base::Vector3f(0, 0, 9)), -1.0F, tolerance);
+
+    // the tessellation is made on a copy, the faces of the nominal shape aren't meshed
+    for (TopExp_Explorer xp(cylinder, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        EXPECT_TRUE(BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull());
+    }
+}
+
+// NOLINTEND
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
+#include <sstream>
 #include <Base/FileInfo.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
+#include <Mod/Mesh/App/Core/IO/ReaderOBJ.h>
+#include <Mod/Mesh/App/Core/IO/ReaderPLY.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <zipios++/fcoll.h>
 
@@ -37,4 +41,175 @@ TEST_F(ImporterTest, Test3MF)
     EXPECT_EQ(mesh2.CountEdges(), 1950);
     EXPECT_EQ(mesh2.CountFacets(), 1300);
 }
+
+TEST_F(ImporterTest, TestAsciiSTL)
+{
+    std::stringstream str;
+    str << "solid test\n"
+        << "  facet normal 0 0 1\n"
+        << "    outer loop\n"
+        << "      vertex 0 0 0\n"
+        << "      VERTEX 1.0 0 0\r\n"
+        << "      Vertex\t0  1e0 0   \n"
+        << "    endloop\n"
+        << "  endfacet\n"
+        << "  facet normal 0 0 1\n"
+        << "    outer loop\n"
+        << "      vertex 1 0 0\n"
+        << "      vertex 1 1 x\n"
+        << "      vertex +1 .1e1 -0\n"
+        << "      vertex 0 1 0\n"
+        << "    endloop\n"
+        << "  endfacet\n"
+        << "endsolid test";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshInput input(kernel);
+    EXPECT_TRUE(input.LoadAsciiSTL(str));
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    EXPECT_EQ(kernel.CountFacets(), 2);
+    EXPECT_EQ(kernel.GetBoundBox().MaxX, 1.0F);
+    EXPECT_EQ(kernel.GetBoundBox().MaxY, 1.0F);
+}
+
+TEST_F(ImporterTest, TestLargeAsciiSTL)
+{
+    // enough lines to be parsed concurrently
+    const int size = 60;
+    std::stringstream str;
+    str << "solid grid\n";
+    auto vertex = [&str](int x, int y) {
+        str << "vertex " << x << ".5 " << y << " " << (x * y) % 7 << "\n";
+    };
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            str << "facet normal 0 0 1\nouter loop\n";
+            vertex(i, j);
+            vertex(i + 1, j);
+            vertex(i + 1, j + 1);
+            str << "endloop\nendfacet\nfacet normal 0 0 1\nouter loop\n";
+            vertex(i, j);
+            vertex(i + 1, j + 1);
+            vertex(i, j + 1);
+            str << "endloop\nendfacet\n";
+        }
+    }
+    str << "endsolid grid\n";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshInput input(kernel);
+    EXPECT_TRUE(input.LoadAsciiSTL(str));
+    EXPECT_EQ(kernel.CountPoints(), (size + 1) * (size + 1));
+    EXPECT_EQ(kernel.CountFacets(), 2 * size * size);
+}
+
+TEST_F(ImporterTest, TestOBJ)
+{
+    std::stringstream str;
+    str << "# comment\n"
+        << "v 0 0 0 255 0 0\n"
+        << "v 1 0 0 0 255 0\r\n"
+        << "v 1 1 0 0 0 255\n"
+        << "v 0 1 0 255 255 255\n"
+        << "v 2 0 0 0.5 0.5 0.5\n"
+        << "vn 0 0 1\n"
+        << "g plane\n"
+        << "f 1//1 2//1 3//1 4//1\n"
+        << "f -4 -1 -3\n"
+        << "f 1 2\n";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::Material mat;
+    MeshCore::ReaderOBJ reader(kernel, &mat);
+    EXPECT_TRUE(reader.Load(str));
+    EXPECT_EQ(kernel.CountPoints(), 5);
+    EXPECT_EQ(kernel.CountFacets(), 3);
+    EXPECT_EQ(reader.GetGroupNames().size(), 1);
+    EXPECT_EQ(mat.binding, MeshCore::MeshIO::PER_VERTEX);
+    EXPECT_EQ(mat.diffuseColor.size(), 5);
+    EXPECT_EQ(mat.diffuseColor[1].g, 1.0F);
+}
+
+TEST_F(ImporterTest, TestNonManifoldOBJ)
+{
+    // three facets share the edge 1-2
+    std::stringstream str;
+    str << "v 0 0 0\n"
+        << "v 1 0 0\n"
+        << "v 0 1 0\n"
+        << "v 0 -1 0\n"
+        << "v 0 0 1\n"
+        << "v 1 1 0\n"
+        << "f 1 2 3\n"
+        << "f 2 1 4\n"
+        << "f 1 2 5\n"
+        << "f 2 6 3\n";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::ReaderOBJ reader(kernel, nullptr);
+    EXPECT_TRUE(reader.Load(str));
+    EXPECT_EQ(kernel.CountFacets(), 4);
+
+    // every facet at the non-manifold edge gets the first of the other facets
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    EXPECT_EQ(facets[0]._aulNeighbours[0], 1);
+    EXPECT_EQ(facets[1]._aulNeighbours[0], 0);
+    EXPECT_EQ(facets[2]._aulNeighbours[0], 0);
+    EXPECT_EQ(facets[0]._aulNeighbours[1], 3);
+    EXPECT_EQ(facets[3]._aulNeighbours[2], 0);
+    EXPECT_EQ(facets[0]._aulNeighbours[2], MeshCore::FACET_INDEX_MAX);
+}
+
+TEST_F(ImporterTest, TestOFF)
+{
+    std::stringstream str;
+    str << "OFF\n"
+        << "4 2 0\n"
+        << "0 0 0\n"
+        << "\n"
+        << "1 0 0\r\n"
+        << "invalid vertex\n"
+        << "1 1 0\n"
+        << "0 1 0\n"
+        << "3 0 1 2 255 0 0\n"
+        << "  \n"
+        << "3 0 2 3 0 255 0\n";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::Material mat;
+    MeshCore::MeshInput input(kernel, &mat);
+    EXPECT_TRUE(input.LoadOFF(str));
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    EXPECT_EQ(kernel.CountFacets(), 2);
+    EXPECT_EQ(mat.binding, MeshCore::MeshIO::PER_FACE);
+    EXPECT_EQ(mat.diffuseColor.size(), 2);
+    EXPECT_EQ(mat.diffuseColor[1].g, 1.0F);
+}
+
+TEST_F(ImporterTest, TestAsciiPLY)
+{
+    std::stringstream str;
+    str << "ply\n"
+        << "format ascii 1.0\n"
+        << "element vertex 4\n"
+        << "property float x\n"
+        << "property float y\n"
+        << "property float z\n"
+        << "element face 2\n"
+        << "property list uchar int vertex_indices\n"
+        << "end_header\n"
+        << "0 0 0\n"
+        << "1 0 0\r\n"
+        << "1.0 1.0 0.0\n"
+        << "0 1e0 0\n"
+        << "3 0 1 2\n"
+        << "3 0 2 3\n";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::ReaderPLY reader(kernel);
+    EXPECT_TRUE(reader.Load(str));
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    EXPECT_EQ(kernel.CountFacets(), 2);
+}
+
 // NOLINTEND(cppcoreguidelines-*,readability-*)
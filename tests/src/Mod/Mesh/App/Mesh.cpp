@@ -1,8 +1,114 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <Base/Exception.h>
 #include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Mesh/App/Core/Adjacency.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Builder.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
 #include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/Visitor.h>
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+namespace
+{
+// A wavy surface of (n-1)*(n-1)*2 triangles
+MeshCore::MeshKernel makeWavySurface(unsigned long n)
+{
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    for (unsigned long i = 0; i < n; i++) {
+        for (unsigned long j = 0; j < n; j++) {
+            float x = float(i) * 0.1F;
+            float y = float(j) * 0.1F;
+            points.push_back(MeshCore::MeshPoint(x, y, std::sin(x) * std::cos(y)));
+        }
+    }
+    for (unsigned long i = 0; i + 1 < n; i++) {
+        for (unsigned long j = 0; j + 1 < n; j++) {
+            unsigned long p0 = i * n + j;
+            facets.push_back(MeshCore::MeshFacet(p0, p0 + n, p0 + 1));
+            facets.push_back(MeshCore::MeshFacet(p0 + 1, p0 + n, p0 + n + 1));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets);
+    return kernel;
+}
+
+// Sets the neighbourhood by matching the edges of the facets one by one in sorted order
+void setNeighbourhoodSerial(MeshCore::MeshFacetArray& facets, MeshCore::FacetIndex index)
+{
+    using Edge = std::pair<MeshCore::PointIndex, MeshCore::PointIndex>;
+    std::map<Edge, std::vector<MeshCore::FacetIndex>> edges;
+    for (MeshCore::FacetIndex i = index; i < facets.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            MeshCore::PointIndex p0 = facets[i]._aulPoints[j];
+            MeshCore::PointIndex p1 = facets[i]._aulPoints[(j + 1) % 3];
+            edges[{std::min(p0, p1), std::max(p0, p1)}].push_back(i);
+        }
+    }
+
+    for (const auto& [edge, list] : edges) {
+        if (list.size() == 2) {
+            facets[list[0]]._aulNeighbours[facets[list[0]].Side(edge.first, edge.second)] = list[1];
+            facets[list[1]]._aulNeighbours[facets[list[1]].Side(edge.first, edge.second)] = list[0];
+        }
+        else if (list.size() == 1) {
+            facets[list[0]]._aulNeighbours[facets[list[0]].Side(edge.first, edge.second)] =
+                MeshCore::FACET_INDEX_MAX;
+        }
+    }
+}
+
+// each facet gets the first other facet with the points of an edge as the readers did before
+void setFirstNeighbourSerial(MeshCore::MeshFacetArray& facets)
+{
+    std::map<MeshCore::PointIndex, std::vector<MeshCore::FacetIndex>> adjacency;
+    for (MeshCore::FacetIndex i = 0; i < facets.size(); i++) {
+        for (MeshCore::PointIndex p : facets[i]._aulPoints) {
+            adjacency[p].push_back(i);
+        }
+    }
+
+    for (MeshCore::FacetIndex i = 0; i < facets.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            MeshCore::PointIndex p0 = facets[i]._aulPoints[j];
+            MeshCore::PointIndex p1 = facets[i]._aulPoints[(j + 1) % 3];
+            facets[i]._aulNeighbours[j] = MeshCore::FACET_INDEX_MAX;
+            for (MeshCore::FacetIndex k : adjacency[p0]) {
+                if (k != i && facets[k].HasPoint(p1)) {
+                    facets[i]._aulNeighbours[j] = k;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+bool haveEqualNeighbours(const MeshCore::MeshFacetArray& facets1,
+                         const MeshCore::MeshFacetArray& facets2)
+{
+    return std::equal(facets1.begin(),
+                      facets1.end(),
+                      facets2.begin(),
+                      facets2.end(),
+                      [](const MeshCore::MeshFacet& f1, const MeshCore::MeshFacet& f2) {
+                          return std::equal(std::begin(f1._aulNeighbours),
+                                            std::end(f1._aulNeighbours),
+                                            std::begin(f2._aulNeighbours));
+                      });
+}
+}  // namespace
+
 TEST(MeshTest, TestDefault)
 {
     MeshCore::MeshKernel kernel;
@@ -95,4 +201,713 @@ TEST(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST(MeshTest, TestFacetGridCells)
+{
+    // large enough to build the grid in parallel
+    MeshCore::MeshKernel kernel = makeWavySurface(260);
+    MeshCore::MeshFacetGrid grid(kernel, 40);
+    EXPECT_TRUE(grid.Verify());
+
+    unsigned long countX {};
+    unsigned long countY {};
+    unsigned long countZ {};
+    grid.GetCtGrids(countX, countY, countZ);
+
+    // every facet is in the grid elements its bounding box overlaps and which it intersects
+    std::vector<std::set<MeshCore::ElementIndex>> expected(countX * countY * countZ);
+    for (MeshCore::FacetIndex index = 0; index < kernel.CountFacets(); index++) {
+        MeshCore::MeshGeomFacet facet = kernel.GetFacet(index);
+        Base::BoundBox3f box = facet.GetBoundBox();
+        unsigned long minX {}, minY {}, minZ {}, maxX {}, maxY {}, maxZ {};
+        grid.Position(Base::Vector3f(box.MinX, box.MinY, box.MinZ), minX, minY, minZ);
+        grid.Position(Base::Vector3f(box.MaxX, box.MaxY, box.MaxZ), maxX, maxY, maxZ);
+        bool single = minX == maxX && minY == maxY && minZ == maxZ;
+        for (unsigned long x = minX; x <= maxX; x++) {
+            for (unsigned long y = minY; y <= maxY; y++) {
+                for (unsigned long z = minZ; z <= maxZ; z++) {
+                    if (single || facet.IntersectBoundingBox(grid.GetBoundBox(x, y, z))) {
+                        expected[grid.GetIndexToPosition(x, y, z)].insert(index);
+                    }
+                }
+            }
+        }
+    }
+
+    for (unsigned long x = 0; x < countX; x++) {
+        for (unsigned long y = 0; y < countY; y++) {
+            for (unsigned long z = 0; z < countZ; z++) {
+                MeshCore::MeshGridCell cell = grid.GetCell(x, y, z);
+                const auto& ref = expected[grid.GetIndexToPosition(x, y, z)];
+                EXPECT_EQ(cell.size(), ref.size());
+                EXPECT_TRUE(std::equal(cell.begin(), cell.end(), ref.begin(), ref.end()));
+            }
+        }
+    }
+}
+
+TEST(MeshTest, TestFacetGridInside)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(50);
+    MeshCore::MeshFacetGrid grid(kernel, 10);
+
+    Base::BoundBox3f box(1.0F, 1.0F, -1.0F, 2.0F, 2.0F, 1.0F);
+    std::vector<MeshCore::ElementIndex> elements;
+    grid.Inside(box, elements);
+    std::set<MeshCore::ElementIndex> unique;
+    grid.Inside(box, unique);
+    EXPECT_TRUE(std::is_sorted(elements.begin(), elements.end()));
+    EXPECT_TRUE(std::equal(elements.begin(), elements.end(), unique.begin(), unique.end()));
+
+    // all facets inside the box are found
+    for (MeshCore::FacetIndex index = 0; index < kernel.CountFacets(); index++) {
+        if (box.IsInBox(kernel.GetFacet(index).GetBoundBox())) {
+            EXPECT_EQ(unique.count(index), 1);
+        }
+    }
+}
+
+TEST(MeshTest, TestPointGridCells)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(330);
+    MeshCore::MeshPointGrid grid(kernel, 40);
+
+    std::vector<int> found(kernel.CountPoints());
+    MeshCore::MeshGridIterator it(grid);
+    for (it.Init(); it.More(); it.Next()) {
+        std::vector<MeshCore::ElementIndex> elements;
+        it.GetElements(elements);
+        EXPECT_EQ(elements.size(), it.GetCtElements());
+        EXPECT_TRUE(std::is_sorted(elements.begin(), elements.end()));
+        Base::BoundBox3f box = it.GetBoundBox();
+        box.Enlarge(1.0e-4F);
+        for (MeshCore::ElementIndex index : elements) {
+            EXPECT_TRUE(box.IsInBox(kernel.GetPoint(index)));
+            found[index]++;
+        }
+    }
+
+    EXPECT_TRUE(std::all_of(found.begin(), found.end(), [](int count) {
+        return count == 1;
+    }));
+}
+
+TEST(MeshTest, TestTopologyBuilder)
+{
+    // large enough to sort and pair the edges in parallel
+    MeshCore::MeshFacetArray facets = makeWavySurface(300).GetFacets();
+    MeshCore::PointIndex numPoints = 300 * 300;
+    // a non-manifold edge, a facet with a flipped normal and degenerated facets
+    facets.push_back(MeshCore::MeshFacet(0, 1, numPoints));
+    facets.push_back(MeshCore::MeshFacet(1, 0, numPoints + 1));
+    facets.push_back(MeshCore::MeshFacet(301, 1, 300));
+    facets.push_back(MeshCore::MeshFacet(numPoints, numPoints, 2));
+    facets.push_back(MeshCore::MeshFacet(2, numPoints, 2));
+    facets.push_back(MeshCore::MeshFacet(5, 5, 5));
+    for (auto& it : facets) {
+        it.SetNeighbours(0, 0, 0);
+    }
+
+    MeshCore::MeshFacetArray serial = facets;
+    setNeighbourhoodSerial(serial, 0);
+    MeshCore::MeshTopologyBuilder topology(facets);
+    topology.SetNeighbourhood();
+    EXPECT_TRUE(haveEqualNeighbours(facets, serial));
+
+    // an inner facet has three neighbours
+    const MeshCore::MeshFacet& facet = facets[2 * 299 * 150 + 300];
+    EXPECT_TRUE(facet.HasNeighbour(0) && facet.HasNeighbour(1) && facet.HasNeighbour(2));
+    // the facets at the non-manifold edge keep their former neighbour
+    EXPECT_EQ(facets[0]._aulNeighbours[2], 0);
+}
+
+TEST(MeshTest, TestTopologyBuilderOfNonManifoldEdges)
+{
+    // large enough to sort and pair the edges in parallel
+    MeshCore::MeshFacetArray facets = makeWavySurface(300).GetFacets();
+    MeshCore::PointIndex numPoints = 300 * 300;
+    // two non-manifold edges of three facets
+    facets.push_back(MeshCore::MeshFacet(0, 1, numPoints));
+    facets.push_back(MeshCore::MeshFacet(1, 0, numPoints + 1));
+    facets.push_back(MeshCore::MeshFacet(2, 1, numPoints + 2));
+    facets.push_back(MeshCore::MeshFacet(numPoints + 3, 1, 2));
+    for (auto& it : facets) {
+        it.SetNeighbours(0, 0, 0);
+    }
+
+    MeshCore::MeshFacetArray serial = facets;
+    setFirstNeighbourSerial(serial);
+    MeshCore::MeshTopologyBuilder topology(facets);
+    topology.SetNonManifoldNeighbours(MeshCore::MeshTopologyBuilder::NonManifoldToFirst);
+    topology.SetNeighbourhood();
+    EXPECT_TRUE(haveEqualNeighbours(facets, serial));
+    EXPECT_EQ(facets[0]._aulNeighbours[2], facets.size() - 4);
+}
+
+TEST(MeshTest, TestMeshBuilderOfNonManifoldEdges)
+{
+    // four facets at the edge from (0,0,0) to (1,0,0)
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshBuilder builder(kernel);
+    builder.Initialize(4);
+    Base::Vector3f p0(0, 0, 0);
+    Base::Vector3f p1(1, 0, 0);
+    builder.AddFacet(MeshCore::MeshGeomFacet(p0, p1, Base::Vector3f(0, 1, 0)));
+    builder.AddFacet(MeshCore::MeshGeomFacet(p1, p0, Base::Vector3f(0, -1, 0)));
+    builder.AddFacet(MeshCore::MeshGeomFacet(p1, p0, Base::Vector3f(0, 0, 1)));
+    builder.AddFacet(MeshCore::MeshGeomFacet(p0, p1, Base::Vector3f(0, 0, -1)));
+    builder.Finish();
+
+    // the first facet gets the last one and the other facets get the first one
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    ASSERT_EQ(facets.size(), 4);
+    for (MeshCore::FacetIndex i = 0; i < 4; i++) {
+        unsigned short side = facets[i].Side(0, 1);
+        ASSERT_LT(side, 3);
+        EXPECT_EQ(facets[i]._aulNeighbours[side], i == 0 ? 3 : 0);
+    }
+}
+
+TEST(MeshTest, TestTopologyBuilderOfAppendedFacets)
+{
+    MeshCore::MeshFacetArray facets = makeWavySurface(40).GetFacets();
+    for (auto& it : facets) {
+        it.SetNeighbours(0, 0, 0);
+    }
+
+    MeshCore::FacetIndex index = facets.size() / 2;
+    MeshCore::MeshFacetArray serial = facets;
+    setNeighbourhoodSerial(serial, index);
+    MeshCore::MeshTopologyBuilder topology(facets);
+    topology.SetNeighbourhood(index);
+    EXPECT_TRUE(haveEqualNeighbours(facets, serial));
+
+    // the facets before the index are not touched
+    EXPECT_EQ(facets[0]._aulNeighbours[0], 0);
+}
+
+TEST(MeshTest, TestRebuildNeighbours)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(20);
+    kernel.RebuildNeighbours();
+
+    MeshCore::MeshFacetArray serial = kernel.GetFacets();
+    setNeighbourhoodSerial(serial, 0);
+    EXPECT_TRUE(haveEqualNeighbours(kernel.GetFacets(), serial));
+    EXPECT_EQ(kernel.CountEdges(), 19 * 20 * 2 + 19 * 19);
+}
+
+TEST(MeshTest, TestAdjacencyTables)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(30);
+    // a degenerated facet and an unreferenced point
+    MeshCore::MeshFacetArray facets = kernel.GetFacets();
+    MeshCore::MeshPointArray points = kernel.GetPoints();
+    facets.push_back(MeshCore::MeshFacet(0, 0, 1));
+    points.push_back(MeshCore::MeshPoint(5.0F, 5.0F, 5.0F));
+    kernel.Adopt(points, facets);
+
+    auto isEqual = [](auto range, const auto& set) {
+        return std::equal(range.begin(), range.end(), set.begin(), set.end());
+    };
+
+    MeshCore::MeshRefPointToFacets refPointFacets(kernel);
+    const MeshCore::MeshPointFacetAdjacency& pointFacets = kernel.GetPointFacetAdjacency();
+    ASSERT_EQ(pointFacets.size(), kernel.CountPoints());
+    for (MeshCore::PointIndex i = 0; i < kernel.CountPoints(); i++) {
+        EXPECT_TRUE(isEqual(pointFacets[i], refPointFacets[i]));
+    }
+    EXPECT_TRUE(pointFacets[kernel.CountPoints() - 1].empty());
+    EXPECT_EQ(pointFacets.GetIndices(0, 1), refPointFacets.GetIndices(0, 1));
+    EXPECT_EQ(pointFacets.GetIndices(31, 32, 61), refPointFacets.GetIndices(31, 32, 61));
+
+    MeshCore::MeshRefPointToPoints refPointPoints(kernel);
+    const MeshCore::MeshPointPointAdjacency& pointPoints = kernel.GetPointPointAdjacency();
+    ASSERT_EQ(pointPoints.size(), kernel.CountPoints());
+    for (MeshCore::PointIndex i = 0; i < kernel.CountPoints(); i++) {
+        EXPECT_TRUE(isEqual(pointPoints[i], refPointPoints[i]));
+    }
+    EXPECT_FLOAT_EQ(pointPoints.GetAverageEdgeLength(kernel, 100),
+                    refPointPoints.GetAverageEdgeLength(100));
+
+    MeshCore::MeshRefFacetToFacets refFacetFacets(kernel);
+    const MeshCore::MeshFacetFacetAdjacency& facetFacets = kernel.GetFacetFacetAdjacency();
+    ASSERT_EQ(facetFacets.size(), kernel.CountFacets());
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        EXPECT_TRUE(isEqual(facetFacets[i], refFacetFacets[i]));
+    }
+}
+
+TEST(MeshTest, TestAdjacencyCache)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(10);
+    const MeshCore::MeshPointFacetAdjacency* table = &kernel.GetPointFacetAdjacency();
+    EXPECT_EQ(table, &kernel.GetPointFacetAdjacency());
+
+    // moving points keeps the table, a copy shares it
+    kernel.MovePoint(0, Base::Vector3f(0.0F, 0.0F, 1.0F));
+    EXPECT_EQ(table, &kernel.GetPointFacetAdjacency());
+    MeshCore::MeshKernel copy(kernel);
+    EXPECT_EQ(table, &copy.GetPointFacetAdjacency());
+
+    // removing a facet and its point rebuilds it
+    kernel.DeleteFacet(0);
+    MeshCore::MeshRefPointToFacets refPointFacets(kernel);
+    const MeshCore::MeshPointFacetAdjacency& rebuilt = kernel.GetPointFacetAdjacency();
+    ASSERT_EQ(rebuilt.size(), kernel.CountPoints());
+    for (MeshCore::PointIndex i = 0; i < kernel.CountPoints(); i++) {
+        EXPECT_EQ(rebuilt[i].size(), refPointFacets[i].size());
+    }
+    EXPECT_EQ(copy.GetPointFacetAdjacency().size(), copy.CountPoints());
+    EXPECT_EQ(copy.GetPointFacetAdjacency()[0].size(), 1);
+}
+
+TEST(MeshTest, TestAdjacencyCacheOfThreads)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(100);
+    MeshCore::MeshKernel copy(kernel);
+
+    // all threads get the same tables, whichever of them builds them
+    constexpr int numThreads = 8;
+    std::vector<const MeshCore::MeshFacetFacetAdjacency*> facetFacets(numThreads);
+    std::vector<const MeshCore::MeshPointPointAdjacency*> pointPoints(numThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; i++) {
+        threads.emplace_back([&, i]() {
+            const MeshCore::MeshKernel& mesh = (i % 2 == 0) ? kernel : copy;
+            facetFacets[i] = &mesh.GetFacetFacetAdjacency();
+            pointPoints[i] = &mesh.GetPointPointAdjacency();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < numThreads; i += 2) {
+        EXPECT_EQ(facetFacets[i], &kernel.GetFacetFacetAdjacency());
+        EXPECT_EQ(pointPoints[i], &kernel.GetPointPointAdjacency());
+        EXPECT_EQ(facetFacets[i + 1], &copy.GetFacetFacetAdjacency());
+        EXPECT_EQ(pointPoints[i + 1], &copy.GetPointPointAdjacency());
+    }
+
+    MeshCore::MeshFacetFacetAdjacency expected(kernel);
+    const MeshCore::MeshFacetFacetAdjacency& cached = kernel.GetFacetFacetAdjacency();
+    ASSERT_EQ(cached.size(), expected.size());
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        EXPECT_TRUE(
+            std::equal(cached[i].begin(), cached[i].end(), expected[i].begin(), expected[i].end()));
+    }
+}
+
+TEST(MeshTest, TestBVHRays)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(40);
+    MeshCore::MeshFacetBVH bvh(kernel);
+    MeshCore::MeshAlgorithm alg(kernel);
+
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> dirs;
+    for (int i = -2; i < 42; i += 3) {
+        for (int j = -2; j < 42; j += 3) {
+            // keep the rays off the vertices of the surface
+            points.emplace_back(float(i) * 0.1F + 0.013F, float(j) * 0.1F + 0.007F, 2.0F);
+            dirs.emplace_back(0.1F * float(i % 5), -0.1F * float(j % 3), -1.0F);
+        }
+    }
+
+    std::vector<MeshCore::MeshFacetBVH::RayHit> hits = bvh.NearestFacetsOnRays(points, dirs);
+    ASSERT_EQ(hits.size(), points.size());
+    int numHits = 0;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        Base::Vector3f res;
+        MeshCore::FacetIndex facet {};
+        bool found = alg.NearestFacetOnRay(points[i], dirs[i], res, facet);
+        EXPECT_EQ(found, hits[i].facet != MeshCore::FACET_INDEX_MAX);
+        if (found) {
+            EXPECT_LT(Base::Distance(res, hits[i].point), 1.0e-4F);
+            numHits++;
+        }
+    }
+    EXPECT_GT(numHits, 0);
+
+    // rays pointing away from the surface
+    Base::Vector3f res;
+    MeshCore::FacetIndex facet {};
+    EXPECT_FALSE(bvh.NearestFacetOnRay(Base::Vector3f(1.0F, 1.0F, 2.0F),
+                                       Base::Vector3f(0.0F, 0.0F, 1.0F),
+                                       res,
+                                       facet));
+}
+
+TEST(MeshTest, TestBVHNearestFacetsOnLines)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(30);
+    MeshCore::MeshFacetBVH bvh(kernel);
+    MeshCore::MeshAlgorithm alg(kernel);
+
+    // points above and below the surface with rays pointing away from it
+    std::vector<Base::Vector3f> points;
+    for (int i = -2; i < 32; i += 3) {
+        for (int j = -2; j < 32; j += 3) {
+            float z = (i + j) % 2 == 0 ? 2.0F : -2.0F;
+            points.emplace_back(float(i) * 0.1F + 0.01F, float(j) * 0.1F + 0.02F, z);
+        }
+    }
+    Base::Vector3f dir(0.0F, 0.0F, 1.0F);
+
+    std::vector<MeshCore::MeshFacetBVH::RayHit> rays = bvh.NearestFacetsOnRays(points, dir);
+    std::vector<MeshCore::MeshFacetBVH::RayHit> lines = bvh.NearestFacetsOnLines(points, dir);
+    ASSERT_EQ(lines.size(), points.size());
+    int numHits = 0;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        // the slow search without a grid finds the facets on both sides of the point
+        Base::Vector3f res;
+        MeshCore::FacetIndex facet {};
+        bool found = alg.NearestFacetOnRay(points[i], dir, res, facet);
+        EXPECT_EQ(found, lines[i].facet != MeshCore::FACET_INDEX_MAX);
+        if (found) {
+            EXPECT_LT(Base::Distance(res, lines[i].point), 1.0e-4F);
+            numHits++;
+        }
+        if (points[i].z > 0.0F) {
+            EXPECT_EQ(rays[i].facet, MeshCore::FACET_INDEX_MAX);
+        }
+    }
+    EXPECT_GT(numHits, 0);
+}
+
+TEST(MeshTest, TestBVHNearestFacet)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(30);
+    MeshCore::MeshFacetBVH bvh(kernel);
+    MeshCore::MeshAlgorithm alg(kernel);
+
+    for (int i = -5; i < 35; i += 4) {
+        for (int j = -5; j < 35; j += 4) {
+            Base::Vector3f pnt(float(i) * 0.1F, float(j) * 0.1F, float(i - j) * 0.05F);
+            Base::Vector3f res1;
+            Base::Vector3f res2;
+            MeshCore::FacetIndex facet {};
+            ASSERT_TRUE(alg.NearestPointFromPoint(pnt, facet, res1));
+            ASSERT_TRUE(alg.NearestPointFromPoint(pnt, bvh, facet, res2));
+            EXPECT_NEAR(Base::Distance(pnt, res1), Base::Distance(pnt, res2), 1.0e-5F);
+
+            // nothing is found below the minimum distance
+            Base::Vector3f res3;
+            float dist = Base::Distance(pnt, res1);
+            if (dist > 1.0e-3F) {
+                EXPECT_EQ(bvh.NearestFacetToPoint(pnt, res3, 0.5F * dist),
+                          MeshCore::FACET_INDEX_MAX);
+            }
+        }
+    }
+}
+
+TEST(MeshTest, TestSelfIntersections)
+{
+    // two wavy surfaces crossing each other
+    MeshCore::MeshKernel kernel = makeWavySurface(20);
+    MeshCore::MeshKernel other = makeWavySurface(20);
+    Base::Matrix4D mat;
+    mat.rotX(0.5);
+    mat.move(Base::Vector3f(0.05F, 0.05F, -0.2F));
+    other.Transform(mat);
+    kernel.Merge(other);
+
+    // brute force
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        for (MeshCore::FacetIndex j = i + 1; j < kernel.CountFacets(); j++) {
+            const auto& p1 = facets[i]._aulPoints;
+            const auto& p2 = facets[j]._aulPoints;
+            if (std::find_first_of(p1, p1 + 3, p2, p2 + 3) != p1 + 3) {
+                continue;
+            }
+            Base::Vector3f pt1, pt2;
+            if (kernel.GetFacet(i).IntersectWithFacet(kernel.GetFacet(j), pt1, pt2) == 2) {
+                pairs.emplace_back(i, j);
+            }
+        }
+    }
+    ASSERT_FALSE(pairs.empty());
+
+    MeshCore::MeshEvalSelfIntersection evalGrid(kernel);
+    MeshCore::MeshEvalSelfIntersection evalBVH(kernel, true);
+    EXPECT_FALSE(evalGrid.Evaluate());
+    EXPECT_FALSE(evalBVH.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairsGrid;
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairsBVH;
+    evalGrid.GetIntersections(pairsGrid);
+    evalBVH.GetIntersections(pairsBVH);
+    EXPECT_EQ(pairsGrid, pairs);
+    EXPECT_EQ(pairsBVH, pairs);
+
+    std::vector<std::pair<Base::Vector3f, Base::Vector3f>> lines;
+    evalGrid.GetIntersections(pairs, lines);
+    EXPECT_EQ(lines.size(), pairs.size());
+
+    MeshCore::MeshKernel surface = makeWavySurface(20);
+    MeshCore::MeshEvalSelfIntersection evalSurface(surface, true);
+    EXPECT_TRUE(evalSurface.Evaluate());
+}
+
+TEST(MeshTest, TestBVHInside)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(50);
+    MeshCore::MeshFacetBVH bvh(kernel);
+    EXPECT_EQ(bvh.GetBoundBox().MinX, kernel.GetBoundBox().MinX);
+    EXPECT_EQ(bvh.GetBoundBox().MaxY, kernel.GetBoundBox().MaxY);
+
+    Base::BoundBox3f box(1.0F, 1.0F, -1.0F, 2.0F, 2.0F, 1.0F);
+    std::vector<MeshCore::FacetIndex> elements;
+    bvh.Inside(box, elements);
+    std::set<MeshCore::FacetIndex> unique(elements.begin(), elements.end());
+    EXPECT_EQ(unique.size(), elements.size());
+
+    for (MeshCore::FacetIndex index = 0; index < kernel.CountFacets(); index++) {
+        EXPECT_EQ(unique.count(index), (kernel.GetFacet(index).GetBoundBox() && box) ? 1 : 0);
+    }
+}
+TEST(MeshTest, TestQuadricDecimation)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(60);
+    kernel.RebuildNeighbours();
+    std::size_t count = kernel.CountFacets();
+
+    MeshCore::MeshQuadricDecimation::Parameters params;
+    params.targetSize = count / 10;
+    params.lockBoundary = true;
+    MeshCore::MeshQuadricDecimation decimation(kernel);
+    std::size_t removed = decimation.Decimate(params);
+    EXPECT_EQ(removed, count - kernel.CountFacets());
+    EXPECT_LE(kernel.CountFacets(), params.targetSize + 1);
+    EXPECT_GE(kernel.CountFacets(), params.targetSize - 1);
+
+    MeshCore::MeshEvalTopology topology(kernel);
+    MeshCore::MeshEvalOrientation orientation(kernel);
+    MeshCore::MeshEvalNeighbourhood neighbourhood(kernel);
+    EXPECT_TRUE(topology.Evaluate());
+    EXPECT_TRUE(orientation.Evaluate());
+    EXPECT_TRUE(neighbourhood.Evaluate());
+
+    // all points of the border are kept
+    const float max = float(59) * 0.1F;
+    std::size_t border = std::count_if(kernel.GetPoints().begin(),
+                                       kernel.GetPoints().end(),
+                                       [max](const MeshCore::MeshPoint& pnt) {
+                                           return pnt.x == 0.0F || pnt.y == 0.0F || pnt.x == max
+                                               || pnt.y == max;
+                                       });
+    EXPECT_EQ(border, 4 * 59);
+}
+
+TEST(MeshTest, TestQuadricDecimationMaxError)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(30);
+    kernel.RebuildNeighbours();
+    std::size_t count = kernel.CountFacets();
+
+    MeshCore::MeshQuadricDecimation::Parameters params;
+    params.maxError = 0.0F;
+    MeshCore::MeshQuadricDecimation decimation(kernel);
+    EXPECT_EQ(decimation.Decimate(params), 0U);
+    EXPECT_EQ(kernel.CountFacets(), count);
+
+    // a plane is reduced to a few facets without error
+    MeshCore::MeshKernel plane = makeWavySurface(30);
+    Base::Matrix4D mat;
+    mat.scale(1.0, 1.0, 0.0);
+    plane.Transform(mat);
+    plane.RebuildNeighbours();
+    MeshCore::MeshQuadricDecimation(plane).Decimate(params);
+    EXPECT_LT(plane.CountFacets(), 100);
+    EXPECT_FLOAT_EQ(plane.GetBoundBox().LengthX(), 2.9F);
+}
+
+TEST(MeshTest, TestQuadricDecimationInSlabs)
+{
+    MeshCore::MeshKernel serial = makeWavySurface(60);
+    serial.RebuildNeighbours();
+    MeshCore::MeshKernel parallel = serial;
+    std::size_t count = serial.CountFacets();
+
+    MeshCore::MeshQuadricDecimation::Parameters params;
+    params.targetSize = count / 10;
+    params.lockBoundary = true;
+    params.threads = 1;
+    MeshCore::MeshQuadricDecimation(serial).Decimate(params);
+
+    // the mesh is small but split into slabs anyway
+    params.minParallelSize = 1000;
+    params.threads = 4;
+    std::size_t removed = MeshCore::MeshQuadricDecimation(parallel).Decimate(params);
+    EXPECT_EQ(removed, count - parallel.CountFacets());
+    EXPECT_LE(parallel.CountFacets(), params.targetSize + 1);
+    EXPECT_GE(parallel.CountFacets(), params.targetSize - 1);
+
+    MeshCore::MeshEvalTopology topology(parallel);
+    MeshCore::MeshEvalOrientation orientation(parallel);
+    MeshCore::MeshEvalNeighbourhood neighbourhood(parallel);
+    EXPECT_TRUE(topology.Evaluate());
+    EXPECT_TRUE(orientation.Evaluate());
+    EXPECT_TRUE(neighbourhood.Evaluate());
+
+    // the slab borders don't degrade the result compared to the serial decimation
+    auto countBorder = [](const MeshCore::MeshKernel& kernel) {
+        const float max = float(59) * 0.1F;
+        return std::count_if(kernel.GetPoints().begin(),
+                             kernel.GetPoints().end(),
+                             [max](const MeshCore::MeshPoint& pnt) {
+                                 return pnt.x == 0.0F || pnt.y == 0.0F || pnt.x == max
+                                     || pnt.y == max;
+                             });
+    };
+    auto maxDeviation = [](const MeshCore::MeshKernel& kernel) {
+        float dev = 0.0F;
+        for (const auto& pnt : kernel.GetPoints()) {
+            dev = std::max(dev, std::fabs(pnt.z - std::sin(pnt.x) * std::cos(pnt.y)));
+        }
+        return dev;
+    };
+    EXPECT_EQ(countBorder(parallel), countBorder(serial));
+    EXPECT_LE(std::abs(long(parallel.CountFacets()) - long(serial.CountFacets())), 2);
+    EXPECT_LE(maxDeviation(parallel), 2.0F * maxDeviation(serial) + 1e-3F);
+}
+
+TEST(MeshTest, TestCompressedStream)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(40);
+    kernel.RebuildNeighbours();
+
+    std::stringstream compressed;
+    kernel.WriteCompressed(compressed);
+    std::stringstream raw;
+    kernel.Write(raw);
+    EXPECT_LT(compressed.str().size(), raw.str().size());
+
+    MeshCore::MeshKernel restored;
+    restored.Read(compressed);
+    ASSERT_EQ(restored.CountPoints(), kernel.CountPoints());
+    ASSERT_EQ(restored.CountFacets(), kernel.CountFacets());
+    for (MeshCore::PointIndex index = 0; index < kernel.CountPoints(); index++) {
+        EXPECT_EQ(restored.GetPoint(index), kernel.GetPoint(index));
+    }
+    for (MeshCore::FacetIndex index = 0; index < kernel.CountFacets(); index++) {
+        const auto& facet = kernel.GetFacets()[index];
+        EXPECT_TRUE(std::equal(std::begin(facet._aulPoints),
+                               std::end(facet._aulPoints),
+                               std::begin(restored.GetFacets()[index]._aulPoints)));
+    }
+    EXPECT_TRUE(haveEqualNeighbours(restored.GetFacets(), kernel.GetFacets()));
+    EXPECT_EQ(restored.GetBoundBox().MaxX, kernel.GetBoundBox().MaxX);
+
+    // the old format can still be read
+    MeshCore::MeshKernel old;
+    old.Read(raw);
+    EXPECT_EQ(old.CountFacets(), kernel.CountFacets());
+
+    // a truncated stream is rejected
+    std::string data = compressed.str();
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+    EXPECT_THROW(restored.Read(truncated), Base::BadFormatError);
+}
+
+TEST(MeshTest, TestSharedArrays)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(10);
+    kernel.RebuildNeighbours();
+    const MeshCore::MeshPointArray* points = &kernel.GetPoints();
+    const MeshCore::MeshFacetArray* facets = &kernel.GetFacets();
+
+    // the original keeps its arrays when it's copied and read
+    MeshCore::MeshKernel copy(kernel);
+    EXPECT_EQ(points, &kernel.GetPoints());
+    EXPECT_EQ(facets, &kernel.GetFacets());
+
+    // transforming the original only detaches the points
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3f(1.0F, 0.0F, 0.0F));
+    kernel.Transform(mat);
+    EXPECT_NE(points, &kernel.GetPoints());
+    EXPECT_EQ(facets, &kernel.GetFacets());
+    EXPECT_FLOAT_EQ(kernel.GetPoint(0).x, 1.0F);
+
+    // the copy takes over the arrays the original doesn't use anymore
+    EXPECT_EQ(points, &copy.GetPoints());
+    EXPECT_NE(facets, &copy.GetFacets());
+    EXPECT_FLOAT_EQ(copy.GetPoint(0).x, 0.0F);
+
+    // removing facets of a copy leaves the original untouched
+    MeshCore::MeshKernel other;
+    other = kernel;
+    other.DeleteFacets({0, 1, 2});
+    EXPECT_EQ(other.CountFacets() + 3, kernel.CountFacets());
+    EXPECT_TRUE(MeshCore::MeshEvalNeighbourhood(kernel).Evaluate());
+
+    // clearing a copy keeps the data of the original
+    copy = kernel;
+    copy.Clear();
+    EXPECT_EQ(copy.CountFacets(), 0);
+    EXPECT_EQ(kernel.CountFacets(), 162);
+}
+
+TEST(MeshTest, TestSharedArraysOfThreads)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(100);
+    MeshCore::MeshKernel copy(kernel);
+
+    // the threads access the copy for the first time at once
+    constexpr int numThreads = 8;
+    std::vector<const MeshCore::MeshPointArray*> points(numThreads);
+    std::vector<const MeshCore::MeshFacetArray*> facets(numThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; i++) {
+        threads.emplace_back([&, i]() {
+            points[i] = &copy.GetPoints();
+            facets[i] = &copy.GetFacets();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < numThreads; i++) {
+        EXPECT_EQ(points[i], &copy.GetPoints());
+        EXPECT_EQ(facets[i], &copy.GetFacets());
+    }
+    EXPECT_NE(&kernel.GetPoints(), &copy.GetPoints());
+    EXPECT_NE(&kernel.GetFacets(), &copy.GetFacets());
+    EXPECT_EQ(copy.GetPoints(), kernel.GetPoints());
+    EXPECT_EQ(copy.CountFacets(), kernel.CountFacets());
+}
+
+TEST(MeshTest, TestSharedArrayFlags)
+{
+    MeshCore::MeshKernel kernel = makeWavySurface(10);
+    kernel.RebuildNeighbours();
+
+    // setting flags of a copy leaves the original untouched
+    MeshCore::MeshKernel copy(kernel);
+    MeshCore::MeshAlgorithm(copy).SetFacetsFlag({0, 1}, MeshCore::MeshFacet::SELECTED);
+    MeshCore::MeshAlgorithm(copy).SetPointFlag(MeshCore::MeshPoint::TMP0);
+    EXPECT_EQ(MeshCore::MeshAlgorithm(copy).CountFacetFlag(MeshCore::MeshFacet::SELECTED), 2);
+    EXPECT_EQ(MeshCore::MeshAlgorithm(kernel).CountFacetFlag(MeshCore::MeshFacet::SELECTED), 0);
+    EXPECT_EQ(MeshCore::MeshAlgorithm(kernel).CountPointFlag(MeshCore::MeshPoint::TMP0), 0);
+
+    // visiting the facets of a copy keeps the VISIT flags of the original
+    copy = kernel;
+    std::vector<MeshCore::FacetIndex> visited;
+    MeshCore::MeshTopFacetVisitor visitor(visited);
+    EXPECT_EQ(copy.VisitNeighbourFacets(visitor, 0), 161);
+    EXPECT_EQ(MeshCore::MeshAlgorithm(kernel).CountFacetFlag(MeshCore::MeshFacet::VISIT), 0);
+
+    // a copy takes over the flags the original has at its first access
+    copy = kernel;
+    MeshCore::MeshAlgorithm(kernel).SetFacetsFlag({5}, MeshCore::MeshFacet::MARKED);
+    EXPECT_EQ(MeshCore::MeshAlgorithm(copy).CountFacetFlag(MeshCore::MeshFacet::MARKED), 1);
+    MeshCore::MeshAlgorithm(kernel).ResetFacetFlag(MeshCore::MeshFacet::MARKED);
+    EXPECT_EQ(MeshCore::MeshAlgorithm(copy).CountFacetFlag(MeshCore::MeshFacet::MARKED), 1);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
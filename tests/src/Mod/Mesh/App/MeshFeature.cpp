@@ -1,6 +1,13 @@
 #include "gtest/gtest.h"
 #include <src/App/InitApplication.h>
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
 #include <Mod/Mesh/App/MeshFeature.h>
+#include <zipios++/zipios-config.h>
+#include <zipios++/zipfile.h>
+#include <zipios++/zipoutputstream.h>
 
 class MeshFeatureTest: public ::testing::Test
 {
@@ -37,4 +44,192 @@ TEST_F(MeshFeatureTest, getComplexElementTypes)
     EXPECT_STREQ(types[0], "Mesh");
     EXPECT_STREQ(types[1], "Segment");
 }
+
+TEST_F(MeshFeatureTest, selectionOfCopy)
+{
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(1, 1, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    Mesh::MeshObject mesh(kernel);
+    Mesh::MeshObject copy(mesh);
+
+    copy.addFacetsToSelection({1});
+    copy.addPointsToSelection({0, 2});
+    EXPECT_EQ(copy.countSelectedFacets(), 1);
+    EXPECT_EQ(copy.countSelectedPoints(), 2);
+    EXPECT_EQ(mesh.countSelectedFacets(), 0);
+    EXPECT_EQ(mesh.countSelectedPoints(), 0);
+
+    // clearing the selection of a copy keeps the one of the original
+    mesh.addFacetsToSelection({0});
+    Mesh::MeshObject other(mesh);
+    other.clearFacetSelection();
+    EXPECT_EQ(other.countSelectedFacets(), 0);
+    EXPECT_EQ(mesh.countSelectedFacets(), 1);
+}
+
+class MeshDeferredRestoreTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        fileName = Base::FileInfo::getTempFileName() + ".FCStd";
+
+        // save a document with a mesh and re-open it with deferred restore
+        std::string name = App::GetApplication().getUniqueDocumentName("test");
+        auto doc = App::GetApplication().newDocument(name.c_str(), "testUser");
+        auto feature = static_cast<Mesh::Feature*>(doc->addObject("Mesh::Feature", "Mesh"));
+        MeshCore::MeshKernel kernel;
+        kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                                Base::Vector3f(1, 0, 0),
+                                                Base::Vector3f(0, 1, 0)));
+        kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(1, 0, 0),
+                                                Base::Vector3f(1, 1, 0),
+                                                Base::Vector3f(0, 1, 0)));
+        feature->Mesh.setValue(kernel);
+        doc->saveAs(fileName.c_str());
+        App::GetApplication().closeDocument(doc->getName());
+
+        getParameter()->SetBool("DeferredRestore", true);
+        document = App::GetApplication().openDocument(fileName.c_str());
+    }
+
+    void TearDown() override
+    {
+        getParameter()->RemoveBool("DeferredRestore");
+        if (document) {
+            App::GetApplication().closeDocument(document->getName());
+        }
+        Base::FileInfo(fileName).deleteFile();
+    }
+
+    static ParameterGrp::handle getParameter()
+    {
+        return App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document");
+    }
+
+    App::Document* getDocument() const
+    {
+        return document;
+    }
+
+    Mesh::Feature* getFeature() const
+    {
+        return dynamic_cast<Mesh::Feature*>(document->getObject("Mesh"));
+    }
+
+    App::Document* reopen(bool deferred)
+    {
+        App::GetApplication().closeDocument(document->getName());
+        getParameter()->SetBool("DeferredRestore", deferred);
+        document = App::GetApplication().openDocument(fileName.c_str());
+        return document;
+    }
+
+private:
+    std::string fileName;
+    App::Document* document {};
+};
+
+TEST_F(MeshDeferredRestoreTest, readOnFirstAccess)
+{
+    ASSERT_TRUE(getDocument());
+    auto feature = getFeature();
+    ASSERT_TRUE(feature);
+
+    EXPECT_TRUE(feature->Mesh.isRestoreDeferred());
+    EXPECT_EQ(feature->Mesh.getValue().countFacets(), 2);
+    EXPECT_FALSE(feature->Mesh.isRestoreDeferred());
+}
+
+TEST_F(MeshDeferredRestoreTest, saveReadsPendingFiles)
+{
+    ASSERT_TRUE(getDocument());
+    auto feature = getFeature();
+    ASSERT_TRUE(feature);
+    ASSERT_TRUE(feature->Mesh.isRestoreDeferred());
+
+    // the project file is overwritten with the data read from it
+    EXPECT_TRUE(getDocument()->save());
+    EXPECT_FALSE(feature->Mesh.isRestoreDeferred());
+    EXPECT_EQ(feature->Mesh.getValue().countFacets(), 2);
+
+    ASSERT_TRUE(reopen(false));
+    feature = getFeature();
+    ASSERT_TRUE(feature);
+    EXPECT_EQ(feature->Mesh.getValue().countFacets(), 2);
+}
+
+TEST_F(MeshDeferredRestoreTest, undoRemoveObject)
+{
+    App::Document* doc = getDocument();
+    ASSERT_TRUE(doc);
+    ASSERT_TRUE(getFeature());
+    ASSERT_TRUE(getFeature()->Mesh.isRestoreDeferred());
+
+    doc->setUndoMode(1);
+    doc->openTransaction("Remove");
+    doc->removeObject("Mesh");
+    doc->commitTransaction();
+    EXPECT_FALSE(getFeature());
+
+    // the project file no longer contains the mesh when it's restored by undo
+    EXPECT_TRUE(doc->save());
+    EXPECT_TRUE(doc->undo());
+
+    auto feature = getFeature();
+    ASSERT_TRUE(feature);
+    EXPECT_FALSE(feature->Mesh.isRestoreDeferred());
+    EXPECT_EQ(feature->Mesh.getValue().countFacets(), 2);
+}
+
+TEST_F(MeshDeferredRestoreTest, readFailureKeepsDeferred)
+{
+    auto feature = getFeature();
+    ASSERT_TRUE(feature);
+
+    // a mesh file with a facet that refers to points which don't exist
+    std::string corrupt = Base::FileInfo::getTempFileName() + ".zip";
+    {
+        Base::FileInfo fi(corrupt);
+        Base::ofstream file(fi, std::ios::out | std::ios::binary);
+        zipios::ZipOutputStream zip(file);
+        zip.putNextEntry("MeshKernel.bms");
+        Base::OutputStream str(zip);
+        str << uint32_t(0xA0B0C0D0) << uint32_t(0x010000);
+        std::string info(256, '\0');
+        zip.write(info.c_str(), info.size());
+        str << uint32_t(1) << uint32_t(1) << 0.0F << 0.0F << 0.0F;
+        str << uint32_t(5) << uint32_t(5) << uint32_t(5);
+    }
+    feature->Mesh.deferRestoreDocFile(std::make_shared<zipios::ZipFile>(corrupt),
+                                      "MeshKernel.bms",
+                                      0);
+
+    // the data isn't taken as restored
+    EXPECT_ANY_THROW(feature->Mesh.getValue());
+    EXPECT_TRUE(feature->Mesh.isRestoreDeferred());
+    EXPECT_ANY_THROW(feature->Mesh.getValue());
+
+    // a new value replaces the data that cannot be read
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    feature->Mesh.setValue(kernel);
+    EXPECT_FALSE(feature->Mesh.isRestoreDeferred());
+    EXPECT_EQ(feature->Mesh.getValue().countFacets(), 1);
+
+    Base::FileInfo(corrupt).deleteFile();
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
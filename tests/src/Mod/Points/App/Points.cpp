@@ -1,7 +1,18 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Mod/Points/App/LineParser.h>
 #include <Mod/Points/App/Points.h>
 #include <Mod/Points/App/PointsAlgos.h>
+#include <Mod/Points/App/PointsEstimation.h>
+#include <Mod/Points/App/PointsFilter.h>
+#include <Mod/Points/App/PointsKDTree.h>
+#include <Mod/Points/App/PointsOctree.h>
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
 
@@ -138,6 +149,41 @@ TEST_F(PointsTest, TestASCII)
     EXPECT_EQ(reader.getHeight(), 1);
 }
 
+TEST_F(PointsTest, TestASCIILines)
+{
+    std::string name = getFileName() + ".asc";
+    {
+        Base::FileInfo fi(name);
+        Base::ofstream str(fi, std::ios::out | std::ios::binary);
+        str << "# comment\n"
+               " 1 2 3\r\n"
+               "-.5\t+2.5e1 3.\n"
+               "4 5 6 7\n"
+               "\n"
+               "1 2\n"
+               "7 8 9";
+    }
+
+    Points::PointKernel kernel;
+    kernel.load(name.c_str());
+    ASSERT_EQ(kernel.size(), 2);
+    EXPECT_EQ(kernel.getPoint(0), Base::Vector3d(1, 2, 3));
+    EXPECT_EQ(kernel.getPoint(1), Base::Vector3d(7, 8, 9));
+
+    std::vector<std::size_t> sizes;
+    Points::AscReader reader;
+    reader.setChunkHandler(
+        [&sizes](const Points::Reader& chunk) {
+            sizes.push_back(chunk.getPoints().size());
+        },
+        1);
+    reader.read(name);
+    EXPECT_EQ(sizes, std::vector<std::size_t>({1, 1}));
+    EXPECT_EQ(reader.getWidth(), 2);
+
+    Base::FileInfo(name).deleteFile();
+}
+
 TEST_F(PointsTest, TestPlainPLY)
 {
     std::string name = getFileName();
@@ -238,4 +284,355 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestPLYChunks)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setNormals(getNormals());
+    writer.write(name);
+
+    std::vector<std::size_t> sizes;
+    Points::PlyReader reader;
+    reader.setChunkHandler(
+        [&sizes](const Points::Reader& chunk) {
+            EXPECT_EQ(chunk.getNormals().size(), chunk.getPoints().size());
+            sizes.push_back(chunk.getPoints().size());
+        },
+        3);
+    reader.read(name);
+
+    EXPECT_EQ(sizes, std::vector<std::size_t>({3, 3, 2}));
+    EXPECT_EQ(reader.getPoints().size(), 0);
+    EXPECT_FALSE(reader.hasNormals());
+}
+
+TEST_F(PointsTest, TestPCDChunks)
+{
+    std::string name = getFileName();
+    Points::PcdWriter writer(getKernel());
+    writer.setColors(getColors());
+    writer.write(name);
+
+    std::vector<Base::Vector3d> points;
+    Points::PcdReader reader;
+    reader.setChunkHandler(
+        [&points](const Points::Reader& chunk) {
+            EXPECT_EQ(chunk.getColors().size(), chunk.getPoints().size());
+            points.insert(points.end(), chunk.getPoints().begin(), chunk.getPoints().end());
+        },
+        5);
+    reader.read(name);
+
+    ASSERT_EQ(points.size(), 8);
+    EXPECT_EQ(points.back(), Base::Vector3d(1, 1, 1));
+}
+
+TEST_F(PointsTest, TestOctree)
+{
+    std::string name = getFileName();
+    Points::PointChunk chunk;
+    chunk.points = getKernel().getBasicPoints();
+    chunk.intensity = getIntensity();
+
+    Points::OctreeBuilder builder(name, 2);
+    builder.add(chunk);
+    builder.add(chunk);
+    builder.finish();
+    EXPECT_EQ(builder.countPoints(), 16);
+
+    Points::OctreeFile octree;
+    octree.open(name);
+    EXPECT_EQ(octree.countPoints(), 16);
+    EXPECT_TRUE(octree.hasIntensity());
+    EXPECT_FALSE(octree.hasNormals());
+    EXPECT_FALSE(octree.hasColors());
+    EXPECT_GT(octree.getNodes().size(), 1);
+    EXPECT_LE(octree.getNodes().front().count, 2);
+
+    std::size_t numPoints = 0;
+    octree.forEachChunk([&numPoints](const Points::PointChunk& chunk) {
+        EXPECT_EQ(chunk.intensity.size(), chunk.size());
+        numPoints += chunk.size();
+    });
+    EXPECT_EQ(numPoints, 16);
+
+    // the root node is always selected first
+    std::vector<std::size_t> nodes = octree.selectNodes(2, [](const Points::OctreeNode&) {
+        return 1.0F;
+    });
+    ASSERT_EQ(nodes.size(), 1);
+    EXPECT_EQ(nodes.front(), 0);
+    EXPECT_EQ(octree.loadNode(0)->size(), octree.getNodes().front().count);
+
+    nodes = octree.selectNodes(100, [](const Points::OctreeNode&) {
+        return 1.0F;
+    });
+    EXPECT_EQ(nodes.size(), octree.getNodes().size());
+}
+
+TEST_F(PointsTest, TestOctreeCorrupt)
+{
+    std::string name = getFileName();
+    Points::PointChunk chunk;
+    chunk.points = getKernel().getBasicPoints();
+    Points::OctreeBuilder builder(name, 2);
+    builder.add(chunk);
+    builder.finish();
+
+    // the offset of the node table follows magic, version, attributes, nodes and points
+    std::fstream str(name, std::ios::in | std::ios::out | std::ios::binary);
+    std::uint64_t tableOffset {};
+    str.seekg(24);
+    str.read(reinterpret_cast<char*>(&tableOffset), sizeof(tableOffset));
+
+    // a point count of the root node beyond the end of the file
+    std::uint32_t count = 0x40000000;
+    str.seekp(static_cast<std::streamoff>(tableOffset + 32));
+    str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    str.flush();
+
+    Points::OctreeFile octree;
+    EXPECT_THROW(octree.open(name), Base::BadFormatError);
+    EXPECT_FALSE(octree.isOpen());
+
+    // a number of nodes that doesn't fit into the file
+    std::uint32_t numNodes = 0xffffffff;
+    str.seekp(12);
+    str.write(reinterpret_cast<const char*>(&numNodes), sizeof(numNodes));
+    str.close();
+    EXPECT_THROW(octree.open(name), Base::BadFormatError);
+    EXPECT_FALSE(octree.isOpen());
+}
+
+TEST_F(PointsTest, TestTokenizer)
+{
+    double value {};
+    EXPECT_TRUE(Points::LineTokenizer::parseReal("1.", value));
+    EXPECT_DOUBLE_EQ(value, 1.0);
+    EXPECT_TRUE(Points::LineTokenizer::parseReal("-inf", value));
+    EXPECT_TRUE(std::isinf(value));
+    EXPECT_TRUE(Points::LineTokenizer::parseReal("1e-400", value));
+    EXPECT_EQ(value, 0.0);
+    EXPECT_FALSE(Points::LineTokenizer::parseReal("1e400", value));
+    EXPECT_FALSE(Points::LineTokenizer::parseReal("0x10", value));
+    EXPECT_FALSE(Points::LineTokenizer::parseReal("", value));
+
+    std::vector<std::string_view> tokens;
+    Points::LineTokenizer::split("  1\t 2\r3 \r", tokens);
+    EXPECT_EQ(tokens, std::vector<std::string_view>({"1", "2", "3"}));
+    Points::LineTokenizer::split(" \r", tokens);
+    EXPECT_EQ(tokens, std::vector<std::string_view>({""}));
+}
+
+TEST_F(PointsTest, TestAsciiTable)
+{
+    std::istringstream str("skip\n\n1 2 3 4\r\n5 6\n7 8 9\n");
+    Points::AsciiTableReader table(str);
+    table.skipLines(1);
+
+    Eigen::MatrixXd data = Eigen::MatrixXd::Zero(2, 3);
+    EXPECT_EQ(table.read(data), 2);
+    EXPECT_EQ(data(0, 2), 3.0);
+    EXPECT_EQ(data(1, 1), 6.0);
+    EXPECT_EQ(data(1, 2), 0.0);
+
+    data.setZero();
+    EXPECT_EQ(table.read(data), 1);
+    EXPECT_EQ(data(0, 0), 7.0);
+    EXPECT_EQ(table.countRows(), 3);
+
+    std::istringstream bad("1 x 3\n");
+    Points::AsciiTableReader badTable(bad);
+    EXPECT_THROW(badTable.read(data), Base::BadFormatError);
+}
+TEST_F(PointsTest, TestKDTree)
+{
+    Points::KDTree tree(getKernel());
+    EXPECT_EQ(tree.size(), 8);
+    EXPECT_EQ(tree.getPoint(5), Base::Vector3f(1, 0, 1));
+
+    std::vector<unsigned long> indices;
+    std::vector<float> distances;
+    tree.findNearest(Base::Vector3f(0.9F, 0.1F, 0.1F), 2, indices, distances);
+    ASSERT_EQ(indices.size(), 2);
+    EXPECT_EQ(indices[0], 4);
+    EXPECT_NEAR(distances[0], 0.03F, 1e-6F);
+
+    tree.findInRadius(Base::Vector3f(0, 0, 0), 1.0F, indices, distances);
+    EXPECT_EQ(indices.size(), 4);
+    EXPECT_EQ(indices[0], 0);
+
+    std::vector<Base::Vector3f> pts {Base::Vector3f(1, 1, 1.2F), Base::Vector3f(5, 5, 5)};
+    Points::Neighbours nn = tree.findNearest(pts, 20);
+    ASSERT_EQ(nn.size(), 2);
+    EXPECT_EQ(nn.count(0), 8);
+    EXPECT_EQ(nn.indices[nn.offsets[0]], 7);
+    EXPECT_EQ(nn.indices[nn.offsets[1]], 7);
+
+    Points::Neighbours rr = tree.findInRadius(pts, 0.5F);
+    EXPECT_EQ(rr.count(0), 1);
+    EXPECT_EQ(rr.count(1), 0);
+}
+
+TEST_F(PointsTest, TestNormalEstimation)
+{
+    // points on a sphere with radius 2
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i <= 20; i++) {
+        float theta = 0.1F + 0.14F * float(i);
+        for (int j = 0; j < 40; j++) {
+            float phi = 0.157F * float(j);
+            points.emplace_back(2.0F * std::sin(theta) * std::cos(phi),
+                                2.0F * std::sin(theta) * std::sin(phi),
+                                2.0F * std::cos(theta));
+        }
+    }
+
+    Points::KDTree tree(points);
+    Points::NormalEstimation estimation(tree);
+    estimation.setKSearch(20);
+    std::vector<Base::Vector3f> normals;
+    std::vector<Points::CurvatureInfo> curvatures;
+    estimation.perform(normals, curvatures);
+    ASSERT_EQ(normals.size(), points.size());
+    ASSERT_EQ(curvatures.size(), points.size());
+
+    // the normals point to the view point at the origin
+    std::size_t index = 10 * 40;
+    Base::Vector3f dir = points[index] * -0.5F;
+    EXPECT_NEAR(normals[index].x, dir.x, 0.01F);
+    EXPECT_NEAR(normals[index].y, dir.y, 0.01F);
+    EXPECT_NEAR(normals[index].z, dir.z, 0.01F);
+    EXPECT_NEAR(curvatures[index].fMaxCurvature, 0.5F, 0.05F);
+    EXPECT_NEAR(curvatures[index].fMinCurvature, 0.5F, 0.05F);
+
+    estimation.setSearchRadius(0.5F);
+    estimation.setViewPoint(Base::Vector3f(0, 0, 10));
+    estimation.perform(normals);
+    EXPECT_GT(normals[0].z, 0.9F);
+}
+
+TEST_F(PointsTest, TestStatisticalOutlierFilter)
+{
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            points.emplace_back(float(i), float(j), 0.0F);
+        }
+    }
+    points.emplace_back(10.0F, 10.0F, 8.0F);
+
+    Points::KDTree tree(points);
+    Points::StatisticalOutlierFilter filter(tree);
+    filter.setKSearch(4);
+    filter.setStdDevMul(2.0);
+    std::vector<unsigned long> outliers = filter.perform();
+    ASSERT_EQ(outliers.size(), 1);
+    EXPECT_EQ(outliers[0], 400);
+}
+TEST_F(PointsTest, TestRadiusOutlierFilter)
+{
+    std::vector<Base::Vector3f> points = getKernel().getBasicPoints();
+    points.emplace_back(5.0F, 5.0F, 5.0F);
+
+    Points::KDTree tree(points);
+    Points::RadiusOutlierFilter filter(tree);
+    filter.setRadius(1.0F);
+    filter.setMinNeighbours(3);
+    std::vector<unsigned long> outliers = filter.perform();
+    ASSERT_EQ(outliers.size(), 1);
+    EXPECT_EQ(outliers[0], 8);
+
+    filter.setMinNeighbours(4);
+    EXPECT_EQ(filter.perform().size(), 9);
+}
+
+TEST_F(PointsTest, TestVoxelGridFilter)
+{
+    std::vector<Base::Vector3f> points = getKernel().getBasicPoints();
+    points.emplace_back(0.1F, 0.1F, 0.1F);
+    points.emplace_back(0.2F, 0.2F, 0.2F);
+    points.emplace_back(0.3F, 0.3F, 0.3F);
+
+    // all points are in one cell, the one next to the centroid is kept
+    Points::VoxelGridFilter filter(points);
+    filter.setLeafSize(2.0F);
+    std::vector<unsigned long> indices = filter.perform();
+    ASSERT_EQ(indices.size(), 1);
+    EXPECT_EQ(indices[0], 10);
+
+    // the extra points share the cell of the origin
+    filter.setLeafSize(0.6F);
+    EXPECT_EQ(filter.perform().size(), 8);
+
+    filter.setLeafSize(0.0F);
+    EXPECT_THROW(filter.perform(), Base::ValueError);
+}
+
+TEST_F(PointsTest, TestPoissonDiskFilter)
+{
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 50; i++) {
+        for (int j = 0; j < 50; j++) {
+            points.emplace_back(0.1F * float(i), 0.1F * float(j), 0.0F);
+        }
+    }
+
+    Points::PoissonDiskFilter filter(points);
+    filter.setRadius(0.5F);
+    std::vector<unsigned long> indices = filter.perform();
+    EXPECT_GT(indices.size(), 25);
+    EXPECT_LT(indices.size(), 200);
+    EXPECT_EQ(filter.perform(), indices);
+
+    // the kept points keep their distance and cover all points
+    Points::KDTree tree(points);
+    std::vector<Base::Vector3f> kept;
+    for (unsigned long index : indices) {
+        kept.push_back(points[index]);
+    }
+    Points::Neighbours inRadius = tree.findInRadius(kept, 0.49F);
+    Points::KDTree keptTree(kept);
+    Points::Neighbours nearest = keptTree.findNearest(points, 1);
+    for (unsigned long index : indices) {
+        EXPECT_EQ(std::count(inRadius.indices.begin(), inRadius.indices.end(), index), 1);
+    }
+    for (float dist : nearest.sqrDistances) {
+        EXPECT_LT(dist, 0.25F);
+    }
+}
+
+TEST_F(PointsTest, TestDuplicateFilter)
+{
+    std::vector<Base::Vector3f> points = getKernel().getBasicPoints();
+    points.push_back(points[3]);
+    points.push_back(points[0]);
+    points.emplace_back(1.0F, 1.0F, 1.001F);
+
+    Points::DuplicateFilter filter(points);
+    std::vector<unsigned long> indices = filter.perform();
+    EXPECT_EQ(indices.size(), 9);
+    EXPECT_EQ(indices.back(), 10);
+
+    filter.setTolerance(0.01F);
+    indices = filter.perform();
+    ASSERT_EQ(indices.size(), 8);
+    EXPECT_EQ(indices.back(), 7);
+}
+
+TEST_F(PointsTest, TestCropFilter)
+{
+    const std::vector<Base::Vector3f>& points = getKernel().getBasicPoints();
+    Points::CropFilter filter(points);
+
+    std::vector<unsigned long> inside = filter.perform(Base::BoundBox3f(-1, -1, -1, 0.5, 2, 2));
+    EXPECT_EQ(inside, std::vector<unsigned long>({0, 1, 2, 3}));
+    inside = filter.perform(Base::Vector3f(0, 0, 0.5F), Base::Vector3f(0, 0, 1));
+    EXPECT_EQ(inside, std::vector<unsigned long>({1, 3, 5, 7}));
+
+    filter.setNegative(true);
+    inside = filter.perform(Base::BoundBox3f(-1, -1, -1, 0.5, 2, 2));
+    EXPECT_EQ(inside, std::vector<unsigned long>({4, 5, 6, 7}));
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
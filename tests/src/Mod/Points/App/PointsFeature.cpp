@@ -1,6 +1,11 @@
 #include "gtest/gtest.h"
+#include <App/Document.h>
 #include <src/App/InitApplication.h>
+#include <Mod/Points/App/FilterFeature.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/Properties.h>
+#include <Mod/Points/App/Structured.h>
+#include <cmath>
 
 class PointsFeatureTest: public ::testing::Test
 {
@@ -33,4 +38,90 @@ TEST_F(PointsFeatureTest, getComplexElementTypes)
 
     EXPECT_EQ(types.size(), 0);
 }
+
+TEST_F(PointsFeatureTest, removeIndices)
+{
+    Points::Feature pf;
+    Points::PointKernel pk;
+    pk.push_back(Base::Vector3d(0, 0, 0));
+    pk.push_back(Base::Vector3d(1, 0, 0));
+    pk.push_back(Base::Vector3d(2, 0, 0));
+    pk.push_back(Base::Vector3d(3, 0, 0));
+    pf.Points.setValue(pk);
+
+    auto grey = dynamic_cast<Points::PropertyGreyValueList*>(
+        pf.addDynamicProperty("Points::PropertyGreyValueList", "Intensity"));
+    ASSERT_TRUE(grey);
+    grey->setValues({0.0F, 0.1F, 0.2F, 0.3F});
+
+    pf.removeIndices({3, 1, 1, 7});
+    EXPECT_EQ(pf.Points.getValue().size(), 2);
+    EXPECT_EQ(pf.Points.getValue().getPoint(1), Base::Vector3d(2, 0, 0));
+    ASSERT_EQ(grey->getSize(), 2);
+    EXPECT_FLOAT_EQ(grey->getValues()[1], 0.2F);
+}
+
+TEST_F(PointsFeatureTest, removeIndicesOfStructured)
+{
+    Points::Structured ps;
+    Points::PointKernel pk;
+    pk.push_back(Base::Vector3d(0, 0, 0));
+    pk.push_back(Base::Vector3d(1, 0, 0));
+    pk.push_back(Base::Vector3d(0, 1, 0));
+    pk.push_back(Base::Vector3d(1, 1, 0));
+    ps.Points.setValue(pk);
+    ps.Width.setValue(2);
+    ps.Height.setValue(2);
+
+    // the grid is kept and the removed points are marked invalid
+    Points::Feature& pf = ps;
+    pf.removeIndices({1});
+    const Points::PointKernel& points = ps.Points.getValue();
+    ASSERT_EQ(points.size(), 4);
+    EXPECT_EQ(points.countValid(), 3);
+    EXPECT_TRUE(std::isnan(points.getBasicPoints()[1].x));
+    EXPECT_EQ(points.getPoint(2), Base::Vector3d(0, 1, 0));
+}
+
+TEST_F(PointsFeatureTest, filter)
+{
+    App::Document* doc = App::GetApplication().newDocument("PointsFilter");
+
+    Points::PointKernel pk;
+    for (int i = 0; i < 10; i++) {
+        pk.push_back(Base::Vector3d(0.1 * i, 0, 0));
+    }
+    auto source = doc->addObject<Points::Feature>("Source");
+    source->Points.setValue(pk);
+    auto grey = dynamic_cast<Points::PropertyGreyValueList*>(
+        source->addDynamicProperty("Points::PropertyGreyValueList", "Intensity"));
+    ASSERT_TRUE(grey);
+    grey->setValues({0.0F, 0.1F, 0.2F, 0.3F, 0.4F, 0.5F, 0.6F, 0.7F, 0.8F, 0.9F});
+
+    auto crop = doc->addObject<Points::CropBox>("Crop");
+    crop->Source.setValue(source);
+    crop->Minimum.setValue(Base::Vector3d(0.25, -1, -1));
+    crop->Maximum.setValue(Base::Vector3d(0.65, 1, 1));
+    doc->recompute();
+
+    EXPECT_EQ(crop->Points.getValue().size(), 4);
+    auto intensity =
+        dynamic_cast<Points::PropertyGreyValueList*>(crop->getPropertyByName("Intensity"));
+    ASSERT_TRUE(intensity);
+    EXPECT_EQ(intensity->getValues(), std::vector<float>({0.3F, 0.4F, 0.5F, 0.6F}));
+
+    // filters can be chained
+    auto voxel = doc->addObject<Points::VoxelGrid>("Voxel");
+    voxel->Source.setValue(crop);
+    voxel->LeafSize.setValue(0.25);
+    doc->recompute();
+    EXPECT_EQ(voxel->Points.getValue().size(), 2);
+
+    crop->Invert.setValue(true);
+    doc->recompute();
+    EXPECT_EQ(crop->Points.getValue().size(), 6);
+    EXPECT_EQ(voxel->Points.getValue().size(), 3);
+
+    App::GetApplication().closeDocument(doc->getName());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
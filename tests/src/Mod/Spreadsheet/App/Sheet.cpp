@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <string>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
+#include <App/PropertyUnits.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+class SheetTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = _doc->addObject<Spreadsheet::Sheet>("Sheet");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    Spreadsheet::Sheet* sheet()
+    {
+        return _sheet;
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    double value(const char* address)
+    {
+        auto prop = sheet()->getPropertyByName(address);
+        if (auto quantity = dynamic_cast<App::PropertyQuantity*>(prop)) {
+            return quantity->getValue();
+        }
+        if (auto number = dynamic_cast<App::PropertyFloat*>(prop)) {
+            return number->getValue();
+        }
+        if (auto integer = dynamic_cast<App::PropertyInteger*>(prop)) {
+            return static_cast<double>(integer->getValue());
+        }
+        ADD_FAILURE() << address << " has no numeric value";
+        return 0.0;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetTest, recomputeChain)  // NOLINT
+{
+    sheet()->setCell("A1", "2");
+    sheet()->setCell("B1", "=A1 + 1");
+    sheet()->setCell("C1", "=B1 * A1");
+    sheet()->setCell("D1", "=C1 - B1");
+    doc()->recompute();
+
+    EXPECT_DOUBLE_EQ(value("B1"), 3.0);
+    EXPECT_DOUBLE_EQ(value("C1"), 6.0);
+    EXPECT_DOUBLE_EQ(value("D1"), 3.0);
+
+    // only the cells depending on A1 are recomputed, in dependency order
+    sheet()->setCell("A1", "5");
+    doc()->recompute();
+
+    EXPECT_DOUBLE_EQ(value("B1"), 6.0);
+    EXPECT_DOUBLE_EQ(value("C1"), 30.0);
+    EXPECT_DOUBLE_EQ(value("D1"), 24.0);
+}
+
+TEST_F(SheetTest, recomputeAlias)  // NOLINT
+{
+    sheet()->setCell("A1", "=4 mm");
+    sheet()->setAlias(App::CellAddress("A1"), "width");
+    sheet()->setCell("B1", "=width * 2");
+    doc()->recompute();
+    EXPECT_DOUBLE_EQ(value("B1"), 8.0);
+
+    sheet()->setCell("A1", "=5 mm");
+    doc()->recompute();
+    EXPECT_DOUBLE_EQ(value("B1"), 10.0);
+
+    // the dependency is gone once the expression changes
+    sheet()->setCell("B1", "=3");
+    sheet()->setCell("A1", "=6 mm");
+    doc()->recompute();
+    EXPECT_DOUBLE_EQ(value("B1"), 3.0);
+}
+
+TEST_F(SheetTest, recomputeManyIndependentCells)  // NOLINT
+{
+    // enough cells in one level to be evaluated concurrently
+    const int count = 500;
+    sheet()->setCell("A1", "3");
+    for (int row = 1; row <= count; ++row) {
+        std::string expr = "=A1 * " + std::to_string(row);
+        sheet()->setCell(("B" + std::to_string(row)).c_str(), expr.c_str());
+        sheet()->setCell(("C" + std::to_string(row)).c_str(),
+                         ("=B" + std::to_string(row) + " + 0.5").c_str());
+    }
+    doc()->recompute();
+
+    for (int row = 1; row <= count; ++row) {
+        EXPECT_DOUBLE_EQ(value(("B" + std::to_string(row)).c_str()), 3.0 * row);
+        EXPECT_DOUBLE_EQ(value(("C" + std::to_string(row)).c_str()), 3.0 * row + 0.5);
+    }
+
+    sheet()->setCell("A1", "7");
+    doc()->recompute();
+
+    for (int row = 1; row <= count; ++row) {
+        EXPECT_DOUBLE_EQ(value(("C" + std::to_string(row)).c_str()), 7.0 * row + 0.5);
+    }
+}
+
+TEST_F(SheetTest, recomputeCycle)  // NOLINT
+{
+    sheet()->setCell("A1", "1");
+    sheet()->setCell("B1", "=C1 + A1");
+    sheet()->setCell("C1", "=B1 + 1");
+    doc()->recompute();
+
+    EXPECT_TRUE(sheet()->getCell(App::CellAddress("B1"))->hasException());
+    EXPECT_TRUE(sheet()->getCell(App::CellAddress("C1"))->hasException());
+
+    // breaking the cycle recovers both cells
+    sheet()->setCell("C1", "=A1 + 1");
+    doc()->recompute();
+
+    EXPECT_FALSE(sheet()->getCell(App::CellAddress("B1"))->hasException());
+    EXPECT_DOUBLE_EQ(value("C1"), 2.0);
+    EXPECT_DOUBLE_EQ(value("B1"), 3.0);
+}